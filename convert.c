@@ -24,35 +24,18 @@ struct converter_state {
     float dc_b;
     float z1_I;
     float z1_Q;
+
+    // DC filter coefficients for a vector of samples at a time, see convert_vec_common
+    // (sized for up to 8 lanes)
+    float dc_columns[8][8];
+    float dc_decay[8];
 };
 
-static uint16_t *uc8_lookup;
+// The UC8 lookup tables are generated at build time (see gentables.c);
+// all there is to do here is lock them in with --mlock
 static bool init_uc8_lookup()
 {
-    if (uc8_lookup)
-        return true;
-
-    uc8_lookup = malloc(sizeof(uint16_t) * 256 * 256);
-    if (!uc8_lookup) {
-        fprintf(stderr, "can't allocate UC8 conversion lookup table\n");
-        return false;
-    }
-
-    for (int i = 0; i <= 255; i++) {
-        for (int q = 0; q <= 255; q++) {
-            float fI, fQ, magsq;
-
-            fI = (i - 127.5) / 127.5;
-            fQ = (q - 127.5) / 127.5;
-            magsq = fI * fI + fQ * fQ;
-            if (magsq > 1)
-                magsq = 1;
-            float mag = sqrtf(magsq);
-
-            uc8_lookup[le16toh((i*256)+q)] = (uint16_t) (mag * 65535.0f + 0.5f);
-        }
-    }
-
+    lock_memory((void *) uc8_lookup, sizeof(uc8_lookup));
     return true;
 }
 
@@ -61,10 +44,11 @@ static void convert_uc8_nodc(void *iq_data,
                              unsigned nsamples,
                              struct converter_state *state,
                              double *out_mean_level,
-                             double *out_mean_power)
+                             double *out_mean_power,
+                             uint16_t *out_block_max)
 {
     uint16_t *in = iq_data;
-    unsigned i;
+    unsigned i, k;
     uint64_t sum_level = 0;
     uint64_t sum_power = 0;
     uint16_t mag;
@@ -78,22 +62,95 @@ static void convert_uc8_nodc(void *iq_data,
         *mag_data++ = mag;                          \
         sum_level += mag;                           \
         sum_power += (uint32_t)mag * (uint32_t)mag; \
+        if (mag > peak)                             \
+            peak = mag;                             \
     } while(0)
 
-    // unroll this a bit
-    for (i = 0; i < (nsamples>>3); ++i) {
-        DO_ONE_SAMPLE;
-        DO_ONE_SAMPLE;
-        DO_ONE_SAMPLE;
-        DO_ONE_SAMPLE;
-        DO_ONE_SAMPLE;
-        DO_ONE_SAMPLE;
-        DO_ONE_SAMPLE;
-        DO_ONE_SAMPLE;
+    for (i = 0; i < nsamples; i += MODES_MAG_BLOCK_SAMPLES) {
+        unsigned n = (nsamples - i < MODES_MAG_BLOCK_SAMPLES ? nsamples - i : MODES_MAG_BLOCK_SAMPLES);
+        uint16_t peak = 0;
+
+        // unroll this a bit
+        for (k = 0; k < (n>>3); ++k) {
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+        }
+
+        for (k = 0; k < (n&7); ++k) {
+            DO_ONE_SAMPLE;
+        }
+
+        if (out_block_max)
+            *out_block_max++ = peak;
     }
 
-    for (i = 0; i < (nsamples&7); ++i) {
-        DO_ONE_SAMPLE;
+#undef DO_ONE_SAMPLE
+
+    if (out_mean_level) {
+        *out_mean_level = sum_level / 65536.0 / nsamples;
+    }
+
+    if (out_mean_power) {
+        *out_mean_power = sum_power / 65535.0 / 65535.0 / nsamples;
+    }
+}
+
+static void convert_uc8_nodc_8(void *iq_data,
+                               uint8_t *mag_data,
+                               unsigned nsamples,
+                               struct converter_state *state,
+                               double *out_mean_level,
+                               double *out_mean_power,
+                               uint16_t *out_block_max)
+{
+    uint16_t *in = iq_data;
+    unsigned i, k;
+    uint64_t sum_level = 0;
+    uint64_t sum_power = 0;
+    uint16_t mag;
+
+    MODES_NOTUSED(state);
+
+    // As convert_uc8_nodc, then rounded to 8 bits; level and power are
+    // summed before rounding, so they match the 16-bit converters exactly
+#define DO_ONE_SAMPLE \
+    do {                                            \
+        mag = uc8_lookup[*in++];                    \
+        *mag_data++ = MAG16_TO_8(mag);              \
+        sum_level += mag;                           \
+        sum_power += (uint32_t)mag * (uint32_t)mag; \
+        if (mag > peak)                             \
+            peak = mag;                             \
+    } while(0)
+
+    for (i = 0; i < nsamples; i += MODES_MAG_BLOCK_SAMPLES) {
+        unsigned n = (nsamples - i < MODES_MAG_BLOCK_SAMPLES ? nsamples - i : MODES_MAG_BLOCK_SAMPLES);
+        uint16_t peak = 0;
+
+        // unroll this a bit
+        for (k = 0; k < (n>>3); ++k) {
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+            DO_ONE_SAMPLE;
+        }
+
+        for (k = 0; k < (n&7); ++k) {
+            DO_ONE_SAMPLE;
+        }
+
+        if (out_block_max)
+            *out_block_max++ = MAG16_TO_8(peak);
     }
 
 #undef DO_ONE_SAMPLE
@@ -107,12 +164,223 @@ static void convert_uc8_nodc(void *iq_data,
     }
 }
 
+#if defined(__GNUC__) && (defined(__clang__) || __GNUC__ >= 9) && !defined(CONVERT_NO_VECTOR) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+
+// The vector converters process CONV_LANES samples at a time with GCC/clang
+// vector extensions (SSE2 or AVX2 on x86, NEON on ARM). Each one is built once
+// for the baseline instruction set and once more for each instruction set in
+// kernel.h that the compiler supports; init_converter picks one at runtime.
+// The vector extensions have no sqrt, so magnitudes are computed as
+// x * rsqrt(x), from the usual bit-level estimate of rsqrt and three
+// Newton-Raphson steps, which is good to float precision. x = 0 gives 0.
+
+#define CONVERT_VECTOR
+
+#define CONV_LANES 8
+typedef uint8_t conv_vu8 __attribute__((vector_size(CONV_LANES * sizeof(uint8_t))));
+typedef uint16_t conv_vu16 __attribute__((vector_size(CONV_LANES * sizeof(uint16_t))));
+typedef int32_t conv_vi32 __attribute__((vector_size(CONV_LANES * sizeof(int32_t))));
+typedef uint32_t conv_vu32 __attribute__((vector_size(CONV_LANES * sizeof(uint32_t))));
+typedef float conv_vf32 __attribute__((vector_size(CONV_LANES * sizeof(float))));
+
+// In place, so that no vector is passed by value (which would have a
+// different ABI in the avx2 and baseline builds)
+// Vectors are wider than SSE2 and NEON registers. GCC splits most operations
+// on them in two, but turns comparisons into scalar code, so min and max are
+// done with arithmetic instead (a and b must differ by less than 2^31)
+#define CONV_MIN(a, b) ((a) - (((a) - (b)) & ~(((a) - (b)) >> 31)))
+#define CONV_MAX(a, b) ((b) + (((a) - (b)) & ~(((a) - (b)) >> 31)))
+
+static inline __attribute__((always_inline)) void conv_sqrt(conv_vf32 *x)
+{
+    conv_vf32 y = (conv_vf32) (0x5f3759df - ((conv_vi32) *x >> 1));
+    y = y * (1.5f - 0.5f * *x * y * y);
+    y = y * (1.5f - 0.5f * *x * y * y);
+    y = y * (1.5f - 0.5f * *x * y * y);
+    *x = *x * y;
+}
+
+// UC8 without the lookup table: with I and Q scaled to odd integers 2*I-255
+// in -255..255, |IQ|^2 is an exact integer and the 16-bit magnitude is
+// sqrt(min(|IQ|^2, 255^2)) * 257, which is what the table holds.
+
+static inline uint16_t uc8_magnitude(uint16_t iq)
+{
+    int I = ((iq & 255) << 1) - 255;
+    int Q = ((iq >> 8) << 1) - 255;
+    int magsq = I * I + Q * Q;
+
+    if (magsq > 255 * 255)
+        magsq = 255 * 255;
+    return (uint16_t) (sqrtf(magsq) * 257.0f + 0.5f);
+}
+
+// mag8 is always a constant: if set, mag_data is uint8_t rather than uint16_t,
+// and gets the 16-bit magnitudes rounded with MAG16_TO_8
+static inline __attribute__((always_inline)) void convert_uc8_nodc_vec_common(void *iq_data,
+                                                                              void *mag_data,
+                                                                              bool mag8,
+                                                                              unsigned nsamples,
+                                                                              double *out_mean_level,
+                                                                              double *out_mean_power,
+                                                                              uint16_t *out_block_max)
+{
+    uint16_t *in = iq_data;
+    uint16_t *mag16 = mag_data;
+    uint8_t *mag8_data = mag_data;
+    unsigned i, k;
+    uint64_t sum_level = 0;
+    uint64_t sum_power = 0;
+
+    for (i = 0; i < nsamples; i += MODES_MAG_BLOCK_SAMPLES) {
+        unsigned n = (nsamples - i < MODES_MAG_BLOCK_SAMPLES ? nsamples - i : MODES_MAG_BLOCK_SAMPLES);
+        conv_vi32 vlevel = { 0 }, vpeak = { 0 };
+        conv_vu32 vpower_lo = { 0 }, vpower_hi = { 0 };
+        uint16_t peak = 0;
+
+        for (k = 0; k + CONV_LANES <= n; k += CONV_LANES) {
+            conv_vu16 iq;
+            conv_vi32 raw, I, Q, magsq, mag;
+            conv_vu32 power;
+            conv_vf32 x;
+
+            memcpy(&iq, in, sizeof(iq));
+            in += CONV_LANES;
+
+            raw = __builtin_convertvector(iq, conv_vi32);
+            I = ((raw & 255) << 1) - 255;
+            Q = ((raw >> 8) << 1) - 255;
+            magsq = I * I + Q * Q;
+            magsq = CONV_MIN(magsq, 255 * 255);
+
+            x = __builtin_convertvector(magsq, conv_vf32);
+            conv_sqrt(&x);
+            mag = __builtin_convertvector(x * 257.0f + 0.5f, conv_vi32);
+            mag = CONV_MIN(mag, 65535);
+            if (mag8) {
+                conv_vu8 out = __builtin_convertvector(MAG16_TO_8(mag), conv_vu8);
+                memcpy(mag8_data, &out, sizeof(out));
+                mag8_data += CONV_LANES;
+            } else {
+                conv_vu16 out = __builtin_convertvector(mag, conv_vu16);
+                memcpy(mag16, &out, sizeof(out));
+                mag16 += CONV_LANES;
+            }
+
+            // mag^2 fits in 32 bits but a block's worth of them doesn't,
+            // so the halves are summed separately
+            vlevel += mag;
+            power = (conv_vu32) mag * (conv_vu32) mag;
+            vpower_lo += power & 65535;
+            vpower_hi += power >> 16;
+            vpeak = CONV_MAX(mag, vpeak);
+        }
+
+        for (unsigned lane = 0; lane < CONV_LANES; ++lane) {
+            sum_level += vlevel[lane];
+            sum_power += vpower_lo[lane] + ((uint64_t) vpower_hi[lane] << 16);
+            if (vpeak[lane] > peak)
+                peak = vpeak[lane];
+        }
+
+        for (; k < n; ++k) {
+            uint16_t mag = uc8_magnitude(*in++);
+            if (mag8)
+                *mag8_data++ = MAG16_TO_8(mag);
+            else
+                *mag16++ = mag;
+            sum_level += mag;
+            sum_power += (uint32_t)mag * (uint32_t)mag;
+            if (mag > peak)
+                peak = mag;
+        }
+
+        if (out_block_max)
+            *out_block_max++ = (mag8 ? MAG16_TO_8(peak) : peak);
+    }
+
+    if (out_mean_level) {
+        *out_mean_level = sum_level / 65536.0 / nsamples;
+    }
+
+    if (out_mean_power) {
+        *out_mean_power = sum_power / 65535.0 / 65535.0 / nsamples;
+    }
+}
+
+#endif /* CONVERT_VECTOR */
+
 static void convert_uc8_generic(void *iq_data,
                                 uint16_t *mag_data,
                                 unsigned nsamples,
                                 struct converter_state *state,
                                 double *out_mean_level,
-                                double *out_mean_power)
+                                double *out_mean_power,
+                                uint16_t *out_block_max)
+{
+    uint8_t *in = iq_data;
+    float z1_I = state->z1_I;
+    float z1_Q = state->z1_Q;
+    const float dc_a = state->dc_a;
+    const float dc_b = state->dc_b;
+
+    unsigned i, k;
+    uint8_t I, Q;
+    float fI, fQ, magsq;
+    float sum_level = 0, sum_power = 0;
+
+    for (i = 0; i < nsamples; i += MODES_MAG_BLOCK_SAMPLES) {
+        unsigned n = (nsamples - i < MODES_MAG_BLOCK_SAMPLES ? nsamples - i : MODES_MAG_BLOCK_SAMPLES);
+        uint16_t peak = 0;
+
+        for (k = 0; k < n; ++k) {
+            I = *in++;
+            Q = *in++;
+            fI = (I - 127.5f) / 127.5f;
+            fQ = (Q - 127.5f) / 127.5f;
+
+            // DC block
+            z1_I = fI * dc_a + z1_I * dc_b;
+            z1_Q = fQ * dc_a + z1_Q * dc_b;
+            fI -= z1_I;
+            fQ -= z1_Q;
+
+            magsq = fI * fI + fQ * fQ;
+            if (magsq > 1)
+                magsq = 1;
+
+            float mag = sqrtf(magsq);
+            sum_power += magsq;
+            sum_level += mag;
+            uint16_t mag16 = (uint16_t)(mag * 65535.0f + 0.5f);
+            *mag_data++ = mag16;
+            if (mag16 > peak)
+                peak = mag16;
+        }
+
+        if (out_block_max)
+            *out_block_max++ = peak;
+    }
+
+    state->z1_I = z1_I;
+    state->z1_Q = z1_Q;
+
+    if (out_mean_level) {
+        *out_mean_level = sum_level / nsamples;
+    }
+
+    if (out_mean_power) {
+        *out_mean_power = sum_power / nsamples;
+    }
+}
+
+static void convert_uc8_generic_8(void *iq_data,
+                                  uint8_t *mag_data,
+                                  unsigned nsamples,
+                                  struct converter_state *state,
+                                  double *out_mean_level,
+                                  double *out_mean_power,
+                                  uint16_t *out_block_max)
 {
     uint8_t *in = iq_data;
     float z1_I = state->z1_I;
@@ -120,31 +388,42 @@ static void convert_uc8_generic(void *iq_data,
     const float dc_a = state->dc_a;
     const float dc_b = state->dc_b;
 
-    unsigned i;
+    unsigned i, k;
     uint8_t I, Q;
     float fI, fQ, magsq;
     float sum_level = 0, sum_power = 0;
 
-    for (i = 0; i < nsamples; ++i) {
-        I = *in++;
-        Q = *in++;
-        fI = (I - 127.5f) / 127.5f;
-        fQ = (Q - 127.5f) / 127.5f;
+    for (i = 0; i < nsamples; i += MODES_MAG_BLOCK_SAMPLES) {
+        unsigned n = (nsamples - i < MODES_MAG_BLOCK_SAMPLES ? nsamples - i : MODES_MAG_BLOCK_SAMPLES);
+        uint8_t peak = 0;
+
+        for (k = 0; k < n; ++k) {
+            I = *in++;
+            Q = *in++;
+            fI = (I - 127.5f) / 127.5f;
+            fQ = (Q - 127.5f) / 127.5f;
+
+            // DC block
+            z1_I = fI * dc_a + z1_I * dc_b;
+            z1_Q = fQ * dc_a + z1_Q * dc_b;
+            fI -= z1_I;
+            fQ -= z1_Q;
 
-        // DC block
-        z1_I = fI * dc_a + z1_I * dc_b;
-        z1_Q = fQ * dc_a + z1_Q * dc_b;
-        fI -= z1_I;
-        fQ -= z1_Q;
+            magsq = fI * fI + fQ * fQ;
+            if (magsq > 1)
+                magsq = 1;
 
-        magsq = fI * fI + fQ * fQ;
-        if (magsq > 1)
-            magsq = 1;
+            float mag = sqrtf(magsq);
+            sum_power += magsq;
+            sum_level += mag;
+            uint8_t mag8 = MAG16_TO_8((uint16_t)(mag * 65535.0f + 0.5f));
+            *mag_data++ = mag8;
+            if (mag8 > peak)
+                peak = mag8;
+        }
 
-        float mag = sqrtf(magsq);
-        sum_power += magsq;
-        sum_level += mag;
-        *mag_data++ = (uint16_t)(mag * 65535.0f + 0.5f);
+        if (out_block_max)
+            *out_block_max++ = peak;
     }
 
     state->z1_I = z1_I;
@@ -163,8 +442,9 @@ static void convert_sc16_generic(void *iq_data,
                                  uint16_t *mag_data,
                                  unsigned nsamples,
                                  struct converter_state *state,
-                                double *out_mean_level,
-                                double *out_mean_power)
+                                 double *out_mean_level,
+                                 double *out_mean_power,
+                                 uint16_t *out_block_max)
 {
     uint16_t *in = iq_data;
     float z1_I = state->z1_I;
@@ -172,31 +452,42 @@ static void convert_sc16_generic(void *iq_data,
     const float dc_a = state->dc_a;
     const float dc_b = state->dc_b;
 
-    unsigned i;
+    unsigned i, k;
     int16_t I, Q;
     float fI, fQ, magsq;
     float sum_level = 0, sum_power = 0;
 
-    for (i = 0; i < nsamples; ++i) {
-        I = (int16_t)le16toh(*in++);
-        Q = (int16_t)le16toh(*in++);
-        fI = I / 32768.0f;
-        fQ = Q / 32768.0f;
+    for (i = 0; i < nsamples; i += MODES_MAG_BLOCK_SAMPLES) {
+        unsigned n = (nsamples - i < MODES_MAG_BLOCK_SAMPLES ? nsamples - i : MODES_MAG_BLOCK_SAMPLES);
+        uint16_t peak = 0;
 
-        // DC block
-        z1_I = fI * dc_a + z1_I * dc_b;
-        z1_Q = fQ * dc_a + z1_Q * dc_b;
-        fI -= z1_I;
-        fQ -= z1_Q;
+        for (k = 0; k < n; ++k) {
+            I = (int16_t)le16toh(*in++);
+            Q = (int16_t)le16toh(*in++);
+            fI = I / 32768.0f;
+            fQ = Q / 32768.0f;
 
-        magsq = fI * fI + fQ * fQ;
-        if (magsq > 1)
-            magsq = 1;
+            // DC block
+            z1_I = fI * dc_a + z1_I * dc_b;
+            z1_Q = fQ * dc_a + z1_Q * dc_b;
+            fI -= z1_I;
+            fQ -= z1_Q;
 
-        float mag = sqrtf(magsq);
-        sum_power += magsq;
-        sum_level += mag;
-        *mag_data++ = (uint16_t)(mag * 65535.0f + 0.5f);
+            magsq = fI * fI + fQ * fQ;
+            if (magsq > 1)
+                magsq = 1;
+
+            float mag = sqrtf(magsq);
+            sum_power += magsq;
+            sum_level += mag;
+            uint16_t mag16 = (uint16_t)(mag * 65535.0f + 0.5f);
+            *mag_data++ = mag16;
+            if (mag16 > peak)
+                peak = mag16;
+        }
+
+        if (out_block_max)
+            *out_block_max++ = peak;
     }
 
     state->z1_I = z1_I;
@@ -216,31 +507,43 @@ static void convert_sc16_nodc(void *iq_data,
                               unsigned nsamples,
                               struct converter_state *state,
                               double *out_mean_level,
-                              double *out_mean_power)
+                              double *out_mean_power,
+                              uint16_t *out_block_max)
 {
     MODES_NOTUSED(state);
 
     uint16_t *in = iq_data;
 
-    unsigned i;
+    unsigned i, k;
     int16_t I, Q;
     float fI, fQ, magsq;
     float sum_level = 0, sum_power = 0;
 
-    for (i = 0; i < nsamples; ++i) {
-        I = (int16_t)le16toh(*in++);
-        Q = (int16_t)le16toh(*in++);
-        fI = I / 32768.0f;
-        fQ = Q / 32768.0f;
+    for (i = 0; i < nsamples; i += MODES_MAG_BLOCK_SAMPLES) {
+        unsigned n = (nsamples - i < MODES_MAG_BLOCK_SAMPLES ? nsamples - i : MODES_MAG_BLOCK_SAMPLES);
+        uint16_t peak = 0;
 
-        magsq = fI * fI + fQ * fQ;
-        if (magsq > 1)
-            magsq = 1;
+        for (k = 0; k < n; ++k) {
+            I = (int16_t)le16toh(*in++);
+            Q = (int16_t)le16toh(*in++);
+            fI = I / 32768.0f;
+            fQ = Q / 32768.0f;
 
-        float mag = sqrtf(magsq);
-        sum_power += magsq;
-        sum_level += mag;
-        *mag_data++ = (uint16_t)(mag * 65535.0f + 0.5f);
+            magsq = fI * fI + fQ * fQ;
+            if (magsq > 1)
+                magsq = 1;
+
+            float mag = sqrtf(magsq);
+            sum_power += magsq;
+            sum_level += mag;
+            uint16_t mag16 = (uint16_t)(mag * 65535.0f + 0.5f);
+            *mag_data++ = mag16;
+            if (mag16 > peak)
+                peak = mag16;
+        }
+
+        if (out_block_max)
+            *out_block_max++ = peak;
     }
 
     if (out_mean_level) {
@@ -259,7 +562,10 @@ static void convert_sc16_nodc(void *iq_data,
 // See convert_benchmark.c for some numbers.
 
 // Leaving SC16QQ_TABLE_BITS undefined will disable the table lookup and always use
-// the floating-point path, which may be faster on some systems
+// the floating-point path, which may be faster on some systems.
+//
+// Where the vector converters are available they are preferred over both,
+// and SC16Q11_TABLE_BITS only matters for benchmarking the table.
 
 #if defined(SC16Q11_TABLE_BITS)
 
@@ -272,7 +578,7 @@ static bool init_sc16q11_lookup()
     if (sc16q11_lookup)
         return true;
 
-    sc16q11_lookup = malloc(sizeof(uint16_t) * (1 << (USE_BITS * 2)));
+    sc16q11_lookup = alloc_big(sizeof(uint16_t) * (1 << (USE_BITS * 2)));
     if (!sc16q11_lookup) {
         fprintf(stderr, "can't allocate SC16Q11 conversion lookup table\n");
         return false;
@@ -299,10 +605,11 @@ static void convert_sc16q11_table(void *iq_data,
                                   unsigned nsamples,
                                   struct converter_state *state,
                                   double *out_mean_level,
-                                  double *out_mean_power)
+                                  double *out_mean_power,
+                                  uint16_t *out_block_max)
 {
     uint16_t *in = iq_data;
-    unsigned i;
+    unsigned i, k;
     uint16_t I, Q;
     uint64_t sum_level = 0;
     uint64_t sum_power = 0;
@@ -310,13 +617,23 @@ static void convert_sc16q11_table(void *iq_data,
 
     MODES_NOTUSED(state);
 
-    for (i = 0; i < nsamples; ++i) {
-        I = abs((int16_t)le16toh(*in++)) & 2047;
-        Q = abs((int16_t)le16toh(*in++)) & 2047;
-        mag = sc16q11_lookup[((I >> LOSE_BITS) << USE_BITS) | (Q >> LOSE_BITS)];
-        *mag_data++ = mag;
-        sum_level += mag;
-        sum_power += (uint32_t)mag * (uint32_t)mag;
+    for (i = 0; i < nsamples; i += MODES_MAG_BLOCK_SAMPLES) {
+        unsigned n = (nsamples - i < MODES_MAG_BLOCK_SAMPLES ? nsamples - i : MODES_MAG_BLOCK_SAMPLES);
+        uint16_t peak = 0;
+
+        for (k = 0; k < n; ++k) {
+            I = abs((int16_t)le16toh(*in++)) & 2047;
+            Q = abs((int16_t)le16toh(*in++)) & 2047;
+            mag = sc16q11_lookup[((I >> LOSE_BITS) << USE_BITS) | (Q >> LOSE_BITS)];
+            *mag_data++ = mag;
+            if (mag > peak)
+                peak = mag;
+            sum_level += mag;
+            sum_power += (uint32_t)mag * (uint32_t)mag;
+        }
+
+        if (out_block_max)
+            *out_block_max++ = peak;
     }
 
     if (out_mean_level) {
@@ -335,31 +652,43 @@ static void convert_sc16q11_nodc(void *iq_data,
                                  unsigned nsamples,
                                  struct converter_state *state,
                                  double *out_mean_level,
-                                 double *out_mean_power)
+                                 double *out_mean_power,
+                                 uint16_t *out_block_max)
 {
     MODES_NOTUSED(state);
 
     uint16_t *in = iq_data;
 
-    unsigned i;
+    unsigned i, k;
     int16_t I, Q;
     float fI, fQ, magsq;
     float sum_level = 0, sum_power = 0;
 
-    for (i = 0; i < nsamples; ++i) {
-        I = (int16_t)le16toh(*in++);
-        Q = (int16_t)le16toh(*in++);
-        fI = I / 2048.0f;
-        fQ = Q / 2048.0f;
+    for (i = 0; i < nsamples; i += MODES_MAG_BLOCK_SAMPLES) {
+        unsigned n = (nsamples - i < MODES_MAG_BLOCK_SAMPLES ? nsamples - i : MODES_MAG_BLOCK_SAMPLES);
+        uint16_t peak = 0;
 
-        magsq = fI * fI + fQ * fQ;
-        if (magsq > 1)
-            magsq = 1;
+        for (k = 0; k < n; ++k) {
+            I = (int16_t)le16toh(*in++);
+            Q = (int16_t)le16toh(*in++);
+            fI = I / 2048.0f;
+            fQ = Q / 2048.0f;
 
-        float mag = sqrtf(magsq);
-        sum_power += magsq;
-        sum_level += mag;
-        *mag_data++ = (uint16_t)(mag * 65535.0f + 0.5f);
+            magsq = fI * fI + fQ * fQ;
+            if (magsq > 1)
+                magsq = 1;
+
+            float mag = sqrtf(magsq);
+            sum_power += magsq;
+            sum_level += mag;
+            uint16_t mag16 = (uint16_t)(mag * 65535.0f + 0.5f);
+            *mag_data++ = mag16;
+            if (mag16 > peak)
+                peak = mag16;
+        }
+
+        if (out_block_max)
+            *out_block_max++ = peak;
     }
 
     if (out_mean_level) {
@@ -373,12 +702,250 @@ static void convert_sc16q11_nodc(void *iq_data,
 
 #endif /* defined(SC16Q11_TABLE_BITS) */
 
+#if defined(CONVERT_VECTOR)
+
+// Vector float path, shared by all formats. Each IQ pair is loaded as one
+// lane (I in the low half) and split with shifts; SC16 and SC16Q11 differ
+// only in scale, UC8 also has an offset. Magnitude, level and power come
+// out of the same pass, with the sums kept in float lanes for each block
+// and accumulated in double.
+//
+// The DC filter is the same single-pole IIR as the scalar converters,
+//
+//   z[n] = a * x[n] + b * z[n-1]
+//
+// evaluated CONV_LANES samples at a time: unrolling the recurrence gives
+//
+//   z[n+k] = b^(k+1) * z[n-1] + sum(j = 0..k) a * b^(k-j) * x[n+j]
+//
+// so each group is one multiply by the decay vector b^(k+1) plus CONV_LANES
+// multiply-adds of precomputed columns a * b^(k-j), with only the last
+// lane carried to the next group. This rounds differently from the scalar
+// filter, but the difference doesn't grow: the filter forgets it with the
+// same ~1s time constant as everything else. Against the scalar converters,
+// on real and synthetic UC8 and SC16 captures, magnitudes agree within 1 LSB
+// of the 16-bit output and mean level and power within 2e-5 (most of which
+// is the scalar converters' float accumulators).
+
+static void init_dc_columns(struct converter_state *state)
+{
+    for (int j = 0; j < CONV_LANES; ++j) {
+        for (int k = 0; k < CONV_LANES; ++k)
+            state->dc_columns[j][k] = (k >= j ? state->dc_a * pow(state->dc_b, k - j) : 0);
+        state->dc_decay[j] = pow(state->dc_b, j + 1);
+    }
+}
+
+static inline __attribute__((always_inline)) void convert_vec_common(void *iq_data,
+                                                                     void *mag_data,
+                                                                     bool mag8,
+                                                                     unsigned nsamples,
+                                                                     struct converter_state *state,
+                                                                     input_format_t format,
+                                                                     bool filter_dc,
+                                                                     double *out_mean_level,
+                                                                     double *out_mean_power,
+                                                                     uint16_t *out_block_max)
+{
+    uint8_t *in8 = iq_data;
+    uint32_t *in32 = iq_data;
+    uint16_t *mag16 = mag_data;
+    uint8_t *mag8_data = mag_data;
+    unsigned i, k;
+    double sum_level = 0, sum_power = 0;
+
+    const float scale = (format == INPUT_UC8 ? 1 / 127.5f : format == INPUT_SC16 ? 1 / 32768.0f : 1 / 2048.0f);
+    const float offset = (format == INPUT_UC8 ? 127.5f : 0);
+
+    float z1_I = state->z1_I;
+    float z1_Q = state->z1_Q;
+    const float dc_a = state->dc_a;
+    const float dc_b = state->dc_b;
+    conv_vf32 dc_columns[CONV_LANES], dc_decay;
+
+    if (filter_dc) {
+        for (int j = 0; j < CONV_LANES; ++j)
+            memcpy(&dc_columns[j], state->dc_columns[j], sizeof(conv_vf32));
+        memcpy(&dc_decay, state->dc_decay, sizeof(dc_decay));
+    }
+
+    for (i = 0; i < nsamples; i += MODES_MAG_BLOCK_SAMPLES) {
+        unsigned n = (nsamples - i < MODES_MAG_BLOCK_SAMPLES ? nsamples - i : MODES_MAG_BLOCK_SAMPLES);
+        conv_vf32 vlevel = { 0 }, vpower = { 0 };
+        conv_vi32 vpeak = { 0 };
+        float block_level = 0, block_power = 0;
+        uint16_t peak = 0;
+
+        for (k = 0; k + CONV_LANES <= n; k += CONV_LANES) {
+            conv_vi32 mag;
+            conv_vf32 fI, fQ, magsq, x;
+
+            if (format == INPUT_UC8) {
+                conv_vu16 raw;
+                memcpy(&raw, in8, sizeof(raw));
+                in8 += 2 * CONV_LANES;
+                fI = (__builtin_convertvector(raw & 255, conv_vf32) - offset) * scale;
+                fQ = (__builtin_convertvector(raw >> 8, conv_vf32) - offset) * scale;
+            } else {
+                conv_vu32 raw;
+                memcpy(&raw, in32, sizeof(raw));
+                in32 += CONV_LANES;
+                fI = __builtin_convertvector((conv_vi32) (raw << 16) >> 16, conv_vf32) * scale;
+                fQ = __builtin_convertvector((conv_vi32) raw >> 16, conv_vf32) * scale;
+            }
+
+            if (filter_dc) {
+                conv_vf32 zI = dc_decay * z1_I;
+                conv_vf32 zQ = dc_decay * z1_Q;
+                for (int j = 0; j < CONV_LANES; ++j) {
+                    zI += dc_columns[j] * fI[j];
+                    zQ += dc_columns[j] * fQ[j];
+                }
+                z1_I = zI[CONV_LANES - 1];
+                z1_Q = zQ[CONV_LANES - 1];
+                fI -= zI;
+                fQ -= zQ;
+            }
+
+            magsq = fI * fI + fQ * fQ;
+            // magsq >= 0, so its bits compare like integers
+            magsq = (conv_vf32) CONV_MIN((conv_vi32) magsq, 0x3f800000 /* 1.0f */);
+
+            x = magsq;
+            conv_sqrt(&x);
+            vlevel += x;
+            vpower += magsq;
+
+            mag = __builtin_convertvector(x * 65535.0f + 0.5f, conv_vi32);
+            if (mag8) {
+                conv_vu8 out = __builtin_convertvector(MAG16_TO_8(mag), conv_vu8);
+                memcpy(mag8_data, &out, sizeof(out));
+                mag8_data += CONV_LANES;
+            } else {
+                conv_vu16 out = __builtin_convertvector(mag, conv_vu16);
+                memcpy(mag16, &out, sizeof(out));
+                mag16 += CONV_LANES;
+            }
+
+            vpeak = CONV_MAX(mag, vpeak);
+        }
+
+        for (unsigned lane = 0; lane < CONV_LANES; ++lane) {
+            block_level += vlevel[lane];
+            block_power += vpower[lane];
+            if (vpeak[lane] > peak)
+                peak = vpeak[lane];
+        }
+
+        for (; k < n; ++k) {
+            float fI, fQ;
+
+            if (format == INPUT_UC8) {
+                fI = (in8[0] - offset) * scale;
+                fQ = (in8[1] - offset) * scale;
+                in8 += 2;
+            } else {
+                fI = (int16_t) (*in32 & 0xFFFF) * scale;
+                fQ = (int16_t) (*in32++ >> 16) * scale;
+            }
+
+            if (filter_dc) {
+                z1_I = fI * dc_a + z1_I * dc_b;
+                z1_Q = fQ * dc_a + z1_Q * dc_b;
+                fI -= z1_I;
+                fQ -= z1_Q;
+            }
+
+            float magsq = fI * fI + fQ * fQ;
+            if (magsq > 1)
+                magsq = 1;
+
+            float mag = sqrtf(magsq);
+            block_power += magsq;
+            block_level += mag;
+            uint16_t out = (uint16_t)(mag * 65535.0f + 0.5f);
+            if (mag8)
+                *mag8_data++ = MAG16_TO_8(out);
+            else
+                *mag16++ = out;
+            if (out > peak)
+                peak = out;
+        }
+
+        sum_level += block_level;
+        sum_power += block_power;
+
+        if (out_block_max)
+            *out_block_max++ = (mag8 ? MAG16_TO_8(peak) : peak);
+    }
+
+    if (filter_dc) {
+        state->z1_I = z1_I;
+        state->z1_Q = z1_Q;
+    }
+
+    if (out_mean_level) {
+        *out_mean_level = sum_level / nsamples;
+    }
+
+    if (out_mean_power) {
+        *out_mean_power = sum_power / nsamples;
+    }
+}
+
+#define CONVERT_KERNEL(name, target, mag_type, call)                    \
+    target static void name(void *iq_data,                              \
+                            mag_type *mag_data,                         \
+                            unsigned nsamples,                          \
+                            struct converter_state *state,              \
+                            double *out_mean_level,                     \
+                            double *out_mean_power,                     \
+                            uint16_t *out_block_max)                    \
+    {                                                                   \
+        MODES_NOTUSED(state);                                           \
+        call;                                                           \
+    }
+
+#define CONVERT_VEC_FN(name, target, format, filter_dc)                 \
+    CONVERT_KERNEL(name, target, uint16_t,                              \
+                   convert_vec_common(iq_data, mag_data, false, nsamples, state, format, filter_dc, \
+                                      out_mean_level, out_mean_power, out_block_max))
+
+// All the vector converters for one instruction set, named with the given
+// suffix. The _8 variants produce 8-bit magnitudes (--mag8).
+#define CONVERT_KERNELS(suffix, target)                                 \
+    CONVERT_KERNEL(convert_uc8_nodc_##suffix, target, uint16_t,         \
+                   convert_uc8_nodc_vec_common(iq_data, mag_data, false, nsamples, \
+                                               out_mean_level, out_mean_power, out_block_max)) \
+    CONVERT_KERNEL(convert_uc8_nodc_8_##suffix, target, uint8_t,        \
+                   convert_uc8_nodc_vec_common(iq_data, mag_data, true, nsamples, \
+                                               out_mean_level, out_mean_power, out_block_max)) \
+    CONVERT_VEC_FN(convert_uc8_dc_##suffix, target, INPUT_UC8, true)    \
+    CONVERT_KERNEL(convert_uc8_dc_8_##suffix, target, uint8_t,          \
+                   convert_vec_common(iq_data, mag_data, true, nsamples, state, INPUT_UC8, true, \
+                                      out_mean_level, out_mean_power, out_block_max)) \
+    CONVERT_VEC_FN(convert_sc16_nodc_##suffix, target, INPUT_SC16, false) \
+    CONVERT_VEC_FN(convert_sc16_dc_##suffix, target, INPUT_SC16, true)  \
+    CONVERT_VEC_FN(convert_sc16q11_nodc_##suffix, target, INPUT_SC16Q11, false) \
+    CONVERT_VEC_FN(convert_sc16q11_dc_##suffix, target, INPUT_SC16Q11, true)
+
+CONVERT_KERNELS(vec, )
+#if defined(KERNEL_HAVE_AVX2)
+CONVERT_KERNELS(avx2, KERNEL_TARGET_AVX2)
+#endif
+#if defined(KERNEL_HAVE_NEON)
+CONVERT_KERNELS(neon, KERNEL_TARGET_NEON)
+#endif
+
+#endif /* CONVERT_VECTOR */
+
 static void convert_sc16q11_generic(void *iq_data,
                                     uint16_t *mag_data,
                                     unsigned nsamples,
                                     struct converter_state *state,
                                     double *out_mean_level,
-                                    double *out_mean_power)
+                                    double *out_mean_power,
+                                    uint16_t *out_block_max)
 {
     uint16_t *in = iq_data;
     float z1_I = state->z1_I;
@@ -386,31 +953,42 @@ static void convert_sc16q11_generic(void *iq_data,
     const float dc_a = state->dc_a;
     const float dc_b = state->dc_b;
 
-    unsigned i;
+    unsigned i, k;
     int16_t I, Q;
     float fI, fQ, magsq;
     float sum_level = 0, sum_power = 0;
 
-    for (i = 0; i < nsamples; ++i) {
-        I = (int16_t)le16toh(*in++);
-        Q = (int16_t)le16toh(*in++);
-        fI = I / 2048.0f;
-        fQ = Q / 2048.0f;
+    for (i = 0; i < nsamples; i += MODES_MAG_BLOCK_SAMPLES) {
+        unsigned n = (nsamples - i < MODES_MAG_BLOCK_SAMPLES ? nsamples - i : MODES_MAG_BLOCK_SAMPLES);
+        uint16_t peak = 0;
+
+        for (k = 0; k < n; ++k) {
+            I = (int16_t)le16toh(*in++);
+            Q = (int16_t)le16toh(*in++);
+            fI = I / 2048.0f;
+            fQ = Q / 2048.0f;
 
-        // DC block
-        z1_I = fI * dc_a + z1_I * dc_b;
-        z1_Q = fQ * dc_a + z1_Q * dc_b;
-        fI -= z1_I;
-        fQ -= z1_Q;
+            // DC block
+            z1_I = fI * dc_a + z1_I * dc_b;
+            z1_Q = fQ * dc_a + z1_Q * dc_b;
+            fI -= z1_I;
+            fQ -= z1_Q;
+
+            magsq = fI * fI + fQ * fQ;
+            if (magsq > 1)
+                magsq = 1;
 
-        magsq = fI * fI + fQ * fQ;
-        if (magsq > 1)
-            magsq = 1;
+            float mag = sqrtf(magsq);
+            sum_power += magsq;
+            sum_level += mag;
+            uint16_t mag16 = (uint16_t)(mag * 65535.0f + 0.5f);
+            *mag_data++ = mag16;
+            if (mag16 > peak)
+                peak = mag16;
+        }
 
-        float mag = sqrtf(magsq);
-        sum_power += magsq;
-        sum_level += mag;
-        *mag_data++ = (uint16_t)(mag * 65535.0f + 0.5f);
+        if (out_block_max)
+            *out_block_max++ = peak;
     }
 
     state->z1_I = z1_I;
@@ -425,57 +1003,97 @@ static void convert_sc16q11_generic(void *iq_data,
     }
 }
 
+#if defined(CONVERT_VECTOR)
+
+// Table rows for a vector converter, one per instruction set it was built
+// for, best first
+#if defined(KERNEL_HAVE_AVX2)
+#define AVX2_ROW(format, dc, name, description) { format, dc, name##_avx2, description " (avx2)", KERNEL_AVX2, NULL, NULL },
+#else
+#define AVX2_ROW(format, dc, name, description)
+#endif
+#if defined(KERNEL_HAVE_NEON)
+#define NEON_ROW(format, dc, name, description) { format, dc, name##_neon, description " (neon)", KERNEL_NEON, NULL, NULL },
+#else
+#define NEON_ROW(format, dc, name, description)
+#endif
+#define VECTOR_ROWS(format, dc, name, description)                      \
+    AVX2_ROW(format, dc, name, description)                             \
+    NEON_ROW(format, dc, name, description)                             \
+    { format, dc, name##_vec, description, KERNEL_VECTOR, NULL, NULL },
+
+// The same for the 8-bit magnitude converters
+#if defined(KERNEL_HAVE_AVX2)
+#define AVX2_ROW8(format, dc, name, description) { format, dc, NULL, description " (avx2)", KERNEL_AVX2, NULL, name##_avx2 },
+#else
+#define AVX2_ROW8(format, dc, name, description)
+#endif
+#if defined(KERNEL_HAVE_NEON)
+#define NEON_ROW8(format, dc, name, description) { format, dc, NULL, description " (neon)", KERNEL_NEON, NULL, name##_neon },
+#else
+#define NEON_ROW8(format, dc, name, description)
+#endif
+#define VECTOR_ROWS8(format, dc, name, description)                     \
+    AVX2_ROW8(format, dc, name, description)                            \
+    NEON_ROW8(format, dc, name, description)                            \
+    { format, dc, NULL, description, KERNEL_VECTOR, NULL, name##_vec },
+
+#else
+#define VECTOR_ROWS(format, dc, name, description)
+#define VECTOR_ROWS8(format, dc, name, description)
+#endif
+
 static struct {
     input_format_t format;
     int can_filter_dc;
     iq_convert_fn fn;
     const char *description;
+    kernel_t kernel;
     bool (*init)();
+    iq_convert8_fn fn8;     // set instead of fn for the 8-bit magnitude converters (--mag8)
 } converters_table[] = {
     // In order of preference
-    { INPUT_UC8,          0, convert_uc8_nodc,         "UC8, integer/table path", init_uc8_lookup },
-    { INPUT_UC8,          1, convert_uc8_generic,      "UC8, float path", NULL },
-    { INPUT_SC16,         0, convert_sc16_nodc,        "SC16, float path, no DC", NULL },
-    { INPUT_SC16,         1, convert_sc16_generic,     "SC16, float path", NULL },
+    { INPUT_UC8,          0, convert_uc8_nodc,         "UC8, integer/table path", KERNEL_SCALAR, init_uc8_lookup, NULL },
+    VECTOR_ROWS(INPUT_UC8, 0, convert_uc8_nodc, "UC8, vector path")
+    VECTOR_ROWS(INPUT_UC8, 1, convert_uc8_dc, "UC8, vector path, DC")
+    { INPUT_UC8,          1, convert_uc8_generic,      "UC8, float path", KERNEL_SCALAR, NULL, NULL },
+    VECTOR_ROWS(INPUT_SC16, 0, convert_sc16_nodc, "SC16, vector path, no DC")
+    { INPUT_SC16,         0, convert_sc16_nodc,        "SC16, float path, no DC", KERNEL_SCALAR, NULL, NULL },
+    VECTOR_ROWS(INPUT_SC16, 1, convert_sc16_dc, "SC16, vector path, DC")
+    { INPUT_SC16,         1, convert_sc16_generic,     "SC16, float path", KERNEL_SCALAR, NULL, NULL },
+    VECTOR_ROWS(INPUT_SC16Q11, 0, convert_sc16q11_nodc, "SC16Q11, vector path, no DC")
 #if defined(SC16Q11_TABLE_BITS)
-    { INPUT_SC16Q11,      0, convert_sc16q11_table,    "SC16Q11, integer/table path", init_sc16q11_lookup },
+    { INPUT_SC16Q11,      0, convert_sc16q11_table,    "SC16Q11, integer/table path", KERNEL_SCALAR, init_sc16q11_lookup, NULL },
 #else
-    { INPUT_SC16Q11,      0, convert_sc16q11_nodc,     "SC16Q11, float path, no DC", NULL },
+    { INPUT_SC16Q11,      0, convert_sc16q11_nodc,     "SC16Q11, float path, no DC", KERNEL_SCALAR, NULL, NULL },
 #endif
-    { INPUT_SC16Q11,      1, convert_sc16q11_generic,  "SC16Q11, float path", NULL },
-    { 0, 0, NULL, NULL, NULL }
+    VECTOR_ROWS(INPUT_SC16Q11, 1, convert_sc16q11_dc, "SC16Q11, vector path, DC")
+    { INPUT_SC16Q11,      1, convert_sc16q11_generic,  "SC16Q11, float path", KERNEL_SCALAR, NULL, NULL },
+
+    // 8-bit magnitudes, UC8 only
+    { INPUT_UC8,          0, NULL,                     "UC8, 8-bit, integer/table path", KERNEL_SCALAR, init_uc8_lookup, convert_uc8_nodc_8 },
+    VECTOR_ROWS8(INPUT_UC8, 0, convert_uc8_nodc_8, "UC8, 8-bit, vector path")
+    VECTOR_ROWS8(INPUT_UC8, 1, convert_uc8_dc_8, "UC8, 8-bit, vector path, DC")
+    { INPUT_UC8,          1, NULL,                     "UC8, 8-bit, float path", KERNEL_SCALAR, NULL, convert_uc8_generic_8 },
+    { 0, 0, NULL, NULL, KERNEL_AUTO, NULL, NULL }
 };
 
-iq_convert_fn init_converter(input_format_t format,
-                             double sample_rate,
-                             int filter_dc,
-                             struct converter_state **out_state)
-{
-    int i;
-
-    for (i = 0; converters_table[i].fn; ++i) {
-        if (converters_table[i].format != format)
-            continue;
-        if (filter_dc && !converters_table[i].can_filter_dc)
-            continue;
-        break;
-    }
-
-    if (!converters_table[i].fn) {
-        fprintf(stderr, "no suitable converter for format=%d dc=%d\n",
-                format, filter_dc);
-        return NULL;
-    }
+static const char *format_names[] = { "UC8", "SC16", "SC16Q11" };
 
+static bool setup_converter(int i,
+                            double sample_rate,
+                            int filter_dc,
+                            struct converter_state **out_state)
+{
     if (converters_table[i].init) {
         if (!converters_table[i].init())
-            return NULL;
+            return false;
     }
 
     *out_state = malloc(sizeof(struct converter_state));
     if (! *out_state) {
         fprintf(stderr, "can't allocate converter state\n");
-        return NULL;
+        return false;
     }
 
     (*out_state)->z1_I = 0;
@@ -491,14 +1109,157 @@ iq_convert_fn init_converter(input_format_t format,
         (*out_state)->dc_a = 0.0;
     }
 
+#if defined(CONVERT_VECTOR)
+    init_dc_columns(*out_state);
+#endif
+
+    return true;
+}
+
+// Index of the preferred converter for this CPU, or -1
+static int select_converter(input_format_t format, int filter_dc, bool mag8)
+{
+    kernel_t candidates[sizeof(converters_table) / sizeof(converters_table[0])];
+    int index[sizeof(converters_table) / sizeof(converters_table[0])];
+    unsigned n = 0;
+    char stage[64];
+    int i, chosen;
+
+    for (i = 0; converters_table[i].description; ++i) {
+        if (converters_table[i].format != format)
+            continue;
+        if (filter_dc && !converters_table[i].can_filter_dc)
+            continue;
+        if (mag8 != (converters_table[i].fn8 != NULL))
+            continue;
+        candidates[n] = converters_table[i].kernel;
+        index[n] = i;
+        ++n;
+    }
+
+    snprintf(stage, sizeof(stage), "%s%s converter%s",
+             format_names[format], mag8 ? " 8-bit" : "", filter_dc ? " with DC filter" : "");
+    chosen = kernel_select(stage, candidates, n);
+    if (chosen < 0) {
+        fprintf(stderr, "no suitable %sconverter for format=%d dc=%d\n",
+                mag8 ? "8-bit " : "", format, filter_dc);
+        return -1;
+    }
+
+    return index[chosen];
+}
+
+// Index of the converter with this description, or -1
+static int find_named_converter(input_format_t format, const char *description, int filter_dc, bool mag8)
+{
+    int i;
+
+    for (i = 0; converters_table[i].description; ++i) {
+        if (converters_table[i].format != format)
+            continue;
+        if (filter_dc && !converters_table[i].can_filter_dc)
+            continue;
+        if (mag8 != (converters_table[i].fn8 != NULL))
+            continue;
+        if (!strcmp(converters_table[i].description, description))
+            return i;
+    }
+
+    fprintf(stderr, "no %sconverter \"%s\" for format=%d dc=%d\n",
+            mag8 ? "8-bit " : "", description, format, filter_dc);
+    return -1;
+}
+
+iq_convert_fn init_converter(input_format_t format,
+                             double sample_rate,
+                             int filter_dc,
+                             struct converter_state **out_state)
+{
+    int i = select_converter(format, filter_dc, false);
+
+    if (i < 0 || !setup_converter(i, sample_rate, filter_dc, out_state))
+        return NULL;
+    return converters_table[i].fn;
+}
+
+iq_convert8_fn init_converter8(input_format_t format,
+                               double sample_rate,
+                               int filter_dc,
+                               struct converter_state **out_state)
+{
+    int i = select_converter(format, filter_dc, true);
+
+    if (i < 0 || !setup_converter(i, sample_rate, filter_dc, out_state))
+        return NULL;
+    return converters_table[i].fn8;
+}
+
+iq_convert_fn init_named_converter(input_format_t format,
+                                   const char *description,
+                                   double sample_rate,
+                                   int filter_dc,
+                                   struct converter_state **out_state)
+{
+    int i = find_named_converter(format, description, filter_dc, false);
+
+    if (i < 0 || !setup_converter(i, sample_rate, filter_dc, out_state))
+        return NULL;
     return converters_table[i].fn;
 }
 
+iq_convert8_fn init_named_converter8(input_format_t format,
+                                     const char *description,
+                                     double sample_rate,
+                                     int filter_dc,
+                                     struct converter_state **out_state)
+{
+    int i = find_named_converter(format, description, filter_dc, true);
+
+    if (i < 0 || !setup_converter(i, sample_rate, filter_dc, out_state))
+        return NULL;
+    return converters_table[i].fn8;
+}
+
+bool converter_info(unsigned index,
+                    input_format_t *format,
+                    int *can_filter_dc,
+                    const char **description,
+                    kernel_t *kernel,
+                    int *mag8)
+{
+    if (index >= sizeof(converters_table) / sizeof(converters_table[0]) || !converters_table[index].description)
+        return false;
+
+    *format = converters_table[index].format;
+    *can_filter_dc = converters_table[index].can_filter_dc;
+    *description = converters_table[index].description;
+    *kernel = converters_table[index].kernel;
+    *mag8 = (converters_table[index].fn8 != NULL);
+    return true;
+}
+
+void compute_block_max(const uint16_t *mag_data, unsigned nsamples, uint16_t *out_block_max)
+{
+    unsigned i, k;
+
+    for (i = 0; i < nsamples; i += MODES_MAG_BLOCK_SAMPLES) {
+        unsigned n = (nsamples - i < MODES_MAG_BLOCK_SAMPLES ? nsamples - i : MODES_MAG_BLOCK_SAMPLES);
+        uint16_t peak = 0;
+
+        for (k = 0; k < n; ++k) {
+            if (mag_data[i + k] > peak)
+                peak = mag_data[i + k];
+        }
+
+        *out_block_max++ = peak;
+    }
+}
+
 void cleanup_converter(struct converter_state *state)
 {
     free(state);
-    free(uc8_lookup);
 #if defined(SC16Q11_TABLE_BITS)
-    free(sc16q11_lookup);    
+    free_big(sc16q11_lookup);
+    sc16q11_lookup = NULL;
 #endif
 }
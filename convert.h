@@ -23,18 +23,66 @@
 struct converter_state;
 typedef enum { INPUT_UC8=0, INPUT_SC16, INPUT_SC16Q11 } input_format_t;
 
+// Converts nsamples of IQ data to magnitudes. If out_block_max is not NULL,
+// the peak magnitude of each MODES_MAG_BLOCK_SAMPLES block of output is
+// written there too (the last block may be partial).
 typedef void (*iq_convert_fn)(void *iq_data,
                               uint16_t *mag_data,
                               unsigned nsamples,
                               struct converter_state *state,
                               double *out_mean_level,
-                              double *out_mean_power);
+                              double *out_mean_power,
+                              uint16_t *out_block_max);
+
+// As iq_convert_fn, but for 8-bit magnitudes (--mag8), scaled 0..255 rather
+// than 0..65535. Only UC8 input has 8-bit converters.
+typedef void (*iq_convert8_fn)(void *iq_data,
+                               uint8_t *mag_data,
+                               unsigned nsamples,
+                               struct converter_state *state,
+                               double *out_mean_level,
+                               double *out_mean_power,
+                               uint16_t *out_block_max);
 
 iq_convert_fn init_converter(input_format_t format,
                              double sample_rate,
                              int filter_dc,
                              struct converter_state **out_state);
 
+iq_convert8_fn init_converter8(input_format_t format,
+                               double sample_rate,
+                               int filter_dc,
+                               struct converter_state **out_state);
+
+// As init_converter, but selects a specific implementation by its description
+// (e.g. "UC8, integer/table path") rather than the preferred one. Used by the
+// benchmarks to compare implementations of the same conversion.
+iq_convert_fn init_named_converter(input_format_t format,
+                                   const char *description,
+                                   double sample_rate,
+                                   int filter_dc,
+                                   struct converter_state **out_state);
+
+iq_convert8_fn init_named_converter8(input_format_t format,
+                                     const char *description,
+                                     double sample_rate,
+                                     int filter_dc,
+                                     struct converter_state **out_state);
+
+// Describes entry 'index' of the converter table, whether or not this CPU
+// can run it. *mag8 is set for 8-bit converters (init_named_converter8).
+// Returns false past the end of the table.
+bool converter_info(unsigned index,
+                    input_format_t *format,
+                    int *can_filter_dc,
+                    const char **description,
+                    kernel_t *kernel,
+                    int *mag8);
+
 void cleanup_converter(struct converter_state *state);
 
+// Fills in the per-block peak magnitudes for data that was converted in
+// pieces that don't line up with MODES_MAG_BLOCK_SAMPLES
+void compute_block_max(const uint16_t *mag_data, unsigned nsamples, uint16_t *out_block_max);
+
 #endif
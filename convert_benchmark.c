@@ -24,6 +24,7 @@ static void **testdata_uc8;
 static void **testdata_sc16;
 static void **testdata_sc16q11;
 static uint16_t *outdata;
+static uint16_t *outblockmax;
 
 // SC16Q11_TABLE_BITS notes:
 
@@ -56,6 +57,26 @@ static uint16_t *outdata;
 // SC16Q11_TABLE_BITS=8:          5.77M samples/second
 // SC16Q11_TABLE_BITS=7:         10.23M samples/second
 
+// The vector path has no table and full precision, so it doesn't depend on
+// SC16Q11_TABLE_BITS at all:
+
+// Xeon (AVX2)
+// SC16Q11_TABLE_BITS undefined: 178.04M samples/second
+// vector path (avx2):           780.45M samples/second
+
+// UC8 notes:
+
+// The integer/table path looks up each IQ pair in a 128kB table; the vector
+// path computes the magnitude directly and needs no table. The table wins
+// while it stays in cache, so it remains the preferred converter; the vector
+// path is there for CPUs with small caches, where the table thrashes.
+
+// Sample results for "UC8, no DC":
+
+// Xeon (AVX2, 2MB L2)
+// table:         1128.54M samples/second
+// vector (avx2):  537.33M samples/second
+
 void prepare()
 {
     srand(1);
@@ -63,17 +84,18 @@ void prepare()
     testdata_uc8 = calloc(10, sizeof(void*));
     testdata_sc16 = calloc(10, sizeof(void*));
     testdata_sc16q11 = calloc(10, sizeof(void*));
-    outdata = calloc(MODES_MAG_BUF_SAMPLES, sizeof(uint16_t));
+    outdata = calloc(MODES_DEFAULT_MAG_BUF_SAMPLES, sizeof(uint16_t));
+    outblockmax = calloc(MODES_DEFAULT_MAG_BUF_SAMPLES / MODES_MAG_BLOCK_SAMPLES, sizeof(uint16_t));
 
     for (int buf = 0; buf < 10; ++buf) {
-        uint8_t *uc8 = calloc(MODES_MAG_BUF_SAMPLES, 2);
+        uint8_t *uc8 = calloc(MODES_DEFAULT_MAG_BUF_SAMPLES, 2);
         testdata_uc8[buf] = uc8;;
-        uint16_t *sc16 = calloc(MODES_MAG_BUF_SAMPLES, 4);
+        uint16_t *sc16 = calloc(MODES_DEFAULT_MAG_BUF_SAMPLES, 4);
         testdata_sc16[buf] = sc16;
-        uint16_t *sc16q11 = calloc(MODES_MAG_BUF_SAMPLES, 4);
+        uint16_t *sc16q11 = calloc(MODES_DEFAULT_MAG_BUF_SAMPLES, 4);
         testdata_sc16q11[buf] = sc16q11;
 
-        for (unsigned i = 0; i < MODES_MAG_BUF_SAMPLES; ++i) {
+        for (unsigned i = 0; i < MODES_DEFAULT_MAG_BUF_SAMPLES; ++i) {
             double I = 2.0 * rand() / (RAND_MAX + 1.0) - 1.0;
             double Q = 2.0 * rand() / (RAND_MAX + 1.0) - 1.0;
 
@@ -89,21 +111,35 @@ void prepare()
     }
 }
 
-void test(const char *what, input_format_t format, void **data, double sample_rate, bool filter_dc) {
+// Returns the conversion rate in samples/second, or 0 if the converter isn't available
+// (with mag8, an 8-bit magnitude converter)
+double test(const char *what, input_format_t format, const char *impl, void **data, double sample_rate, bool filter_dc, bool mag8) {
     fprintf(stderr, "Benchmarking: %s ", what);
 
     struct converter_state *state;
-    iq_convert_fn converter = init_converter(format, sample_rate, filter_dc, &state);
-    if (!converter) {
+    iq_convert_fn converter = NULL;
+    iq_convert8_fn converter8 = NULL;
+    if (mag8 && impl)
+        converter8 = init_named_converter8(format, impl, sample_rate, filter_dc, &state);
+    else if (mag8)
+        converter8 = init_converter8(format, sample_rate, filter_dc, &state);
+    else if (impl)
+        converter = init_named_converter(format, impl, sample_rate, filter_dc, &state);
+    else
+        converter = init_converter(format, sample_rate, filter_dc, &state);
+    if (!converter && !converter8) {
         fprintf(stderr, "Can't initialize converter\n");
-        return;
+        return 0;
     }
 
     struct timespec total = { 0, 0 };
     int iterations = 0;
 
     // Run it once to force init.
-    converter(data[0], outdata, MODES_MAG_BUF_SAMPLES, state, NULL, NULL);
+    if (converter8)
+        converter8(data[0], (uint8_t *) outdata, MODES_DEFAULT_MAG_BUF_SAMPLES, state, NULL, NULL, outblockmax);
+    else
+        converter(data[0], outdata, MODES_DEFAULT_MAG_BUF_SAMPLES, state, NULL, NULL, outblockmax);
 
     while (total.tv_sec < 5) {
         fprintf(stderr, ".");
@@ -112,7 +148,10 @@ void test(const char *what, input_format_t format, void **data, double sample_ra
         start_cpu_timing(&start);
 
         for (int i = 0; i < 10; ++i) {
-            converter(data[i], outdata, MODES_MAG_BUF_SAMPLES, state, NULL, NULL);
+            if (converter8)
+                converter8(data[i], (uint8_t *) outdata, MODES_DEFAULT_MAG_BUF_SAMPLES, state, NULL, NULL, outblockmax);
+            else
+                converter(data[i], outdata, MODES_DEFAULT_MAG_BUF_SAMPLES, state, NULL, NULL, outblockmax);
         }
 
         end_cpu_timing(&start, &total);
@@ -122,12 +161,14 @@ void test(const char *what, input_format_t format, void **data, double sample_ra
     fprintf(stderr, "\n");
     free(state);
 
-    double samples = 10.0 * iterations * MODES_MAG_BUF_SAMPLES;
+    double samples = 10.0 * iterations * MODES_DEFAULT_MAG_BUF_SAMPLES;
     double nanos = total.tv_sec * 1e9 + total.tv_nsec;
     fprintf(stderr, "  %.2fM samples in %.6f seconds\n",
             samples / 1e6, nanos / 1e9);
     fprintf(stderr, "  %.2fM samples/second\n",
             samples / nanos * 1e3);
+
+    return samples / nanos * 1e9;
 }
 
 int main(int argc, char **argv)
@@ -135,14 +176,53 @@ int main(int argc, char **argv)
     MODES_NOTUSED(argc);
     MODES_NOTUSED(argv);
 
-    prepare();
-
-    test("SC16Q11, DC", INPUT_SC16Q11, testdata_sc16q11, 2400000, true);
-    test("SC16Q11, no DC", INPUT_SC16Q11, testdata_sc16q11, 2400000, false);
+    static const char *format_names[] = { "UC8", "SC16", "SC16Q11" };
+    void **testdata[3];
+    struct {
+        input_format_t format;
+        int filter_dc;
+        const char *description;
+        kernel_t kernel;
+        int mag8;
+        double rate;
+    } results[64];
+    unsigned nresults = 0;
 
-    test("UC8, DC", INPUT_UC8, testdata_uc8, 2400000, true);
-    test("UC8, no DC", INPUT_UC8, testdata_uc8, 2400000, false);
+    prepare();
+    testdata[INPUT_UC8] = testdata_uc8;
+    testdata[INPUT_SC16] = testdata_sc16;
+    testdata[INPUT_SC16Q11] = testdata_sc16q11;
+
+    // Every converter this CPU can run, with DC filtering on for those that can do it
+    for (unsigned i = 0; nresults < sizeof(results) / sizeof(results[0]); ++i) {
+        input_format_t format;
+        int filter_dc;
+        const char *description;
+        kernel_t kernel;
+        int mag8;
+
+        if (!converter_info(i, &format, &filter_dc, &description, &kernel, &mag8))
+            break;
+        if (!kernel_supported(kernel))
+            continue;
+
+        results[nresults].format = format;
+        results[nresults].filter_dc = filter_dc;
+        results[nresults].description = description;
+        results[nresults].kernel = kernel;
+        results[nresults].mag8 = mag8;
+        results[nresults].rate = test(description, format, description, testdata[format], 2400000, filter_dc, mag8);
+        ++nresults;
+    }
 
-    test("SC16, DC", INPUT_SC16, testdata_sc16, 2400000, true);
-    test("SC16, no DC", INPUT_SC16, testdata_sc16, 2400000, false);
+    fprintf(stderr, "\n%-8s %-4s %-3s %-7s %-36s %s\n", "Format", "Bits", "DC", "Kernel", "Converter", "M samples/second");
+    for (unsigned i = 0; i < nresults; ++i) {
+        fprintf(stderr, "%-8s %-4d %-3s %-7s %-36s %10.2f\n",
+                format_names[results[i].format],
+                results[i].mag8 ? 8 : 16,
+                results[i].filter_dc ? "yes" : "no",
+                kernel_name(results[i].kernel),
+                results[i].description,
+                results[i].rate / 1e6);
+    }
 }
@@ -20,6 +20,7 @@
 #include "dump1090.h"
 
 #include <assert.h>
+#include <sys/mman.h>
 
 // Errorinfo for "no errors"
 static struct errorinfo NO_ERRORS;
@@ -27,64 +28,259 @@ static struct errorinfo NO_ERRORS;
 // Generator polynomial for the Mode S CRC:
 #define MODES_GENERATOR_POLY 0xfff409U
 
-// CRC values for all single-byte messages;
-// used to speed up CRC calculation.
-static uint32_t crc_table[256];
+// The simplest possible implementation, to check the others against
+static inline uint32_t checksum_bytewise(const uint8_t *message, int n)
+{
+    uint32_t rem = 0;
+    int i;
 
-// Syndrome values for all single-bit errors;
-// used to speed up construction of error-
-// correction tables.
-static uint32_t single_bit_syndrome[112];
+    for (i = 0; i < n-3; ++i)
+        rem = modesChecksumStep(rem, message[i]);
+
+    return rem ^ (message[n-3] << 16) ^ (message[n-2] << 8) ^ (message[n-1]);
+}
 
-static void initLookupTables()
+// Slice-by-8: eight independent table lookups per eight message bytes,
+// then four, then single bytes for whatever is left over
+static inline uint32_t checksum_slice8(const uint8_t *message, int n)
 {
-    int i;
-    uint8_t msg[112/8];
-    
-    for (i = 0; i < 256; ++i) {
-        uint32_t c = i << 16;
-        int j;
-        for (j = 0; j < 8; ++j) {
-            if (c & 0x800000)
-                c = (c<<1) ^ MODES_GENERATOR_POLY;
-            else
-                c = (c<<1);
-        }
+    const uint8_t *p = message;
+    const uint8_t *end = message + n - 3;
+    uint32_t rem = 0;
+
+    for (; end - p >= 8; p += 8) {
+        uint64_t w = ((uint64_t) rem << 40) ^
+            ((uint64_t) p[0] << 56 | (uint64_t) p[1] << 48 | (uint64_t) p[2] << 40 | (uint64_t) p[3] << 32 |
+             (uint64_t) p[4] << 24 | (uint64_t) p[5] << 16 | (uint64_t) p[6] << 8 | p[7]);
 
-        crc_table[i] = c & 0x00ffffff;
+        rem = crc_table[7][w >> 56] ^ crc_table[6][(w >> 48) & 255] ^
+            crc_table[5][(w >> 40) & 255] ^ crc_table[4][(w >> 32) & 255] ^
+            crc_table[3][(w >> 24) & 255] ^ crc_table[2][(w >> 16) & 255] ^
+            crc_table[1][(w >> 8) & 255] ^ crc_table[0][w & 255];
     }
 
-    memset(msg, 0, sizeof(msg));
-    for (i = 0; i < 112; ++i) {
-        msg[i/8] ^= 1 << (7 - (i & 7));
-        single_bit_syndrome[i] = modesChecksum(msg, 112);
-        msg[i/8] ^= 1 << (7 - (i & 7));
+    if (end - p >= 4) {
+        rem = modesChecksumStep4(rem, p);
+        p += 4;
     }
+
+    for (; p < end; ++p)
+        rem = modesChecksumStep(rem, *p);
+
+    return rem ^ (p[0] << 16) ^ (p[1] << 8) ^ p[2];
 }
 
-uint32_t modesChecksum(uint8_t *message, int bits)
+static void checksum_batch_slice8(uint8_t *const *msgs, const int *bitlen, uint32_t *out, unsigned n)
 {
-    uint32_t rem = 0;
+    unsigned i;
+
+    for (i = 0; i < n; ++i)
+        out[i] = checksum_slice8(msgs[i], bitlen[i] / 8);
+}
+
+#ifdef KERNEL_HAVE_CLMUL
+// Carry-less multiply kernel. The checksum (after the final XOR of the
+// parity bytes) is just the whole message, as a polynomial, modulo the
+// generator G. A 112-bit message A*x^56 + B folds to A*(x^56 mod G) + B,
+// which is under 80 bits; a 56-bit message is already there. Barrett
+// reduction then gets the remainder with two more multiplies instead of
+// a loop over the bytes.
+static uint64_t crc_fold56;     // x^56 mod G
+static uint64_t crc_barrett;    // floor(x^80 / G), 57 bits
+
+#ifdef __x86_64__
+#include <wmmintrin.h>
+
+KERNEL_TARGET_CLMUL static inline uint64_t clmul(uint64_t a, uint64_t b, uint64_t *hi)
+{
+    __m128i r = _mm_clmulepi64_si128(_mm_cvtsi64_si128(a), _mm_cvtsi64_si128(b), 0x00);
+    *hi = _mm_cvtsi128_si64(_mm_unpackhi_epi64(r, r));
+    return _mm_cvtsi128_si64(r);
+}
+#else
+#include <arm_neon.h>
+
+static inline uint64_t clmul(uint64_t a, uint64_t b, uint64_t *hi)
+{
+    uint64x2_t r = vreinterpretq_u64_p128(vmull_p64(a, b));
+    *hi = vgetq_lane_u64(r, 1);
+    return vgetq_lane_u64(r, 0);
+}
+#endif
+
+static inline uint64_t load56(const uint8_t *p)
+{
+    return (uint64_t) p[0] << 48 | (uint64_t) p[1] << 40 | (uint64_t) p[2] << 32 |
+        (uint64_t) p[3] << 24 | (uint64_t) p[4] << 16 | (uint64_t) p[5] << 8 | p[6];
+}
+
+KERNEL_TARGET_CLMUL static inline uint32_t checksum_clmul(const uint8_t *message, int bits)
+{
+    uint64_t lo, hi, q, unused;
+
+    if (bits == 112) {
+        lo = clmul(load56(message), crc_fold56, &hi) ^ load56(message + 7);
+    } else {
+        lo = load56(message);
+        hi = 0;
+    }
+
+    // q = floor(floor(P / x^24) * floor(x^80 / G) / x^56) = floor(P / G)
+    q = clmul((lo >> 24) | (hi << 40), crc_barrett, &hi);
+    q = (q >> 56) | (hi << 8);
+
+    return (lo ^ clmul(q, MODES_GENERATOR_POLY | 0x1000000, &unused)) & 0xffffff;
+}
+
+KERNEL_TARGET_CLMUL static void checksum_batch_clmul(uint8_t *const *msgs, const int *bitlen, uint32_t *out, unsigned n)
+{
+    unsigned i;
+
+    for (i = 0; i < n; ++i) {
+        if (bitlen[i] == 56 || bitlen[i] == 112)
+            out[i] = checksum_clmul(msgs[i], bitlen[i]);
+        else
+            out[i] = checksum_slice8(msgs[i], bitlen[i] / 8);
+    }
+}
+
+static void initClmulConstants()
+{
+    uint32_t r = 0;
+    uint64_t q = 0;
     int i;
-    int n = bits/8;
+
+    // x^56 mod G is the CRC of a 1 followed by 56 zero bits
+    r = 1;
+    for (i = 0; i < 56; ++i) {
+        r <<= 1;
+        if (r & 0x1000000)
+            r ^= MODES_GENERATOR_POLY | 0x1000000;
+    }
+    crc_fold56 = r;
+
+    // Long division of x^80 by G, keeping the quotient
+    r = 0;
+    for (i = 80; i >= 0; --i) {
+        r = (r << 1) | (i == 80);
+        q <<= 1;
+        if (r & 0x1000000) {
+            r ^= MODES_GENERATOR_POLY | 0x1000000;
+            q |= 1;
+        }
+    }
+    crc_barrett = q;
+}
+#endif
+
+typedef void (*checksum_batch_fn)(uint8_t *const *msgs, const int *bitlen, uint32_t *out, unsigned n);
+
+// In order of preference
+static const struct {
+    kernel_t kernel;
+    checksum_batch_fn fn;
+} checksum_kernels[] = {
+#ifdef KERNEL_HAVE_CLMUL
+    { KERNEL_CLMUL, checksum_batch_clmul },
+#endif
+    { KERNEL_SCALAR, checksum_batch_slice8 }
+};
+
+#define NUM_CHECKSUM_KERNELS (sizeof(checksum_kernels) / sizeof(checksum_kernels[0]))
+
+static checksum_batch_fn checksum_batch = checksum_batch_slice8;
+
+static void selectChecksumKernel()
+{
+    kernel_t candidates[NUM_CHECKSUM_KERNELS];
+    unsigned i;
+    int chosen;
+
+#ifdef KERNEL_HAVE_CLMUL
+    initClmulConstants();
+#endif
+
+    for (i = 0; i < NUM_CHECKSUM_KERNELS; ++i)
+        candidates[i] = checksum_kernels[i].kernel;
+
+    chosen = kernel_select("CRC", candidates, NUM_CHECKSUM_KERNELS);
+    if (chosen >= 0)
+        checksum_batch = checksum_kernels[chosen].fn;
+}
+
+uint32_t modesChecksum(uint8_t *message, int bits)
+{
+    uint32_t rem;
 
     assert(bits % 8 == 0);
-    assert(n >= 3);
+    assert(bits/8 >= 3);
+
+    checksum_batch(&message, &bits, &rem, 1);
+    return rem;
+}
+
+void modesChecksumBatch(uint8_t *const *msgs, const int *bitlen, uint32_t *out, unsigned n)
+{
+#ifndef NDEBUG
+    unsigned i;
 
-    for (i = 0; i < n-3; ++i) {
-        rem = (rem << 8) ^ crc_table[message[i] ^ ((rem & 0xff0000) >> 16)];
-        rem = rem & 0xffffff;
+    for (i = 0; i < n; ++i) {
+        assert(bitlen[i] % 8 == 0);
+        assert(bitlen[i]/8 >= 3);
     }
+#endif
 
-    rem = rem ^ (message[n-3] << 16) ^ (message[n-2] << 8) ^ (message[n-1]);
-    return rem;
+    checksum_batch(msgs, bitlen, out, n);
+}
+
+// An error table as an open-addressed hash table keyed on the syndrome:
+// each entry sits in the first free slot at or after syndrome_slot(). Empty
+// slots have syndrome 0, which never needs looking up (it means no errors).
+// At most half the slots are used, so a lookup, hit or miss, usually
+// touches a single cache line.
+struct syndrome_hash {
+    struct errorinfo *slots;
+    uint32_t mask;              // number of slots - 1
+    unsigned shift;             // 32 - log2(number of slots)
+};
+
+static struct syndrome_hash errorHash_short;
+static struct syndrome_hash errorHash_long;
+
+static inline uint32_t syndrome_slot(const struct syndrome_hash *hash, uint32_t syndrome)
+{
+    // syndromes of few-bit errors are linear combinations of each other, so
+    // spread them with a multiplicative hash rather than using the low bits
+    return (syndrome * 0x9E3779B1U) >> hash->shift;
+}
+
+static inline struct errorinfo *syndrome_hash_find(const struct syndrome_hash *hash, uint32_t syndrome)
+{
+    uint32_t i;
+
+    if (!hash->slots)
+        return NULL;
+
+    for (i = syndrome_slot(hash, syndrome); ; i = (i + 1) & hash->mask) {
+        struct errorinfo *entry = &hash->slots[i];
+        if (entry->syndrome == syndrome)
+            return entry;
+        if (entry->syndrome == 0)
+            return NULL;
+    }
 }
 
-static struct errorinfo *bitErrorTable_short;
-static int bitErrorTableSize_short;
+static void setHashSlots(struct syndrome_hash *hash, struct errorinfo *slots, uint32_t count)
+{
+    unsigned bits = 0;
+
+    while ((1U << bits) < count)
+        ++bits;
 
-static struct errorinfo *bitErrorTable_long;
-static int bitErrorTableSize_long;
+    hash->slots = slots;
+    hash->mask = count - 1;
+    hash->shift = 32 - bits;
+}
 
 // compare two errorinfo structures
 static int syndrome_compare(const void *x, const void *y) {
@@ -138,7 +334,7 @@ static int prepareSubtable(struct errorinfo *table, int n, int maxsize, int offs
         assert(n < maxsize);
 
         table[n] = *base_entry;
-        table[n].syndrome ^= single_bit_syndrome[i + offset];
+        table[n].syndrome ^= crc_single_bit_syndrome[i + offset];
         table[n].errors = error_bit+1;
         table[n].bit[error_bit] = i;
         
@@ -160,7 +356,7 @@ static int flagCollisions(struct errorinfo *table, int tablesize, int offset, in
     for (i = startbit; i < endbit; ++i) {
         struct errorinfo ei;
 
-        ei.syndrome = base_syndrome ^ single_bit_syndrome[i + offset];
+        ei.syndrome = base_syndrome ^ crc_single_bit_syndrome[i + offset];
 
         if (error_bit >= first_error) {
             struct errorinfo *collision = bsearch(&ei, table, tablesize, sizeof(struct errorinfo), syndrome_compare);
@@ -352,33 +548,216 @@ static struct errorinfo *prepareErrorTable(int bits, int max_correct, int max_de
     return table;
 }
 
+// Builds a hash over the entries of an error table, which must have
+// distinct syndromes. Returns false if out of memory.
+static bool buildSyndromeHash(struct syndrome_hash *hash, const struct errorinfo *table, int tablesize)
+{
+    unsigned bits = 4;
+    int i;
+
+    while ((1U << bits) < 2U * tablesize)
+        ++bits;
+
+    setHashSlots(hash, calloc(1U << bits, sizeof(struct errorinfo)), 1U << bits);
+    if (!hash->slots)
+        return false;
+
+    for (i = 0; i < tablesize; ++i) {
+        uint32_t j;
+
+        if (table[i].syndrome == 0)
+            continue;       // an undetectable error; nothing to correct
+
+        for (j = syndrome_slot(hash, table[i].syndrome); hash->slots[j].syndrome != 0; j = (j + 1) & hash->mask)
+            ;
+        hash->slots[j] = table[i];
+    }
+
+    return true;
+}
+
+// Builds the hash for one message length, and throws away the table
+static void prepareErrorHash(struct syndrome_hash *hash, int bits, int max_correct, int max_detect)
+{
+    struct errorinfo *table;
+    int tablesize;
+
+    hash->slots = NULL;
+    table = prepareErrorTable(bits, max_correct, max_detect, &tablesize);
+    if (table && !buildSyndromeHash(hash, table, tablesize))
+        fprintf(stderr, "Out of memory building the %d-bit error correction table; not correcting those\n", bits);
+    free(table);
+}
+
+// The error tables can be kept in a cache file (--error-table-cache), which
+// later starts map read-only instead of building the tables again; several
+// dump1090 processes mapping the same file share the pages. The file is a
+// header followed by the short and long hash slots, in native byte order.
+#define ERROR_CACHE_MAGIC "D1090ERR"
+#define ERROR_CACHE_VERSION 1          // bump whenever the table contents or layout change
+
+struct error_cache_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;               // 0x01020304, as written
+    uint32_t generator;                // MODES_GENERATOR_POLY
+    uint32_t fix_bits;                 // modesChecksumInit() argument the tables were built for
+    uint32_t entry_size;               // sizeof(struct errorinfo)
+    uint32_t short_slots;
+    uint32_t long_slots;
+    uint32_t short_checksum;           // modesChecksum-style CRC of the short slots
+    uint32_t long_checksum;            // and of the long slots
+};
+
+static struct {
+    void *map;                         // the mapped cache file the hash slots point into, or NULL
+    size_t size;
+} errorCache;
+
+static bool valid_slot_count(uint32_t slots)
+{
+    return slots >= 16 && !(slots & (slots - 1));
+}
+
+static uint32_t slots_checksum(const struct errorinfo *slots, uint32_t count)
+{
+    return checksum_slice8((const uint8_t *) slots, count * sizeof(struct errorinfo));
+}
+
+// Maps the error tables from a cache file. Returns false if there is no
+// usable cache for these settings.
+static bool loadErrorCache(const char *path, int fixBits)
+{
+    const struct error_cache_header *header;
+    struct errorinfo *slots;
+    struct stat st;
+    void *map;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) < 0) {
+        if (errno != ENOENT)
+            fprintf(stderr, "Can't open error table cache %s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    if (fstat(fd, &st) < 0 || (size_t) st.st_size < sizeof(*header)) {
+        close(fd);
+        fprintf(stderr, "Error table cache %s is not usable, rebuilding it\n", path);
+        return false;
+    }
+
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        fprintf(stderr, "Can't map error table cache %s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    header = map;
+    slots = (struct errorinfo *) (header + 1);
+    if (memcmp(header->magic, ERROR_CACHE_MAGIC, sizeof(header->magic)) ||
+        header->version != ERROR_CACHE_VERSION ||
+        header->byte_order != 0x01020304 ||
+        header->generator != MODES_GENERATOR_POLY ||
+        header->fix_bits != (uint32_t) fixBits ||
+        header->entry_size != sizeof(struct errorinfo) ||
+        !valid_slot_count(header->short_slots) ||
+        !valid_slot_count(header->long_slots) ||
+        (size_t) st.st_size != sizeof(*header) + ((size_t) header->short_slots + header->long_slots) * sizeof(struct errorinfo) ||
+        slots_checksum(slots, header->short_slots) != header->short_checksum ||
+        slots_checksum(slots + header->short_slots, header->long_slots) != header->long_checksum) {
+        munmap(map, st.st_size);
+        fprintf(stderr, "Error table cache %s is stale or damaged, rebuilding it\n", path);
+        return false;
+    }
+
+    setHashSlots(&errorHash_short, slots, header->short_slots);
+    setHashSlots(&errorHash_long, slots + header->short_slots, header->long_slots);
+    errorCache.map = map;
+    errorCache.size = st.st_size;
+    return true;
+}
+
+// Writes the current error tables to a cache file, replacing it atomically
+static void saveErrorCache(const char *path, int fixBits)
+{
+    char tmppath[PATH_MAX];
+    struct error_cache_header header;
+    size_t short_size, long_size;
+    mode_t mask;
+    int fd;
+
+    if (!errorHash_short.slots || !errorHash_long.slots)
+        return;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ERROR_CACHE_MAGIC, sizeof(header.magic));
+    header.version = ERROR_CACHE_VERSION;
+    header.byte_order = 0x01020304;
+    header.generator = MODES_GENERATOR_POLY;
+    header.fix_bits = fixBits;
+    header.entry_size = sizeof(struct errorinfo);
+    header.short_slots = errorHash_short.mask + 1;
+    header.long_slots = errorHash_long.mask + 1;
+    header.short_checksum = slots_checksum(errorHash_short.slots, header.short_slots);
+    header.long_checksum = slots_checksum(errorHash_long.slots, header.long_slots);
+
+    short_size = header.short_slots * sizeof(struct errorinfo);
+    long_size = header.long_slots * sizeof(struct errorinfo);
+
+    snprintf(tmppath, PATH_MAX, "%s.XXXXXX", path);
+    tmppath[PATH_MAX-1] = 0;
+    if ((fd = mkstemp(tmppath)) < 0) {
+        fprintf(stderr, "Can't write error table cache %s: %s\n", path, strerror(errno));
+        return;
+    }
+
+    mask = umask(0);
+    umask(mask);
+    fchmod(fd, 0644 & ~mask);
+
+    if (write(fd, &header, sizeof(header)) != sizeof(header) ||
+        write(fd, errorHash_short.slots, short_size) != (ssize_t) short_size ||
+        write(fd, errorHash_long.slots, long_size) != (ssize_t) long_size ||
+        close(fd) < 0 ||
+        rename(tmppath, path) < 0) {
+        fprintf(stderr, "Can't write error table cache %s: %s\n", path, strerror(errno));
+        unlink(tmppath);
+    }
+}
+
 // Precompute syndrome tables for 56- and 112-bit messages.
 void modesChecksumInit(int fixBits)
 {
-    initLookupTables();
+    selectChecksumKernel();
+
+    if (fixBits > 0 && Modes.error_table_cache && loadErrorCache(Modes.error_table_cache, fixBits))
+        return;
 
     switch (fixBits) {
     case 0:
-        bitErrorTable_short = bitErrorTable_long = NULL;
-        bitErrorTableSize_short = bitErrorTableSize_long = 0;
+        errorHash_short.slots = errorHash_long.slots = NULL;
         break;
 
     case 1:
         // For 1 bit correction, we have 100% coverage up to 4 bit detection, so don't bother
         // with flagging collisions there.
-        bitErrorTable_short = prepareErrorTable(MODES_SHORT_MSG_BITS, 1, 1, &bitErrorTableSize_short);
-        bitErrorTable_long = prepareErrorTable(MODES_LONG_MSG_BITS, 1, 1, &bitErrorTableSize_long);
+        prepareErrorHash(&errorHash_short, MODES_SHORT_MSG_BITS, 1, 1);
+        prepareErrorHash(&errorHash_long, MODES_LONG_MSG_BITS, 1, 1);
         break;
 
     default:
         // Detect out to 4 bit errors; this reduces our 2-bit coverage to about 65%.
         // This can take a little while - tell the user.
         fprintf(stderr, "Preparing error correction tables.. ");
-        bitErrorTable_short = prepareErrorTable(MODES_SHORT_MSG_BITS, 2, 4, &bitErrorTableSize_short);
-        bitErrorTable_long = prepareErrorTable(MODES_LONG_MSG_BITS, 2, 4, &bitErrorTableSize_long);
+        prepareErrorHash(&errorHash_short, MODES_SHORT_MSG_BITS, 2, 4);
+        prepareErrorHash(&errorHash_long, MODES_LONG_MSG_BITS, 2, 4);
         fprintf(stderr, "done.\n");
         break;
     }
+
+    if (fixBits > 0 && Modes.error_table_cache)
+        saveErrorCache(Modes.error_table_cache, fixBits);
 }
 
 // Given an error syndrome and message length, return
@@ -386,23 +765,11 @@ void modesChecksumInit(int fixBits)
 // syndrome is uncorrectable
 struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen)
 {
-    struct errorinfo *table;
-    int tablesize;
-
-    struct errorinfo ei;
-
     if (syndrome == 0)
         return &NO_ERRORS;
 
     assert (bitlen == 56 || bitlen == 112);
-    if (bitlen == 56) { table = bitErrorTable_short; tablesize = bitErrorTableSize_short; }
-    else { table = bitErrorTable_long; tablesize = bitErrorTableSize_long; }
-
-    if (!table)
-        return NULL;
-
-    ei.syndrome = syndrome;
-    return bsearch(&ei, table, tablesize, sizeof(struct errorinfo), syndrome_compare);
+    return syndrome_hash_find(bitlen == 56 ? &errorHash_short : &errorHash_long, syndrome);
 }
 
 // Given a message and an error-correction descriptor,
@@ -418,16 +785,28 @@ void modesChecksumFix(uint8_t *msg, struct errorinfo *info)
         msg[info->bit[i] >> 3] ^= 1 << (7 - (info->bit[i] & 7));
 }
 
+// Return the syndrome of a single-bit error at the given
+// bit of a message of length bitlen
+uint32_t modesChecksumBitSyndrome(int bit, int bitlen)
+{
+    return crc_single_bit_syndrome[bit + 112 - bitlen];
+}
+
 /* 
  * Clean CRC LUTs on exit.
  * 
  */
 void crcCleanupTables(void) {
-    if(bitErrorTable_short != NULL)
-        free(bitErrorTable_short);
+    if (errorCache.map) {
+        munmap(errorCache.map, errorCache.size);
+        errorCache.map = NULL;
+    } else {
+        free(errorHash_short.slots);
+        free(errorHash_long.slots);
+    }
 
-    if(bitErrorTable_long != NULL)
-        free(bitErrorTable_long);
+    errorHash_short.slots = NULL;
+    errorHash_long.slots = NULL;
 }
 
 #ifdef CRCDEBUG
@@ -442,7 +821,42 @@ int main(int argc, char **argv)
         return 1;
     }
 
-    initLookupTables();
+#ifdef KERNEL_HAVE_CLMUL
+    initClmulConstants();
+#endif
+
+    // every kernel must agree with the bytewise CRC, for the lengths
+    // they special-case and for a few they don't
+    fprintf(stderr, "checking CRC kernels..\n");
+    srand(1);
+    for (i = 0; i < 100000; ++i) {
+        static const int lengths[] = { 56, 112, 24, 64, 88, 120 };
+        uint8_t msg[120/8];
+        uint8_t *msgs[1] = { msg };
+        int bits = lengths[i % 6];
+        uint32_t expected, got;
+        unsigned j, k;
+
+        for (j = 0; j < sizeof(msg); ++j)
+            msg[j] = rand();
+
+        expected = checksum_bytewise(msg, bits/8);
+        for (k = 0; k < NUM_CHECKSUM_KERNELS; ++k) {
+            if (!kernel_supported(checksum_kernels[k].kernel))
+                continue;
+            checksum_kernels[k].fn(msgs, &bits, &got, 1);
+            if (got != expected) {
+                fprintf(stderr, "%s CRC kernel: %d-bit message gave %06X, expected %06X\n",
+                        kernel_name(checksum_kernels[k].kernel), bits, got, expected);
+                return 1;
+            }
+        }
+    }
+    for (i = 0; i < (int) NUM_CHECKSUM_KERNELS; ++i) {
+        if (kernel_supported(checksum_kernels[i].kernel))
+            fprintf(stderr, "PASS: %s CRC kernel\n", kernel_name(checksum_kernels[i].kernel));
+    }
+
     shorttable = prepareErrorTable(MODES_SHORT_MSG_BITS, atoi(argv[1]), atoi(argv[2]), &shortlen);
     longtable = prepareErrorTable(MODES_LONG_MSG_BITS, atoi(argv[1]), atoi(argv[2]), &longlen);
 
@@ -559,6 +973,33 @@ int main(int argc, char **argv)
         }
     }
 
+    // the hashes must find exactly the syndromes in the tables
+    fprintf(stderr, "checking syndrome hashes..\n");
+    if (!buildSyndromeHash(&errorHash_short, shorttable, shortlen) || !buildSyndromeHash(&errorHash_long, longtable, longlen)) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (i = 1; i < 0x1000000; ++i) {
+        struct errorinfo key, *expected, *got;
+
+        key.syndrome = i;
+        expected = bsearch(&key, shorttable, shortlen, sizeof(struct errorinfo), syndrome_compare);
+        got = modesChecksumDiagnose(i, MODES_SHORT_MSG_BITS);
+        if (!expected != !got || (got && memcmp(expected, got, sizeof(*got)))) {
+            fprintf(stderr, "56-bit syndrome %06X: hash lookup disagrees with the table\n", i);
+            return 1;
+        }
+
+        expected = bsearch(&key, longtable, longlen, sizeof(struct errorinfo), syndrome_compare);
+        got = modesChecksumDiagnose(i, MODES_LONG_MSG_BITS);
+        if (!expected != !got || (got && memcmp(expected, got, sizeof(*got)))) {
+            fprintf(stderr, "112-bit syndrome %06X: hash lookup disagrees with the table\n", i);
+            return 1;
+        }
+    }
+    fprintf(stderr, "PASS: syndrome hashes (correct %s, detect %s)\n", argv[1], argv[2]);
+    crcCleanupTables();
+
     free(shorttable);
     free(longtable);
 
@@ -22,6 +22,8 @@
 
 #include <stdint.h>
 
+#include "tables.h"
+
 // Global max for fixable bit erros
 #define MODES_MAX_BITERRORS 2
 
@@ -32,10 +34,31 @@ struct errorinfo {
     uint16_t padding;
 };
 
+// Fold one more message byte into a running CRC remainder (start from 0).
+// After feeding all but the last 3 bytes of a message, XORing the remainder
+// with those last 3 bytes gives the same result as modesChecksum().
+static inline uint32_t modesChecksumStep(uint32_t rem, uint8_t byte)
+{
+    return ((rem << 8) ^ crc_table[0][byte ^ (rem >> 16)]) & 0xffffff;
+}
+
+// As four calls to modesChecksumStep(), but the four table lookups don't
+// depend on each other
+static inline uint32_t modesChecksumStep4(uint32_t rem, const uint8_t *bytes)
+{
+    uint32_t w = (rem << 8) ^ ((uint32_t) bytes[0] << 24 | (uint32_t) bytes[1] << 16 | (uint32_t) bytes[2] << 8 | bytes[3]);
+
+    return crc_table[3][w >> 24] ^ crc_table[2][(w >> 16) & 255] ^ crc_table[1][(w >> 8) & 255] ^ crc_table[0][w & 255];
+}
+
 void modesChecksumInit(int fixBits);
 uint32_t modesChecksum(uint8_t *msg, int bitlen);
+// modesChecksum() of n messages at once: out[i] = modesChecksum(msgs[i], bitlen[i]).
+// Independent messages keep more of the CPU busy than one at a time.
+void modesChecksumBatch(uint8_t *const *msgs, const int *bitlen, uint32_t *out, unsigned n);
 struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen);
 void modesChecksumFix(uint8_t *msg, struct errorinfo *info);
+uint32_t modesChecksumBitSyndrome(int bit, int bitlen);
 void crcCleanupTables(void);
 
 #endif
@@ -0,0 +1,730 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// demod_2000.c: 2.0MHz Mode S demodulator.
+//
+// Copyright (c) 2014,2015 Oliver Jowett <oliver@mutability.co.uk>
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <assert.h>
+
+// This file is built twice: as is, for 16-bit magnitudes, and with DEMOD_MAG8
+// for the 8-bit magnitudes of --mag8 (see mag_t), where the public functions
+// have a Mag8 suffix.
+#ifdef DEMOD_MAG8
+#define demodulate2000Init demodulate2000Mag8Init
+#define demodulate2000 demodulate2000Mag8
+#define demodulate2000AC demodulate2000Mag8AC
+#define SCAN_STAGE "2.0MHz 8-bit preamble scan"
+#else
+#define SCAN_STAGE "2.0MHz preamble scan"
+#endif
+
+// 2.0MHz sampling rate version
+//
+// When sampling at 2.0MHz we have exactly 1 sample per symbol.
+// Each symbol is 500ns wide, and so is each sample; a 12MHz clock tick is 1/6 of a sample.
+//
+// A manchester encoded bit is a pair of samples, 1-0 for a 1 bit and 0-1 for a 0 bit,
+// and the whole message shares the phase offset of the preamble, so there is no phase
+// to track through the message. That offset is at most half a sample either way
+// (otherwise the preamble would have matched one sample earlier or later), but as it
+// gets close to half a sample each symbol is spread over two samples, and a simple
+// comparison of the two samples of a bit stops working; see slice_message_sequence().
+//
+// The preamble pulses are at 0, 1.0, 3.5 and 4.5us, i.e. samples 0, 2, 7 and 9,
+// and the data starts at 8us, sample 16.
+
+// Number of bytes to demodulate for a message starting with the given first byte,
+// or 1 if the DF is not one we can use and we should give up immediately.
+static inline int slice_message_bytes(uint8_t first_byte)
+{
+    switch (first_byte >> 3) {
+    case 0: case 4: case 5: case 11:
+        return MODES_SHORT_MSG_BYTES;
+
+    case 16: case 17: case 18: case 20: case 21: case 24:
+        return MODES_LONG_MSG_BYTES;
+
+    default:
+        return 1; // unknown DF
+    }
+}
+
+// Slice the 8 bits (16 samples) starting at m[0]
+static inline __attribute__((always_inline)) uint8_t slice_byte(mag_t *m)
+{
+    uint8_t byte = 0;
+    int i;
+
+    for (i = 0; i < 8; ++i)
+        byte = (byte << 1) | (m[2*i] > m[2*i+1]);
+
+    return byte;
+}
+
+// Demodulate a message whose data starts at m (sample 16 after the preamble start)
+// by comparing the two samples of each bit. Returns the number of bytes demodulated
+// into msg (1, 7 or 14); for 7 or 14 bytes, *crc_out is the message CRC.
+//
+// If the DF in the first byte cannot score better than min_score, give up
+// after the first byte.
+static int slice_message(mag_t *m, unsigned char *msg, int min_score, uint32_t *crc_out)
+{
+    int bytelen, i;
+    uint32_t rem;
+
+    msg[0] = slice_byte(m);
+    bytelen = slice_message_bytes(msg[0]);
+    if (bytelen == 1 || scoreModesMessageMax(msg[0] >> 3) <= min_score)
+        return 1;
+
+    for (i = 1; i < bytelen; ++i)
+        msg[i] = slice_byte(m + 16*i);
+
+    rem = 0;
+    for (i = 0; i + 4 <= bytelen - 3; i += 4)
+        rem = modesChecksumStep4(rem, msg + i);
+    for (; i < bytelen - 3; ++i)
+        rem = modesChecksumStep(rem, msg[i]);
+
+    *crc_out = rem ^ (msg[bytelen-3] << 16) ^ (msg[bytelen-2] << 8) ^ msg[bytelen-1];
+    return bytelen;
+}
+
+// Demodulate a message whose data starts at m, when it is 'phase' 12MHz ticks
+// late (or early, if negative) relative to our samples, and the pulse level
+// is 'level'. Returns the number of bytes demodulated as for slice_message().
+//
+// Near half a sample out, the two samples of a bit are often about equal and
+// comparing them says little. Instead, every sample is modelled as a mix of two
+// adjacent symbols: a symbol that is t ticks late puts (6-t)/6 of its level in
+// its own sample and t/6 in the next one. The most likely bit sequence under
+// that model is found with a two-state Viterbi search, where the state is the
+// last symbol of the previous bit (a 1 bit ends in 0, a 0 bit ends in 1).
+static int slice_message_sequence(mag_t *m, int phase, int level, unsigned char *msg, uint32_t *crc_out)
+{
+    unsigned char from[MODES_LONG_MSG_BITS][2]; // best previous state, per bit and state
+    int metric[2], short_metric[2] = { 0, 0 };
+    int i, state, bytelen;
+
+    if (phase < 0) {
+        // early by t ticks is late by 6-t ticks relative to the previous sample
+        --m;
+        phase += 6;
+    }
+
+    // The last preamble symbol is quiet. Metrics are summed absolute errors
+    // (scaled by 6) and stay well within an int for 224 samples.
+    metric[0] = 0;
+    metric[1] = 1 << 28;
+    for (i = 0; i < MODES_LONG_MSG_BITS; ++i) {
+        int first = 6 * m[2*i], second = 6 * m[2*i+1];
+        int next[2];
+        int bit;
+
+        for (bit = 0; bit < 2; ++bit) {
+            // symbols of this bit are (bit, !bit); the new state is !bit
+            int second_expect = ((6 - phase) * !bit + phase * bit) * level;
+            int cost0 = metric[0] + abs(first - (6 - phase) * bit * level) + abs(second - second_expect);
+            int cost1 = metric[1] + abs(first - ((6 - phase) * bit + phase) * level) + abs(second - second_expect);
+
+            if (cost1 < cost0) {
+                next[!bit] = cost1;
+                from[i][!bit] = 1;
+            } else {
+                next[!bit] = cost0;
+                from[i][!bit] = 0;
+            }
+        }
+
+        metric[0] = next[0];
+        metric[1] = next[1];
+        if (i == MODES_SHORT_MSG_BITS - 1) {
+            short_metric[0] = metric[0];
+            short_metric[1] = metric[1];
+        }
+    }
+
+    // Trace back from the end of a short message first, to find the DF,
+    // then again from the end of a long message if it was a long DF.
+    bytelen = MODES_SHORT_MSG_BYTES;
+    state = (short_metric[1] < short_metric[0]);
+    for (;;) {
+        memset(msg, 0, bytelen);
+        for (i = bytelen * 8 - 1; i >= 0; --i) {
+            if (!state)
+                msg[i/8] |= 0x80 >> (i%8);
+            state = from[i][state];
+        }
+
+        if (slice_message_bytes(msg[0]) != MODES_LONG_MSG_BYTES || bytelen == MODES_LONG_MSG_BYTES)
+            break;
+        bytelen = MODES_LONG_MSG_BYTES;
+        state = (metric[1] < metric[0]);
+    }
+
+    if (slice_message_bytes(msg[0]) != bytelen)
+        return 1;
+
+    *crc_out = modesChecksum(msg, bytelen * 8);
+    return bytelen;
+}
+
+// The shape tests of check_preamble(), which only compare samples with each
+// other: either the plain pulse pattern or the split pattern. P(k) is sample k
+// after the preamble start.
+#define PREAMBLE_SHAPE(P)                                                         \
+    (((P(0) > P(1)) & (P(1) < P(2)) & (P(2) > P(3)) & (P(3) < P(0)) &           \
+      (P(4) < P(0)) & (P(5) < P(0)) & (P(6) < P(0)) &                           \
+      (P(7) > P(8)) & (P(8) < P(9)) & (P(9) > P(6))) |                          \
+     ((P(0) > P(4)) & (P(1) > P(5)) & (P(2) > P(4)) & (P(3) > P(5)) &           \
+      (P(7) > P(6)) & (P(8) > P(11)) & (P(9) > P(12)) & (P(10) > P(13))))
+
+// Returns the first offset in [j, end) that passes the preamble shape tests, or end.
+// There are scalar and vector kernels for this; demodulate2000Init() picks one.
+typedef uint32_t (*next_preamble_fn)(const mag_t *m, uint32_t j, uint32_t end);
+
+#define SCAN_P(k) p[k]
+
+static uint32_t next_preamble_scalar(const mag_t *m, uint32_t j, uint32_t end)
+{
+    for (; j < end; ++j) {
+        const mag_t *p = &m[j];
+        if (PREAMBLE_SHAPE(SCAN_P))
+            return j;
+    }
+
+    return end;
+}
+
+#undef SCAN_P
+
+#if defined(__GNUC__) && !defined(DEMOD_NO_VECTOR)
+
+// GCC/clang vector extensions, as for the 2.4MHz preamble scan
+#define SCAN_LANES (16 / sizeof(mag_t))
+typedef mag_t scan_vec __attribute__((vector_size(16)));
+
+#define SCAN_LOAD(v, p) memcpy(&(v), (p), sizeof(scan_vec))
+#define SCAN_P(k) p##k
+
+static inline __attribute__((always_inline)) uint32_t next_preamble_vec_common(const mag_t *m, uint32_t j, uint32_t end)
+{
+    for (; j < end; j += SCAN_LANES) {
+        const mag_t *p = &m[j];
+        scan_vec p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13;
+        unsigned k;
+
+        SCAN_LOAD(p0, p+0);   SCAN_LOAD(p1, p+1);   SCAN_LOAD(p2, p+2);   SCAN_LOAD(p3, p+3);
+        SCAN_LOAD(p4, p+4);   SCAN_LOAD(p5, p+5);   SCAN_LOAD(p6, p+6);   SCAN_LOAD(p7, p+7);
+        SCAN_LOAD(p8, p+8);   SCAN_LOAD(p9, p+9);   SCAN_LOAD(p10, p+10); SCAN_LOAD(p11, p+11);
+        SCAN_LOAD(p12, p+12); SCAN_LOAD(p13, p+13);
+
+        scan_vec shape = (scan_vec) PREAMBLE_SHAPE(SCAN_P);
+
+        uint64_t any[sizeof(scan_vec) / sizeof(uint64_t)];
+        memcpy(any, &shape, sizeof(any));
+        if (!(any[0] | any[1]))
+            continue;
+
+        for (k = 0; k < SCAN_LANES; ++k) {
+            if (shape[k])
+                return (j + k < end ? j + k : end);
+        }
+    }
+
+    return end;
+}
+
+#undef SCAN_P
+#undef SCAN_LOAD
+
+#define NEXT_PREAMBLE_KERNEL(name, target)                              \
+    target static uint32_t name(const mag_t *m, uint32_t j, uint32_t end) \
+    {                                                                   \
+        return next_preamble_vec_common(m, j, end);                     \
+    }
+
+NEXT_PREAMBLE_KERNEL(next_preamble_vec, )
+#if defined(KERNEL_HAVE_AVX2)
+NEXT_PREAMBLE_KERNEL(next_preamble_avx2, KERNEL_TARGET_AVX2)
+#endif
+#if defined(KERNEL_HAVE_NEON)
+NEXT_PREAMBLE_KERNEL(next_preamble_neon, KERNEL_TARGET_NEON)
+#endif
+
+#endif /* vector */
+
+static const struct {
+    kernel_t kernel;
+    next_preamble_fn fn;
+} next_preamble_kernels[] = {
+    // In order of preference
+#if defined(__GNUC__) && !defined(DEMOD_NO_VECTOR)
+#if defined(KERNEL_HAVE_AVX2)
+    { KERNEL_AVX2, next_preamble_avx2 },
+#endif
+#if defined(KERNEL_HAVE_NEON)
+    { KERNEL_NEON, next_preamble_neon },
+#endif
+    { KERNEL_VECTOR, next_preamble_vec },
+#endif
+    { KERNEL_SCALAR, next_preamble_scalar }
+};
+
+#define NUM_NEXT_PREAMBLE_KERNELS (sizeof(next_preamble_kernels) / sizeof(next_preamble_kernels[0]))
+
+static next_preamble_fn next_preamble = next_preamble_scalar;
+
+void demodulate2000Init(void)
+{
+    kernel_t candidates[NUM_NEXT_PREAMBLE_KERNELS];
+    unsigned i;
+    int chosen;
+
+    for (i = 0; i < NUM_NEXT_PREAMBLE_KERNELS; ++i)
+        candidates[i] = next_preamble_kernels[i].kernel;
+
+    chosen = kernel_select(SCAN_STAGE, candidates, NUM_NEXT_PREAMBLE_KERNELS);
+    if (chosen >= 0)
+        next_preamble = next_preamble_kernels[chosen].fn;
+}
+
+// Check for a Mode S preamble starting at p[0]. Returns the level of the
+// preamble pulses, or 0 if this doesn't look like a preamble.
+static inline int check_preamble(mag_t *p)
+{
+    unsigned high;
+
+    // pulses in 0, 2, 7, 9; at least a dip between them
+    if (p[0] > p[1] && p[1] < p[2] && p[2] > p[3] && p[3] < p[0] &&
+        p[4] < p[0] && p[5] < p[0] && p[6] < p[0] &&
+        p[7] > p[8] && p[8] < p[9] && p[9] > p[6]) {
+        // The quiet samples away from the pulses (which don't see any leakage
+        // whatever the phase) must be below 2/3 of the mean pulse level
+        high = (p[0] + p[2] + p[7] + p[9]) / 6;
+        if (p[4] >= high || p[5] >= high)
+            return 0;
+        if (p[11] >= high || p[12] >= high || p[13] >= high || p[14] >= high)
+            return 0;
+
+        return (p[0] + p[2] + p[7] + p[9]) / 4;
+    }
+
+    // About half a sample out, each pulse is split evenly over two samples
+    // (0-1, 2-3, 7-8, 9-10) and the dips above are not there; the quiet
+    // samples must then be below 2/3 of the lowest pulse sample
+    if (p[0] > p[4] && p[1] > p[5] && p[2] > p[4] && p[3] > p[5] &&
+        p[7] > p[6] && p[8] > p[11] && p[9] > p[12] && p[10] > p[13]) {
+        unsigned low = p[0];
+
+        if (p[1] < low) low = p[1];
+        if (p[2] < low) low = p[2];
+        if (p[3] < low) low = p[3];
+        if (p[7] < low) low = p[7];
+        if (p[8] < low) low = p[8];
+        if (p[9] < low) low = p[9];
+        if (p[10] < low) low = p[10];
+
+        high = low * 2 / 3;
+        if (p[4] >= high || p[5] >= high || p[6] >= high)
+            return 0;
+        if (p[11] >= high || p[12] >= high || p[13] >= high || p[14] >= high)
+            return 0;
+
+        return (p[0] + p[1] + p[2] + p[3] + p[7] + p[8] + p[9] + p[10]) / 4;
+    }
+
+    return 0;
+}
+
+// Estimate the phase of the message relative to our samples, in 12MHz ticks
+// (-3..+3; positive means the message started after the start of sample 0),
+// from the power that leaked into the quiet samples either side of the third and
+// fourth preamble pulses.
+static inline int preamble_phase(mag_t *p)
+{
+    int phase;
+
+    if (p[10] > p[6]) // late: pulse 9 leaked into sample 10
+        phase = (6 * p[10] + (p[9] + p[10]) / 2) / (p[9] + p[10]);
+    else              // early: pulse 7 leaked into sample 6
+        phase = -((6 * p[6] + (p[6] + p[7]) / 2) / (p[6] + p[7]));
+
+    // noise can push it past half a sample
+    if (phase > 3)
+        phase = 3;
+    else if (phase < -3)
+        phase = -3;
+    return phase;
+}
+
+//
+// Given 'mlen' magnitude samples in 'm', sampled at 2.0MHz,
+// try to demodulate some Mode S messages.
+//
+void demodulate2000(struct mag_buf *mag)
+{
+    static struct modesMessage zeroMessage;
+    struct modesMessage mm;
+    unsigned char msg1[MODES_LONG_MSG_BYTES], msg2[MODES_LONG_MSG_BYTES], *msg;
+    uint32_t j;
+
+    mag_t *m = MAG_DATA(mag);
+    uint32_t mlen = mag->length;
+
+    uint64_t sum_scaled_signal_power = 0;
+
+    msg = msg1;
+
+    for (j = 0; (j = next_preamble(m, j, mlen)) < mlen; j++) {
+        mag_t *preamble = &m[j];
+        unsigned char *bestmsg;
+        int bestscore, phase, trial;
+        int msglen;
+
+        if (!check_preamble(preamble))
+            continue;
+
+        Modes.stats_current.demod_preambles++;
+        phase = preamble_phase(preamble);
+
+        // Try a plain slice first and then, unless we are right on the
+        // symbol boundaries, a sequence search that allows for the symbols
+        // leaking into each other. Either may give the better result.
+        bestmsg = NULL; bestscore = -2;
+        for (trial = 0; trial < (phase ? 2 : 1); ++trial) {
+            int score, nbytes;
+            uint32_t crc;
+
+            if (trial == 0) {
+                nbytes = slice_message(&preamble[16], msg, bestscore, &crc);
+            } else {
+                if (bestmsg && bestscore >= scoreModesMessageMax(bestmsg[0] >> 3))
+                    break; // can't do any better
+
+                // pulse level: each of the last two pulses is spread over samples 6-8 or 8-10
+                int level = (preamble[6] + preamble[7] + preamble[8] + preamble[9] + preamble[10]) / 2;
+                nbytes = slice_message_sequence(&preamble[16], phase, level, msg, &crc);
+            }
+            if (nbytes == 1)
+                continue;
+
+            score = scoreModesMessageCRC(msg, nbytes*8, crc);
+            if (score > bestscore) {
+                // new high score!
+                bestmsg = msg;
+                bestscore = score;
+
+                // swap to using the other buffer so we don't clobber our demodulated data
+                msg = (msg == msg1) ? msg2 : msg1;
+            }
+        }
+
+        // Do we have a candidate?
+        if (bestscore < 0) {
+            if (bestscore == -1)
+                Modes.stats_current.demod_rejected_unknown_icao++;
+            else
+                Modes.stats_current.demod_rejected_bad++;
+            continue; // nope.
+        }
+
+        msglen = modesMessageLenByType(bestmsg[0] >> 3);
+
+        // Set initial mm structure details
+        mm = zeroMessage;
+
+        // For consistency with how the Beast / Radarcape does it,
+        // we report the timestamp at the end of bit 56 (even if
+        // the frame is a 112-bit frame)
+        mm.timestampMsg = mag->sampleTimestamp + j*6 + (8 + 56) * 12 + phase;
+
+        // compute message receive time as block-start-time + difference in the 12MHz clock
+        mm.sysTimestampMsg = mag->sysTimestamp; // start of block time
+        mm.sysTimestampMsg.tv_nsec += receiveclock_ns_elapsed(mag->sampleTimestamp, mm.timestampMsg);
+        normalize_timespec(&mm.sysTimestampMsg);
+
+        mm.score = bestscore;
+
+        // Decode the received message
+        {
+            int result = decodeModesMessage(&mm, bestmsg);
+            if (result < 0) {
+                if (result == -1)
+                    Modes.stats_current.demod_rejected_unknown_icao++;
+                else
+                    Modes.stats_current.demod_rejected_bad++;
+                continue;
+            } else {
+                Modes.stats_current.demod_accepted[mm.correctedbits]++;
+            }
+        }
+
+        // measure signal power
+        {
+            double signal_power;
+            uint64_t scaled_signal_power = 0;
+            int signal_len = msglen*2;
+            int k;
+
+            for (k = 0; k < signal_len; ++k) {
+                uint32_t mag = m[j+16+k];
+                scaled_signal_power += mag * mag;
+            }
+
+            signal_power = scaled_signal_power / (double) MAG_FULL_SCALE / MAG_FULL_SCALE;
+            mm.signalLevel = signal_power / signal_len;
+            Modes.stats_current.signal_power_sum += signal_power;
+            Modes.stats_current.signal_power_count += signal_len;
+            sum_scaled_signal_power += scaled_signal_power;
+
+            if (mm.signalLevel > Modes.stats_current.peak_signal_power)
+                Modes.stats_current.peak_signal_power = mm.signalLevel;
+            if (mm.signalLevel > 0.50119)
+                Modes.stats_current.strong_signal_count++; // signal power above -3dBFS
+        }
+
+        // Skip over the message:
+        // (we actually skip to 8 bits before the end of the message,
+        //  because we can often decode two messages that *almost* collide,
+        //  where the preamble of the second message clobbered the last
+        //  few bits of the first message, but the message bits didn't
+        //  overlap)
+        j += msglen*2 - 1;
+
+        // Pass data to the next layer
+        useModesMessage(&mm);
+    }
+
+    if (Modes.mode_ac)
+        demodulate2000AC(mag);
+
+    /* update noise power */
+    {
+        double sum_signal_power = sum_scaled_signal_power / (double) MAG_FULL_SCALE / MAG_FULL_SCALE;
+        Modes.stats_current.noise_power_sum += (mag->mean_power * mag->length - sum_signal_power);
+        Modes.stats_current.noise_power_count += mag->length;
+    }
+}
+
+//////////
+////////// MODE A/C
+//////////
+
+// Mode A/C bits are 1.45us wide, consisting of 0.45us on and 1.0us off
+// We track this in terms of a (virtual) 60MHz clock, which is the lowest common multiple
+// of the bit frequency and the 2.0MHz sampling frequency
+//
+//            0.45us = 27 cycles }
+//            1.00us = 60 cycles } one bit period = 1.45us = 87 cycles
+//
+// one 2.0MHz sample = 30 cycles
+//
+// This is the same algorithm as the 2.4MHz version; the framing pulse still
+// fits within two samples, and the third sample after the leading edge is
+// still in the quiet part of the bit.
+
+// Try to demodulate a Mode A/C message with F1 starting at f1_sample.
+// Returns 1 if a message was found and passed on, 0 otherwise.
+static int demodulate2000AC_at(struct mag_buf *mag, unsigned f1_sample, unsigned noise_level)
+{
+    struct modesMessage mm;
+    mag_t *m = MAG_DATA(mag);
+    uint32_t mlen = mag->length;
+
+    // Mode A/C messages should match this bit sequence:
+
+    // bit #     value
+    //   -1       0    quiet zone
+    //    0       1    framing pulse (F1)
+    //    1      C1
+    //    2      A1
+    //    3      C2
+    //    4      A2
+    //    5      C4
+    //    6      A4
+    //    7       0    quiet zone (X1)
+    //    8      B1
+    //    9      D1
+    //   10      B2
+    //   11      D2
+    //   12      B4
+    //   13      D4
+    //   14       1    framing pulse (F2)
+    //   15       0    quiet zone (X2)
+    //   16       0    quiet zone (X3)
+    //   17     SPI
+    //   18       0    quiet zone (X4)
+    //   19       0    quiet zone (X5)
+
+    // Look for a F1 and F2 pair,
+    // with F1 starting at offset f1_sample.
+
+    // the first framing pulse covers 0.9 samples,
+    // and so at most 2 samples depending on the
+    // phase of the leading edge:
+    //
+    //   |---|      |---|
+    // __|F1 |______|C1 |_
+    //
+    // | 0 | 1 | 2 | 3 | 4 |
+
+    if (!(m[f1_sample-1] < m[f1_sample+0]))
+        return 0;      // not a rising edge
+
+    if (m[f1_sample+2] > m[f1_sample+0] || m[f1_sample+2] > m[f1_sample+1])
+        return 0;      // quiet part of bit wasn't sufficiently quiet
+
+    unsigned f1_level = (MAG_TO_16(m[f1_sample+0]) + MAG_TO_16(m[f1_sample+1])) / 2;
+
+    if (noise_level * 2 > f1_level) {
+        // require 6dB above noise
+        return 0;
+    }
+
+    // estimate initial clock phase based on the amount of the
+    // pulse that ended up in the second sample
+
+    float fraction = (float)m[f1_sample+1] / (m[f1_sample] + m[f1_sample+1]);
+    unsigned f1_clock = (unsigned) (30 * (f1_sample + fraction) + 0.5);
+
+    // same again for F2
+    // F2 is 20.3us / 14 bit periods after F1
+    unsigned f2_clock = f1_clock + (87 * 14);
+    unsigned f2_sample = f2_clock / 30;
+    assert(f2_sample < mlen + Modes.trailing_samples);
+
+    if (!(m[f2_sample-1] < m[f2_sample+0]))
+        return 0;
+
+    if (m[f2_sample+2] > m[f2_sample+0] || m[f2_sample+2] > m[f2_sample+1])
+        return 0;      // quiet part of bit wasn't sufficiently quiet
+
+    unsigned f2_level = (MAG_TO_16(m[f2_sample+0]) + MAG_TO_16(m[f2_sample+1])) / 2;
+
+    if (noise_level * 2 > f2_level) {
+        // require 6dB above noise
+        return 0;
+    }
+
+    unsigned f1f2_level = (f1_level > f2_level ? f1_level : f2_level);
+
+    float midpoint = sqrtf(noise_level * f1f2_level); // geometric mean of the two levels
+    unsigned signal_threshold = (unsigned) (midpoint * M_SQRT2 + 0.5); // +3dB
+    unsigned noise_threshold = (unsigned) (midpoint / M_SQRT2 + 0.5);  // -3dB
+
+    // Looks like a real signal. Demodulate all the bits.
+    unsigned uncertain_bits = 0;
+    unsigned noisy_bits = 0;
+    unsigned bits = 0;
+    unsigned bit;
+    unsigned clock;
+    for (bit = 0, clock = f1_clock; bit < 20; ++bit, clock += 87) {
+        unsigned sample = clock / 30;
+
+        bits <<= 1;
+        noisy_bits <<= 1;
+        uncertain_bits <<= 1;
+
+        // check for excessive noise in the quiet period
+        if (MAG_TO_16(m[sample+2]) >= signal_threshold) {
+            noisy_bits |= 1;
+        }
+
+        // decide if this bit is on or off
+        if (MAG_TO_16(m[sample+0]) >= signal_threshold || MAG_TO_16(m[sample+1]) >= signal_threshold) {
+            bits |= 1;
+        } else if (MAG_TO_16(m[sample+0]) > noise_threshold && MAG_TO_16(m[sample+1]) > noise_threshold) {
+            /* not certain about this bit */
+            uncertain_bits |= 1;
+        } else {
+            /* this bit is off */
+        }
+    }
+
+    // framing bits must be on
+    if ((bits & 0x80020) != 0x80020) {
+        return 0;
+    }
+
+    // quiet bits must be off
+    if ((bits & 0x0101B) != 0) {
+        return 0;
+    }
+
+    if (noisy_bits || uncertain_bits) {
+        return 0;
+    }
+
+    // Convert to the form that we use elsewhere:
+    //  00 A4 A2 A1  00 B4 B2 B1  SPI C4 C2 C1  00 D4 D2 D1
+    unsigned modeac =
+        ((bits & 0x40000) ? 0x0010 : 0) |  // C1
+        ((bits & 0x20000) ? 0x1000 : 0) |  // A1
+        ((bits & 0x10000) ? 0x0020 : 0) |  // C2
+        ((bits & 0x08000) ? 0x2000 : 0) |  // A2
+        ((bits & 0x04000) ? 0x0040 : 0) |  // C4
+        ((bits & 0x02000) ? 0x4000 : 0) |  // A4
+        ((bits & 0x00800) ? 0x0100 : 0) |  // B1
+        ((bits & 0x00400) ? 0x0001 : 0) |  // D1
+        ((bits & 0x00200) ? 0x0200 : 0) |  // B2
+        ((bits & 0x00100) ? 0x0002 : 0) |  // D2
+        ((bits & 0x00080) ? 0x0400 : 0) |  // B4
+        ((bits & 0x00040) ? 0x0004 : 0) |  // D4
+        ((bits & 0x00004) ? 0x0080 : 0);   // SPI
+
+    // This message looks good, submit it
+    memset(&mm, 0, sizeof(mm));
+
+    // For consistency with how the Beast / Radarcape does it,
+    // we report the timestamp at the second framing pulse (F2)
+    mm.timestampMsg = mag->sampleTimestamp + f2_clock / 5;  // 60MHz -> 12MHz
+
+    // compute message receive time as block-start-time + difference in the 12MHz clock
+    mm.sysTimestampMsg = mag->sysTimestamp; // start of block time
+    mm.sysTimestampMsg.tv_nsec += receiveclock_ns_elapsed(mag->sampleTimestamp, mm.timestampMsg);
+    normalize_timespec(&mm.sysTimestampMsg);
+
+    decodeModeAMessage(&mm, modeac);
+
+    // Pass data to the next layer
+    useModesMessage(&mm);
+
+    Modes.stats_current.demod_modeac++;
+    return 1;
+}
+
+void demodulate2000AC(struct mag_buf *mag)
+{
+    mag_t *m = MAG_DATA(mag);
+    uint32_t mlen = mag->length;
+    uint32_t f1_sample;
+
+    double noise_stddev = sqrt(mag->mean_power - mag->mean_level * mag->mean_level); // Var(X) = E[(X-E[X])^2] = E[X^2] - (E[X])^2
+    unsigned noise_level = (unsigned) ((mag->mean_power + noise_stddev) * 65535 + 0.5);
+
+    for (f1_sample = 1; f1_sample < mlen; ++f1_sample) {
+        // quick check for a rising edge, quiet third sample and level before trying harder
+        if (!(m[f1_sample-1] < m[f1_sample] && m[f1_sample+2] <= m[f1_sample] && m[f1_sample+2] <= m[f1_sample+1] &&
+              (MAG_TO_16(m[f1_sample]) + MAG_TO_16(m[f1_sample+1])) / 2 >= noise_level * 2))
+            continue;
+
+        if (demodulate2000AC_at(mag, f1_sample, noise_level))
+            f1_sample += (20*87 / 30);
+    }
+}
@@ -25,6 +25,20 @@
 #include <gd.h>
 #endif
 
+// This file is built twice: as is, for 16-bit magnitudes, and with DEMOD_MAG8
+// for the 8-bit magnitudes of --mag8 (see mag_t), where the public functions
+// have a Mag8 suffix.
+#ifdef DEMOD_MAG8
+#define demodulate2400Init demodulate2400Mag8Init
+#define demodulate2400 demodulate2400Mag8
+#define demodulate2400AC demodulate2400Mag8AC
+#define demodulate2400InitThreads demodulate2400Mag8InitThreads
+#define demodulate2400StopThreads demodulate2400Mag8StopThreads
+#define SCAN_STAGE "2.4MHz 8-bit preamble scan"
+#else
+#define SCAN_STAGE "2.4MHz preamble scan"
+#endif
+
 // 2.4MHz sampling rate version
 //
 // When sampling at 2.4MHz we have exactly 6 samples per 5 symbols.
@@ -42,348 +56,1322 @@
 // nb: the correlation functions sum to zero, so we do not need to adjust for the DC offset in the input signal
 // (adding any constant value to all of m[0..3] does not change the result)
 
-static inline int slice_phase0(uint16_t *m) {
+static inline int slice_phase0(mag_t *m) {
     return 5 * m[0] - 3 * m[1] - 2 * m[2];
 }
-static inline int slice_phase1(uint16_t *m) {
+static inline int slice_phase1(mag_t *m) {
     return 4 * m[0] - m[1] - 3 * m[2];
 }
-static inline int slice_phase2(uint16_t *m) {
+static inline int slice_phase2(mag_t *m) {
     return 3 * m[0] + m[1] - 4 * m[2];
 }
-static inline int slice_phase3(uint16_t *m) {
+static inline int slice_phase3(mag_t *m) {
     return 2 * m[0] + 3 * m[1] - 5 * m[2];
 }
-static inline int slice_phase4(uint16_t *m) {
+static inline int slice_phase4(mag_t *m) {
     return m[0] + 5 * m[1] - 5 * m[2] - m[3];
 }
 
 //
-// Given 'mlen' magnitude samples in 'm', sampled at 2.4MHz,
-// try to demodulate some Mode S messages.
+// Per-phase bit slicers
 //
-void demodulate2400(struct mag_buf *mag)
+// A byte (8 bits = 16 symbols) covers 19 or 20 samples depending on its starting phase;
+// after it, the phase advances by 1 (mod 5). slice_byte() slices one byte starting
+// at the given phase; it is always inlined with a constant phase so the switch
+// folds away.
+//
+
+static inline __attribute__((always_inline)) uint8_t slice_byte(mag_t *p, int phase)
 {
-    static struct modesMessage zeroMessage;
-    struct modesMessage mm;
-    unsigned char msg1[MODES_LONG_MSG_BYTES], msg2[MODES_LONG_MSG_BYTES], *msg;
-    uint32_t j;
+    switch (phase) {
+    case 0:
+        return
+            (slice_phase0(p) > 0 ? 0x80 : 0) |
+            (slice_phase2(p+2) > 0 ? 0x40 : 0) |
+            (slice_phase4(p+4) > 0 ? 0x20 : 0) |
+            (slice_phase1(p+7) > 0 ? 0x10 : 0) |
+            (slice_phase3(p+9) > 0 ? 0x08 : 0) |
+            (slice_phase0(p+12) > 0 ? 0x04 : 0) |
+            (slice_phase2(p+14) > 0 ? 0x02 : 0) |
+            (slice_phase4(p+16) > 0 ? 0x01 : 0);
+
+    case 1:
+        return
+            (slice_phase1(p) > 0 ? 0x80 : 0) |
+            (slice_phase3(p+2) > 0 ? 0x40 : 0) |
+            (slice_phase0(p+5) > 0 ? 0x20 : 0) |
+            (slice_phase2(p+7) > 0 ? 0x10 : 0) |
+            (slice_phase4(p+9) > 0 ? 0x08 : 0) |
+            (slice_phase1(p+12) > 0 ? 0x04 : 0) |
+            (slice_phase3(p+14) > 0 ? 0x02 : 0) |
+            (slice_phase0(p+17) > 0 ? 0x01 : 0);
+
+    case 2:
+        return
+            (slice_phase2(p) > 0 ? 0x80 : 0) |
+            (slice_phase4(p+2) > 0 ? 0x40 : 0) |
+            (slice_phase1(p+5) > 0 ? 0x20 : 0) |
+            (slice_phase3(p+7) > 0 ? 0x10 : 0) |
+            (slice_phase0(p+10) > 0 ? 0x08 : 0) |
+            (slice_phase2(p+12) > 0 ? 0x04 : 0) |
+            (slice_phase4(p+14) > 0 ? 0x02 : 0) |
+            (slice_phase1(p+17) > 0 ? 0x01 : 0);
+
+    case 3:
+        return
+            (slice_phase3(p) > 0 ? 0x80 : 0) |
+            (slice_phase0(p+3) > 0 ? 0x40 : 0) |
+            (slice_phase2(p+5) > 0 ? 0x20 : 0) |
+            (slice_phase4(p+7) > 0 ? 0x10 : 0) |
+            (slice_phase1(p+10) > 0 ? 0x08 : 0) |
+            (slice_phase3(p+12) > 0 ? 0x04 : 0) |
+            (slice_phase0(p+15) > 0 ? 0x02 : 0) |
+            (slice_phase2(p+17) > 0 ? 0x01 : 0);
+
+    default:
+        return
+            (slice_phase4(p) > 0 ? 0x80 : 0) |
+            (slice_phase1(p+3) > 0 ? 0x40 : 0) |
+            (slice_phase3(p+5) > 0 ? 0x20 : 0) |
+            (slice_phase0(p+8) > 0 ? 0x10 : 0) |
+            (slice_phase2(p+10) > 0 ? 0x08 : 0) |
+            (slice_phase4(p+12) > 0 ? 0x04 : 0) |
+            (slice_phase1(p+15) > 0 ? 0x02 : 0) |
+            (slice_phase3(p+17) > 0 ? 0x01 : 0);
+    }
+}
 
-    unsigned char *bestmsg;
-    int bestscore, bestphase;
+// Number of bytes to demodulate for a message starting with the given first byte,
+// or 1 if the DF is not one we can use and we should give up immediately.
+static inline int slice_message_bytes(uint8_t first_byte)
+{
+    switch (first_byte >> 3) {
+    case 0: case 4: case 5: case 11:
+        return MODES_SHORT_MSG_BYTES;
 
-    uint16_t *m = mag->data;
-    uint32_t mlen = mag->length;
+    case 16: case 17: case 18: case 20: case 21: case 24:
+        return MODES_LONG_MSG_BYTES;
 
-    uint64_t sum_scaled_signal_power = 0;
+    default:
+        return 1; // unknown DF
+    }
+}
 
-    msg = msg1;
-
-    for (j = 0; j < mlen; j++) {
-        uint16_t *preamble = &m[j];
-        int high;
-        uint32_t base_signal, base_noise;
-        int try_phase;
-        int msglen;
-
-        // Look for a message starting at around sample 0 with phase offset 3..7
-
-        // Ideal sample values for preambles with different phase
-        // Xn is the first data symbol with phase offset N
-        //
-        // sample#: 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0
-        // phase 3: 2/4\0/5\1 0 0 0 0/5\1/3 3\0 0 0 0 0 0 X4
-        // phase 4: 1/5\0/4\2 0 0 0 0/4\2 2/4\0 0 0 0 0 0 0 X0
-        // phase 5: 0/5\1/3 3\0 0 0 0/3 3\1/5\0 0 0 0 0 0 0 X1
-        // phase 6: 0/4\2 2/4\0 0 0 0 2/4\0/5\1 0 0 0 0 0 0 X2
-        // phase 7: 0/3 3\1/5\0 0 0 0 1/5\0/4\2 0 0 0 0 0 0 X3
-        //
-        
-        // quick check: we must have a rising edge 0->1 and a falling edge 12->13
-        if (! (preamble[0] < preamble[1] && preamble[12] > preamble[13]) )
-           continue;
-
-        if (preamble[1] > preamble[2] &&                                       // 1
-            preamble[2] < preamble[3] && preamble[3] > preamble[4] &&          // 3
-            preamble[8] < preamble[9] && preamble[9] > preamble[10] &&         // 9
-            preamble[10] < preamble[11]) {                                     // 11-12
-            // peaks at 1,3,9,11-12: phase 3
-            high = (preamble[1] + preamble[3] + preamble[9] + preamble[11] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[3] + preamble[9];
-            base_noise = preamble[5] + preamble[6] + preamble[7];
-        } else if (preamble[1] > preamble[2] &&                                // 1
-                   preamble[2] < preamble[3] && preamble[3] > preamble[4] &&   // 3
-                   preamble[8] < preamble[9] && preamble[9] > preamble[10] &&  // 9
-                   preamble[11] < preamble[12]) {                              // 12
-            // peaks at 1,3,9,12: phase 4
-            high = (preamble[1] + preamble[3] + preamble[9] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[3] + preamble[9] + preamble[12];
-            base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
-        } else if (preamble[1] > preamble[2] &&                                // 1
-                   preamble[2] < preamble[3] && preamble[4] > preamble[5] &&   // 3-4
-                   preamble[8] < preamble[9] && preamble[10] > preamble[11] && // 9-10
-                   preamble[11] < preamble[12]) {                              // 12
-            // peaks at 1,3-4,9-10,12: phase 5
-            high = (preamble[1] + preamble[3] + preamble[4] + preamble[9] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[12];
-            base_noise = preamble[6] + preamble[7];
-        } else if (preamble[1] > preamble[2] &&                                 // 1
-                   preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
-                   preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
-                   preamble[11] < preamble[12]) {                               // 12
-            // peaks at 1,4,10,12: phase 6
-            high = (preamble[1] + preamble[4] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[4] + preamble[10] + preamble[12];
-            base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
-        } else if (preamble[2] > preamble[3] &&                                 // 1-2
-                   preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
-                   preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
-                   preamble[11] < preamble[12]) {                               // 12
-            // peaks at 1-2,4,10,12: phase 7
-            high = (preamble[1] + preamble[2] + preamble[4] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[4] + preamble[10] + preamble[12];
-            base_noise = preamble[6] + preamble[7] + preamble[8];
-        } else {
-            // no suitable peaks
-            continue;
-        }
+// Byte n of a message whose first byte starts at phase P begins at sample
+// 19*n + (P+n)/5 (one extra sample for every phase-4 byte already passed),
+// with phase (P+n)%5. All of this is constant once P is fixed.
+#define SLICE_BYTE(P, n) slice_byte(m + 19*(n) + ((P)+(n))/5, ((P)+(n))%5)
 
-        // Check for enough signal
-        if (base_signal * 2 < 3 * base_noise) // about 3.5dB SNR
-            continue;
+// Generate a straight-line slicer for one starting phase. Returns the number
+// of bytes demodulated into msg (1, 7 or 14); for 7 or 14 bytes, *crc_out is
+// the message CRC, computed as we go.
+//
+// If the DF in the first byte cannot score better than min_score, give up
+// after the first byte: this trial phase can never replace the current best.
+#define DEFINE_MESSAGE_SLICER(P)                                        \
+static int slice_message_phase##P(mag_t *m, unsigned char *msg,      \
+                                  int min_score, uint32_t *crc_out)     \
+{                                                                       \
+    int bytelen;                                                        \
+    uint32_t rem;                                                       \
+                                                                        \
+    msg[0] = SLICE_BYTE(P, 0);                                          \
+    bytelen = slice_message_bytes(msg[0]);                              \
+    if (bytelen == 1 || scoreModesMessageMax(msg[0] >> 3) <= min_score) \
+        return 1;                                                       \
+                                                                        \
+    msg[1] = SLICE_BYTE(P, 1);                                          \
+    msg[2] = SLICE_BYTE(P, 2);                                          \
+    msg[3] = SLICE_BYTE(P, 3);                                          \
+    rem = modesChecksumStep4(0, msg);                                   \
+    msg[4] = SLICE_BYTE(P, 4);                                          \
+    msg[5] = SLICE_BYTE(P, 5);                                          \
+    msg[6] = SLICE_BYTE(P, 6);                                          \
+    if (bytelen == MODES_SHORT_MSG_BYTES) {                             \
+        *crc_out = rem ^ (msg[4] << 16) ^ (msg[5] << 8) ^ msg[6];       \
+        return MODES_SHORT_MSG_BYTES;                                   \
+    }                                                                   \
+                                                                        \
+    msg[7] = SLICE_BYTE(P, 7);                                          \
+    rem = modesChecksumStep4(rem, msg + 4);                             \
+    msg[8] = SLICE_BYTE(P, 8); rem = modesChecksumStep(rem, msg[8]);    \
+    msg[9] = SLICE_BYTE(P, 9); rem = modesChecksumStep(rem, msg[9]);    \
+    msg[10] = SLICE_BYTE(P, 10); rem = modesChecksumStep(rem, msg[10]); \
+    msg[11] = SLICE_BYTE(P, 11);                                        \
+    msg[12] = SLICE_BYTE(P, 12);                                        \
+    msg[13] = SLICE_BYTE(P, 13);                                        \
+    *crc_out = rem ^ (msg[11] << 16) ^ (msg[12] << 8) ^ msg[13];        \
+    return MODES_LONG_MSG_BYTES;                                        \
+}
+
+DEFINE_MESSAGE_SLICER(0)
+DEFINE_MESSAGE_SLICER(1)
+DEFINE_MESSAGE_SLICER(2)
+DEFINE_MESSAGE_SLICER(3)
+DEFINE_MESSAGE_SLICER(4)
+
+#undef DEFINE_MESSAGE_SLICER
+#undef SLICE_BYTE
+
+// Demodulate a message whose data starts at m (sample 19 after the preamble start)
+// with the given trial phase (4..8, in units of 1/5 sample)
+static inline int slice_message(int try_phase, mag_t *m, unsigned char *msg, int min_score, uint32_t *crc_out)
+{
+    switch (try_phase) {
+    case 4: return slice_message_phase4(m, msg, min_score, crc_out);
+    case 5: return slice_message_phase0(m + 1, msg, min_score, crc_out);
+    case 6: return slice_message_phase1(m + 1, msg, min_score, crc_out);
+    case 7: return slice_message_phase2(m + 1, msg, min_score, crc_out);
+    case 8: return slice_message_phase3(m + 1, msg, min_score, crc_out);
+    default: return 1;
+    }
+}
+
+//
+// Soft-decision error correction (--soft-fix)
+//
+// The slicers only keep the sign of each bit's correlation, but its magnitude
+// says how sure we are about the bit: noise or an overlapping signal usually
+// flips bits whose correlation was close to zero. When the syndrome tables
+// can't fix a DF11/17/18 CRC, go back to the samples, find the n least
+// confident bits (ignoring the DF field), and look for a single bit, or a
+// unique pair of bits, among them whose error syndrome matches. Only
+// considering weak bits avoids most of the false corrections that blind 2-bit
+// correction makes, and needs no tables.
+//
+
+// Correlation for one bit (a 1-0 symbol pair) at the given phase; see slice_phase0..4
+static inline __attribute__((always_inline)) int slice_bit_correlation(mag_t *m, int phase)
+{
+    switch (phase) {
+    case 0: return slice_phase0(m);
+    case 1: return slice_phase1(m);
+    case 2: return slice_phase2(m);
+    case 3: return slice_phase3(m);
+    default: return slice_phase4(m);
+    }
+}
+
+// Every 5 bits (12 samples) the phase comes round again, so with a constant
+// starting phase each bit's phase and sample offset are constants too.
+// Fills in conf[from..nbits), rounded out to multiples of 5 bits.
+static inline __attribute__((always_inline)) void slice_confidence(mag_t *m, int phase, int from, int nbits, unsigned *conf)
+{
+    int bit;
+
+#define SLICE_CONF(k)                                                   \
+    do {                                                                \
+        int corr = slice_bit_correlation(m + (phase + 12*(k)) / 5,      \
+                                         (phase + 12*(k)) % 5);         \
+        conf[bit + (k)] = (corr < 0 ? -corr : corr);                    \
+    } while (0)
+
+    from -= from % 5;
+    for (bit = from, m += 12 * (from / 5); bit < nbits; bit += 5, m += 12) {
+        SLICE_CONF(0);
+        SLICE_CONF(1);
+        SLICE_CONF(2);
+        SLICE_CONF(3);
+        SLICE_CONF(4);
+    }
+
+#undef SLICE_CONF
+}
+
+// As slice_message(), but for the confidence of bits [from, nbits)
+static void slice_message_confidence(int try_phase, mag_t *m, int from, int nbits, unsigned *conf)
+{
+    switch (try_phase) {
+    case 4: slice_confidence(m, 4, from, nbits, conf); break;
+    case 5: slice_confidence(m + 1, 0, from, nbits, conf); break;
+    case 6: slice_confidence(m + 1, 1, from, nbits, conf); break;
+    case 7: slice_confidence(m + 1, 2, from, nbits, conf); break;
+    case 8: slice_confidence(m + 1, 3, from, nbits, conf); break;
+    }
+}
+
+// Try to locate the errors in a message sliced from m (sample 19 after the
+// preamble start) at try_phase, with CRC crc. On success fills in *ei, with
+// the syndrome as scoreModesMessage() / decodeModesMessage() will see it, and
+// returns 1.
+static int demodulate2400_soft_fix(mag_t *m, int try_phase, unsigned char *msg, int nbytes, uint32_t crc,
+                                   struct errorinfo *ei)
+{
+    unsigned conf[MODES_LONG_MSG_BITS + 4];
+    int weak_bit[MODES_MAX_SOFT_FIX_BITS];
+    unsigned weak_conf[MODES_MAX_SOFT_FIX_BITS];
+    uint32_t weak_syndrome[MODES_MAX_SOFT_FIX_BITS];
+    int nweak = 0, nbits = nbytes * 8, lastbit = nbits, maxweak = Modes.soft_fix_bits;
+    mag_t *preamble = m - 19;
+    uint32_t mask = 0xffffff, syndrome;
+    unsigned level;
+    int bit, a, b, found = 0;
+
+    switch (msg[0] >> 3) {
+    case 11:
+        // the bottom 7 bits of the syndrome are the IID, which we can't
+        // check, and errors in the last 7 bits only change the IID
+        mask = 0xffff80;
+        lastbit = nbits - 7;
+        break;
+    case 17:
+    case 18:
+        break;
+    default:
+        return 0;
+    }
 
-        // Check that the "quiet" bits 6,7,15,16,17 are actually quiet
-        if (preamble[5] >= high ||
-            preamble[6] >= high ||
-            preamble[7] >= high ||
-            preamble[8] >= high ||
-            preamble[14] >= high ||
-            preamble[15] >= high ||
-            preamble[16] >= high ||
-            preamble[17] >= high ||
-            preamble[18] >= high) {
+    syndrome = crc & mask;
+    if (!syndrome)
+        return 0;
+
+    // The DF field is never corrected, so if it was hard to read (compared
+    // to the mean level around the preamble pulses) then the rest probably
+    // is too: this is most likely noise and not worth a closer look. This
+    // check drops about 3/4 of the work on noise for 1/5 fewer repairs.
+    level = (preamble[1] + preamble[2] + preamble[3] + preamble[4] +
+             preamble[9] + preamble[10] + preamble[11] + preamble[12]) / 8;
+    slice_message_confidence(try_phase, m, 0, 5, conf);
+    for (bit = 0; bit < 5; ++bit) {
+        if (conf[bit] < level)
+            return 0;
+    }
+
+    // find the least confident bits, keeping them sorted by confidence
+    slice_message_confidence(try_phase, m, 5, nbits, conf);
+    for (bit = 5; bit < lastbit; ++bit) {
+        int k;
+
+        if (nweak == maxweak && conf[bit] >= weak_conf[nweak - 1])
             continue;
+        if (nweak < maxweak)
+            ++nweak;
+        for (k = nweak - 1; k > 0 && weak_conf[k - 1] > conf[bit]; --k) {
+            weak_bit[k] = weak_bit[k - 1];
+            weak_conf[k] = weak_conf[k - 1];
         }
+        weak_bit[k] = bit;
+        weak_conf[k] = conf[bit];
+    }
 
-        // try all phases
-        Modes.stats_current.demod_preambles++;
-        bestmsg = NULL; bestscore = -2; bestphase = -1;
-        for (try_phase = 4; try_phase <= 8; ++try_phase) {
-            uint16_t *pPtr;
-            int phase, i, score, bytelen;
-
-            // Decode all the next 112 bits, regardless of the actual message
-            // size. We'll check the actual message type later
-            
-            pPtr = &m[j+19] + (try_phase/5);
-            phase = try_phase % 5;
-
-            bytelen = MODES_LONG_MSG_BYTES;
-            for (i = 0; i < bytelen; ++i) {
-                uint8_t theByte = 0;
-
-                switch (phase) {
-                case 0:
-                    theByte = 
-                        (slice_phase0(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase2(pPtr+2) > 0 ? 0x40 : 0) |
-                        (slice_phase4(pPtr+4) > 0 ? 0x20 : 0) |
-                        (slice_phase1(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase3(pPtr+9) > 0 ? 0x08 : 0) |
-                        (slice_phase0(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase2(pPtr+14) > 0 ? 0x02 : 0) |
-                        (slice_phase4(pPtr+16) > 0 ? 0x01 : 0);
-
-
-                    phase = 1;
-                    pPtr += 19;
-                    break;
-                    
-                case 1:
-                    theByte =
-                        (slice_phase1(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase3(pPtr+2) > 0 ? 0x40 : 0) |
-                        (slice_phase0(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase2(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase4(pPtr+9) > 0 ? 0x08 : 0) |
-                        (slice_phase1(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase3(pPtr+14) > 0 ? 0x02 : 0) |
-                        (slice_phase0(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 2;
-                    pPtr += 19;
-                    break;
-                    
-                case 2:
-                    theByte =
-                        (slice_phase2(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase4(pPtr+2) > 0 ? 0x40 : 0) |
-                        (slice_phase1(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase3(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase0(pPtr+10) > 0 ? 0x08 : 0) |
-                        (slice_phase2(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase4(pPtr+14) > 0 ? 0x02 : 0) |
-                        (slice_phase1(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 3;
-                    pPtr += 19;
-                    break;
-                    
-                case 3:
-                    theByte = 
-                        (slice_phase3(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase0(pPtr+3) > 0 ? 0x40 : 0) |
-                        (slice_phase2(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase4(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase1(pPtr+10) > 0 ? 0x08 : 0) |
-                        (slice_phase3(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase0(pPtr+15) > 0 ? 0x02 : 0) |
-                        (slice_phase2(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 4;
-                    pPtr += 19;
-                    break;
-                    
-                case 4:
-                    theByte = 
-                        (slice_phase4(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase1(pPtr+3) > 0 ? 0x40 : 0) |
-                        (slice_phase3(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase0(pPtr+8) > 0 ? 0x10 : 0) |
-                        (slice_phase2(pPtr+10) > 0 ? 0x08 : 0) |
-                        (slice_phase4(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase1(pPtr+15) > 0 ? 0x02 : 0) |
-                        (slice_phase3(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 0;
-                    pPtr += 20;
-                    break;
-                }
+    for (a = 0; a < nweak; ++a)
+        weak_syndrome[a] = modesChecksumBitSyndrome(weak_bit[a], nbits) & mask;
 
-                msg[i] = theByte;
-                if (i == 0) {
-                    switch (msg[0] >> 3) {
-                    case 0: case 4: case 5: case 11:
-                        bytelen = MODES_SHORT_MSG_BYTES; break;
-                        
-                    case 16: case 17: case 18: case 20: case 21: case 24:
-                        break;
-
-                    default:
-                        bytelen = 1; // unknown DF, give up immediately
-                        break;
-                    }
-                }
+    ei->syndrome = syndrome;
+    ei->bit[0] = ei->bit[1] = -1;
+
+    // a single weak bit?
+    for (a = 0; a < nweak; ++a) {
+        if (weak_syndrome[a] == syndrome) {
+            ei->errors = 1;
+            ei->bit[0] = weak_bit[a];
+            return 1;
+        }
+    }
+
+    // two-bit errors are ambiguous in DF11 (see crc.c)
+    if (mask != 0xffffff)
+        return 0;
+
+    // a pair of weak bits? Give up if more than one pair fits.
+    for (a = 0; a < nweak; ++a) {
+        for (b = a + 1; b < nweak; ++b) {
+            if ((weak_syndrome[a] ^ weak_syndrome[b]) == syndrome) {
+                if (found++)
+                    return 0;
+                ei->errors = 2;
+                ei->bit[0] = (weak_bit[a] < weak_bit[b] ? weak_bit[a] : weak_bit[b]);
+                ei->bit[1] = (weak_bit[a] < weak_bit[b] ? weak_bit[b] : weak_bit[a]);
             }
+        }
+    }
 
-            // Score the mode S message and see if it's any good.
-            score = scoreModesMessage(msg, i*8);
-            if (score > bestscore) {
-                // new high score!
-                bestmsg = msg;
-                bestscore = score;
-                bestphase = try_phase;
-                
-                // swap to using the other buffer so we don't clobber our demodulated data
-                // (if we find a better result then we'll swap back, but that's OK because
-                // we no longer need this copy if we found a better one)
-                msg = (msg == msg1) ? msg2 : msg1;
+    return found;
+}
+
+//
+// Preamble phase ranking (--demod-phases)
+//
+// The preamble pulses are 1.2 samples wide, so each one spreads its energy over
+// two or three samples. The later a pulse starts within its first sample, the
+// more of its energy lands in the following sample. Summing the "late" samples
+// of the two pulse pairs (2,4 and 10,12) against the whole pulse energy gives
+// a split that grows monotonically with the phase offset:
+//
+//   phase:          3    4    5    6    7
+//   late / total:  5/24 8/24 12/24 15/23 17/22
+//
+// (from the ideal sample values tabulated in demodulate2400). Interpolating the
+// measured split between those points gives a phase estimate that is finer
+// than the peak pattern match, and trial phases are tried nearest-first.
+//
+
+// A pruned search is accepted only if it found a message that no other phase
+// could beat (scoreModesMessageMax for its DF), otherwise we fall back to trying
+// all phases. A lower bar is not safe: a wrong phase can decode as, say, a DF11
+// with a known address and a damaged IID, which scores 1000 against the 1600
+// of the right phase.
+
+// How the phase search for one preamble went
+#define PHASE_SEARCH_FULL     0   // all phases tried, in order (no ranking)
+#define PHASE_SEARCH_RANKED   1   // the ranked phases were good enough
+#define PHASE_SEARCH_FALLBACK 2   // ranked phases were not good enough, tried them all
+
+static void rank_preamble_phases(mag_t *preamble, int order[5])
+{
+    // ideal late/total split for phases 3..7, scaled by 240
+    static const int ideal_split[5] = { 50, 80, 120, 157, 185 };
+    uint32_t late = preamble[2] + preamble[4] + preamble[10] + preamble[12];
+    uint32_t total = preamble[0] + preamble[1] + preamble[2] + preamble[3] + preamble[4] +
+        preamble[9] + preamble[10] + preamble[11] + preamble[12];
+    int split, estimate, lo, hi, k;
+
+    // phase estimate, in units of 1/10 of the trial phase (40..80)
+    split = total ? (int) (late * 240 / total) : 0;
+    if (split <= ideal_split[0]) {
+        estimate = 40;
+    } else if (split >= ideal_split[4]) {
+        estimate = 80;
+    } else {
+        for (k = 0; split >= ideal_split[k+1]; ++k)
+            ;
+        estimate = 10 * (k + 4) + 10 * (split - ideal_split[k]) / (ideal_split[k+1] - ideal_split[k]);
+    }
+
+    // nearest trial phase first, then work outwards taking whichever neighbour is closer
+    lo = (estimate + 5) / 10;
+    hi = lo + 1;
+    for (k = 0; k < 5; ++k) {
+        if (hi > 8 || (lo >= 4 && estimate - 10 * lo <= 10 * hi - estimate))
+            order[k] = lo--;
+        else
+            order[k] = hi++;
+    }
+}
+
+//
+// Preamble candidate scanning
+//
+// The preamble shape tests below only compare neighbouring samples, so they can be
+// evaluated for many sample offsets at once. scan_preambles() runs the quick
+// rising/falling edge check plus the five per-phase peak patterns over a range of
+// offsets and emits a compact list of offsets that passed, along with a bitmask
+// of which phase patterns (3..7) matched. The rest of the preamble checks (SNR,
+// quiet bits) and the decoding still happen per candidate in demodulate2400().
+//
+// With Mode A/C enabled, the same pass also looks for the start of an F1
+// framing pulse (rising edge, quiet third sample, 6dB above the buffer noise
+// level) using the samples already loaded for the preamble tests, and emits
+// those offsets to a second list for demodulate2400AC_at(). A/C offsets are
+// one sample later than the preamble offsets they were tested with, as the
+// rising edge test needs the previous sample.
+//
+
+#define PREAMBLE_SCAN_CHUNK 512
+
+#define PHASE_HINT_3 0x01
+#define PHASE_HINT_4 0x02
+#define PHASE_HINT_5 0x04
+#define PHASE_HINT_6 0x08
+#define PHASE_HINT_7 0x10
+
+struct preamble_candidate {
+    uint32_t offset;     // sample offset of preamble[0] within the mag_buf
+    uint32_t phase_hint; // PHASE_HINT_* bits for the matching patterns
+};
+
+// There are scalar and vector kernels for the scan; demodulate2400Init() picks one.
+// A/C offsets are only looked for if ac_out is not NULL.
+typedef unsigned (*scan_preambles_fn)(const mag_t *m, uint32_t start, uint32_t end, struct preamble_candidate *out,
+                                      mag_t ac_level, uint32_t *ac_out, unsigned *n_ac_out);
+
+#if defined(__GNUC__) && !defined(DEMOD_NO_VECTOR)
+
+// GCC/clang vector extensions: one SSE2 / NEON register's worth of mag_t,
+// i.e. 8 lanes, or 16 with --mag8. Wider vectors are no faster with AVX2, and
+// where they don't fit in a register GCC turns the comparisons below into
+// scalar code.
+#define SCAN_LANES (16 / sizeof(mag_t))
+typedef mag_t scan_vec __attribute__((vector_size(16)));
+
+// (a macro rather than an inline function, so that no vector type crosses a
+// function boundary)
+#define SCAN_LOAD(v, p) memcpy(&(v), (p), sizeof(scan_vec))
+
+// with_ac is always a constant, so the Mode-S-only scan pays nothing for A/C
+static inline __attribute__((always_inline)) unsigned scan_preambles_vec(const mag_t *m, uint32_t start, uint32_t end,
+                                                                         struct preamble_candidate *out, int with_ac,
+                                                                         mag_t ac_level, uint32_t *ac_out, unsigned *n_ac_out)
+{
+    unsigned n = 0, n_ac = 0;
+    uint32_t j;
+
+    for (j = start; j < end; j += SCAN_LANES) {
+        const mag_t *p = &m[j];
+        scan_vec p0, p1, p2, p3, p4, p5, p8, p9, p10, p11, p12, p13;
+
+        SCAN_LOAD(p0, p+0);  SCAN_LOAD(p1, p+1);   SCAN_LOAD(p2, p+2);   SCAN_LOAD(p3, p+3);
+        SCAN_LOAD(p4, p+4);  SCAN_LOAD(p5, p+5);   SCAN_LOAD(p8, p+8);   SCAN_LOAD(p9, p+9);
+        SCAN_LOAD(p10, p+10); SCAN_LOAD(p11, p+11); SCAN_LOAD(p12, p+12); SCAN_LOAD(p13, p+13);
+
+        scan_vec quick = (scan_vec) ((p0 < p1) & (p12 > p13));
+        scan_vec r12 = (scan_vec) (p1 > p2), f23 = (scan_vec) (p2 < p3), f34 = (scan_vec) (p3 > p4);
+        scan_vec r89 = (scan_vec) (p8 < p9), f910 = (scan_vec) (p9 > p10), r1112 = (scan_vec) (p11 < p12);
+        scan_vec f1011 = (scan_vec) (p10 > p11);
+
+        scan_vec ph3 = r12 & f23 & f34 & r89 & f910 & (scan_vec) (p10 < p11);
+        scan_vec ph4 = r12 & f23 & f34 & r89 & f910 & r1112;
+        scan_vec ph5 = r12 & f23 & (scan_vec) (p4 > p5) & r89 & f1011 & r1112;
+        scan_vec ph6 = r12 & (scan_vec) (p3 < p4) & (scan_vec) (p4 > p5) & (scan_vec) (p9 < p10) & f1011 & r1112;
+        scan_vec ph7 = (scan_vec) (p2 > p3) & (scan_vec) (p3 < p4) & (scan_vec) (p4 > p5) & (scan_vec) (p9 < p10) & f1011 & r1112;
+
+        scan_vec hint = quick & ((ph3 & PHASE_HINT_3) | (ph4 & PHASE_HINT_4) | (ph5 & PHASE_HINT_5) |
+                                 (ph6 & PHASE_HINT_6) | (ph7 & PHASE_HINT_7));
+
+        scan_vec ac = { 0 };
+        if (with_ac) {
+            // F1 at p+1: rising edge 0->1, quiet sample 3, (p1+p2)/2 >= ac_level
+            scan_vec level = (p1 >> 1) + (p2 >> 1) + (p1 & p2 & 1);
+            ac = (scan_vec) ((p0 < p1) & (p3 <= p1) & (p3 <= p2) & (level >= ac_level));
+        }
+
+        uint64_t any[sizeof(scan_vec) / sizeof(uint64_t)];
+        scan_vec either = hint | ac;
+        memcpy(any, &either, sizeof(any));
+        if (!(any[0] | any[1]))
+            continue;
+
+        for (unsigned k = 0; k < SCAN_LANES && j + k < end; ++k) {
+            if (hint[k]) {
+                out[n].offset = j + k;
+                out[n].phase_hint = hint[k];
+                ++n;
             }
+            if (with_ac && ac[k])
+                ac_out[n_ac++] = j + k + 1;
+        }
+    }
+
+    if (with_ac)
+        *n_ac_out = n_ac;
+    return n;
+}
+
+// Both specialisations are inlined into each kernel
+#define SCAN_PREAMBLES_KERNEL(name, target)                             \
+    target static unsigned name(const mag_t *m, uint32_t start, uint32_t end, struct preamble_candidate *out, \
+                                mag_t ac_level, uint32_t *ac_out, unsigned *n_ac_out) \
+    {                                                                   \
+        if (ac_out)                                                     \
+            return scan_preambles_vec(m, start, end, out, 1, ac_level, ac_out, n_ac_out); \
+        else                                                            \
+            return scan_preambles_vec(m, start, end, out, 0, 0, NULL, NULL); \
+    }
+
+SCAN_PREAMBLES_KERNEL(scan_preambles_vector, )
+#if defined(KERNEL_HAVE_AVX2)
+SCAN_PREAMBLES_KERNEL(scan_preambles_avx2, KERNEL_TARGET_AVX2)
+#endif
+#if defined(KERNEL_HAVE_NEON)
+SCAN_PREAMBLES_KERNEL(scan_preambles_neon, KERNEL_TARGET_NEON)
+#endif
+
+#endif /* vector */
+
+
+static inline unsigned preamble_phase_hint(const mag_t *p)
+{
+    unsigned hint = 0;
+
+    if (! (p[0] < p[1] && p[12] > p[13]) )
+        return 0;
+
+    if (p[1] > p[2] && p[2] < p[3] && p[3] > p[4] && p[8] < p[9] && p[9] > p[10] && p[10] < p[11])
+        hint |= PHASE_HINT_3;
+    if (p[1] > p[2] && p[2] < p[3] && p[3] > p[4] && p[8] < p[9] && p[9] > p[10] && p[11] < p[12])
+        hint |= PHASE_HINT_4;
+    if (p[1] > p[2] && p[2] < p[3] && p[4] > p[5] && p[8] < p[9] && p[10] > p[11] && p[11] < p[12])
+        hint |= PHASE_HINT_5;
+    if (p[1] > p[2] && p[3] < p[4] && p[4] > p[5] && p[9] < p[10] && p[10] > p[11] && p[11] < p[12])
+        hint |= PHASE_HINT_6;
+    if (p[2] > p[3] && p[3] < p[4] && p[4] > p[5] && p[9] < p[10] && p[10] > p[11] && p[11] < p[12])
+        hint |= PHASE_HINT_7;
+
+    return hint;
+}
+
+static unsigned scan_preambles_scalar(const mag_t *m, uint32_t start, uint32_t end, struct preamble_candidate *out,
+                                      mag_t ac_level, uint32_t *ac_out, unsigned *n_ac_out)
+{
+    unsigned n = 0, n_ac = 0;
+    uint32_t j;
+
+    for (j = start; j < end; ++j) {
+        const mag_t *p = &m[j];
+        unsigned hint = preamble_phase_hint(p);
+        if (hint) {
+            out[n].offset = j;
+            out[n].phase_hint = hint;
+            ++n;
         }
+        if (ac_out && p[0] < p[1] && p[3] <= p[1] && p[3] <= p[2] && (p[1] + p[2]) / 2 >= ac_level)
+            ac_out[n_ac++] = j + 1;
+    }
+
+    if (n_ac_out)
+        *n_ac_out = n_ac;
+    return n;
+}
+
+static const struct {
+    kernel_t kernel;
+    scan_preambles_fn fn;
+} scan_preambles_kernels[] = {
+    // In order of preference
+#if defined(__GNUC__) && !defined(DEMOD_NO_VECTOR)
+#if defined(KERNEL_HAVE_AVX2)
+    { KERNEL_AVX2, scan_preambles_avx2 },
+#endif
+#if defined(KERNEL_HAVE_NEON)
+    { KERNEL_NEON, scan_preambles_neon },
+#endif
+    { KERNEL_VECTOR, scan_preambles_vector },
+#endif
+    { KERNEL_SCALAR, scan_preambles_scalar }
+};
+
+#define NUM_SCAN_PREAMBLES_KERNELS (sizeof(scan_preambles_kernels) / sizeof(scan_preambles_kernels[0]))
 
-        // Do we have a candidate?
-        if (bestscore < 0) {
-            if (bestscore == -1)
+static scan_preambles_fn scan_preambles = scan_preambles_scalar;
+
+void demodulate2400Init(void)
+{
+    kernel_t candidates[NUM_SCAN_PREAMBLES_KERNELS];
+    unsigned i;
+    int chosen;
+
+    for (i = 0; i < NUM_SCAN_PREAMBLES_KERNELS; ++i)
+        candidates[i] = scan_preambles_kernels[i].kernel;
+
+    chosen = kernel_select(SCAN_STAGE, candidates, NUM_SCAN_PREAMBLES_KERNELS);
+    if (chosen >= 0)
+        scan_preambles = scan_preambles_kernels[chosen].fn;
+}
+
+// A preamble that has been sliced at each trial phase, but not yet decoded.
+// Worker threads (--demod-threads) collect these for the main thread to decode.
+//
+// Scores depend on the ICAO filter, which only the main thread updates as it
+// decodes messages, so every trial that got as far as a CRC is kept and is
+// scored again when the main thread gets to it. Stats are counted then too,
+// so that preambles the main thread skips over are not counted.
+struct sliced_message {
+    uint32_t offset;                      // preamble start, in samples from the start of the buffer
+    int search;                           // PHASE_SEARCH_* outcome
+    int ntrials;
+    struct {
+        int phase;
+        int nbytes;
+        uint32_t crc;
+        struct errorinfo soft;            // --soft-fix correction, if soft.errors > 0
+        unsigned char msg[MODES_LONG_MSG_BYTES];
+    } trials[5];
+};
+
+// One slice of a magnitude buffer handled by a single worker
+struct demod_slice {
+    uint32_t from, to;                    // range of preamble offsets this slice owns
+    struct timespec demod_cpu;            // worker CPU time
+    struct sliced_message *messages;      // preambles found in [from, to), in offset order
+    unsigned nmessages;
+    unsigned max_messages;
+};
+
+//
+// Decode a message found at sample offset j and pass it on. Returns the offset
+// where the search for the next preamble should resume, or 0 if the message
+// was rejected.
+//
+static uint32_t demodulate2400_emit(struct mag_buf *mag, uint32_t j, unsigned char *bestmsg, int bestscore, int bestphase,
+                                    struct errorinfo *bestsoft, uint64_t *sum_scaled_signal_power)
+{
+    static struct modesMessage zeroMessage;
+    struct modesMessage mm;
+    mag_t *m = MAG_DATA(mag);
+    int msglen;
+
+    msglen = modesMessageLenByType(bestmsg[0] >> 3);
+
+    // Set initial mm structure details
+    mm = zeroMessage;
+
+    // For consistency with how the Beast / Radarcape does it,
+    // we report the timestamp at the end of bit 56 (even if
+    // the frame is a 112-bit frame)
+    mm.timestampMsg = mag->sampleTimestamp + j*5 + (8 + 56) * 12 + bestphase;
+
+    // compute message receive time as block-start-time + difference in the 12MHz clock
+    mm.sysTimestampMsg = mag->sysTimestamp; // start of block time
+    mm.sysTimestampMsg.tv_nsec += receiveclock_ns_elapsed(mag->sampleTimestamp, mm.timestampMsg);
+    normalize_timespec(&mm.sysTimestampMsg);
+
+    mm.score = bestscore;
+    mm.softfix = *bestsoft;
+
+    // Decode the received message
+    {
+        int result = decodeModesMessage(&mm, bestmsg);
+        if (result < 0) {
+            if (result == -1)
                 Modes.stats_current.demod_rejected_unknown_icao++;
             else
                 Modes.stats_current.demod_rejected_bad++;
-            continue; // nope.
+            return 0;
+        } else {
+            Modes.stats_current.demod_accepted[mm.correctedbits]++;
+            if (bestsoft->errors)
+                Modes.stats_current.demod_soft_fixed++; // the tables couldn't fix it, so decoding used this
         }
+    }
 
-        msglen = modesMessageLenByType(bestmsg[0] >> 3);
+    // measure signal power
+    {
+        double signal_power;
+        uint64_t scaled_signal_power = 0;
+        int signal_len = msglen*12/5;
+        int k;
+
+        for (k = 0; k < signal_len; ++k) {
+            uint32_t mag = m[j+19+k];
+            scaled_signal_power += mag * mag;
+        }
 
-        // Set initial mm structure details
-        mm = zeroMessage;
+        signal_power = scaled_signal_power / (double) MAG_FULL_SCALE / MAG_FULL_SCALE;
+        mm.signalLevel = signal_power / signal_len;
+        Modes.stats_current.signal_power_sum += signal_power;
+        Modes.stats_current.signal_power_count += signal_len;
+        *sum_scaled_signal_power += scaled_signal_power;
 
-        // For consistency with how the Beast / Radarcape does it,
-        // we report the timestamp at the end of bit 56 (even if
-        // the frame is a 112-bit frame)
-        mm.timestampMsg = mag->sampleTimestamp + j*5 + (8 + 56) * 12 + bestphase;
+        if (mm.signalLevel > Modes.stats_current.peak_signal_power)
+            Modes.stats_current.peak_signal_power = mm.signalLevel;
+        if (mm.signalLevel > 0.50119)
+            Modes.stats_current.strong_signal_count++; // signal power above -3dBFS
+    }
 
-        // compute message receive time as block-start-time + difference in the 12MHz clock
-        mm.sysTimestampMsg = mag->sysTimestamp; // start of block time
-        mm.sysTimestampMsg.tv_nsec += receiveclock_ns_elapsed(mag->sampleTimestamp, mm.timestampMsg);
-        normalize_timespec(&mm.sysTimestampMsg);
+    // Pass data to the next layer
+    useModesMessage(&mm);
+
+    // Skip over the message:
+    // (we actually skip to 8 bits before the end of the message,
+    //  because we can often decode two messages that *almost* collide,
+    //  where the preamble of the second message clobbered the last
+    //  few bits of the first message, but the message bits didn't
+    //  overlap)
+    return j + msglen*12/5 + 1;
+}
 
-        mm.score = bestscore;
+//
+// Try the trial phases for a preamble at m[j] and return the best score found
+// (-2 if nothing usable), with the message, phase and any --soft-fix
+// correction that gave it. Two message buffers are needed so the best result
+// so far is not overwritten. *search_out says how a ranked phase search
+// (--demod-phases) went. If record is not NULL, each trial that gets as far
+// as a CRC is kept there (and msg1/msg2 are not used).
+//
+static inline int demodulate2400_phases(mag_t *m, uint32_t j, unsigned char *msg1, unsigned char *msg2,
+                                        unsigned char **bestmsg_out, int *bestphase_out, struct errorinfo *bestsoft_out,
+                                        int *search_out, struct sliced_message *record)
+{
+    unsigned char *msg = msg1, *bestmsg = NULL;
+    struct errorinfo soft = { 0, 0, { -1, -1 }, 0 }, bestsoft = soft;
+    int bestscore = -2, bestphase = -1;
+    int phase_order[5] = { 4, 5, 6, 7, 8 };
+    int search = PHASE_SEARCH_FULL;
+    int k;
+
+    // try all phases, or the most likely ones first if --demod-phases asked for that
+    if (Modes.demod_phases < 5)
+        rank_preamble_phases(&m[j], phase_order);
+    if (record)
+        record->ntrials = 0;
+
+    for (k = 0; k < 5; ++k) {
+        int try_phase, score, nbytes;
+        uint32_t crc;
+
+        if (k == Modes.demod_phases) {
+            // done with the ranked phases; was that enough?
+            if (bestmsg && bestscore == scoreModesMessageMax(bestmsg[0] >> 3)) {
+                search = PHASE_SEARCH_RANKED;
+                break;
+            }
+            search = PHASE_SEARCH_FALLBACK;
+        }
+
+        try_phase = phase_order[k];
+        if (record)
+            msg = record->trials[record->ntrials].msg;
+
+        // Decode all the next 112 bits (stopping early for short or
+        // unknown DFs, or DFs that can't beat our best score so far)
+        // with the slicer specialized for this phase.
+        // We'll check the actual message type later
+        nbytes = slice_message(try_phase, &m[j+19], msg, bestscore, &crc);
+        if (nbytes == 1)
+            continue;
+
+        // Score the mode S message and see if it's any good.
+        score = scoreModesMessageCRC(msg, nbytes*8, crc);
+        soft.errors = 0;
+        if (score == -2 && Modes.soft_fix_bits && demodulate2400_soft_fix(&m[j+19], try_phase, msg, nbytes, crc, &soft))
+            score = scoreModesMessageSoft(msg, nbytes*8, crc, &soft);
+
+        if (record) {
+            record->trials[record->ntrials].phase = try_phase;
+            record->trials[record->ntrials].nbytes = nbytes;
+            record->trials[record->ntrials].crc = crc;
+            record->trials[record->ntrials].soft = soft;
+            record->ntrials++;
+        }
+
+        if (score > bestscore) {
+            // new high score!
+            bestmsg = msg;
+            bestscore = score;
+            bestphase = try_phase;
+            bestsoft = soft;
+
+            // swap to using the other buffer so we don't clobber our demodulated data
+            // (if we find a better result then we'll swap back, but that's OK because
+            // we no longer need this copy if we found a better one)
+            if (!record)
+                msg = (msg == msg1) ? msg2 : msg1;
+        }
+    }
 
-        // Decode the received message
-        {
-            int result = decodeModesMessage(&mm, bestmsg);
-            if (result < 0) {
-                if (result == -1)
+    *bestmsg_out = bestmsg;
+    *bestphase_out = bestphase;
+    *bestsoft_out = bestsoft;
+    *search_out = search;
+    return bestscore;
+}
+
+// Count a preamble that passed the preamble checks
+static void demodulate2400_count_preamble(int search)
+{
+    Modes.stats_current.demod_preambles++;
+    if (search == PHASE_SEARCH_RANKED)
+        Modes.stats_current.demod_phase_ranked++;
+    else if (search == PHASE_SEARCH_FALLBACK)
+        Modes.stats_current.demod_phase_fallback++;
+}
+
+static unsigned modeac_noise_level(struct mag_buf *mag);
+static int demodulate2400AC_at(struct mag_buf *mag, unsigned f1_sample, unsigned noise_level);
+
+// Try the Mode A/C candidates ac[a..n_ac) from the fused scan that start at or
+// before 'until', skipping any inside a Mode A/C message we already found.
+// Returns the index of the first candidate not yet tried.
+static unsigned demodulate2400_ac_candidates(struct mag_buf *mag, const uint32_t *ac, unsigned a, unsigned n_ac,
+                                             uint32_t until, uint32_t *ac_next, unsigned noise_level)
+{
+    for (; a < n_ac && ac[a] <= until; ++a) {
+        if (ac[a] < *ac_next || ac[a] >= mag->length)
+            continue;
+        if (demodulate2400AC_at(mag, ac[a], noise_level))
+            *ac_next = ac[a] + (20*87 / 25) + 1;
+    }
+
+    return a;
+}
+
+//
+// Quiet span skipping
+//
+// The converters leave the peak magnitude of each MODES_MAG_BLOCK_SAMPLES block
+// in mag->block_max. Every test made at one offset (preamble, or a Mode A/C
+// F1 pulse) looks at less than a block's worth of samples, so if a block and
+// the one after it both peak below some level, nothing that needs a sample at
+// or above that level can start anywhere in the first block.
+//
+// For Mode A/C that level is the 6dB-over-noise F1 requirement, so skipping
+// is exact. The Mode S preamble checks are relative (peaks against the quiet
+// bits), so there is no exact level; --demod-skip-quiet sets one relative to
+// the buffer's mean level.
+//
+
+static inline int demodulate2400_block_quiet(const struct mag_buf *mag, unsigned block, unsigned nblocks, uint16_t level)
+{
+    return mag->block_max[block] < level && (block + 1 >= nblocks || mag->block_max[block + 1] < level);
+}
+
+// Find the first offset in [from, to) that isn't in a quiet block at 'level'
+// and return it, setting *run_end to the end of the run of non-quiet offsets
+// that starts there. Returns 'to' if there is nothing left to look at.
+// Offsets in the overlap at the start of the buffer are never skipped, as the
+// map doesn't cover them.
+static uint32_t demodulate2400_next_loud(const struct mag_buf *mag, uint32_t from, uint32_t to,
+                                         uint16_t level, uint32_t *run_end)
+{
+    const uint32_t base = Modes.trailing_samples;
+    unsigned nblocks = (mag->length + MODES_MAG_BLOCK_SAMPLES - 1) / MODES_MAG_BLOCK_SAMPLES;
+    uint32_t j = from, e;
+
+    while (j < to && j >= base && demodulate2400_block_quiet(mag, (j - base) / MODES_MAG_BLOCK_SAMPLES, nblocks, level))
+        j = base + ((j - base) / MODES_MAG_BLOCK_SAMPLES + 1) * MODES_MAG_BLOCK_SAMPLES;
+
+    if (j >= to) {
+        *run_end = to;
+        return to;
+    }
+
+    e = j;
+    while (e < to && (e < base || !demodulate2400_block_quiet(mag, (e - base) / MODES_MAG_BLOCK_SAMPLES, nblocks, level))) {
+        if (e < base)
+            e = base;
+        else
+            e = base + ((e - base) / MODES_MAG_BLOCK_SAMPLES + 1) * MODES_MAG_BLOCK_SAMPLES;
+    }
+
+    *run_end = (e < to ? e : to);
+    return j;
+}
+
+// Level below which no Mode S preamble is looked for (--demod-skip-quiet), or 0
+static uint16_t demodulate2400_quiet_level(const struct mag_buf *mag)
+{
+    double level;
+
+    if (Modes.demod_skip_quiet <= 0)
+        return 0;
+
+    level = mag->mean_level * MAG_FULL_SCALE * pow(10.0, Modes.demod_skip_quiet / 20.0);
+    return (level >= MAG_FULL_SCALE ? MAG_FULL_SCALE : (uint16_t) level);
+}
+
+//
+// Search preamble offsets [start, end) of 'mag' for Mode S messages.
+//
+// With slice == NULL, each message is decoded and passed on as soon as it is
+// found, and stats go to Modes.stats_current. If mode_ac is set, Mode A/C
+// messages are found in the same pass over the samples (see scan_preambles)
+// and passed on in time order with the Mode S ones. Otherwise this only slices and
+// scores messages (it touches no shared state, so it can run on a worker
+// thread) and appends those starting in [slice->from, slice->to) to
+// slice->messages for the main thread to decode, including any that overlap
+// an earlier one.
+//
+static void demodulate2400_range(struct mag_buf *mag, uint32_t start, uint32_t end,
+                                 struct demod_slice *slice, uint64_t *sum_scaled_signal_power, int mode_ac)
+{
+    unsigned char msg1[MODES_LONG_MSG_BYTES], msg2[MODES_LONG_MSG_BYTES];
+    uint32_t j, chunk, next = start;
+    struct preamble_candidate candidates[PREAMBLE_SCAN_CHUNK];
+
+    uint32_t ac_candidates[PREAMBLE_SCAN_CHUNK];
+    uint32_t ac_next = start + 1;
+    unsigned ac_noise_level = 0;
+    mag_t ac_level = 0;
+    uint16_t quiet_level = demodulate2400_quiet_level(mag);
+
+    unsigned char *bestmsg;
+    int bestscore, bestphase;
+    struct errorinfo bestsoft;
+
+    mag_t *m = MAG_DATA(mag);
+
+    if (mode_ac) {
+        // shared by every A/C candidate in this buffer; F1 must be 6dB above it
+        ac_noise_level = modeac_noise_level(mag);
+        ac_level = MAG_FROM_16(ac_noise_level * 2); // rounded down, so the scan never misses a candidate
+        if (ac_noise_level * 2 > 65535)
+            mode_ac = 0; // nothing can pass
+        else if (ac_level < quiet_level)
+            quiet_level = ac_level; // only skip what neither decoder wants
+    }
+
+    for (chunk = start; chunk < end; chunk += PREAMBLE_SCAN_CHUNK) {
+        uint32_t chunk_end = (chunk + PREAMBLE_SCAN_CHUNK < end ? chunk + PREAMBLE_SCAN_CHUNK : end);
+        uint32_t scan_from = (mode_ac && ac_next - 1 < next ? ac_next - 1 : next);
+        uint32_t run_start, run_end;
+        unsigned ncandidates = 0, c, n_ac = 0, a = 0;
+
+        if (scan_from >= chunk_end)
+            continue; // still inside a message we decoded earlier
+
+        run_start = (scan_from > chunk ? scan_from : chunk);
+        while (run_start < chunk_end) {
+            unsigned run_ac = 0;
+
+            if (quiet_level)
+                run_start = demodulate2400_next_loud(mag, run_start, chunk_end, quiet_level, &run_end);
+            else
+                run_end = chunk_end;
+            if (run_start >= run_end)
+                break;
+
+            ncandidates += scan_preambles(m, run_start, run_end, candidates + ncandidates,
+                                          ac_level, mode_ac ? ac_candidates + n_ac : NULL, &run_ac);
+            n_ac += run_ac;
+            run_start = run_end;
+        }
+
+        for (c = 0; c < ncandidates; ++c) {
+            mag_t *preamble;
+            unsigned hint;
+            int high;
+            uint32_t base_signal, base_noise;
+            int search;
+
+            j = candidates[c].offset;
+
+            // Mode A/C messages that start first go first
+            if (a < n_ac)
+                a = demodulate2400_ac_candidates(mag, ac_candidates, a, n_ac, j, &ac_next, ac_noise_level);
+
+            if (j < next)
+                continue; // overlaps a message we just decoded
+
+            preamble = &m[j];
+            hint = candidates[c].phase_hint;
+
+            // Look for a message starting at around sample 0 with phase offset 3..7
+
+            // Ideal sample values for preambles with different phase
+            // Xn is the first data symbol with phase offset N
+            //
+            // sample#: 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0
+            // phase 3: 2/4\0/5\1 0 0 0 0/5\1/3 3\0 0 0 0 0 0 X4
+            // phase 4: 1/5\0/4\2 0 0 0 0/4\2 2/4\0 0 0 0 0 0 0 X0
+            // phase 5: 0/5\1/3 3\0 0 0 0/3 3\1/5\0 0 0 0 0 0 0 X1
+            // phase 6: 0/4\2 2/4\0 0 0 0 2/4\0/5\1 0 0 0 0 0 0 X2
+            // phase 7: 0/3 3\1/5\0 0 0 0 1/5\0/4\2 0 0 0 0 0 0 X3
+            //
+
+            // scan_preambles() has already done the quick check (rising edge 0->1 and
+            // falling edge 12->13) and told us which of the peak patterns matched.
+            // Take the first match, in phase order.
+
+            if (hint & PHASE_HINT_3) {
+                // peaks at 1,3,9,11-12: phase 3
+                high = (preamble[1] + preamble[3] + preamble[9] + preamble[11] + preamble[12]) / 4;
+                base_signal = preamble[1] + preamble[3] + preamble[9];
+                base_noise = preamble[5] + preamble[6] + preamble[7];
+            } else if (hint & PHASE_HINT_4) {
+                // peaks at 1,3,9,12: phase 4
+                high = (preamble[1] + preamble[3] + preamble[9] + preamble[12]) / 4;
+                base_signal = preamble[1] + preamble[3] + preamble[9] + preamble[12];
+                base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
+            } else if (hint & PHASE_HINT_5) {
+                // peaks at 1,3-4,9-10,12: phase 5
+                high = (preamble[1] + preamble[3] + preamble[4] + preamble[9] + preamble[10] + preamble[12]) / 4;
+                base_signal = preamble[1] + preamble[12];
+                base_noise = preamble[6] + preamble[7];
+            } else if (hint & PHASE_HINT_6) {
+                // peaks at 1,4,10,12: phase 6
+                high = (preamble[1] + preamble[4] + preamble[10] + preamble[12]) / 4;
+                base_signal = preamble[1] + preamble[4] + preamble[10] + preamble[12];
+                base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
+            } else if (hint & PHASE_HINT_7) {
+                // peaks at 1-2,4,10,12: phase 7
+                high = (preamble[1] + preamble[2] + preamble[4] + preamble[10] + preamble[12]) / 4;
+                base_signal = preamble[4] + preamble[10] + preamble[12];
+                base_noise = preamble[6] + preamble[7] + preamble[8];
+            } else {
+                // no suitable peaks
+                continue;
+            }
+
+            // Check for enough signal
+            if (base_signal * 2 < 3 * base_noise) // about 3.5dB SNR
+                continue;
+
+            // Check that the "quiet" bits 6,7,15,16,17 are actually quiet
+            if (preamble[5] >= high ||
+                preamble[6] >= high ||
+                preamble[7] >= high ||
+                preamble[8] >= high ||
+                preamble[14] >= high ||
+                preamble[15] >= high ||
+                preamble[16] >= high ||
+                preamble[17] >= high ||
+                preamble[18] >= high) {
+                continue;
+            }
+
+            if (slice) {
+                // Leave the decoding (and counting) to the main thread
+                struct sliced_message *sm;
+
+                if (slice->nmessages == slice->max_messages) {
+                    slice->max_messages = (slice->max_messages ? slice->max_messages * 2 : 256);
+                    slice->messages = realloc(slice->messages, slice->max_messages * sizeof(*slice->messages));
+                    if (!slice->messages) {
+                        fprintf(stderr, "Out of memory allocating demodulator slice.\n");
+                        exit(1);
+                    }
+                }
+
+                sm = &slice->messages[slice->nmessages];
+                demodulate2400_phases(m, j, NULL, NULL, &bestmsg, &bestphase, &bestsoft, &search, sm);
+                sm->offset = j;
+                sm->search = search;
+                slice->nmessages++;
+
+                // Don't skip over the message here: only decoding can tell
+                // whether it is real, and the main thread skips as it decodes
+                continue;
+            }
+
+            bestscore = demodulate2400_phases(m, j, msg1, msg2, &bestmsg, &bestphase, &bestsoft, &search, NULL);
+            demodulate2400_count_preamble(search);
+
+            // Do we have a candidate?
+            if (bestscore < 0) {
+                if (bestscore == -1)
                     Modes.stats_current.demod_rejected_unknown_icao++;
                 else
                     Modes.stats_current.demod_rejected_bad++;
-                continue;
-            } else {
-                Modes.stats_current.demod_accepted[mm.correctedbits]++;
+                continue; // nope.
+            }
+
+            {
+                uint32_t resume = demodulate2400_emit(mag, j, bestmsg, bestscore, bestphase, &bestsoft, sum_scaled_signal_power);
+                if (resume)
+                    next = resume;
             }
         }
 
-        // measure signal power
-        {
-            double signal_power;
-            uint64_t scaled_signal_power = 0;
-            int signal_len = msglen*12/5;
-            int k;
+        if (a < n_ac)
+            demodulate2400_ac_candidates(mag, ac_candidates, a, n_ac, chunk_end, &ac_next, ac_noise_level);
+    }
+}
+
+//
+// Parallel demodulation (--demod-threads)
+//
+// Each magnitude buffer is split into equal slices, one per thread. The main
+// thread slices the first one itself and the worker pool takes the rest.
+// Workers keep every preamble they find, even inside another message. Once
+// all slices are done, the main thread decodes the collected messages in
+// order, skipping any that overlap a message it decoded, exactly as the
+// serial demodulator would have skipped them.
+//
+
+static struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t start_cond;            // signalled when there is a new buffer to work on
+    pthread_cond_t done_cond;             // signalled when a worker finishes its slice
+    pthread_t *threads;
+    struct demod_slice *slices;           // slices[0] is handled by the main thread
+    int nslices;
+    struct mag_buf *mag;                  // buffer being worked on
+    unsigned generation;                  // bumped for each new buffer
+    int pending;                          // number of workers still busy
+    int exit;
+} demod_pool;
+
+static void demodulate2400_slice(struct mag_buf *mag, struct demod_slice *slice)
+{
+    struct timespec start_time;
+
+    start_cpu_timing(&start_time);
+    demodulate2400_range(mag, slice->from, slice->to, slice, NULL, 0);
+    end_cpu_timing(&start_time, &slice->demod_cpu);
+}
+
+static void *demodulate2400_worker(void *arg)
+{
+    struct demod_slice *slice = arg;
+    unsigned generation = 0;
+
+    placementJoin(THREAD_DEMOD);
+
+    pthread_mutex_lock(&demod_pool.mutex);
+    for (;;) {
+        while (!demod_pool.exit && demod_pool.generation == generation)
+            pthread_cond_wait(&demod_pool.start_cond, &demod_pool.mutex);
+        if (demod_pool.exit)
+            break;
+        generation = demod_pool.generation;
+
+        pthread_mutex_unlock(&demod_pool.mutex);
+        demodulate2400_slice(demod_pool.mag, slice);
+        pthread_mutex_lock(&demod_pool.mutex);
+
+        if (--demod_pool.pending == 0)
+            pthread_cond_signal(&demod_pool.done_cond);
+    }
+    pthread_mutex_unlock(&demod_pool.mutex);
+
+    placementLeave();
+    return NULL;
+}
+
+void demodulate2400InitThreads(int nthreads)
+{
+    int i;
+
+    if (nthreads <= 1)
+        return;
+
+    pthread_mutex_init(&demod_pool.mutex, NULL);
+    pthread_cond_init(&demod_pool.start_cond, NULL);
+    pthread_cond_init(&demod_pool.done_cond, NULL);
+
+    demod_pool.nslices = nthreads;
+    demod_pool.slices = calloc(nthreads, sizeof(*demod_pool.slices));
+    demod_pool.threads = calloc(nthreads, sizeof(*demod_pool.threads));
+    if (!demod_pool.slices || !demod_pool.threads) {
+        fprintf(stderr, "Out of memory allocating demodulator threads.\n");
+        exit(1);
+    }
+
+    for (i = 1; i < nthreads; ++i)
+        pthread_create(&demod_pool.threads[i], NULL, demodulate2400_worker, &demod_pool.slices[i]);
+}
 
-            for (k = 0; k < signal_len; ++k) {
-                uint32_t mag = m[j+19+k];
-                scaled_signal_power += mag * mag;
+void demodulate2400StopThreads(void)
+{
+    int i;
+
+    if (demod_pool.nslices <= 1)
+        return;
+
+    pthread_mutex_lock(&demod_pool.mutex);
+    demod_pool.exit = 1;
+    pthread_cond_broadcast(&demod_pool.start_cond);
+    pthread_mutex_unlock(&demod_pool.mutex);
+
+    for (i = 1; i < demod_pool.nslices; ++i)
+        pthread_join(demod_pool.threads[i], NULL);
+
+    for (i = 0; i < demod_pool.nslices; ++i)
+        free(demod_pool.slices[i].messages);
+    free(demod_pool.slices);
+    free(demod_pool.threads);
+    demod_pool.slices = NULL;
+    demod_pool.threads = NULL;
+    demod_pool.nslices = 0;
+
+    pthread_cond_destroy(&demod_pool.done_cond);
+    pthread_cond_destroy(&demod_pool.start_cond);
+    pthread_mutex_destroy(&demod_pool.mutex);
+}
+
+static void demodulate2400_parallel(struct mag_buf *mag, uint64_t *sum_scaled_signal_power)
+{
+    uint32_t slice_len = (mag->length + demod_pool.nslices - 1) / demod_pool.nslices;
+    uint32_t next = 0;
+    int i;
+
+    for (i = 0; i < demod_pool.nslices; ++i) {
+        struct demod_slice *slice = &demod_pool.slices[i];
+        slice->from = (i * slice_len < mag->length ? i * slice_len : mag->length);
+        slice->to = (slice->from + slice_len < mag->length ? slice->from + slice_len : mag->length);
+        slice->demod_cpu.tv_sec = 0;
+        slice->demod_cpu.tv_nsec = 0;
+        slice->nmessages = 0;
+    }
+
+    // start the workers on slices 1..n, do slice 0 ourselves
+    pthread_mutex_lock(&demod_pool.mutex);
+    demod_pool.mag = mag;
+    demod_pool.pending = demod_pool.nslices - 1;
+    demod_pool.generation++;
+    pthread_cond_broadcast(&demod_pool.start_cond);
+    pthread_mutex_unlock(&demod_pool.mutex);
+
+    demodulate2400_range(mag, demod_pool.slices[0].from, demod_pool.slices[0].to, &demod_pool.slices[0], NULL, 0);
+
+    pthread_mutex_lock(&demod_pool.mutex);
+    while (demod_pool.pending > 0)
+        pthread_cond_wait(&demod_pool.done_cond, &demod_pool.mutex);
+    pthread_mutex_unlock(&demod_pool.mutex);
+
+    // merge, in offset (and so timestamp) order
+    for (i = 0; i < demod_pool.nslices; ++i) {
+        struct demod_slice *slice = &demod_pool.slices[i];
+        unsigned n;
+
+        // worker CPU time is accounted as demodulation time, too
+        add_timespecs(&Modes.stats_current.demod_cpu, &slice->demod_cpu, &Modes.stats_current.demod_cpu);
+
+        for (n = 0; n < slice->nmessages; ++n) {
+            struct sliced_message *sm = &slice->messages[n];
+            unsigned char *bestmsg = NULL;
+            struct errorinfo *bestsoft = NULL;
+            int bestscore = -2, bestphase = -1;
+            int t;
+            uint32_t resume;
+
+            if (sm->offset < next)
+                continue; // overlaps a message we just decoded
+
+            demodulate2400_count_preamble(sm->search);
+
+            // Score again, in trial order: earlier messages in this buffer
+            // may have added addresses to the ICAO filter since slicing.
+            for (t = 0; t < sm->ntrials; ++t) {
+                int score = scoreModesMessageSoft(sm->trials[t].msg, sm->trials[t].nbytes*8, sm->trials[t].crc,
+                                                  sm->trials[t].soft.errors ? &sm->trials[t].soft : NULL);
+                if (score > bestscore) {
+                    bestmsg = sm->trials[t].msg;
+                    bestscore = score;
+                    bestphase = sm->trials[t].phase;
+                    bestsoft = &sm->trials[t].soft;
+                }
             }
 
-            signal_power = scaled_signal_power / 65535.0 / 65535.0;
-            mm.signalLevel = signal_power / signal_len;
-            Modes.stats_current.signal_power_sum += signal_power;
-            Modes.stats_current.signal_power_count += signal_len;
-            sum_scaled_signal_power += scaled_signal_power;
+            if (bestscore < 0) {
+                if (bestscore == -1)
+                    Modes.stats_current.demod_rejected_unknown_icao++;
+                else
+                    Modes.stats_current.demod_rejected_bad++;
+                continue;
+            }
 
-            if (mm.signalLevel > Modes.stats_current.peak_signal_power)
-                Modes.stats_current.peak_signal_power = mm.signalLevel;
-            if (mm.signalLevel > 0.50119)
-                Modes.stats_current.strong_signal_count++; // signal power above -3dBFS
+            resume = demodulate2400_emit(mag, sm->offset, bestmsg, bestscore, bestphase, bestsoft, sum_scaled_signal_power);
+            if (resume)
+                next = resume;
         }
+    }
+}
 
-        // Skip over the message:
-        // (we actually skip to 8 bits before the end of the message,
-        //  because we can often decode two messages that *almost* collide,
-        //  where the preamble of the second message clobbered the last
-        //  few bits of the first message, but the message bits didn't
-        //  overlap)
-        j += msglen*12/5;
-            
-        // Pass data to the next layer
-        useModesMessage(&mm);
+//
+// Given 'mlen' magnitude samples in 'm', sampled at 2.4MHz,
+// try to demodulate some Mode S messages (and Mode A/C messages,
+// if Modes.mode_ac is set).
+//
+void demodulate2400(struct mag_buf *mag)
+{
+    uint64_t sum_scaled_signal_power = 0;
+
+    if (demod_pool.nslices > 1) {
+        demodulate2400_parallel(mag, &sum_scaled_signal_power);
+        if (Modes.mode_ac)
+            demodulate2400AC(mag);
+    } else {
+        // single pass for both Mode S and (if enabled) Mode A/C
+        demodulate2400_range(mag, 0, mag->length, NULL, &sum_scaled_signal_power, Modes.mode_ac);
     }
 
     /* update noise power */
     {
-        double sum_signal_power = sum_scaled_signal_power / 65535.0 / 65535.0;
+        double sum_signal_power = sum_scaled_signal_power / (double) MAG_FULL_SCALE / MAG_FULL_SCALE;
         Modes.stats_current.noise_power_sum += (mag->mean_power * mag->length - sum_signal_power);
         Modes.stats_current.noise_power_count += mag->length;
     }
 }
 
-
 #ifdef MODEAC_DEBUG
 
 static int yscale(unsigned signal)
 {
-    return (int) (299 - 299.0 * signal / 65536.0);
+    return (int) (299 - 299.0 * signal / (MAG_FULL_SCALE + 1.0));
 }
 
-static void draw_modeac(uint16_t *m, unsigned modeac, unsigned f1_clock, unsigned noise_threshold, unsigned signal_threshold, unsigned bits, unsigned noisy_bits, unsigned uncertain_bits)
+static void draw_modeac(mag_t *m, unsigned modeac, unsigned f1_clock, unsigned noise_threshold, unsigned signal_threshold, unsigned bits, unsigned noisy_bits, unsigned uncertain_bits)
 {
     // 25 bits at 87*60MHz
     // use 1 pixel = 30MHz = 1087 pixels
@@ -438,8 +1426,8 @@ static void draw_modeac(uint16_t *m, unsigned modeac, unsigned f1_clock, unsigne
     }
 
     // draw thresholds
-    gdImageLine(im, 0, yscale(noise_threshold), 1087, yscale(noise_threshold), blue);
-    gdImageLine(im, 0, yscale(signal_threshold), 1087, yscale(signal_threshold), blue);
+    gdImageLine(im, 0, yscale(MAG_FROM_16(noise_threshold)), 1087, yscale(MAG_FROM_16(noise_threshold)), blue);
+    gdImageLine(im, 0, yscale(MAG_FROM_16(signal_threshold)), 1087, yscale(MAG_FROM_16(signal_threshold)), blue);
 
     // save it
 
@@ -469,193 +1457,213 @@ static void draw_modeac(uint16_t *m, unsigned modeac, unsigned f1_clock, unsigne
 //
 // one 2.4MHz sample = 25 cycles
 
-void demodulate2400AC(struct mag_buf *mag)
+// Noise level used for the Mode A/C framing pulse checks, from the buffer's
+// mean level and power, on the 0..65535 scale (see MAG_TO_16)
+static unsigned modeac_noise_level(struct mag_buf *mag)
+{
+    double noise_stddev = sqrt(mag->mean_power - mag->mean_level * mag->mean_level); // Var(X) = E[(X-E[X])^2] = E[X^2] - (E[X])^2
+    return (unsigned) ((mag->mean_power + noise_stddev) * 65535 + 0.5);
+}
+
+// Try to demodulate a Mode A/C message with F1 starting at f1_sample.
+// Returns 1 if a message was found and passed on, 0 otherwise.
+static int demodulate2400AC_at(struct mag_buf *mag, unsigned f1_sample, unsigned noise_level)
 {
     struct modesMessage mm;
-    uint16_t *m = mag->data;
+    mag_t *m = MAG_DATA(mag);
     uint32_t mlen = mag->length;
-    unsigned f1_sample;
-
-    memset(&mm, 0, sizeof(mm));
-
-    double noise_stddev = sqrt(mag->mean_power - mag->mean_level * mag->mean_level); // Var(X) = E[(X-E[X])^2] = E[X^2] - (E[X])^2
-    unsigned noise_level = (unsigned) ((mag->mean_power + noise_stddev) * 65535 + 0.5);
-
-    for (f1_sample = 1; f1_sample < mlen; ++f1_sample) {
-        // Mode A/C messages should match this bit sequence:
-
-        // bit #     value
-        //   -1       0    quiet zone
-        //    0       1    framing pulse (F1)
-        //    1      C1
-        //    2      A1
-        //    3      C2
-        //    4      A2
-        //    5      C4
-        //    6      A4
-        //    7       0    quiet zone (X1)
-        //    8      B1
-        //    9      D1
-        //   10      B2
-        //   11      D2
-        //   12      B4
-        //   13      D4
-        //   14       1    framing pulse (F2)
-        //   15       0    quiet zone (X2)
-        //   16       0    quiet zone (X3)
-        //   17     SPI
-        //   18       0    quiet zone (X4)
-        //   19       0    quiet zone (X5)
-
-        // Look for a F1 and F2 pair,
-        // with F1 starting at offset f1_sample.
-
-        // the first framing pulse covers 3.5 samples:
-        //
-        // |----|        |----|
-        // | F1 |________| C1 |_
-        //
-        // | 0 | 1 | 2 | 3 | 4 |
-        //
-        // and there is some unknown phase offset of the
-        // leading edge e.g.:
-        //
-        //   |----|        |----|
-        // __| F1 |________| C1 |_
-        //
-        // | 0 | 1 | 2 | 3 | 4 |
-        //
-        // in theory the "on" period can straddle 3 samples
-        // but it's not a big deal as at most 4% of the power
-        // is in the third sample.
-
-        if (!(m[f1_sample-1] < m[f1_sample+0]))
-            continue;      // not a rising edge
-
-        if (m[f1_sample+2] > m[f1_sample+0] || m[f1_sample+2] > m[f1_sample+1])
-            continue;      // quiet part of bit wasn't sufficiently quiet
-
-        unsigned f1_level = (m[f1_sample+0] + m[f1_sample+1]) / 2;
-
-        if (noise_level * 2 > f1_level) {
-            // require 6dB above noise
-            continue;
-        }
 
-        // estimate initial clock phase based on the amount of power
-        // that ended up in the second sample
+    // Mode A/C messages should match this bit sequence:
+
+    // bit #     value
+    //   -1       0    quiet zone
+    //    0       1    framing pulse (F1)
+    //    1      C1
+    //    2      A1
+    //    3      C2
+    //    4      A2
+    //    5      C4
+    //    6      A4
+    //    7       0    quiet zone (X1)
+    //    8      B1
+    //    9      D1
+    //   10      B2
+    //   11      D2
+    //   12      B4
+    //   13      D4
+    //   14       1    framing pulse (F2)
+    //   15       0    quiet zone (X2)
+    //   16       0    quiet zone (X3)
+    //   17     SPI
+    //   18       0    quiet zone (X4)
+    //   19       0    quiet zone (X5)
+
+    // Look for a F1 and F2 pair,
+    // with F1 starting at offset f1_sample.
+
+    // the first framing pulse covers 3.5 samples:
+    //
+    // |----|        |----|
+    // | F1 |________| C1 |_
+    //
+    // | 0 | 1 | 2 | 3 | 4 |
+    //
+    // and there is some unknown phase offset of the
+    // leading edge e.g.:
+    //
+    //   |----|        |----|
+    // __| F1 |________| C1 |_
+    //
+    // | 0 | 1 | 2 | 3 | 4 |
+    //
+    // in theory the "on" period can straddle 3 samples
+    // but it's not a big deal as at most 4% of the power
+    // is in the third sample.
+
+    if (!(m[f1_sample-1] < m[f1_sample+0]))
+        return 0;      // not a rising edge
+
+    if (m[f1_sample+2] > m[f1_sample+0] || m[f1_sample+2] > m[f1_sample+1])
+        return 0;      // quiet part of bit wasn't sufficiently quiet
+
+    unsigned f1_level = (MAG_TO_16(m[f1_sample+0]) + MAG_TO_16(m[f1_sample+1])) / 2;
+
+    if (noise_level * 2 > f1_level) {
+        // require 6dB above noise
+        return 0;
+    }
 
-        float f1a_power = (float)m[f1_sample] * m[f1_sample];
-        float f1b_power = (float)m[f1_sample+1] * m[f1_sample+1];
-        float fraction = f1b_power / (f1a_power + f1b_power);
-        unsigned f1_clock = (unsigned) (25 * (f1_sample + fraction * fraction) + 0.5);
+    // estimate initial clock phase based on the amount of power
+    // that ended up in the second sample
 
-        // same again for F2
-        // F2 is 20.3us / 14 bit periods after F1
-        unsigned f2_clock = f1_clock + (87 * 14);
-        unsigned f2_sample = f2_clock / 25;
-        assert(f2_sample < mlen + Modes.trailing_samples);
+    float f1a_power = (float)m[f1_sample] * m[f1_sample];
+    float f1b_power = (float)m[f1_sample+1] * m[f1_sample+1];
+    float fraction = f1b_power / (f1a_power + f1b_power);
+    unsigned f1_clock = (unsigned) (25 * (f1_sample + fraction * fraction) + 0.5);
 
-        if (!(m[f2_sample-1] < m[f2_sample+0]))
-            continue;
+    // same again for F2
+    // F2 is 20.3us / 14 bit periods after F1
+    unsigned f2_clock = f1_clock + (87 * 14);
+    unsigned f2_sample = f2_clock / 25;
+    assert(f2_sample < mlen + Modes.trailing_samples);
 
-        if (m[f2_sample+2] > m[f2_sample+0] || m[f2_sample+2] > m[f2_sample+1])
-            continue;      // quiet part of bit wasn't sufficiently quiet
+    if (!(m[f2_sample-1] < m[f2_sample+0]))
+        return 0;
 
-        unsigned f2_level = (m[f2_sample+0] + m[f2_sample+1]) / 2;
+    if (m[f2_sample+2] > m[f2_sample+0] || m[f2_sample+2] > m[f2_sample+1])
+        return 0;      // quiet part of bit wasn't sufficiently quiet
 
-        if (noise_level * 2 > f2_level) {
-            // require 6dB above noise
-            continue;
-        }
+    unsigned f2_level = (MAG_TO_16(m[f2_sample+0]) + MAG_TO_16(m[f2_sample+1])) / 2;
 
-        unsigned f1f2_level = (f1_level > f2_level ? f1_level : f2_level);
+    if (noise_level * 2 > f2_level) {
+        // require 6dB above noise
+        return 0;
+    }
 
-        float midpoint = sqrtf(noise_level * f1f2_level); // geometric mean of the two levels
-        unsigned signal_threshold = (unsigned) (midpoint * M_SQRT2 + 0.5); // +3dB
-        unsigned noise_threshold = (unsigned) (midpoint / M_SQRT2 + 0.5);  // -3dB
+    unsigned f1f2_level = (f1_level > f2_level ? f1_level : f2_level);
 
-        // Looks like a real signal. Demodulate all the bits.
-        unsigned uncertain_bits = 0;
-        unsigned noisy_bits = 0;
-        unsigned bits = 0;
-        unsigned bit;
-        unsigned clock;
-        for (bit = 0, clock = f1_clock; bit < 20; ++bit, clock += 87) {
-            unsigned sample = clock / 25;
+    float midpoint = sqrtf(noise_level * f1f2_level); // geometric mean of the two levels
+    unsigned signal_threshold = (unsigned) (midpoint * M_SQRT2 + 0.5); // +3dB
+    unsigned noise_threshold = (unsigned) (midpoint / M_SQRT2 + 0.5);  // -3dB
 
-            bits <<= 1;
-            noisy_bits <<= 1;
-            uncertain_bits <<= 1;
+    // Looks like a real signal. Demodulate all the bits.
+    unsigned uncertain_bits = 0;
+    unsigned noisy_bits = 0;
+    unsigned bits = 0;
+    unsigned bit;
+    unsigned clock;
+    for (bit = 0, clock = f1_clock; bit < 20; ++bit, clock += 87) {
+        unsigned sample = clock / 25;
 
-            // check for excessive noise in the quiet period
-            if (m[sample+2] >= signal_threshold) {
-                noisy_bits |= 1;
-            }
+        bits <<= 1;
+        noisy_bits <<= 1;
+        uncertain_bits <<= 1;
 
-            // decide if this bit is on or off
-            if (m[sample+0] >= signal_threshold || m[sample+1] >= signal_threshold) {
-                bits |= 1;
-            } else if (m[sample+0] > noise_threshold && m[sample+1] > noise_threshold) {
-                /* not certain about this bit */
-                uncertain_bits |= 1;
-            } else {
-                /* this bit is off */
-            }
+        // check for excessive noise in the quiet period
+        if (MAG_TO_16(m[sample+2]) >= signal_threshold) {
+            noisy_bits |= 1;
         }
 
-        // framing bits must be on
-        if ((bits & 0x80020) != 0x80020) {
-            continue;
+        // decide if this bit is on or off
+        if (MAG_TO_16(m[sample+0]) >= signal_threshold || MAG_TO_16(m[sample+1]) >= signal_threshold) {
+            bits |= 1;
+        } else if (MAG_TO_16(m[sample+0]) > noise_threshold && MAG_TO_16(m[sample+1]) > noise_threshold) {
+            /* not certain about this bit */
+            uncertain_bits |= 1;
+        } else {
+            /* this bit is off */
         }
+    }
 
-        // quiet bits must be off
-        if ((bits & 0x0101B) != 0) {
-            continue;
-        }
+    // framing bits must be on
+    if ((bits & 0x80020) != 0x80020) {
+        return 0;
+    }
 
-        if (noisy_bits || uncertain_bits) {
-            continue;
-        }
+    // quiet bits must be off
+    if ((bits & 0x0101B) != 0) {
+        return 0;
+    }
 
-        // Convert to the form that we use elsewhere:
-        //  00 A4 A2 A1  00 B4 B2 B1  SPI C4 C2 C1  00 D4 D2 D1
-        unsigned modeac =
-            ((bits & 0x40000) ? 0x0010 : 0) |  // C1
-            ((bits & 0x20000) ? 0x1000 : 0) |  // A1
-            ((bits & 0x10000) ? 0x0020 : 0) |  // C2
-            ((bits & 0x08000) ? 0x2000 : 0) |  // A2
-            ((bits & 0x04000) ? 0x0040 : 0) |  // C4
-            ((bits & 0x02000) ? 0x4000 : 0) |  // A4
-            ((bits & 0x00800) ? 0x0100 : 0) |  // B1
-            ((bits & 0x00400) ? 0x0001 : 0) |  // D1
-            ((bits & 0x00200) ? 0x0200 : 0) |  // B2
-            ((bits & 0x00100) ? 0x0002 : 0) |  // D2
-            ((bits & 0x00080) ? 0x0400 : 0) |  // B4
-            ((bits & 0x00040) ? 0x0004 : 0) |  // D4
-            ((bits & 0x00004) ? 0x0080 : 0);   // SPI
+    if (noisy_bits || uncertain_bits) {
+        return 0;
+    }
+
+    // Convert to the form that we use elsewhere:
+    //  00 A4 A2 A1  00 B4 B2 B1  SPI C4 C2 C1  00 D4 D2 D1
+    unsigned modeac =
+        ((bits & 0x40000) ? 0x0010 : 0) |  // C1
+        ((bits & 0x20000) ? 0x1000 : 0) |  // A1
+        ((bits & 0x10000) ? 0x0020 : 0) |  // C2
+        ((bits & 0x08000) ? 0x2000 : 0) |  // A2
+        ((bits & 0x04000) ? 0x0040 : 0) |  // C4
+        ((bits & 0x02000) ? 0x4000 : 0) |  // A4
+        ((bits & 0x00800) ? 0x0100 : 0) |  // B1
+        ((bits & 0x00400) ? 0x0001 : 0) |  // D1
+        ((bits & 0x00200) ? 0x0200 : 0) |  // B2
+        ((bits & 0x00100) ? 0x0002 : 0) |  // D2
+        ((bits & 0x00080) ? 0x0400 : 0) |  // B4
+        ((bits & 0x00040) ? 0x0004 : 0) |  // D4
+        ((bits & 0x00004) ? 0x0080 : 0);   // SPI
 
 #ifdef MODEAC_DEBUG
-        draw_modeac(m, modeac, f1_clock, noise_threshold, signal_threshold, bits, noisy_bits, uncertain_bits);
+    draw_modeac(m, modeac, f1_clock, noise_threshold, signal_threshold, bits, noisy_bits, uncertain_bits);
 #endif
 
-        // This message looks good, submit it
+    // This message looks good, submit it
+    memset(&mm, 0, sizeof(mm));
 
-        // For consistency with how the Beast / Radarcape does it,
-        // we report the timestamp at the second framing pulse (F2)
-        mm.timestampMsg = mag->sampleTimestamp + f2_clock / 5;  // 60MHz -> 12MHz
+    // For consistency with how the Beast / Radarcape does it,
+    // we report the timestamp at the second framing pulse (F2)
+    mm.timestampMsg = mag->sampleTimestamp + f2_clock / 5;  // 60MHz -> 12MHz
 
-        // compute message receive time as block-start-time + difference in the 12MHz clock
-        mm.sysTimestampMsg = mag->sysTimestamp; // start of block time
-        mm.sysTimestampMsg.tv_nsec += receiveclock_ns_elapsed(mag->sampleTimestamp, mm.timestampMsg);
-        normalize_timespec(&mm.sysTimestampMsg);
+    // compute message receive time as block-start-time + difference in the 12MHz clock
+    mm.sysTimestampMsg = mag->sysTimestamp; // start of block time
+    mm.sysTimestampMsg.tv_nsec += receiveclock_ns_elapsed(mag->sampleTimestamp, mm.timestampMsg);
+    normalize_timespec(&mm.sysTimestampMsg);
 
-        decodeModeAMessage(&mm, modeac);
+    decodeModeAMessage(&mm, modeac);
 
-        // Pass data to the next layer
-        useModesMessage(&mm);
+    // Pass data to the next layer
+    useModesMessage(&mm);
+
+    Modes.stats_current.demod_modeac++;
+    return 1;
+}
 
-        f1_sample += (20*87 / 25);
-        Modes.stats_current.demod_modeac++;
+void demodulate2400AC(struct mag_buf *mag)
+{
+    uint32_t mlen = mag->length;
+    unsigned noise_level = modeac_noise_level(mag);
+    uint16_t quiet_level = MAG_FROM_16(noise_level * 2 > 65535 ? 65535 : noise_level * 2);
+    uint32_t j = 0, run_end;
+
+    // j is the sample before F1, as in the fused scan
+    while (j + 1 < mlen) {
+        j = demodulate2400_next_loud(mag, j, mlen - 1, quiet_level, &run_end);
+        for (; j < run_end; ++j) {
+            if (demodulate2400AC_at(mag, j + 1, noise_level))
+                j += (20*87 / 25);
+        }
     }
 }
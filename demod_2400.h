@@ -24,7 +24,17 @@
 
 struct mag_buf;
 
+void demodulate2400Init(void);
 void demodulate2400(struct mag_buf *mag);
 void demodulate2400AC(struct mag_buf *mag);
+void demodulate2400InitThreads(int nthreads);
+void demodulate2400StopThreads(void);
+
+// The same, for 8-bit magnitudes (--mag8)
+void demodulate2400Mag8Init(void);
+void demodulate2400Mag8(struct mag_buf *mag);
+void demodulate2400Mag8AC(struct mag_buf *mag);
+void demodulate2400Mag8InitThreads(int nthreads);
+void demodulate2400Mag8StopThreads(void);
 
 #endif
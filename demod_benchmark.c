@@ -0,0 +1,553 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// demod_benchmark.c: benchmarks for the demodulators
+//
+// Copyright (c) 2016-2017 Oliver Jowett <oliver@mutability.co.uk>
+// Copyright (c) 2017 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+// Each test runs a demodulator over a set of magnitude buffers until it has
+// used 5 seconds of CPU, with messages going through the usual decoding and
+// tracking but not displayed or sent anywhere (Modes.quiet, no networking).
+//
+// testfiles/modes1.bin is a 2.0MHz capture, so it is only run through the
+// 2.0MHz demodulator. The synthetic buffers are a dense mix of Mode S and
+// Mode A/C replies at random levels and phases, generated at each sample rate
+// from the same list of messages.
+//
+// The 8-bit (--mag8) runs use copies of the 16-bit buffers, rounded to 8 bits
+// as the UC8 converters would.
+//
+// Built with DEMOD_CHECK (demodtests), it benchmarks nothing and instead checks
+// that the ranked phase search (--demod-phases 1-4) emits exactly the same
+// messages as the full search on the synthetic 2.4MHz buffers.
+
+#define SYNTH_BUFFERS 4
+#define SYNTH_ADDRESSES 64
+
+struct testdata {
+    const char *name;
+    double sample_rate;
+    int mag8;
+    unsigned trailing_samples;
+    unsigned nbufs;
+    struct mag_buf *bufs;
+};
+
+#ifndef DEMOD_CHECK
+static struct testdata modes1_2000;
+static struct testdata synth_2000;
+static struct testdata modes1_2000_mag8;
+#endif
+static struct testdata synth_2400;
+static struct testdata synth_2400_mag8;
+
+void receiverPositionChanged(float lat, float lon, float alt)
+{
+    /* nothing */
+    (void) lat;
+    (void) lon;
+    (void) alt;
+}
+
+static unsigned trailing_samples_for(double sample_rate)
+{
+    return (MODES_PREAMBLE_US + MODES_LONG_MSG_BITS + 16) * 1e-6 * sample_rate;
+}
+
+static void alloc_buffers(struct testdata *td, const char *name, double sample_rate, int mag8, unsigned nbufs)
+{
+    td->name = name;
+    td->sample_rate = sample_rate;
+    td->mag8 = mag8;
+    td->trailing_samples = trailing_samples_for(sample_rate);
+    td->nbufs = nbufs;
+    td->bufs = calloc(nbufs, sizeof(struct mag_buf));
+
+    for (unsigned i = 0; i < nbufs; ++i) {
+        td->bufs[i].data = calloc(MODES_DEFAULT_MAG_BUF_SAMPLES + td->trailing_samples, mag8 ? sizeof(uint8_t) : sizeof(uint16_t));
+        td->bufs[i].block_max = calloc((MODES_DEFAULT_MAG_BUF_SAMPLES + MODES_MAG_BLOCK_SAMPLES - 1) / MODES_MAG_BLOCK_SAMPLES, sizeof(uint16_t));
+        td->bufs[i].sampleTimestamp = (uint64_t) i * MODES_DEFAULT_MAG_BUF_SAMPLES * 12e6 / sample_rate;
+    }
+}
+
+// Copy the overlap from the previous buffer, as the SDR code does
+static void fill_overlap(struct testdata *td)
+{
+    for (unsigned i = 1; i < td->nbufs; ++i) {
+        if (td->mag8)
+            memcpy(td->bufs[i].data8, td->bufs[i-1].data8 + td->bufs[i-1].length, td->trailing_samples * sizeof(uint8_t));
+        else
+            memcpy(td->bufs[i].data, td->bufs[i-1].data + td->bufs[i-1].length, td->trailing_samples * sizeof(uint16_t));
+    }
+}
+
+// Per-buffer mean level and power, and the peak map, as the converters would produce them
+static void compute_levels(struct mag_buf *buf, unsigned trailing_samples)
+{
+    const uint16_t *m = buf->data + trailing_samples;
+    double sum_level = 0, sum_power = 0;
+
+    for (unsigned i = 0; i < buf->length; ++i) {
+        double mag = m[i] / 65535.0;
+        sum_level += mag;
+        sum_power += mag * mag;
+    }
+
+    buf->mean_level = sum_level / buf->length;
+    buf->mean_power = sum_power / buf->length;
+    compute_block_max(m, buf->length, buf->block_max);
+}
+
+#ifndef DEMOD_CHECK
+static int load_modes1(struct testdata *td, const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "Can't open %s: %s\n", path, strerror(errno));
+        return 0;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long bytes = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    unsigned samples = bytes / 2;
+    unsigned nbufs = (samples + MODES_DEFAULT_MAG_BUF_SAMPLES - 1) / MODES_DEFAULT_MAG_BUF_SAMPLES;
+    alloc_buffers(td, "modes1.bin", 2000000, 0, nbufs);
+
+    struct converter_state *state;
+    iq_convert_fn converter = init_converter(INPUT_UC8, td->sample_rate, 0, &state);
+    uint8_t *iq = malloc(MODES_DEFAULT_MAG_BUF_SAMPLES * 2);
+
+    for (unsigned i = 0; i < nbufs; ++i) {
+        struct mag_buf *buf = &td->bufs[i];
+        size_t n = fread(iq, 2, MODES_DEFAULT_MAG_BUF_SAMPLES, f);
+
+        buf->length = n;
+        converter(iq, buf->data + td->trailing_samples, n, state, &buf->mean_level, &buf->mean_power, buf->block_max);
+    }
+
+    free(iq);
+    cleanup_converter(state);
+    fclose(f);
+
+    fill_overlap(td);
+    return 1;
+}
+#endif
+
+// A random Mode S message with a valid CRC: DF17 or DF11 from one of the
+// addresses (so that the address filter learns them), or DF4/5/20/21 with the
+// address in the parity field.
+static int synth_message(uint8_t *msg, const uint32_t *addresses)
+{
+    static const int types[] = { 17, 17, 17, 11, 11, 4, 5, 20, 21 };
+    int df = types[rand() % 9];
+    int bits = (df == 17 || df == 20 || df == 21) ? MODES_LONG_MSG_BITS : MODES_SHORT_MSG_BITS;
+    uint32_t addr = addresses[rand() % SYNTH_ADDRESSES];
+    uint32_t crc;
+
+    for (int i = 0; i < bits/8; ++i)
+        msg[i] = rand() & 255;
+
+    msg[0] = (df << 3) | ((df == 11 || df == 17) ? 5 : (msg[0] & 7));
+    if (df == 11 || df == 17) {
+        msg[1] = addr >> 16;
+        msg[2] = addr >> 8;
+        msg[3] = addr;
+    }
+    if (df == 17)
+        msg[4] = (11 << 3) | (msg[4] & 7); // airborne position
+
+    msg[bits/8-3] = msg[bits/8-2] = msg[bits/8-1] = 0;
+    crc = modesChecksum(msg, bits);
+    if (df != 11 && df != 17)
+        crc ^= addr;
+    msg[bits/8-3] = crc >> 16;
+    msg[bits/8-2] = crc >> 8;
+    msg[bits/8-1] = crc;
+
+    return bits;
+}
+
+// Add a pulse from clock a to clock b (60MHz clock), of the given level, to
+// the samples it overlaps
+static void synth_pulse(double *level, unsigned nsamples, unsigned clocks_per_sample, uint64_t a, uint64_t b, double amplitude)
+{
+    for (uint64_t s = a / clocks_per_sample; s <= (b - 1) / clocks_per_sample && s < nsamples; ++s) {
+        uint64_t lo = (a > s * clocks_per_sample ? a : s * clocks_per_sample);
+        uint64_t hi = (b < (s + 1) * clocks_per_sample ? b : (s + 1) * clocks_per_sample);
+        level[s] += amplitude * (hi - lo) / clocks_per_sample;
+    }
+}
+
+static double gaussian()
+{
+    double u1 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    double u2 = rand() / (RAND_MAX + 1.0);
+    return sqrt(-2 * log(u1)) * cos(2 * M_PI * u2);
+}
+
+// Generate the synthetic buffers at the given sample rate. They always cover
+// the time of SYNTH_BUFFERS buffers at 2.4MHz, and the same seed gives the same
+// messages at the same times for every sample rate.
+static void make_synthetic(struct testdata *td, const char *name, double sample_rate)
+{
+    unsigned clocks_per_sample = (unsigned) (60e6 / sample_rate + 0.5);
+    uint64_t end_clock = (uint64_t) SYNTH_BUFFERS * MODES_DEFAULT_MAG_BUF_SAMPLES * 25; // 60MHz clock
+    unsigned nsamples = end_clock / clocks_per_sample;
+    uint32_t addresses[SYNTH_ADDRESSES];
+    double *level = calloc(nsamples, sizeof(double));
+
+    srand(1);
+
+    for (int i = 0; i < SYNTH_ADDRESSES; ++i)
+        addresses[i] = 1 + rand() % 0xFFFFFF;
+
+    // about 5000 replies per second, at random levels and (sub-sample) times
+    for (uint64_t clock = 3000; ; ) {
+        double amplitude = 0.05 + 0.85 * rand() / (RAND_MAX + 1.0);
+
+        clock += 2000 + rand() % 8000;
+        if (clock + 120 * 60 >= end_clock)
+            break;
+
+        if (rand() % 10 == 0) {
+            // Mode A/C: F1, random code bits with the X bit clear, F2, no SPI
+            unsigned bits = 0x80020 | (rand() & 0x7EFC0);
+            for (int bit = 0; bit < 20; ++bit) {
+                if (bits & (1 << (19 - bit)))
+                    synth_pulse(level, nsamples, clocks_per_sample, clock + bit * 87, clock + bit * 87 + 27, amplitude);
+            }
+            clock += 20 * 87;
+        } else {
+            uint8_t msg[MODES_LONG_MSG_BYTES];
+            int bits = synth_message(msg, addresses);
+
+            // preamble
+            synth_pulse(level, nsamples, clocks_per_sample, clock, clock + 30, amplitude);
+            synth_pulse(level, nsamples, clocks_per_sample, clock + 60, clock + 90, amplitude);
+            synth_pulse(level, nsamples, clocks_per_sample, clock + 210, clock + 240, amplitude);
+            synth_pulse(level, nsamples, clocks_per_sample, clock + 270, clock + 300, amplitude);
+            clock += 480;
+
+            for (int bit = 0; bit < bits; ++bit, clock += 60) {
+                if (msg[bit/8] & (0x80 >> (bit%8)))
+                    synth_pulse(level, nsamples, clocks_per_sample, clock, clock + 30, amplitude);
+                else
+                    synth_pulse(level, nsamples, clocks_per_sample, clock + 30, clock + 60, amplitude);
+            }
+        }
+    }
+
+    alloc_buffers(td, name, sample_rate, 0, (nsamples + MODES_DEFAULT_MAG_BUF_SAMPLES - 1) / MODES_DEFAULT_MAG_BUF_SAMPLES);
+    for (unsigned i = 0; i < td->nbufs; ++i) {
+        struct mag_buf *buf = &td->bufs[i];
+        uint16_t *m = buf->data + td->trailing_samples;
+
+        buf->length = nsamples - i * MODES_DEFAULT_MAG_BUF_SAMPLES;
+        if (buf->length > MODES_DEFAULT_MAG_BUF_SAMPLES)
+            buf->length = MODES_DEFAULT_MAG_BUF_SAMPLES;
+        for (unsigned j = 0; j < buf->length; ++j) {
+            double I = level[i * MODES_DEFAULT_MAG_BUF_SAMPLES + j] + 0.02 * gaussian();
+            double Q = 0.02 * gaussian();
+            double mag = sqrt(I * I + Q * Q);
+            m[j] = (uint16_t) (mag > 1.0 ? 65535 : mag * 65535 + 0.5);
+        }
+        compute_levels(buf, td->trailing_samples);
+    }
+
+    free(level);
+    fill_overlap(td);
+}
+
+// Make an 8-bit copy of a set of 16-bit buffers
+static void make_mag8(struct testdata *td8, const struct testdata *td, const char *name)
+{
+    alloc_buffers(td8, name, td->sample_rate, 1, td->nbufs);
+
+    for (unsigned i = 0; i < td->nbufs; ++i) {
+        const struct mag_buf *buf = &td->bufs[i];
+        struct mag_buf *buf8 = &td8->bufs[i];
+        unsigned nblocks = (buf->length + MODES_MAG_BLOCK_SAMPLES - 1) / MODES_MAG_BLOCK_SAMPLES;
+        uint64_t sum_level = 0, sum_power = 0;
+
+        buf8->length = buf->length;
+        for (unsigned j = 0; j < td->trailing_samples + buf->length; ++j) {
+            uint16_t mag = buf->data[j];
+            buf8->data8[j] = MAG16_TO_8(mag);
+            if (j >= td->trailing_samples) {
+                sum_level += mag;
+                sum_power += (uint32_t) mag * mag;
+            }
+        }
+
+        // rounding doesn't change which sample is the largest
+        for (unsigned b = 0; b < nblocks; ++b)
+            buf8->block_max[b] = MAG16_TO_8(buf->block_max[b]);
+
+        // level and power are summed before rounding, as in the converters
+        buf8->mean_level = sum_level / 65536.0 / buf->length;
+        buf8->mean_power = sum_power / 65535.0 / 65535.0 / buf->length;
+    }
+}
+
+static void run_buffers(struct testdata *td, uint64_t *clock_offset)
+{
+    for (unsigned i = 0; i < td->nbufs; ++i) {
+        struct mag_buf *buf = &td->bufs[i];
+        uint64_t timestamp = buf->sampleTimestamp;
+
+        // keep the 12MHz clock moving forward from one pass to the next
+        buf->sampleTimestamp += *clock_offset;
+        if (td->sample_rate == 2000000 && td->mag8)
+            demodulate2000Mag8(buf);
+        else if (td->sample_rate == 2000000)
+            demodulate2000(buf);
+        else if (td->mag8)
+            demodulate2400Mag8(buf);
+        else
+            demodulate2400(buf);
+        buf->sampleTimestamp = timestamp;
+    }
+
+    *clock_offset += (uint64_t) td->nbufs * MODES_DEFAULT_MAG_BUF_SAMPLES * 12e6 / td->sample_rate;
+}
+
+#ifdef DEMOD_CHECK
+
+// Run the buffers once, from an empty address filter and with the given
+// --demod-phases, and return the messages emitted (as --raw would show them)
+// in a temporary file. Timestamps are left out: two phases can give the same
+// message, and which one the search settles on moves the timestamp a little.
+static FILE *run_captured(struct testdata *td, int demod_phases)
+{
+    FILE *out = tmpfile();
+    int saved_stdout;
+    uint64_t clock_offset = 0;
+
+    if (!out) {
+        fprintf(stderr, "Can't create a temporary file: %s\n", strerror(errno));
+        exit(1);
+    }
+
+    Modes.sample_rate = td->sample_rate;
+    Modes.mag8 = td->mag8;
+    Modes.trailing_samples = td->trailing_samples;
+    Modes.demod_phases = demod_phases;
+
+    // one untimed pass so the address filter knows the addresses, as in the benchmarks
+    icaoFilterInit();
+    Modes.quiet = 1;
+    run_buffers(td, &clock_offset);
+
+    fflush(stdout);
+    saved_stdout = dup(STDOUT_FILENO);
+    dup2(fileno(out), STDOUT_FILENO);
+    Modes.quiet = 0;
+    clock_offset = 0;
+    run_buffers(td, &clock_offset);
+    fflush(stdout);
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+
+    rewind(out);
+    return out;
+}
+
+// Compare the ranked phase searches against the full search; returns the
+// number of them that differed
+static int check_phases(struct testdata *td)
+{
+    FILE *full = run_captured(td, 5);
+    unsigned lines = 0;
+    char a[256], b[256];
+    int failures = 0;
+
+    while (fgets(a, sizeof(a), full))
+        ++lines;
+
+    for (int phases = 1; phases < 5; ++phases) {
+        FILE *ranked = run_captured(td, phases);
+        unsigned differ = 0;
+
+        rewind(full);
+        for (;;) {
+            char *la = fgets(a, sizeof(a), full);
+            char *lb = fgets(b, sizeof(b), ranked);
+            if (!la && !lb)
+                break;
+            if (!la || !lb || strcmp(la, lb)) {
+                if (differ++ == 0)
+                    fprintf(stderr, "  first difference: %s vs %s", la ? la : "(end)\n", lb ? lb : "(end)\n");
+            }
+        }
+        fclose(ranked);
+
+        fprintf(stderr, "%s: %s, --demod-phases %d vs 5: %u messages, %u differ\n",
+                differ ? "FAIL" : "PASS", td->name, phases, lines, differ);
+        if (differ)
+            ++failures;
+    }
+
+    fclose(full);
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    int failures = 0;
+
+    MODES_NOTUSED(argc);
+    MODES_NOTUSED(argv);
+
+    memset(&Modes, 0, sizeof(Modes));
+    Modes.raw = 1;
+    Modes.check_crc = 1;
+    Modes.nfix_crc = 1;
+    Modes.demod_phases = 5;
+    Modes.demod_threads = 1;
+    Modes.maxRange = 1852 * 300;
+
+    modesChecksumInit(Modes.nfix_crc);
+    icaoFilterInit();
+    demodulate2400Init();
+    demodulate2400InitThreads(Modes.demod_threads);
+    demodulate2400Mag8Init();
+    demodulate2400Mag8InitThreads(Modes.demod_threads);
+
+    // the synthetic replies are mostly DF17 and DF11
+    make_synthetic(&synth_2400, "synthetic 2.4MHz", 2400000);
+    make_mag8(&synth_2400_mag8, &synth_2400, "synthetic 2.4MHz, 8-bit");
+
+    failures += check_phases(&synth_2400);
+    failures += check_phases(&synth_2400_mag8);
+
+    demodulate2400StopThreads();
+    demodulate2400Mag8StopThreads();
+    return failures ? 1 : 0;
+}
+
+#else
+
+static void test(const char *what, struct testdata *td, int mode_ac)
+{
+    fprintf(stderr, "Benchmarking: %s, %s ", what, td->name);
+
+    Modes.sample_rate = td->sample_rate;
+    Modes.mag8 = td->mag8;
+    Modes.trailing_samples = td->trailing_samples;
+    Modes.mode_ac = mode_ac;
+
+    // Start from an empty address filter, and run once (untimed) so that
+    // it has seen the addresses in the data.
+    uint64_t clock_offset = 0;
+    icaoFilterInit();
+    run_buffers(td, &clock_offset);
+
+    struct timespec total = { 0, 0 };
+    int iterations = 0;
+
+    reset_stats(&Modes.stats_current);
+    while (total.tv_sec < 5) {
+        fprintf(stderr, ".");
+
+        struct timespec start;
+        start_cpu_timing(&start);
+
+        for (int i = 0; i < 10; ++i)
+            run_buffers(td, &clock_offset);
+
+        end_cpu_timing(&start, &total);
+        iterations++;
+    }
+
+    fprintf(stderr, "\n");
+
+    double samples = 0;
+    for (unsigned i = 0; i < td->nbufs; ++i)
+        samples += td->bufs[i].length;
+    samples *= 10.0 * iterations;
+
+    double messages = Modes.stats_current.demod_modeac;
+    for (int i = 0; i <= MODES_MAX_BITERRORS; ++i)
+        messages += Modes.stats_current.demod_accepted[i];
+
+    double nanos = total.tv_sec * 1e9 + total.tv_nsec;
+    fprintf(stderr, "  %.2fM samples in %.6f seconds\n",
+            samples / 1e6, nanos / 1e9);
+    fprintf(stderr, "  %.2fM samples/second\n",
+            samples / nanos * 1e3);
+    fprintf(stderr, "  %.0f preambles/second\n",
+            Modes.stats_current.demod_preambles / nanos * 1e9);
+    fprintf(stderr, "  %.0f messages/second (%.1f per pass)\n",
+            messages / nanos * 1e9, messages / (10.0 * iterations));
+}
+
+int main(int argc, char **argv)
+{
+    memset(&Modes, 0, sizeof(Modes));
+    Modes.quiet = 1;
+    Modes.check_crc = 1;
+    Modes.nfix_crc = 1;
+    Modes.demod_phases = 5;
+    Modes.demod_threads = 1;
+    Modes.maxRange = 1852 * 300;
+
+    // optional argument: the kernel to use, as for --kernel
+    if (argc > 1 && (!kernel_parse(argv[1], &Modes.kernel) ||
+                     (Modes.kernel != KERNEL_AUTO && !kernel_supported(Modes.kernel)))) {
+        fprintf(stderr, "usage: %s [auto|scalar|vector|neon|avx2]\n", argv[0]);
+        return 1;
+    }
+
+    modesChecksumInit(Modes.nfix_crc);
+    icaoFilterInit();
+    demodulate2000Init();
+    demodulate2400Init();
+    demodulate2400InitThreads(Modes.demod_threads);
+    demodulate2000Mag8Init();
+    demodulate2400Mag8Init();
+    demodulate2400Mag8InitThreads(Modes.demod_threads);
+
+    if (!load_modes1(&modes1_2000, "testfiles/modes1.bin"))
+        return 1;
+    make_synthetic(&synth_2000, "synthetic 2.0MHz", 2000000);
+    make_synthetic(&synth_2400, "synthetic 2.4MHz", 2400000);
+    make_mag8(&modes1_2000_mag8, &modes1_2000, "modes1.bin, 8-bit");
+    make_mag8(&synth_2400_mag8, &synth_2400, "synthetic 2.4MHz, 8-bit");
+
+    test("2.4MHz, Mode S", &synth_2400, 0);
+    test("2.4MHz, Mode S + A/C", &synth_2400, 1);
+
+    test("2.0MHz, Mode S", &modes1_2000, 0);
+    test("2.0MHz, Mode S + A/C", &modes1_2000, 1);
+    test("2.0MHz, Mode S", &synth_2000, 0);
+    test("2.0MHz, Mode S + A/C", &synth_2000, 1);
+
+    test("2.4MHz, Mode S", &synth_2400_mag8, 0);
+    test("2.4MHz, Mode S + A/C", &synth_2400_mag8, 1);
+    test("2.0MHz, Mode S", &modes1_2000_mag8, 0);
+    test("2.0MHz, Mode S + A/C", &modes1_2000_mag8, 1);
+
+    demodulate2400StopThreads();
+    demodulate2400Mag8StopThreads();
+    return 0;
+}
+
+#endif
@@ -51,6 +51,7 @@
 #include "help.h"
 
 #include <stdarg.h>
+#include <sys/mman.h>
 
 //
 // ============================= Program options help ==========================
@@ -163,33 +164,37 @@ static void modesInitConfig(void) {
     Modes.maxRange                = 1852 * 300; // 300NM default max range
     Modes.mode_ac_auto            = 1;
     Modes.nfix_crc                = 1;
+    Modes.demod_phases            = 5;
+    Modes.demod_threads           = 1;
+    Modes.demod_skip_quiet        = 0;
+    Modes.soft_fix_bits           = 0;
+    Modes.sample_rate             = 2400000.0;
+    Modes.kernel                  = KERNEL_AUTO;
+    Modes.mag8                    = 0;
+    Modes.spin_wait_us            = 50;
+    Modes.low_latency             = 0;
+    Modes.mag_buf_samples         = MODES_DEFAULT_MAG_BUF_SAMPLES;
+    Modes.mag_buffer_count        = MODES_DEFAULT_MAG_BUFFERS;
+    Modes.mlock                   = 0;
+    Modes.inline_convert          = 0;
+    Modes.mlockall                = 0;
 
     sdrInitConfig();
 }
 //
+// The demodulator for the sample rate and magnitude width (--mag8) in use
+static void (*demodulate)(struct mag_buf *mag);
+
 //=========================================================================
 //
 static void modesInit(void) {
-    int i;
-
-    pthread_mutex_init(&Modes.data_mutex,NULL);
-    pthread_cond_init(&Modes.data_cond,NULL);
-
-    Modes.sample_rate = 2400000.0;
+    fifoInit();
 
     // Allocate the various buffers used by Modes
     Modes.trailing_samples = (MODES_PREAMBLE_US + MODES_LONG_MSG_BITS + 16) * 1e-6 * Modes.sample_rate;
 
-    for (i = 0; i < MODES_MAG_BUFFERS; ++i) {
-        if ( (Modes.mag_buffers[i].data = calloc(MODES_MAG_BUF_SAMPLES+Modes.trailing_samples, sizeof(uint16_t))) == NULL ) {
-            fprintf(stderr, "Out of memory allocating magnitude buffer.\n");
-            exit(1);
-        }
-
-        Modes.mag_buffers[i].length = 0;
-        Modes.mag_buffers[i].dropped = 0;
-        Modes.mag_buffers[i].sampleTimestamp = 0;
-    }
+    if (!magRingInit())
+        exit(1);
 
     // Validate the users Lat/Lon home location inputs
     if ( (Modes.fUserLat >   90.0)  // Latitude must be -90 to +90
@@ -221,26 +226,26 @@ static void modesInit(void) {
     // Prepare error correction tables
     modesChecksumInit(Modes.nfix_crc);
     icaoFilterInit();
-    modeACInit();
+    if (Modes.sample_rate == 2000000.0 && Modes.mag8) {
+        demodulate2000Mag8Init();
+        demodulate = demodulate2000Mag8;
+    } else if (Modes.sample_rate == 2000000.0) {
+        demodulate2000Init();
+        demodulate = demodulate2000;
+    } else if (Modes.mag8) {
+        demodulate2400Mag8Init();
+        demodulate2400Mag8InitThreads(Modes.demod_threads);
+        demodulate = demodulate2400Mag8;
+    } else {
+        demodulate2400Init();
+        demodulate2400InitThreads(Modes.demod_threads);
+        demodulate = demodulate2400;
+    }
 
     if (Modes.show_only)
         icaoFilterAdd(Modes.show_only);
 }
 
-// Set affinity of calling thread to specific core on a multi-core CPU
-static int thread_to_core(int core_id) {
-   int num_cores = sysconf(_SC_NPROCESSORS_ONLN);
-   if (core_id < 0 || core_id >= num_cores)
-      return EINVAL;
-
-   cpu_set_t cpuset;
-   CPU_ZERO(&cpuset);
-   CPU_SET(core_id, &cpuset);
-
-   pthread_t current_thread = pthread_self();    
-   return pthread_setaffinity_np(current_thread, sizeof(cpu_set_t), &cpuset);
-}
-
 //
 //=========================================================================
 //
@@ -251,16 +256,15 @@ void *readerThreadEntryPoint(void *arg)
 {
     MODES_NOTUSED(arg);
 
-    // Try sticking this thread to core 3
-    thread_to_core(3);
-    
+    placementJoin(THREAD_READER);
+
     sdrRun();
 
     // Wake the main thread (if it's still waiting)
-    pthread_mutex_lock(&Modes.data_mutex);
     Modes.exit = 1; // just in case
-    pthread_cond_signal(&Modes.data_cond);
-    pthread_mutex_unlock(&Modes.data_mutex);
+    fifoWake();
+
+    placementLeave();
 
 #ifndef _WIN32
     pthread_exit(NULL);
@@ -411,6 +415,7 @@ static void cleanup_and_exit(int code) {
      * otherwise points to const string
      */
     free(Modes.json_dir);
+    free(Modes.error_table_cache);
     free(Modes.net_bind_address);
     free(Modes.net_input_beast_ports);
     free(Modes.net_output_beast_ports);
@@ -429,9 +434,7 @@ static void cleanup_and_exit(int code) {
     }
     
     int i;
-    for (i = 0; i < MODES_MAG_BUFFERS; ++i) {
-        free(Modes.mag_buffers[i].data);
-    }
+    magRingFree();
     for (i = 0; i < HISTORY_SIZE; ++i) {
         free(Modes.json_aircraft_history[i].content);
     }
@@ -479,6 +482,120 @@ static error_t parse_opt (int key, char *arg, struct argp_state *state)
         case OptDcFilter:
             Modes.dc_filter = 1;
             break;
+        case OptDemodPhases:
+            Modes.demod_phases = atoi(arg);
+            if (Modes.demod_phases < 1 || Modes.demod_phases > 5) {
+                fprintf(stderr, "--demod-phases must be between 1 and 5\n");
+                return 1;
+            }
+            break;
+        case OptDemodThreads:
+            Modes.demod_threads = atoi(arg);
+            if (Modes.demod_threads < 1 || Modes.demod_threads > MODES_MAX_DEMOD_THREADS) {
+                fprintf(stderr, "--demod-threads must be between 1 and %d\n", MODES_MAX_DEMOD_THREADS);
+                return 1;
+            }
+            break;
+        case OptDemodSkipQuiet:
+            Modes.demod_skip_quiet = atof(arg);
+            if (Modes.demod_skip_quiet < 0 || Modes.demod_skip_quiet > 40) {
+                fprintf(stderr, "--demod-skip-quiet must be between 0 and 40 dB\n");
+                return 1;
+            }
+            break;
+        case OptSoftFix:
+            Modes.soft_fix_bits = atoi(arg);
+            if (Modes.soft_fix_bits < 0 || Modes.soft_fix_bits > MODES_MAX_SOFT_FIX_BITS) {
+                fprintf(stderr, "--soft-fix must be between 0 and %d\n", MODES_MAX_SOFT_FIX_BITS);
+                return 1;
+            }
+            break;
+        case OptSampleRate:
+            if (!strcmp(arg, "2.0") || !strcmp(arg, "2")) {
+                Modes.sample_rate = 2000000.0;
+            } else if (!strcmp(arg, "2.4")) {
+                Modes.sample_rate = 2400000.0;
+            } else {
+                fprintf(stderr, "--sample-rate must be 2.0 or 2.4\n");
+                return 1;
+            }
+            break;
+        case OptKernel:
+            if (!kernel_parse(arg, &Modes.kernel)) {
+                fprintf(stderr, "--kernel must be one of auto, scalar, vector, neon, avx2, clmul\n");
+                return 1;
+            }
+            if (Modes.kernel != KERNEL_AUTO && !kernel_supported(Modes.kernel)) {
+                fprintf(stderr, "--kernel %s is not supported on this CPU\n", kernel_name(Modes.kernel));
+                return 1;
+            }
+            break;
+        case OptMag8:
+            Modes.mag8 = 1;
+            break;
+        case OptSpinWait:
+            Modes.spin_wait_us = atoi(arg);
+            if (Modes.spin_wait_us < 0) {
+                fprintf(stderr, "--spin-wait must not be negative\n");
+                return 1;
+            }
+            break;
+        case OptLowLatency:
+            Modes.low_latency = 1;
+            break;
+        case OptBufferSamples: {
+            int n = atoi(arg);
+            if (n < MODES_MIN_MAG_BUF_SAMPLES || n > MODES_MAX_MAG_BUF_SAMPLES || n % 1024) {
+                fprintf(stderr, "--buffer-samples must be a multiple of 1024 between %d and %d\n",
+                        MODES_MIN_MAG_BUF_SAMPLES, MODES_MAX_MAG_BUF_SAMPLES);
+                return 1;
+            }
+            Modes.mag_buf_samples = n;
+            break;
+        }
+        case OptBuffers: {
+            int n = atoi(arg);
+            if (n < MODES_MIN_MAG_BUFFERS || n > MODES_MAX_MAG_BUFFERS) {
+                fprintf(stderr, "--buffers must be between %d and %d\n",
+                        MODES_MIN_MAG_BUFFERS, MODES_MAX_MAG_BUFFERS);
+                return 1;
+            }
+            Modes.mag_buffer_count = n;
+            break;
+        }
+        case OptMlock:
+            Modes.mlock = 1;
+            break;
+        case OptInlineConvert:
+            Modes.inline_convert = 1;
+            break;
+        case OptCpuMain:
+            if (!placementSetCpus(THREAD_MAIN, arg))
+                return 1;
+            break;
+        case OptCpuReader:
+            if (!placementSetCpus(THREAD_READER, arg))
+                return 1;
+            break;
+        case OptCpuConvert:
+            if (!placementSetCpus(THREAD_CONVERT, arg))
+                return 1;
+            break;
+        case OptCpuDemod:
+            if (!placementSetCpus(THREAD_DEMOD, arg))
+                return 1;
+            break;
+        case OptSchedPolicy:
+            if (!placementSetPolicy(arg))
+                return 1;
+            break;
+        case OptSchedPriority:
+            if (!placementSetPriority(arg))
+                return 1;
+            break;
+        case OptMlockAll:
+            Modes.mlockall = 1;
+            break;
         case OptFix:
             Modes.nfix_crc = 1;
             break;
@@ -529,6 +646,9 @@ static error_t parse_opt (int key, char *arg, struct argp_state *state)
         case OptAggressive:
             Modes.nfix_crc = MODES_MAX_BITERRORS;
             break;
+        case OptErrorTableCache:
+            Modes.error_table_cache = strdup(arg);
+            break;
         case OptInteractive:
             Modes.interactive = 1;
             break;
@@ -674,6 +794,12 @@ static error_t parse_opt (int key, char *arg, struct argp_state *state)
             if (state->arg_num > 0)
             /* We use only options but no arguments */
                 argp_usage (state);
+            // The 2.0MHz demodulator has none of these
+            if (Modes.sample_rate == 2000000.0 &&
+                (Modes.demod_phases != 5 || Modes.demod_threads != 1 || Modes.demod_skip_quiet || Modes.soft_fix_bits)) {
+                fprintf(stderr, "--demod-phases, --demod-threads, --demod-skip-quiet and --soft-fix need --sample-rate 2.4\n");
+                return 1;
+            }
             break;
         default:
             return ARGP_ERR_UNKNOWN;
@@ -694,11 +820,9 @@ int main(int argc, char **argv) {
     signal(SIGINT, sigintHandler);
     signal(SIGTERM, sigtermHandler);
 
-    /* On a multi-core CPU we run the main thread and reader thread on different cores.
-     * Try sticking the main thread to core 1
-     */    
-    thread_to_core(1);
-    
+    // Before option parsing, which may set CPU lists per thread
+    placementInit();
+
     // Parse the command line options
     if( argp_parse(&argp, argc, argv, 0, 0, 0) ){
         cleanup_and_exit(1);
@@ -713,6 +837,14 @@ int main(int argc, char **argv) {
     log_with_timestamp("%s %s starting up.", MODES_DUMP1090_VARIANT, MODES_DUMP1090_VERSION);
     modesInit();
 
+    // Threads started from here on (including this one) get their
+    // --cpu-* placement and scheduling policy
+    placementJoin(THREAD_MAIN);
+
+    if (Modes.mlockall && mlockall(MCL_CURRENT | MCL_FUTURE) < 0) {
+        fprintf(stderr, "Can't lock memory with --mlockall: %s (check ulimit -l)\n", strerror(errno));
+    }
+
     if (!sdrOpen()) {
         cleanup_and_exit(1);
     }
@@ -756,63 +888,37 @@ int main(int argc, char **argv) {
         int watchdogCounter = 10; // about 1 second
 
         // Create the thread that will read the data from the device.
-        pthread_mutex_lock(&Modes.data_mutex);
         pthread_create(&Modes.reader_thread, NULL, readerThreadEntryPoint, NULL);
 
         while (!Modes.exit) {
             struct timespec start_time;
+            struct mag_buf *buf;
 
-            if (Modes.first_free_buffer == Modes.first_filled_buffer) {
-                /* wait for more data.
-                 * we should be getting data every 50-60ms. wait for max 100ms before we give up and do some background work.
-                 * this is fairly aggressive as all our network I/O runs out of the background work!
-                 */
-
-                struct timespec ts;
-                clock_gettime(CLOCK_REALTIME, &ts);
-                ts.tv_nsec += 100000000;
-                normalize_timespec(&ts);
-                pthread_cond_timedwait(&Modes.data_cond, &Modes.data_mutex, &ts); // This unlocks Modes.data_mutex, and waits for Modes.data_cond
-            }
-
-            // Modes.data_mutex is locked, and possibly we have data.
+            /* wait for more data.
+             * we should be getting data every 50-60ms. wait for max 100ms before we give up and do some background work.
+             * this is fairly aggressive as all our network I/O runs out of the background work!
+             */
+            fifoWaitForData(100);
 
             // copy out reader CPU time and reset it
-            add_timespecs(&Modes.reader_cpu_accumulator, &Modes.stats_current.reader_cpu, &Modes.stats_current.reader_cpu);
-            Modes.reader_cpu_accumulator.tv_sec = 0;
-            Modes.reader_cpu_accumulator.tv_nsec = 0;
-         
-            if (Modes.first_free_buffer != Modes.first_filled_buffer) {
-                // FIFO is not empty, process one buffer.
-
-                struct mag_buf *buf;
+            fifoTakeReaderCpu(&Modes.stats_current.reader_cpu);
 
+            if ((buf = fifoPeek()) != NULL) {
+                // FIFO is not empty, process one buffer. The reader thread
+                // carries on filling the other buffers meanwhile.
                 start_cpu_timing(&start_time);
-                buf = &Modes.mag_buffers[Modes.first_filled_buffer];
 
-                // Process data after releasing the lock, so that the capturing
-                // thread can read data while we perform computationally expensive
-                // stuff at the same time.
-                pthread_mutex_unlock(&Modes.data_mutex);
-
-                demodulate2400(buf);
-                if (Modes.mode_ac) {
-                    demodulate2400AC(buf);
-                }
+                demodulate(buf);
 
                 Modes.stats_current.samples_processed += buf->length;
                 Modes.stats_current.samples_dropped += buf->dropped;
                 end_cpu_timing(&start_time, &Modes.stats_current.demod_cpu);
 
                 // Mark the buffer we just processed as completed.
-                pthread_mutex_lock(&Modes.data_mutex);
-                Modes.first_filled_buffer = (Modes.first_filled_buffer + 1) % MODES_MAG_BUFFERS;
-                pthread_cond_signal(&Modes.data_cond);
-                pthread_mutex_unlock(&Modes.data_mutex);
+                fifoPop();
                 watchdogCounter = 10;
             } else {
                 // Nothing to process this time around.
-                pthread_mutex_unlock(&Modes.data_mutex);
                 if (--watchdogCounter <= 0) {
                     log_with_timestamp("No data received from the SDR for a long time, it may have wedged");
                     watchdogCounter = 600;
@@ -822,15 +928,16 @@ int main(int argc, char **argv) {
             start_cpu_timing(&start_time);
             backgroundTasks();
             end_cpu_timing(&start_time, &Modes.stats_current.background_cpu);
-            pthread_mutex_lock(&Modes.data_mutex);
         }
 
-        pthread_mutex_unlock(&Modes.data_mutex);
+        fifoWake(); // in case the reader is waiting for us
 
         log_with_timestamp("Waiting for receive thread termination");
         pthread_join(Modes.reader_thread,NULL);     // Wait on reader thread exit
-        pthread_cond_destroy(&Modes.data_cond);     // Thread cleanup - only after the reader thread is dead!
-        pthread_mutex_destroy(&Modes.data_mutex);
+        if (Modes.mag8)
+            demodulate2400Mag8StopThreads();
+        else
+            demodulate2400StopThreads();
     }
 
     // If --stats were given, print statistics
@@ -88,10 +88,16 @@
 // ============================= #defines ===============================
 
 #define MODES_DEFAULT_FREQ      1090000000
-#define MODES_RTL_BUFFERS       16                         // Number of RTL buffers
-#define MODES_RTL_BUF_SIZE      (16*16384)                 // 256k
-#define MODES_MAG_BUF_SAMPLES   (MODES_RTL_BUF_SIZE / 2)   // Each sample is 2 bytes
-#define MODES_MAG_BUFFERS       12                         // Number of magnitude buffers (should be smaller than RTL_BUFFERS for flowcontrol to work)
+#define MODES_DEFAULT_MAG_BUF_SAMPLES 131072             // Default samples per SDR / magnitude buffer (--buffer-samples), 256k of UC8
+#define MODES_MIN_MAG_BUF_SAMPLES 8192
+#define MODES_MAX_MAG_BUF_SAMPLES 1048576
+#define MODES_DEFAULT_MAG_BUFFERS 12                       // Default number of magnitude buffers (--buffers)
+#define MODES_MIN_MAG_BUFFERS   3
+#define MODES_MAX_MAG_BUFFERS   256
+#define MODES_RTL_EXTRA_BUFFERS 4                          // RTL buffers beyond the number of magnitude buffers (there must be more for flowcontrol to work)
+#define MODES_MAG_BLOCK_SAMPLES 64                         // Granularity of the per-buffer peak magnitude map
+#define MODES_MAX_DEMOD_THREADS 16                         // Maximum number of threads demodulating one magnitude buffer
+#define MODES_MAX_SOFT_FIX_BITS 16                         // Maximum number of low-confidence bits considered by --soft-fix
 #define MODES_AUTO_GAIN         -100                       // Use automatic gain
 #define MODES_MAX_GAIN          999999                     // Use max available gain
 #define MODEAC_MSG_BYTES        2
@@ -219,17 +225,23 @@ typedef enum {
 #include "anet.h"
 #include "net_io.h"
 #include "crc.h"
+#include "demod_2000.h"
 #include "demod_2400.h"
 #include "stats.h"
 #include "cpr.h"
 #include "icao_filter.h"
+#include "kernel.h"
+#include "mag_ring.h"
+#include "fifo.h"
+#include "raw_feed.h"
+#include "placement.h"
 #include "convert.h"
 #include "sdr.h"
 
 //======================== structure declarations =========================
 
 typedef enum {
-    SDR_NONE = 0, SDR_IFILE, SDR_RTLSDR, SDR_BLADERF, SDR_MODESBEAST
+    SDR_NONE = 0, SDR_IFILE, SDR_RTLSDR, SDR_BLADERF, SDR_MODESBEAST, SDR_RTLSIM
 } sdr_type_t;
 
 // Structure representing one magnitude buffer
@@ -240,20 +252,59 @@ struct mag_buf {
     uint32_t        dropped;         // Number of dropped samples preceding this buffer
     unsigned        length;          // Number of valid samples _after_ overlap. Total buffer length is buf->length + Modes.trailing_samples.
     struct timespec sysTimestamp;    // Estimated system time at start of block
-    uint16_t       *data;            // Magnitude data. Starts with Modes.trailing_samples worth of overlap from the previous block
-#if defined(__arm__)
-    /*padding 4 bytes*/
-    uint32_t        padding;
-#endif
+    union {
+        uint16_t   *data;            // Magnitude data, in the magnitude ring. Starts with Modes.trailing_samples worth of overlap from the previous block
+        uint8_t    *data8;           // The same, as 8-bit magnitudes (--mag8)
+    };
+    uint16_t       *block_max;       // Peak magnitude of each MODES_MAG_BLOCK_SAMPLES block of data, starting after the overlap
 };
 
+// Raw samples copied out of a device callback, waiting for conversion into a
+// mag_buf (see raw_feed.c)
+struct raw_buf {
+    uint64_t        sampleTimestamp; // Clock timestamp of the start of this block, 12MHz clock
+    uint32_t        dropped;         // Number of dropped samples preceding this block
+    unsigned        length;          // Number of samples in data
+    struct timespec sysTimestamp;    // Estimated system time at start of block
+    uint8_t        *data;            // UC8 I/Q samples, 2 bytes each
+};
+
+// Magnitude sample type for the demodulators, which are built once for each
+// width; DEMOD_MAG8 is set for the 8-bit (--mag8) build.
+#ifdef DEMOD_MAG8
+typedef uint8_t mag_t;
+#define MAG_FULL_SCALE 255
+#define MAG_DATA(buf) ((buf)->data8)
+#else
+typedef uint16_t mag_t;
+#define MAG_FULL_SCALE 65535
+#define MAG_DATA(buf) ((buf)->data)
+#endif
+
+// Rescales a magnitude to 0..65535. The Mode A/C noise and pulse levels are
+// kept on this scale in both builds, as rounding them to whole 8-bit steps
+// moves the thresholds by up to 1dB at typical noise levels. An 8-bit sample
+// was rounded up from 16 bits (MAG16_TO_8), so it maps back to the middle of
+// its step rather than the top.
+#ifdef DEMOD_MAG8
+#define MAG_TO_16(x) ((x) ? (x) * 257u - 128 : 0u)
+#else
+#define MAG_TO_16(x) (x)
+#endif
+#define MAG_FROM_16(x) ((x) / (65535 / MAG_FULL_SCALE))
+
+// Rounds a 16-bit magnitude up to an 8-bit one, i.e. (x + 256) / 257. The
+// --mag8 converters compute each magnitude at 16 bits and round it with this.
+// Rounding up never turns a weak sample into silence, and the preamble and
+// slicer comparisons only see where the step boundaries fall, not the offset.
+#define MAG16_TO_8(x) (((x) * 255 + 65535) >> 16)
+
+// Size of one sample in a mag_buf
+#define MODES_MAG_SAMPLE_SIZE (Modes.mag8 ? sizeof(uint8_t) : sizeof(uint16_t))
+
 // Program global state
 struct {                             // Internal state
-    pthread_cond_t  data_cond;       // Conditional variable associated
     pthread_t       reader_thread;
-    pthread_mutex_t data_mutex;      // Mutex to synchronize buffer access
-    unsigned        first_free_buffer;  // Entry in mag_buffers that will next be filled with input.
-    unsigned        first_filled_buffer;// Entry in mag_buffers that has valid data and will be demodulated next. If equal to next_free_buffer, there is no unprocessed data.
     unsigned        trailing_samples;   // extra trailing samples in magnitude buffers
     int             exit;            // Exit from the main loop when true    
     int             dc_filter;       // should we apply a DC filter?    
@@ -283,6 +334,20 @@ struct {                             // Internal state
 
     // Configuration
     int   nfix_crc;                  // Number of crc bit error(s) to correct
+    char *error_table_cache;         // File to keep the error correction tables in, or NULL to build them every time
+    int   demod_phases;              // Number of preamble-ranked phases to try before a full phase search
+    int   demod_threads;             // Number of threads to split each magnitude buffer across
+    double demod_skip_quiet;         // Skip preamble search where the peak level is less than this many dB above the mean level (0 = off)
+    int   soft_fix_bits;             // Number of least confident bits to try correcting when the CRC is bad (0 = off)
+    kernel_t kernel;                 // Converter / demodulator kernel override (KERNEL_AUTO: pick by CPU features)
+    int   mag8;                      // Use 8-bit magnitude buffers (UC8 input only)
+    int   spin_wait_us;              // How long the reader and demodulator spin waiting for each other before sleeping
+    int   low_latency;               // Spin rather than sleep while waiting for sample buffers
+    unsigned mag_buf_samples;        // Samples per SDR / magnitude buffer
+    unsigned mag_buffer_count;       // Number of magnitude buffers
+    int   mlock;                     // Lock sample buffers and lookup tables into memory
+    int   inline_convert;            // Convert rtlsdr samples in the USB callback rather than on a conversion thread
+    int   mlockall;                  // Lock all our memory, present and future, into RAM
     int   check_crc;                 // Only display messages with good CRC
     int   raw;                       // Raw output format
     int   mode_ac;                   // Enable decoding of SSR Modes A & C
@@ -335,8 +400,8 @@ struct {                             // Internal state
     struct stats stats_1min[15];
     struct stats stats_5min;
     struct stats stats_15min;
-    struct timespec reader_cpu_accumulator;               // CPU time used by the reader thread, copied out and reset by the main thread under the mutex
-    struct mag_buf  mag_buffers[MODES_MAG_BUFFERS];       // Converted magnitude buffers from RTL or file input
+    struct mag_buf *mag_buffers;                          // Converted magnitude buffers from RTL or file input (mag_buffer_count of them)
+    struct raw_buf *raw_buffers;                          // Raw RTL blocks waiting for the conversion thread (mag_buffer_count of them, or NULL)
     struct {
         long clen;
         char *content;
@@ -366,6 +431,7 @@ struct modesMessage {
 #endif
     uint64_t      timestampMsg;                   // Timestamp of the message (12MHz clock)
     double        signalLevel;                    // RSSI, in the range [0..1], as a fraction of full-scale power
+    struct errorinfo softfix;                     // Bit errors located by the demodulator from bit confidences (softfix.errors == 0: none)
     // Raw data, just extracted directly from the message
     // The names reflect the field names in Annex 4
     unsigned IID; // extracted from CRC of DF11s
@@ -508,8 +574,9 @@ struct modesMessage {
     unsigned spi : 1;
     unsigned alert_valid : 1;
     unsigned alert : 1;
-    /*padding 12 bit*/
-    unsigned padding : 12;
+    unsigned body_pending : 1;  // decodeModesMessageBody() has yet to run
+    /*padding 11 bit*/
+    unsigned padding : 11;
 };
 
 /* All the program options */
@@ -547,6 +614,27 @@ enum {
   OptJsonTime,
   OptJsonLocAcc,
   OptDcFilter,
+  OptDemodPhases,
+  OptDemodThreads,
+  OptDemodSkipQuiet,
+  OptSoftFix,
+  OptSampleRate,
+  OptKernel,
+  OptMag8,
+  OptSpinWait,
+  OptLowLatency,
+  OptBufferSamples,
+  OptBuffers,
+  OptMlock,
+  OptInlineConvert,
+  OptCpuMain,
+  OptCpuReader,
+  OptCpuConvert,
+  OptCpuDemod,
+  OptSchedPolicy,
+  OptSchedPriority,
+  OptMlockAll,
+  OptErrorTableCache,
   OptNet,
   OptNetOnly,
   OptNetBindAddr,
@@ -597,7 +685,6 @@ extern "C" {
 //
 int  detectModeA       (uint16_t *m, struct modesMessage *mm);
 void decodeModeAMessage(struct modesMessage *mm, int ModeA);
-void modeACInit();
 int modeAToModeC (unsigned int modeA);
 unsigned modeCToModeA (int modeC);
 
@@ -606,7 +693,11 @@ unsigned modeCToModeA (int modeC);
 //
 int modesMessageLenByType(int type);
 int scoreModesMessage(unsigned char *msg, int validbits);
+int scoreModesMessageCRC(unsigned char *msg, int validbits, uint32_t crc);
+int scoreModesMessageSoft(unsigned char *msg, int validbits, uint32_t crc, struct errorinfo *soft);
+int scoreModesMessageMax(int msgtype);
 int decodeModesMessage (struct modesMessage *mm, unsigned char *msg);
+void decodeModesMessageBody(struct modesMessage *mm);
 void useModesMessage    (struct modesMessage *mm);
 //
 // Functions exported from interactive.c
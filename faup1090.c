@@ -131,7 +131,6 @@ static void faupInit(void) {
     // Prepare error correction tables
     modesChecksumInit(1);
     icaoFilterInit();
-    modeACInit();
 }
 
 static error_t parse_opt (int key, char *arg, struct argp_state *state)
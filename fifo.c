@@ -0,0 +1,290 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// fifo.c: lock-free handoff of sample buffers between the reader, conversion
+// and demodulator threads
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <stdatomic.h>
+
+#ifdef __linux__
+# include <linux/futex.h>
+# include <sys/syscall.h>
+#endif
+
+// An index that one thread advances and the other waits on. The index is
+// the futex word, so it must stay a plain 32-bit atomic.
+struct fifo_index {
+    atomic_uint value;
+    atomic_int sleepers;    // threads parked waiting for value to change
+};
+
+static struct fifo_index first_free;     // Entry in mag_buffers that will next be filled with input. Only the reader advances it.
+static struct fifo_index first_filled;   // Entry in mag_buffers that will be demodulated next; if equal to first_free, there is no unprocessed data. Only the demodulator advances it.
+static struct fifo_index raw_first_free;   // Entry in raw_buffers that the device callback fills next. Only the callback advances it.
+static struct fifo_index raw_first_filled; // Entry in raw_buffers that will be converted next. Only the conversion thread advances it.
+static atomic_uint_fast64_t reader_cpu_ns;
+
+#ifndef __linux__
+static pthread_mutex_t park_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t park_cond = PTHREAD_COND_INITIALIZER;
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+# define cpu_relax() __builtin_ia32_pause()
+#elif defined(__aarch64__) || (defined(__arm__) && defined(__ARM_ARCH) && __ARM_ARCH >= 7)
+# define cpu_relax() __asm__ __volatile__("yield")
+#else
+# define cpu_relax() do { } while (0)
+#endif
+
+void fifoInit(void)
+{
+    atomic_init(&first_free.value, 0);
+    atomic_init(&first_free.sleepers, 0);
+    atomic_init(&first_filled.value, 0);
+    atomic_init(&first_filled.sleepers, 0);
+    atomic_init(&raw_first_free.value, 0);
+    atomic_init(&raw_first_free.sleepers, 0);
+    atomic_init(&raw_first_filled.value, 0);
+    atomic_init(&raw_first_filled.sleepers, 0);
+    atomic_init(&reader_cpu_ns, 0);
+}
+
+static uint64_t elapsed_ns(const struct timespec *from, const struct timespec *to)
+{
+    return (to->tv_sec - from->tv_sec) * 1000000000ULL + to->tv_nsec - from->tv_nsec;
+}
+
+// Sleeps until index->value is no longer 'old' (or for timeout_ns)
+static void park(struct fifo_index *index, unsigned old, uint64_t timeout_ns)
+{
+    // The sleepers count and the index are both seq_cst, so either we see
+    // the new value here or advance() sees us and wakes us.
+    atomic_fetch_add(&index->sleepers, 1);
+
+#ifdef __linux__
+    if (atomic_load(&index->value) == old && !Modes.exit) {
+        struct timespec ts = { timeout_ns / 1000000000, timeout_ns % 1000000000 };
+        // returns at once if the value has already changed
+        syscall(SYS_futex, &index->value, FUTEX_WAIT_PRIVATE, old, &ts, NULL, 0);
+    }
+#else
+    pthread_mutex_lock(&park_mutex);
+    if (atomic_load(&index->value) == old && !Modes.exit) {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_sec += timeout_ns / 1000000000;
+        ts.tv_nsec += timeout_ns % 1000000000;
+        normalize_timespec(&ts);
+        pthread_cond_timedwait(&park_cond, &park_mutex, &ts);
+    }
+    pthread_mutex_unlock(&park_mutex);
+#endif
+
+    atomic_fetch_sub(&index->sleepers, 1);
+}
+
+static void wake(struct fifo_index *index)
+{
+    if (!atomic_load(&index->sleepers))
+        return;
+
+#ifdef __linux__
+    syscall(SYS_futex, &index->value, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+#else
+    pthread_mutex_lock(&park_mutex);
+    pthread_cond_broadcast(&park_cond);
+    pthread_mutex_unlock(&park_mutex);
+#endif
+}
+
+// Waits up to timeout_ms for index->value to change from 'old': spin for a
+// while, since the other side is often nearly done, then sleep.
+static void wait_for_change(struct fifo_index *index, unsigned old, unsigned timeout_ms)
+{
+    uint64_t timeout_ns = timeout_ms * 1000000ULL;
+    uint64_t spin_ns = (Modes.low_latency ? timeout_ns : Modes.spin_wait_us * 1000ULL);
+    uint64_t waited_ns = 0;
+    struct timespec start, now;
+    unsigned n;
+
+    if (spin_ns > timeout_ns)
+        spin_ns = timeout_ns;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (n = 0; ; ++n) {
+        if (atomic_load_explicit(&index->value, memory_order_acquire) != old || Modes.exit)
+            return;
+
+        cpu_relax();
+        if ((n & 63) == 0) {
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            if ((waited_ns = elapsed_ns(&start, &now)) >= spin_ns)
+                break;
+        }
+    }
+
+    if (waited_ns < timeout_ns)
+        park(index, old, timeout_ns - waited_ns);
+}
+
+// Both queues have Modes.mag_buffer_count entries
+static void advance(struct fifo_index *index)
+{
+    atomic_store(&index->value, (atomic_load_explicit(&index->value, memory_order_relaxed) + 1) % Modes.mag_buffer_count);
+    wake(index);
+}
+
+static unsigned free_after(struct fifo_index *free_index, struct fifo_index *filled_index)
+{
+    unsigned next_free = (atomic_load_explicit(&free_index->value, memory_order_relaxed) + 1) % Modes.mag_buffer_count;
+    unsigned filled = atomic_load_explicit(&filled_index->value, memory_order_acquire);
+
+    return (filled - next_free + Modes.mag_buffer_count) % Modes.mag_buffer_count;
+}
+
+struct mag_buf *fifoNextFree(struct mag_buf **lastbuf)
+{
+    unsigned free_index = atomic_load_explicit(&first_free.value, memory_order_relaxed);
+
+    if (lastbuf)
+        *lastbuf = &Modes.mag_buffers[(free_index + Modes.mag_buffer_count - 1) % Modes.mag_buffer_count];
+    return &Modes.mag_buffers[free_index];
+}
+
+unsigned fifoFreeBuffers(void)
+{
+    return free_after(&first_free, &first_filled);
+}
+
+void fifoPush(void)
+{
+    unsigned next_free = (atomic_load_explicit(&first_free.value, memory_order_relaxed) + 1) % Modes.mag_buffer_count;
+
+    // The next buffer isn't visible to the demodulator until it is pushed
+    Modes.mag_buffers[next_free].dropped = 0;
+    Modes.mag_buffers[next_free].length = 0;  // just in case
+
+    advance(&first_free);
+}
+
+void fifoWaitForSpace(unsigned timeout_ms)
+{
+    unsigned filled = atomic_load(&first_filled.value);
+    unsigned next_free = (atomic_load_explicit(&first_free.value, memory_order_relaxed) + 1) % Modes.mag_buffer_count;
+
+    if (filled == next_free)
+        wait_for_change(&first_filled, filled, timeout_ms);
+}
+
+void fifoWaitForDrain(unsigned timeout_ms)
+{
+    unsigned filled = atomic_load(&first_filled.value);
+
+    if (filled != atomic_load_explicit(&first_free.value, memory_order_relaxed))
+        wait_for_change(&first_filled, filled, timeout_ms);
+}
+
+void fifoAddReaderCpu(struct timespec *thread_cpu)
+{
+    struct timespec used = { 0, 0 };
+
+    end_cpu_timing(thread_cpu, &used);
+    atomic_fetch_add_explicit(&reader_cpu_ns, used.tv_sec * 1000000000ULL + used.tv_nsec, memory_order_relaxed);
+    start_cpu_timing(thread_cpu);
+}
+
+struct mag_buf *fifoPeek(void)
+{
+    unsigned filled = atomic_load_explicit(&first_filled.value, memory_order_relaxed);
+
+    if (filled == atomic_load_explicit(&first_free.value, memory_order_acquire))
+        return NULL;
+    return &Modes.mag_buffers[filled];
+}
+
+void fifoPop(void)
+{
+    advance(&first_filled);
+}
+
+void fifoWaitForData(unsigned timeout_ms)
+{
+    unsigned free_index = atomic_load(&first_free.value);
+
+    if (free_index == atomic_load_explicit(&first_filled.value, memory_order_relaxed))
+        wait_for_change(&first_free, free_index, timeout_ms);
+}
+
+void fifoTakeReaderCpu(struct timespec *add_to)
+{
+    uint64_t ns = atomic_exchange_explicit(&reader_cpu_ns, 0, memory_order_relaxed);
+
+    add_to->tv_sec += ns / 1000000000;
+    add_to->tv_nsec += ns % 1000000000;
+    normalize_timespec(add_to);
+}
+
+struct raw_buf *fifoRawNextFree(void)
+{
+    return &Modes.raw_buffers[atomic_load_explicit(&raw_first_free.value, memory_order_relaxed)];
+}
+
+unsigned fifoRawFreeBuffers(void)
+{
+    return free_after(&raw_first_free, &raw_first_filled);
+}
+
+void fifoRawPush(void)
+{
+    unsigned next_free = (atomic_load_explicit(&raw_first_free.value, memory_order_relaxed) + 1) % Modes.mag_buffer_count;
+
+    Modes.raw_buffers[next_free].dropped = 0;
+    Modes.raw_buffers[next_free].length = 0;
+
+    advance(&raw_first_free);
+}
+
+struct raw_buf *fifoRawPeek(void)
+{
+    unsigned filled = atomic_load_explicit(&raw_first_filled.value, memory_order_relaxed);
+
+    if (filled == atomic_load_explicit(&raw_first_free.value, memory_order_acquire))
+        return NULL;
+    return &Modes.raw_buffers[filled];
+}
+
+void fifoRawPop(void)
+{
+    advance(&raw_first_filled);
+}
+
+void fifoRawWaitForData(unsigned timeout_ms)
+{
+    unsigned free_index = atomic_load(&raw_first_free.value);
+
+    if (free_index == atomic_load_explicit(&raw_first_filled.value, memory_order_relaxed))
+        wait_for_change(&raw_first_free, free_index, timeout_ms);
+}
+
+void fifoWake(void)
+{
+    wake(&first_free);
+    wake(&first_filled);
+    wake(&raw_first_free);
+    wake(&raw_first_filled);
+}
@@ -0,0 +1,85 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// fifo.h: lock-free handoff of sample buffers between the reader, conversion
+// and demodulator threads
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_FIFO_H
+#define DUMP1090_FIFO_H
+
+#include <stdbool.h>
+#include <time.h>
+
+struct mag_buf;
+struct raw_buf;
+
+// Modes.mag_buffers is a single-producer, single-consumer queue: the reader
+// thread fills buffers and pushes them, the main thread demodulates and pops
+// them. Neither side takes a lock. A side that has to wait for the other
+// spins for Modes.spin_wait_us and then sleeps until woken (or, with
+// Modes.low_latency, spins for the whole wait).
+
+void fifoInit(void);
+
+// Reader side.
+
+// The buffer to fill next, and (in *lastbuf) the one filled before it
+struct mag_buf *fifoNextFree(struct mag_buf **lastbuf);
+// How many more buffers are free after the one returned by fifoNextFree;
+// it may only be filled and pushed if this is nonzero
+unsigned fifoFreeBuffers(void);
+// Passes the buffer returned by fifoNextFree on to the demodulator
+void fifoPush(void);
+// Waits up to timeout_ms for fifoFreeBuffers() to become nonzero
+void fifoWaitForSpace(unsigned timeout_ms);
+// Waits up to timeout_ms for the demodulator to finish every pushed buffer
+void fifoWaitForDrain(unsigned timeout_ms);
+// Adds the reader's CPU time since *thread_cpu to the stats, and restarts
+// the measurement
+void fifoAddReaderCpu(struct timespec *thread_cpu);
+
+// Demodulator side.
+
+// The oldest pushed buffer, or NULL if there is none
+struct mag_buf *fifoPeek(void);
+// Hands the buffer returned by fifoPeek back to the reader
+void fifoPop(void);
+// Waits up to timeout_ms for fifoPeek() to return a buffer
+void fifoWaitForData(unsigned timeout_ms);
+// Moves the reader CPU time accumulated so far into *add_to
+void fifoTakeReaderCpu(struct timespec *add_to);
+
+// Raw side. Modes.raw_buffers is a second queue of the same kind, used when a
+// device callback only copies raw samples (see raw_feed.h): the callback
+// pushes, the conversion thread pops. The callback never waits; it drops the
+// block if no buffer is free.
+
+// The raw buffer to fill next
+struct raw_buf *fifoRawNextFree(void);
+// How many more raw buffers are free after the one returned by fifoRawNextFree
+unsigned fifoRawFreeBuffers(void);
+// Passes the buffer returned by fifoRawNextFree on to the conversion thread
+void fifoRawPush(void);
+// The oldest pushed raw buffer, or NULL if there is none
+struct raw_buf *fifoRawPeek(void);
+// Hands the buffer returned by fifoRawPeek back to the callback
+void fifoRawPop(void);
+// Waits up to timeout_ms for fifoRawPeek() to return a buffer
+void fifoRawWaitForData(unsigned timeout_ms);
+
+// Wakes any waiting thread, e.g. after setting Modes.exit
+void fifoWake(void);
+
+#endif
@@ -0,0 +1,280 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// gentables.c: generates tables.c, the constant lookup tables
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// The Makefile runs this as "gentables > tables.c", so the tables are const
+// arrays in .rodata: nothing to compute at startup, and the pages are shared
+// between processes. Built with -DTABLES_CHECK and linked against tables.o
+// instead, it recomputes every table on the target and checks that the
+// compiled-in copy matches (tabletests, run by "make test").
+//
+// This is deliberately standalone (no dump1090.h), so that it can be built
+// with a host compiler when cross-compiling.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef TABLES_CHECK
+#include "tables.h"
+#endif
+
+// As in crc.c
+#define MODES_GENERATOR_POLY 0xfff409U
+
+// As in dump1090.h
+#define INVALID_ALTITUDE (-9999)
+
+static uint32_t gen_crc_table[8][256];
+static uint32_t gen_crc_single_bit_syndrome[112];
+static int gen_modeAToCTable[4096];
+static unsigned gen_modeCToATable[4096];
+static uint16_t gen_uc8_lookup[256 * 256];
+
+//
+// CRC
+//
+
+static void gen_crc()
+{
+    int i, k;
+    uint8_t msg[112/8];
+
+    for (i = 0; i < 256; ++i) {
+        uint32_t c = i << 16;
+        int j;
+        for (j = 0; j < 8; ++j) {
+            if (c & 0x800000)
+                c = (c<<1) ^ MODES_GENERATOR_POLY;
+            else
+                c = (c<<1);
+        }
+
+        gen_crc_table[0][i] = c & 0x00ffffff;
+    }
+
+    // Each further slice is the previous one followed by another zero byte
+    for (k = 1; k < 8; ++k) {
+        for (i = 0; i < 256; ++i) {
+            uint32_t c = gen_crc_table[k-1][i];
+            gen_crc_table[k][i] = ((c << 8) & 0xffffff) ^ gen_crc_table[0][c >> 16];
+        }
+    }
+
+    // Syndromes of single-bit errors, byte at a time
+    memset(msg, 0, sizeof(msg));
+    for (i = 0; i < 112; ++i) {
+        uint32_t rem = 0;
+        int j;
+
+        msg[i/8] ^= 1 << (7 - (i & 7));
+        for (j = 0; j < 112/8 - 3; ++j)
+            rem = ((rem << 8) ^ gen_crc_table[0][msg[j] ^ (rem >> 16)]) & 0xffffff;
+        gen_crc_single_bit_syndrome[i] = rem ^ (msg[11] << 16) ^ (msg[12] << 8) ^ msg[13];
+        msg[i/8] ^= 1 << (7 - (i & 7));
+    }
+}
+
+//
+// Mode A / Mode C
+//
+
+// As in track.h
+static unsigned indexToModeA(unsigned index)
+{
+    return (index & 0007) | ((index & 0070) << 1) | ((index & 0700) << 2) | ((index & 07000) << 3);
+}
+
+static int internalModeAToModeC(unsigned int ModeA)
+{
+    unsigned int FiveHundreds = 0;
+    unsigned int OneHundreds  = 0;
+
+  if ((ModeA & 0xFFFF8889) != 0 ||         // check zero bits are zero, D1 set is illegal
+      (ModeA & 0x000000F0) == 0) { // C1,,C4 cannot be Zero
+      return INVALID_ALTITUDE;
+  }
+
+  if (ModeA & 0x0010) {OneHundreds ^= 0x007;} // C1
+  if (ModeA & 0x0020) {OneHundreds ^= 0x003;} // C2
+  if (ModeA & 0x0040) {OneHundreds ^= 0x001;} // C4
+
+  // Remove 7s from OneHundreds (Make 7->5, snd 5->7).
+  if ((OneHundreds & 5) == 5) {OneHundreds ^= 2;}
+
+  // Check for invalid codes, only 1 to 5 are valid
+  if (OneHundreds > 5) {
+      return INVALID_ALTITUDE;
+  }
+
+//if (ModeA & 0x0001) {FiveHundreds ^= 0x1FF;} // D1 never used for altitude
+  if (ModeA & 0x0002) {FiveHundreds ^= 0x0FF;} // D2
+  if (ModeA & 0x0004) {FiveHundreds ^= 0x07F;} // D4
+
+  if (ModeA & 0x1000) {FiveHundreds ^= 0x03F;} // A1
+  if (ModeA & 0x2000) {FiveHundreds ^= 0x01F;} // A2
+  if (ModeA & 0x4000) {FiveHundreds ^= 0x00F;} // A4
+
+  if (ModeA & 0x0100) {FiveHundreds ^= 0x007;} // B1
+  if (ModeA & 0x0200) {FiveHundreds ^= 0x003;} // B2
+  if (ModeA & 0x0400) {FiveHundreds ^= 0x001;} // B4
+
+  // Correct order of OneHundreds.
+  if (FiveHundreds & 1) {OneHundreds = 6 - OneHundreds;}
+
+  return ((FiveHundreds * 5) + OneHundreds - 13);
+}
+
+static bool gen_mode_ac()
+{
+    for (unsigned i = 0; i < 4096; ++i) {
+        unsigned modeA = indexToModeA(i);
+        int modeC = internalModeAToModeC(modeA);
+        gen_modeAToCTable[i] = modeC;
+
+        modeC += 13;
+        if (modeC >= 0 && modeC < 4096) {
+            if (gen_modeCToATable[modeC] != 0) {
+                fprintf(stderr, "gentables: Mode C %d has more than one Mode A code\n", modeC - 13);
+                return false;
+            }
+            gen_modeCToATable[modeC] = modeA;
+        }
+    }
+
+    return true;
+}
+
+//
+// UC8 sample conversion
+//
+
+// The converters look up each I/Q byte pair read as a uint16_t. The
+// magnitude is symmetric in I and Q, so the table is the same whichever
+// byte ends up in the high half, and doesn't depend on byte order.
+static void gen_uc8()
+{
+    for (int i = 0; i <= 255; i++) {
+        for (int q = 0; q <= 255; q++) {
+            float fI, fQ, magsq;
+
+            fI = (i - 127.5) / 127.5;
+            fQ = (q - 127.5) / 127.5;
+            magsq = fI * fI + fQ * fQ;
+            if (magsq > 1)
+                magsq = 1;
+            float mag = sqrtf(magsq);
+
+            gen_uc8_lookup[(i*256)+q] = (uint16_t) (mag * 65535.0f + 0.5f);
+        }
+    }
+}
+
+#ifndef TABLES_CHECK
+
+// Prints n values of the given size (1, 2 or 4 bytes) as the body of an
+// array initializer
+static void emit_values(const void *table, size_t size, bool is_signed, unsigned n)
+{
+    unsigned i;
+
+    for (i = 0; i < n; ++i) {
+        long long v;
+
+        switch (size) {
+        case 1: v = ((const uint8_t *) table)[i]; break;
+        case 2: v = ((const uint16_t *) table)[i]; break;
+        default: v = is_signed ? ((const int32_t *) table)[i] : (long long) ((const uint32_t *) table)[i]; break;
+        }
+
+        printf("%s%lld,", (i % 16) ? " " : "\n    ", v);
+    }
+    printf("\n");
+}
+
+int main()
+{
+    int k;
+
+    gen_crc();
+    if (!gen_mode_ac())
+        return 1;
+    gen_uc8();
+
+    printf("// Generated by gentables from gentables.c; do not edit.\n\n");
+    printf("#include \"tables.h\"\n\n");
+
+    printf("const uint32_t crc_table[8][256] = {\n");
+    for (k = 0; k < 8; ++k) {
+        printf("  {");
+        emit_values(gen_crc_table[k], sizeof(uint32_t), false, 256);
+        printf("  },\n");
+    }
+    printf("};\n\n");
+
+    printf("const uint32_t crc_single_bit_syndrome[112] = {");
+    emit_values(gen_crc_single_bit_syndrome, sizeof(uint32_t), false, 112);
+    printf("};\n\n");
+
+    printf("const int modeAToCTable[4096] = {");
+    emit_values(gen_modeAToCTable, sizeof(int), true, 4096);
+    printf("};\n\n");
+
+    printf("const unsigned modeCToATable[4096] = {");
+    emit_values(gen_modeCToATable, sizeof(unsigned), false, 4096);
+    printf("};\n\n");
+
+    printf("const uint16_t uc8_lookup[256 * 256] = {");
+    emit_values(gen_uc8_lookup, sizeof(uint16_t), false, 256 * 256);
+    printf("};\n");
+
+    return ferror(stdout) ? 1 : 0;
+}
+
+#else /* TABLES_CHECK */
+
+static int check(const char *name, const void *compiled, const void *generated, size_t size)
+{
+    if (memcmp(compiled, generated, size)) {
+        printf("FAIL: %s doesn't match what gentables computes here\n", name);
+        return 1;
+    }
+
+    printf("PASS: %s\n", name);
+    return 0;
+}
+
+int main()
+{
+    int failures = 0;
+
+    gen_crc();
+    if (!gen_mode_ac())
+        return 1;
+    gen_uc8();
+
+    failures += check("crc_table", crc_table, gen_crc_table, sizeof(gen_crc_table));
+    failures += check("crc_single_bit_syndrome", crc_single_bit_syndrome, gen_crc_single_bit_syndrome, sizeof(gen_crc_single_bit_syndrome));
+    failures += check("modeAToCTable", modeAToCTable, gen_modeAToCTable, sizeof(gen_modeAToCTable));
+    failures += check("modeCToATable", modeCToATable, gen_modeCToATable, sizeof(gen_modeCToATable));
+    failures += check("uc8_lookup", uc8_lookup, gen_uc8_lookup, sizeof(gen_uc8_lookup));
+
+    return failures ? 1 : 0;
+}
+
+#endif /* TABLES_CHECK */
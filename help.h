@@ -46,6 +46,7 @@ static struct argp_option options[] =
     #else
         {"aggressive", OptAggressive, 0, OPTION_HIDDEN, "Enable two-bit CRC error correction", 1},
     #endif     
+    {"error-table-cache", OptErrorTableCache, "<file>", 0, "Keep the CRC error correction tables in <file>, so later starts (and other dump1090 processes) map it rather than building the tables again", 1},
 #endif    
 #if defined(DUMP1090)    
     {"device-type", OptDeviceType, "<type>", 0, "Select SDR type", 1},
@@ -65,6 +66,26 @@ static struct argp_option options[] =
     {"debug", OptDebug, "<flags>", 0, "Debug mode (verbose), see flags below", 1},
     {"quiet", OptQuiet, 0, 0, "Disable output. Use for daemon applications", 1},
     {"dcfilter", OptDcFilter, 0, 0, "Apply a 1Hz DC filter to input data (requires more CPU)", 1},
+    {"demod-phases", OptDemodPhases, "<n>", 0, "Try only the n most likely preamble phases (1-5) before a full search (default: 5)", 1},
+    {"demod-threads", OptDemodThreads, "<n>", 0, "Split demodulation of each sample buffer across n threads (default: 1)", 1},
+    {"demod-skip-quiet", OptDemodSkipQuiet, "<dB>", 0, "Don't look for Mode S preambles where no sample is this far above the mean level (default: 0, off)", 1},
+    {"soft-fix", OptSoftFix, "<n>", 0, "Correct 1- or 2-bit CRC errors among the n least confidently demodulated bits (0-16, default: 0, off)", 1},
+    {"sample-rate", OptSampleRate, "<MS/s>", 0, "Sample rate to demodulate at, 2.0 or 2.4 (default: 2.4; the --demod-* and --soft-fix options need 2.4)", 1},
+    {"kernel", OptKernel, "<name>", 0, "Use this kernel for sample conversion, preamble scanning and CRCs where available: auto, scalar, vector, neon, avx2 or clmul (default: auto, the fastest this CPU supports)", 1},
+    {"mag8", OptMag8, 0, 0, "Keep 8-bit rather than 16-bit magnitudes, halving demodulator memory traffic but losing some weak messages: up to about 0.5% of Mode S at 2.4MHz and 1% at 2.0MHz, more with weak signals (UC8 input only: rtlsdr or an ifile)", 1},
+    {"spin-wait", OptSpinWait, "<us>", 0, "Spin for up to <us> microseconds waiting for the next sample buffer (or for a free one) before sleeping (default: 50)", 1},
+    {"low-latency", OptLowLatency, 0, 0, "Busy-poll for sample buffers instead of sleeping: lowest handoff latency, but the demodulator thread uses a whole core", 1},
+    {"buffer-samples", OptBufferSamples, "<n>", 0, "Samples per sample buffer, a multiple of 1024 from 8192 to 1048576 (default: 131072); smaller buffers cut latency, larger ones cut per-buffer overhead", 1},
+    {"buffers", OptBuffers, "<n>", 0, "Number of sample buffers between the reader and the demodulator, 3-256 (default: 12); more buffers ride out longer stalls before samples are dropped", 1},
+    {"mlock", OptMlock, 0, 0, "Lock the sample buffers and lookup tables into RAM so they are never paged out (may need a higher RLIMIT_MEMLOCK, see ulimit -l)", 1},
+    {"inline-convert", OptInlineConvert, 0, 0, "Convert rtlsdr samples inside the USB callback rather than on a separate thread (saves a copy and a thread, but a slow conversion can make the dongle drop samples)", 1},
+    {"cpu-main", OptCpuMain, "<cpus>", 0, "Run the main thread (demodulation, network and json output) on these CPUs, e.g. 1 or 0,2-3 (default: any)", 1},
+    {"cpu-reader", OptCpuReader, "<cpus>", 0, "Run the SDR / file reader thread on these CPUs (default: any)", 1},
+    {"cpu-convert", OptCpuConvert, "<cpus>", 0, "Run the rtlsdr sample conversion thread on these CPUs (default: any)", 1},
+    {"cpu-demod", OptCpuDemod, "<cpus>", 0, "Run the --demod-threads worker threads on these CPUs (default: any)", 1},
+    {"sched-policy", OptSchedPolicy, "<policy>", 0, "Scheduling policy for all our threads: other, fifo or rr (default: other). fifo and rr need root, CAP_SYS_NICE or RLIMIT_RTPRIO", 1},
+    {"sched-priority", OptSchedPriority, "<n>", 0, "Real-time priority with --sched-policy fifo or rr (default: 10); the main and demodulator threads run one lower", 1},
+    {"mlockall", OptMlockAll, 0, 0, "Lock all memory, including future allocations, into RAM (see also --mlock)", 1},
     #ifndef _WIN32    
         {"write-json", OptJsonDir, "<dir>", 0, "Periodically write json output to <dir> (for external webserver)", 1},
         {"write-json-every", OptJsonTime, "<t>", 0, "Write json output every t seconds (default 1)", 1},
@@ -121,6 +142,7 @@ static struct argp_option options[] =
     
     {0,0,0,0, "ifile-specific options:", 6},
     {0,0,0, OPTION_DOC, "use with --ifile", 6},
+    {0,0,0, OPTION_DOC, "--device-type rtlsim --ifile <path> instead replays UC8 samples through the rtlsdr callback path at the sample rate, for testing without a dongle", 6},
     {"ifile", OptIfileName, "<path>", 0, "Read samples from given file ('-' for stdin)", 6},
     {"iformat", OptIfileFormat, "<type>", 0, "Set sample format (UC8, SC16, SC16Q11)", 6},
     {"throttle", OptIfileThrottle, 0, 0, "Process samples at the original capture speed", 6},
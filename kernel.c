@@ -0,0 +1,123 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// kernel.c: runtime selection of converter and demodulator kernels
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#if defined(KERNEL_HAVE_NEON)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
+static const char *kernel_names[KERNEL_MAX] = {
+    "auto", "scalar", "vector", "neon", "avx2", "clmul"
+};
+
+static bool kernel_cpu_checked;
+static bool kernel_cpu[KERNEL_MAX];
+
+static void check_cpu()
+{
+    kernel_cpu[KERNEL_SCALAR] = true;
+
+    // Generic vector code is only worth running where the baseline
+    // instruction set has a vector unit to lower it to
+#if defined(__SSE2__) || defined(__ARM_NEON) || defined(__ALTIVEC__)
+    kernel_cpu[KERNEL_VECTOR] = true;
+#endif
+
+#if defined(KERNEL_HAVE_AVX2)
+    __builtin_cpu_init();
+    kernel_cpu[KERNEL_AVX2] = __builtin_cpu_supports("avx2");
+#endif
+
+#if defined(KERNEL_HAVE_CLMUL) && defined(__x86_64__)
+    __builtin_cpu_init();
+    kernel_cpu[KERNEL_CLMUL] = __builtin_cpu_supports("pclmul");
+#elif defined(KERNEL_HAVE_CLMUL)
+    kernel_cpu[KERNEL_CLMUL] = true;
+#endif
+
+#if defined(KERNEL_HAVE_NEON)
+    kernel_cpu[KERNEL_NEON] = (getauxval(AT_HWCAP) & HWCAP_NEON) != 0;
+#endif
+
+    kernel_cpu_checked = true;
+}
+
+bool kernel_supported(kernel_t kernel)
+{
+    if (!kernel_cpu_checked)
+        check_cpu();
+
+    if (kernel <= KERNEL_AUTO || kernel >= KERNEL_MAX)
+        return false;
+    return kernel_cpu[kernel];
+}
+
+int kernel_select(const char *stage, const kernel_t *candidates, unsigned n)
+{
+    int chosen = -1;
+    unsigned i;
+
+    if (Modes.kernel != KERNEL_AUTO && kernel_supported(Modes.kernel)) {
+        for (i = 0; i < n; ++i) {
+            if (candidates[i] == Modes.kernel) {
+                chosen = i;
+                break;
+            }
+        }
+    }
+
+    if (chosen < 0) {
+        for (i = 0; i < n; ++i) {
+            if (kernel_supported(candidates[i])) {
+                chosen = i;
+                break;
+            }
+        }
+    }
+
+    if (chosen < 0) {
+        fprintf(stderr, "%s: no usable kernel\n", stage);
+    } else if (Modes.kernel != KERNEL_AUTO && candidates[chosen] != Modes.kernel) {
+        fprintf(stderr, "%s: using %s kernel (no %s kernel available)\n",
+                stage, kernel_name(candidates[chosen]), kernel_name(Modes.kernel));
+    } else {
+        fprintf(stderr, "%s: using %s kernel\n", stage, kernel_name(candidates[chosen]));
+    }
+
+    return chosen;
+}
+
+const char *kernel_name(kernel_t kernel)
+{
+    if (kernel < KERNEL_AUTO || kernel >= KERNEL_MAX)
+        return "unknown";
+    return kernel_names[kernel];
+}
+
+bool kernel_parse(const char *name, kernel_t *out)
+{
+    for (int k = KERNEL_AUTO; k < KERNEL_MAX; ++k) {
+        if (!strcasecmp(name, kernel_names[k])) {
+            *out = (kernel_t) k;
+            return true;
+        }
+    }
+
+    return false;
+}
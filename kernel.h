@@ -0,0 +1,74 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// kernel.h: runtime selection of converter and demodulator kernels
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_KERNEL_H
+#define DUMP1090_KERNEL_H
+
+#include <stdbool.h>
+
+// The instruction sets a kernel can be built for. A stage (a converter, or
+// a demodulator's preamble scan) may have an implementation for several of
+// these; the best one the CPU supports is picked at startup, unless
+// overridden with --kernel.
+typedef enum {
+    KERNEL_AUTO = 0,  // no override
+    KERNEL_SCALAR,    // plain C
+    KERNEL_VECTOR,    // compiler vector extensions, for the baseline instruction set
+    KERNEL_NEON,      // vector extensions built for NEON, on 32-bit ARM builds without it
+    KERNEL_AVX2,      // vector extensions built for AVX2, on x86
+    KERNEL_CLMUL,     // carry-less multiply: PCLMULQDQ on x86-64, PMULL on ARMv8
+    KERNEL_MAX
+} kernel_t;
+
+// Function attributes to build a kernel for a particular instruction set.
+// The KERNEL_HAVE_* macros say which ones this compiler can build.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define KERNEL_HAVE_AVX2
+# define KERNEL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+#if defined(__GNUC__) && defined(__x86_64__)
+# define KERNEL_HAVE_CLMUL
+# define KERNEL_TARGET_CLMUL __attribute__((target("pclmul")))
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+// only when the whole build targets the crypto extension
+# define KERNEL_HAVE_CLMUL
+# define KERNEL_TARGET_CLMUL
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__ARM_NEON) && defined(__linux__) && (defined(__clang__) || __GNUC__ >= 6)
+# define KERNEL_HAVE_NEON
+# define KERNEL_TARGET_NEON __attribute__((target("fpu=neon")))
+#endif
+
+// Can kernels built for this instruction set run on this CPU, and are they
+// worth running? (KERNEL_VECTOR isn't, when the baseline has no vector unit
+// and the compiler falls back to emulating vectors with scalar code)
+bool kernel_supported(kernel_t kernel);
+
+// Picks one of candidates[0..n-1], which are in order of preference, and
+// logs the choice. Unsupported candidates are skipped; a --kernel override
+// wins if it is one of the candidates. Returns the index of the chosen
+// candidate, or -1 if none can run here.
+int kernel_select(const char *stage, const kernel_t *candidates, unsigned n);
+
+const char *kernel_name(kernel_t kernel);
+
+// Parses a --kernel argument; returns false if it isn't a kernel name
+bool kernel_parse(const char *name, kernel_t *out);
+
+#endif
@@ -0,0 +1,172 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// mag_ring.c: mirror-mapped ring holding the magnitude buffers
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <sys/mman.h>
+
+static uint8_t *ring_base;  // first of the two mappings
+static size_t ring_size;    // bytes in one mapping
+
+// An unlinked shared memory object of the given size, or -1. With hugetlb,
+// it is backed by huge pages (Linux only).
+static int ring_fd(size_t size, bool hugetlb)
+{
+    int fd;
+
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+# ifdef MFD_HUGETLB
+    fd = memfd_create("dump1090-mag", MFD_CLOEXEC | (hugetlb ? MFD_HUGETLB : 0));
+# else
+    if (hugetlb)
+        return -1;
+    fd = memfd_create("dump1090-mag", MFD_CLOEXEC);
+# endif
+#else
+    char name[64];
+    if (hugetlb)
+        return -1;
+    snprintf(name, sizeof(name), "/dump1090-mag-%d", (int) getpid());
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0)
+        shm_unlink(name);
+#endif
+
+    if (fd >= 0 && ftruncate(fd, size) < 0) {
+        close(fd);
+        fd = -1;
+    }
+
+    return fd;
+}
+
+// Maps a ring of 'size' bytes (a multiple of 'align') twice, back to back,
+// at an address aligned to 'align'. Returns NULL on failure.
+static uint8_t *map_ring(size_t size, size_t align, bool hugetlb)
+{
+    uint8_t *reserved, *base;
+    size_t slack;
+    int fd;
+
+    if ((fd = ring_fd(size, hugetlb)) < 0)
+        return NULL;
+
+    // Reserve space for both copies, then map the ring over each half
+    reserved = mmap(NULL, 2 * size + align, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+
+    base = (uint8_t *) (((uintptr_t) reserved + align - 1) / align * align);
+    slack = base - reserved;
+    if (slack)
+        munmap(reserved, slack);
+    if (align - slack)
+        munmap(base + 2 * size, align - slack);
+
+    if (mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(base, 2 * size);
+        close(fd);
+        return NULL;
+    }
+
+    close(fd); // the mappings keep it alive
+    return base;
+}
+
+bool magRingInit(void)
+{
+    size_t page = sysconf(_SC_PAGESIZE);
+    size_t huge = huge_page_size();
+    size_t bytes;
+    unsigned i;
+
+    if (!(Modes.mag_buffers = calloc(Modes.mag_buffer_count, sizeof(struct mag_buf)))) {
+        fprintf(stderr, "Out of memory allocating magnitude buffers.\n");
+        return false;
+    }
+
+    // Up to mag_buffer_count-1 buffers can be waiting for the demodulator
+    // while the reader fills the next one; with the overlap of the oldest,
+    // that always fits.
+    bytes = ((size_t) Modes.mag_buffer_count * Modes.mag_buf_samples + Modes.trailing_samples) * MODES_MAG_SAMPLE_SIZE;
+
+    // Huge pages if the system has some reserved, ordinary pages otherwise
+    ring_base = NULL;
+    if (huge) {
+        ring_size = (bytes + huge - 1) / huge * huge;
+        ring_base = map_ring(ring_size, huge, true);
+    }
+    if (!ring_base) {
+        ring_size = (bytes + page - 1) / page * page;
+        ring_base = map_ring(ring_size, page, false);
+    }
+    if (!ring_base) {
+        fprintf(stderr, "Can't map magnitude ring: %s\n", strerror(errno));
+        magRingFree();
+        return false;
+    }
+
+    // Both mappings share the same pages
+    lock_memory(ring_base, ring_size);
+
+    for (i = 0; i < Modes.mag_buffer_count; ++i) {
+        size_t block_max_size = (Modes.mag_buf_samples + MODES_MAG_BLOCK_SAMPLES - 1) / MODES_MAG_BLOCK_SAMPLES * sizeof(uint16_t);
+
+        // The first buffer's overlap is the (zeroed) start of the ring
+        Modes.mag_buffers[i].data = (uint16_t *) ring_base;
+
+        if ( (Modes.mag_buffers[i].block_max = calloc(1, block_max_size)) == NULL ) {
+            fprintf(stderr, "Out of memory allocating magnitude buffer.\n");
+            magRingFree();
+            return false;
+        }
+        lock_memory(Modes.mag_buffers[i].block_max, block_max_size);
+    }
+
+    return true;
+}
+
+void magRingFree(void)
+{
+    unsigned i;
+
+    if (Modes.mag_buffers) {
+        for (i = 0; i < Modes.mag_buffer_count; ++i)
+            free(Modes.mag_buffers[i].block_max);
+        free(Modes.mag_buffers);
+        Modes.mag_buffers = NULL;
+    }
+
+    if (ring_base) {
+        munmap(ring_base, 2 * ring_size);
+        ring_base = NULL;
+    }
+}
+
+void magRingFollow(struct mag_buf *outbuf, const struct mag_buf *lastbuf)
+{
+    uint8_t *next = (uint8_t *) lastbuf->data + (size_t) lastbuf->length * MODES_MAG_SAMPLE_SIZE;
+
+    // Stay in the first mapping; the second one catches the run-off
+    if (next >= ring_base + ring_size)
+        next -= ring_size;
+
+    outbuf->data = (uint16_t *) next;
+}
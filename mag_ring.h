@@ -0,0 +1,42 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// mag_ring.h: mirror-mapped ring holding the magnitude buffers
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_MAG_RING_H
+#define DUMP1090_MAG_RING_H
+
+#include <stdbool.h>
+
+struct mag_buf;
+
+// The samples of all of Modes.mag_buffers live in one ring, which is mapped
+// twice, back to back, so that a buffer that runs off the end of the ring
+// carries on at the start. Each buffer is placed straight after the samples
+// of the one before it (magRingFollow), so its leading Modes.trailing_samples
+// of overlap are already in place and never need copying.
+
+// Maps the ring (from huge pages where available, and locked with --mlock)
+// and sets up Modes.mag_buffers. Needs Modes.trailing_samples, Modes.mag8,
+// Modes.mag_buf_samples and Modes.mag_buffer_count to be set. Returns false
+// (with a message on stderr) on failure.
+bool magRingInit(void);
+void magRingFree(void);
+
+// Points outbuf->data at the ring position following the samples of lastbuf,
+// the buffer before it. Call this before writing any new data to outbuf.
+void magRingFollow(struct mag_buf *outbuf, const struct mag_buf *lastbuf);
+
+#endif
@@ -309,6 +309,39 @@ static inline  __attribute__((always_inline)) unsigned getbits(unsigned char *da
 
 static unsigned char all_zeros[14] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 int scoreModesMessage(unsigned char *msg, int validbits)
+{
+    int msgbits;
+
+    if (validbits < 56)
+        return -2;
+
+    msgbits = modesMessageLenByType(getbits(msg, 1, 5));
+    if (validbits < msgbits)
+        return -2;
+
+    return scoreModesMessageCRC(msg, validbits, modesChecksum(msg, msgbits));
+}
+
+// Look up the bit errors for a syndrome, falling back to a correction that the
+// demodulator found from soft decisions (see --soft-fix) if it matches
+static struct errorinfo *diagnose_with_soft(uint32_t syndrome, int bitlen, struct errorinfo *soft)
+{
+    struct errorinfo *ei = modesChecksumDiagnose(syndrome, bitlen);
+    if (!ei && soft && soft->errors > 0 && soft->syndrome == syndrome)
+        return soft;
+    return ei;
+}
+
+// As scoreModesMessage(), but with the message CRC already computed
+// by the caller (e.g. incrementally while demodulating)
+int scoreModesMessageCRC(unsigned char *msg, int validbits, uint32_t checksum)
+{
+    return scoreModesMessageSoft(msg, validbits, checksum, NULL);
+}
+
+// As scoreModesMessageCRC(), also accepting a soft-decision correction
+// (or NULL) for DF11/17/18 syndromes that the tables can't fix
+int scoreModesMessageSoft(unsigned char *msg, int validbits, uint32_t checksum, struct errorinfo *soft)
 {
     int msgtype, msgbits, crc, iid;
     uint32_t addr;
@@ -326,7 +359,7 @@ int scoreModesMessage(unsigned char *msg, int validbits)
     if (!memcmp(all_zeros, msg, msgbits/8))
         return -2;
 
-    crc = modesChecksum(msg, msgbits);
+    crc = checksum;
 
     switch (msgtype) {
     case 0: // short air-air surveillance
@@ -348,7 +381,7 @@ int scoreModesMessage(unsigned char *msg, int validbits)
         crc = crc & 0xffff80;
         addr = getbits(msg, 9, 32);
 
-        ei = modesChecksumDiagnose(crc, msgbits);
+        ei = diagnose_with_soft(crc, msgbits, soft);
         if (!ei)
             return -2; // can't correct errors
 
@@ -376,7 +409,7 @@ int scoreModesMessage(unsigned char *msg, int validbits)
         
     case 17:   // Extended squitter
     case 18:   // Extended squitter/non-transponder
-        ei = modesChecksumDiagnose(crc, msgbits);
+        ei = diagnose_with_soft(crc, msgbits, soft);
         if (!ei)
             return -2; // can't correct errors
 
@@ -409,6 +442,24 @@ int scoreModesMessage(unsigned char *msg, int validbits)
     }
 }
 
+// The best score scoreModesMessage() can return for a message of this DF
+// (see the table above), or -2 if it will always be rejected
+int scoreModesMessageMax(int msgtype)
+{
+    switch (msgtype) {
+    case 0: case 4: case 5: case 16:
+    case 20: case 21:
+    case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31:
+        return 1000;
+    case 11:
+        return 1600;
+    case 17: case 18:
+        return 1800;
+    default:
+        return -2;
+    }
+}
+
 //
 //=========================================================================
 //
@@ -479,7 +530,7 @@ int decodeModesMessage(struct modesMessage *mm, unsigned char *msg)
         mm->IID = mm->crc & 0x7f;
         if (mm->crc & 0xffff80) {
             int addr;
-            struct errorinfo *ei = modesChecksumDiagnose(mm->crc & 0xffff80, mm->msgbits);
+            struct errorinfo *ei = diagnose_with_soft(mm->crc & 0xffff80, mm->msgbits, &mm->softfix);
             if (!ei) {
                 return -2; // couldn't fix it
             }
@@ -512,7 +563,7 @@ int decodeModesMessage(struct modesMessage *mm, unsigned char *msg)
         // These message types use Parity/Interrogator, but are specified to set II=0
 
         if (mm->crc != 0) {
-            ei = modesChecksumDiagnose(mm->crc, mm->msgbits);
+            ei = diagnose_with_soft(mm->crc, mm->msgbits, &mm->softfix);
             if (!ei) {
                 return -2; // couldn't fix it
             }
@@ -557,13 +608,49 @@ int decodeModesMessage(struct modesMessage *mm, unsigned char *msg)
         return -2;
     }      
 
-    // decode the bulk of the message
-
     // AA (Address announced)
     if (mm->msgtype == 11 || mm->msgtype == 17 || mm->msgtype == 18) {
         mm->AA = mm->addr = getbits(msg, 9, 32);
     }
 
+    // The bulk of the message is decoded on demand by decodeModesMessageBody(),
+    // as a relay that only forwards the bytes never needs it. DF18 is the
+    // exception: CF and the IMF bit in the ES say what sort of address it
+    // carries, which matters for the ICAO filter below.
+    mm->body_pending = 1;
+    if (mm->msgtype == 18)
+        decodeModesMessageBody(mm);
+
+    if (!mm->correctedbits && (mm->msgtype == 17 || mm->msgtype == 18 || (mm->msgtype == 11 && mm->IID == 0))) {
+        // No CRC errors seen, and either it was an DF17/18 extended squitter
+        // or a DF11 acquisition squitter with II = 0. We probably have the right address.
+
+        // We wait until here to do this as we may have needed to decode an ES to note
+        // the type of address in DF18 messages.
+
+        // NB this is the only place that adds addresses!
+        icaoFilterAdd(mm->addr);
+    }
+
+    // MLAT overrides all other sources
+    if (mm->remote && mm->timestampMsg == MAGIC_MLAT_TIMESTAMP)
+        mm->source = SOURCE_MLAT;
+
+    // all done
+    return 0;
+}
+
+// Decode everything in a message that decodeModesMessage() left for later:
+// all the fields beyond DF, address, CRC and source. Anything that looks at
+// those fields calls this first; it does nothing the second time.
+void decodeModesMessageBody(struct modesMessage *mm)
+{
+    unsigned char *msg = mm->msg;
+
+    if (!mm->body_pending)
+        return;
+    mm->body_pending = 0;
+
     // AC (Altitude Code)
     if (mm->msgtype == 0 || mm->msgtype == 4 || mm->msgtype == 16 || mm->msgtype == 20) {
         mm->AC = getbits(msg, 20, 32);
@@ -717,24 +804,6 @@ int decodeModesMessage(struct modesMessage *mm, unsigned char *msg)
         else
             mm->airground = AG_UNCERTAIN;
     }
-
-    if (!mm->correctedbits && (mm->msgtype == 17 || mm->msgtype == 18 || (mm->msgtype == 11 && mm->IID == 0))) {
-        // No CRC errors seen, and either it was an DF17/18 extended squitter
-        // or a DF11 acquisition squitter with II = 0. We probably have the right address.
-
-        // We wait until here to do this as we may have needed to decode an ES to note
-        // the type of address in DF18 messages.
-
-        // NB this is the only place that adds addresses!
-        icaoFilterAdd(mm->addr);
-    }
-
-    // MLAT overrides all other sources
-    if (mm->remote && mm->timestampMsg == MAGIC_MLAT_TIMESTAMP)
-        mm->source = SOURCE_MLAT;
-
-    // all done
-    return 0;
 }
 
 // Decode BDS2,0 carried in Comm-B or ES
@@ -1520,6 +1589,8 @@ static void displayModesMessage(struct modesMessage *mm) {
         return;         // Enough for --onlyaddr mode
     }
 
+    decodeModesMessageBody(mm);
+
     // Show the raw message.
     if (Modes.mlat && mm->timestampMsg) {
         printf("@%012" PRIX64, mm->timestampMsg);
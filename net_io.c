@@ -557,6 +557,8 @@ static void modesSendSBSOutput(struct modesMessage *mm, struct aircraft *a) {
     if (!p)
         return;
 
+    decodeModesMessageBody(mm);
+
     //
     // SBS BS style output checked against the following reference
     // http://www.homepages.mcb.net/bones/SBS/Article/Barebones42_Socket_Data.htm - seems comprehensive
@@ -754,6 +756,14 @@ static void send_sbs_heartbeat(struct net_service *service)
 //
 //=========================================================================
 //
+// Does any connected client get output built from decoded messages or
+// aircraft state? Beast and raw clients only get the message bytes.
+int modesNetWantsDecoded(void)
+{
+    return (Modes.sbs_out.service && Modes.sbs_out.service->connections) ||
+        (Modes.fatsv_out.service && Modes.fatsv_out.service->connections);
+}
+
 void modesQueueOutput(struct modesMessage *mm, struct aircraft *a) {
     int is_mlat = (mm->source == SOURCE_MLAT);
 
@@ -1319,13 +1329,19 @@ static char * appendStatsJson(char *p,
                       st->demod_rejected_bad,
                       st->demod_rejected_unknown_icao);
 
-        for (i=0; i <= Modes.nfix_crc; ++i) {
+        for (i=0; i <= (Modes.soft_fix_bits ? MODES_MAX_BITERRORS : Modes.nfix_crc); ++i) {
             if (i == 0) p += snprintf(p, end-p, ",\"accepted\":[%u", st->demod_accepted[i]);
             else p += snprintf(p, end-p, ",%u", st->demod_accepted[i]);
         }
 
         p += snprintf(p, end-p, "]");
 
+        if (Modes.demod_phases < 5)
+            p += snprintf(p, end-p, ",\"phase_ranked\":%u,\"phase_fallback\":%u", st->demod_phase_ranked, st->demod_phase_fallback);
+
+        if (Modes.soft_fix_bits)
+            p += snprintf(p, end-p, ",\"soft_fixed\":%u", st->demod_soft_fixed);
+
         if (st->signal_power_sum > 0 && st->signal_power_count > 0)
             p += snprintf(p, end-p,",\"signal\":%.1f", 10 * log10(st->signal_power_sum / st->signal_power_count));
         if (st->noise_power_sum > 0 && st->noise_power_count > 0)
@@ -1408,7 +1424,7 @@ static char * appendStatsJson(char *p,
     
 char *generateStatsJson(const char *url_path, int *len) {
     struct stats add;
-    char *buf = (char *) malloc(4096), *p = buf, *end = buf + 4096;
+    char *buf = (char *) malloc(16384), *p = buf, *end = buf + 16384;
 
     MODES_NOTUSED(url_path);
 
@@ -1427,7 +1443,9 @@ char *generateStatsJson(const char *url_path, int *len) {
 
     add_stats(&Modes.stats_alltime, &Modes.stats_current, &add);
     p = appendStatsJson(p, end, &add, "total");
-    p += snprintf(p, end-p, "\n}\n");    
+    p += snprintf(p, end-p, ",\n\"threads\":");
+    p = placementAppendJson(p, end);
+    p += snprintf(p, end-p, "\n}\n");
 
     assert(p <= end);
 
@@ -1832,6 +1850,8 @@ static void writeFATSVEvent(struct modesMessage *mm, struct aircraft *a)
     if (a->messages < 2)  // basic filter for bad decodes
         return;
 
+    decodeModesMessageBody(mm);
+
     switch (mm->msgtype) {
     case 20:
     case 21:
@@ -93,6 +93,7 @@ void sendBeastSettings(struct client *c, const char *settings);
 
 void modesInitNet(void);
 void modesQueueOutput(struct modesMessage *mm, struct aircraft *a);
+int modesNetWantsDecoded(void);
 void modesNetPeriodicWork(void);
 
 // TODO: move these somewhere else
@@ -0,0 +1,272 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// placement.c: CPU placement and scheduling policy for our threads
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <sched.h>
+
+#define PLACEMENT_MAX_THREADS 64
+#define PLACEMENT_DEFAULT_PRIORITY 10
+
+static const char *role_names[THREAD_ROLES] = { "main", "reader", "convert", "demod" };
+
+// A thread that has called placementJoin
+struct placed_thread {
+    thread_role_t role;
+    pthread_t thread;
+    bool running;
+    cpu_set_t cpus;             // as actually applied
+    int policy;
+    int priority;
+    struct timespec cpu;        // CPU time used, filled in by placementLeave
+};
+
+static pthread_mutex_t placement_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static struct {
+    cpu_set_t startup_cpus;                 // where we were allowed to run at startup; used for roles with no CPU list
+    cpu_set_t cpus[THREAD_ROLES];
+    bool has_cpus[THREAD_ROLES];
+    int policy;
+    int priority;                           // 0: PLACEMENT_DEFAULT_PRIORITY
+    struct placed_thread threads[PLACEMENT_MAX_THREADS];
+    unsigned nthreads;                      // protected by placement_mutex
+} placement;
+
+static _Thread_local struct placed_thread *this_thread;
+
+void placementInit(void)
+{
+    if (sched_getaffinity(0, sizeof(placement.startup_cpus), &placement.startup_cpus) < 0) {
+        unsigned i;
+
+        CPU_ZERO(&placement.startup_cpus);
+        for (i = 0; i < CPU_SETSIZE; ++i)
+            CPU_SET(i, &placement.startup_cpus);
+    }
+
+    placement.policy = SCHED_OTHER;
+    placement.priority = 0;
+}
+
+// Parses a CPU list such as "1" or "0,2-3"
+static bool parse_cpu_list(const char *s, cpu_set_t *set)
+{
+    CPU_ZERO(set);
+
+    while (*s) {
+        char *end;
+        long from, to;
+
+        from = to = strtol(s, &end, 10);
+        if (end == s || from < 0 || from >= CPU_SETSIZE)
+            return false;
+
+        if (*end == '-') {
+            s = end + 1;
+            to = strtol(s, &end, 10);
+            if (end == s || to < from || to >= CPU_SETSIZE)
+                return false;
+        }
+
+        for (; from <= to; ++from)
+            CPU_SET(from, set);
+
+        if (*end == ',')
+            ++end;
+        else if (*end)
+            return false;
+        s = end;
+    }
+
+    return CPU_COUNT(set) > 0;
+}
+
+bool placementSetCpus(thread_role_t role, const char *cpus)
+{
+    if (!parse_cpu_list(cpus, &placement.cpus[role])) {
+        fprintf(stderr, "--cpu-%s: '%s' is not a CPU list (e.g. 2 or 0,2-3)\n", role_names[role], cpus);
+        return false;
+    }
+
+    placement.has_cpus[role] = true;
+    return true;
+}
+
+bool placementSetPolicy(const char *policy)
+{
+    if (!strcasecmp(policy, "other")) {
+        placement.policy = SCHED_OTHER;
+    } else if (!strcasecmp(policy, "fifo")) {
+        placement.policy = SCHED_FIFO;
+    } else if (!strcasecmp(policy, "rr")) {
+        placement.policy = SCHED_RR;
+    } else {
+        fprintf(stderr, "--sched-policy must be one of other, fifo or rr\n");
+        return false;
+    }
+
+    return true;
+}
+
+bool placementSetPriority(const char *priority)
+{
+    int min = sched_get_priority_min(SCHED_FIFO);
+    int max = sched_get_priority_max(SCHED_FIFO);
+
+    placement.priority = atoi(priority);
+    if (placement.priority < min || placement.priority > max) {
+        fprintf(stderr, "--sched-priority must be between %d and %d\n", min, max);
+        return false;
+    }
+
+    return true;
+}
+
+static const char *policy_name(int policy)
+{
+    switch (policy) {
+    case SCHED_OTHER: return "other";
+    case SCHED_FIFO:  return "fifo";
+    case SCHED_RR:    return "rr";
+    default:          return "unknown";
+    }
+}
+
+// The reader side runs a step above the demodulator, so that a demodulator
+// that can't keep up makes us drop whole buffers rather than starve the
+// input and lose samples at the device.
+static int role_priority(thread_role_t role)
+{
+    int priority = (placement.priority ? placement.priority : PLACEMENT_DEFAULT_PRIORITY);
+
+    if ((role == THREAD_MAIN || role == THREAD_DEMOD) && priority > sched_get_priority_min(placement.policy))
+        --priority;
+    return priority;
+}
+
+void placementJoin(thread_role_t role)
+{
+    static bool warned_cpus, warned_policy;
+    cpu_set_t *cpus = (placement.has_cpus[role] ? &placement.cpus[role] : &placement.startup_cpus);
+    pthread_t self = pthread_self();
+    struct placed_thread joined;
+    struct sched_param param;
+    int err;
+
+    if ((err = pthread_setaffinity_np(self, sizeof(cpu_set_t), cpus)) != 0 && !warned_cpus) {
+        fprintf(stderr, "Can't restrict the %s thread to the given CPUs: %s\n", role_names[role], strerror(err));
+        warned_cpus = true;
+    }
+
+    if (placement.policy != SCHED_OTHER) {
+        param.sched_priority = role_priority(role);
+        if ((err = pthread_setschedparam(self, placement.policy, &param)) != 0 && !warned_policy) {
+            fprintf(stderr, "Can't use %s scheduling for the %s thread: %s%s\n",
+                    policy_name(placement.policy), role_names[role], strerror(err),
+                    err == EPERM ? " (this needs root, CAP_SYS_NICE or a high enough RLIMIT_RTPRIO)" : "");
+            warned_policy = true;
+        }
+    }
+
+    // Record what we actually got
+    memset(&joined, 0, sizeof(joined));
+    joined.role = role;
+    joined.thread = self;
+    joined.running = true;
+    if (pthread_getaffinity_np(self, sizeof(cpu_set_t), &joined.cpus) != 0)
+        CPU_ZERO(&joined.cpus);
+    if (pthread_getschedparam(self, &joined.policy, &param) == 0) {
+        joined.priority = param.sched_priority;
+    } else {
+        joined.policy = -1;
+        joined.priority = 0;
+    }
+
+    pthread_mutex_lock(&placement_mutex);
+    if (placement.nthreads < PLACEMENT_MAX_THREADS) {
+        this_thread = &placement.threads[placement.nthreads++];
+        *this_thread = joined;
+    }
+    pthread_mutex_unlock(&placement_mutex);
+}
+
+void placementLeave(void)
+{
+    if (!this_thread)
+        return;
+
+    pthread_mutex_lock(&placement_mutex);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &this_thread->cpu);
+    this_thread->running = false;
+    pthread_mutex_unlock(&placement_mutex);
+
+    this_thread = NULL;
+}
+
+// Appends a CPU set as a list of ranges, e.g. 0-3,6
+static char *append_cpu_list(char *p, char *end, const cpu_set_t *set)
+{
+    const char *sep = "";
+    int i, j;
+
+    for (i = 0; i < CPU_SETSIZE; i = j) {
+        if (!CPU_ISSET(i, set)) {
+            j = i + 1;
+            continue;
+        }
+
+        for (j = i + 1; j < CPU_SETSIZE && CPU_ISSET(j, set); ++j)
+            ;
+        if (j - 1 == i)
+            p += snprintf(p, end - p, "%s%d", sep, i);
+        else
+            p += snprintf(p, end - p, "%s%d-%d", sep, i, j - 1);
+        sep = ",";
+    }
+
+    return p;
+}
+
+char *placementAppendJson(char *p, char *end)
+{
+    unsigned i;
+
+    p += snprintf(p, end - p, "[");
+
+    pthread_mutex_lock(&placement_mutex);
+    for (i = 0; i < placement.nthreads; ++i) {
+        struct placed_thread *t = &placement.threads[i];
+        struct timespec cpu = t->cpu;
+        clockid_t clock;
+
+        // A thread only stops running under placement_mutex, so it is
+        // still safe to look at here
+        if (t->running && pthread_getcpuclockid(t->thread, &clock) == 0)
+            clock_gettime(clock, &cpu);
+
+        p += snprintf(p, end - p, "%s{\"role\":\"%s\",\"cpus\":\"", (i ? "," : ""), role_names[t->role]);
+        p = append_cpu_list(p, end, &t->cpus);
+        p += snprintf(p, end - p, "\",\"policy\":\"%s\",\"priority\":%d,\"running\":%s,\"cpu\":%llu}",
+                      policy_name(t->policy), t->priority, (t->running ? "true" : "false"),
+                      (unsigned long long) cpu.tv_sec * 1000 + cpu.tv_nsec / 1000000);
+    }
+    pthread_mutex_unlock(&placement_mutex);
+
+    p += snprintf(p, end - p, "]");
+    return p;
+}
@@ -0,0 +1,55 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// placement.h: CPU placement and scheduling policy for our threads
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_PLACEMENT_H
+#define DUMP1090_PLACEMENT_H
+
+#include <stdbool.h>
+
+// What a thread does. The main thread demodulates (or the first slice of
+// each buffer, with --demod-threads) and also runs all network and json
+// output from backgroundTasks().
+typedef enum {
+    THREAD_MAIN = 0,    // demodulation, network, json
+    THREAD_READER,      // SDR / file input (and the rtlsdr USB callback)
+    THREAD_CONVERT,     // rtlsdr sample conversion
+    THREAD_DEMOD,       // --demod-threads workers
+    THREAD_ROLES
+} thread_role_t;
+
+// Call once, before any threads are created
+void placementInit(void);
+
+// Option handling. Each returns false (with a message on stderr) if the
+// argument is bad.
+// Restricts threads of this role to a CPU list such as "2" or "0,2-3"
+bool placementSetCpus(thread_role_t role, const char *cpus);
+// "other" (the default), "fifo" or "rr"
+bool placementSetPolicy(const char *policy);
+bool placementSetPriority(const char *priority);
+
+// Applies the CPU list and scheduling policy for 'role' to the calling
+// thread, and registers it for the stats. Every thread we create calls this
+// first thing, and placementLeave() just before it returns.
+void placementJoin(thread_role_t role);
+void placementLeave(void);
+
+// Appends a json array describing each thread: its role, the CPUs it may
+// run on, its scheduling policy and priority, and CPU time used
+char *placementAppendJson(char *p, char *end);
+
+#endif
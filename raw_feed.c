@@ -0,0 +1,269 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// raw_feed.c: raw sample handoff from a device callback to a conversion thread
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <stdatomic.h>
+
+static struct {
+    iq_convert_fn converter;
+    iq_convert8_fn converter8;              // instead of converter, with --mag8
+    struct converter_state *converter_state;
+    uint8_t *raw_data;                      // storage behind Modes.raw_buffers
+    pthread_t thread;
+    bool thread_running;
+    atomic_bool draining;                   // set once the callback has delivered its last block
+
+    // State of the callback
+    bool was_odd;
+    bool dropping;
+    uint64_t sampleCounter;
+    struct timespec callback_cpu;
+} feed;
+
+bool rawFeedOpen(void)
+{
+    unsigned i;
+
+    if (Modes.mag8)
+        feed.converter8 = init_converter8(INPUT_UC8,
+                                          Modes.sample_rate,
+                                          Modes.dc_filter,
+                                          &feed.converter_state);
+    else
+        feed.converter = init_converter(INPUT_UC8,
+                                        Modes.sample_rate,
+                                        Modes.dc_filter,
+                                        &feed.converter_state);
+    if (!feed.converter && !feed.converter8) {
+        fprintf(stderr, "Can't initialize sample converter\n");
+        rawFeedClose();
+        return false;
+    }
+
+    feed.was_odd = false;
+    feed.dropping = false;
+    feed.sampleCounter = 0;
+
+    if (Modes.inline_convert)
+        return true;
+
+    Modes.raw_buffers = calloc(Modes.mag_buffer_count, sizeof(struct raw_buf));
+    feed.raw_data = alloc_big((size_t) Modes.mag_buffer_count * Modes.mag_buf_samples * 2);
+    if (!Modes.raw_buffers || !feed.raw_data) {
+        fprintf(stderr, "Out of memory allocating raw sample buffers.\n");
+        rawFeedClose();
+        return false;
+    }
+
+    for (i = 0; i < Modes.mag_buffer_count; ++i)
+        Modes.raw_buffers[i].data = feed.raw_data + (size_t) i * Modes.mag_buf_samples * 2;
+
+    return true;
+}
+
+static void convert(uint8_t *buf, struct mag_buf *outbuf)
+{
+    if (feed.converter8)
+        feed.converter8(buf, &outbuf->data8[Modes.trailing_samples], outbuf->length, feed.converter_state, &outbuf->mean_level, &outbuf->mean_power, outbuf->block_max);
+    else
+        feed.converter(buf, &outbuf->data[Modes.trailing_samples], outbuf->length, feed.converter_state, &outbuf->mean_level, &outbuf->mean_power, outbuf->block_max);
+}
+
+static void *convertThreadEntryPoint(void *arg)
+{
+    struct timespec thread_cpu;
+
+    MODES_NOTUSED(arg);
+
+    placementJoin(THREAD_CONVERT);
+    start_cpu_timing(&thread_cpu);
+
+    while (!Modes.exit) {
+        bool draining = atomic_load(&feed.draining);
+        struct raw_buf *rawbuf;
+        struct mag_buf *outbuf, *lastbuf;
+
+        if (!(rawbuf = fifoRawPeek())) {
+            if (draining)
+                break;
+            fifoRawWaitForData(100);
+            continue;
+        }
+
+        // Waiting here is fine: the raw buffers take up the slack
+        if (!fifoFreeBuffers()) {
+            fifoWaitForSpace(100);
+            continue;
+        }
+
+        outbuf = fifoNextFree(&lastbuf);
+        outbuf->dropped = rawbuf->dropped;
+        outbuf->sampleTimestamp = rawbuf->sampleTimestamp;
+        outbuf->sysTimestamp = rawbuf->sysTimestamp;
+
+        // The overlap is the end of the last block, already in the ring
+        magRingFollow(outbuf, lastbuf);
+
+        outbuf->length = rawbuf->length;
+        convert(rawbuf->data, outbuf);
+        fifoRawPop();
+
+        // accumulate CPU, and restart measurement
+        fifoAddReaderCpu(&thread_cpu);
+
+        // Push the new data to the demodulation thread
+        fifoPush();
+    }
+
+    placementLeave();
+    return NULL;
+}
+
+void rawFeedStart(void)
+{
+    start_cpu_timing(&feed.callback_cpu);
+
+    if (Modes.inline_convert)
+        return;
+
+    atomic_store(&feed.draining, false);
+    if (pthread_create(&feed.thread, NULL, convertThreadEntryPoint, NULL) != 0) {
+        fprintf(stderr, "Can't start the sample conversion thread, converting in the callback instead\n");
+        Modes.inline_convert = 1;
+        return;
+    }
+    feed.thread_running = true;
+}
+
+// Where the drop count for the next block goes
+static uint32_t *next_dropped(void)
+{
+    if (Modes.inline_convert)
+        return &fifoNextFree(NULL)->dropped;
+    else
+        return &fifoRawNextFree()->dropped;
+}
+
+void rawFeedLost(uint32_t samples)
+{
+    *next_dropped() += samples;
+    feed.sampleCounter += samples;
+}
+
+void rawFeedBlock(uint8_t *buf, uint32_t len)
+{
+    uint32_t slen;
+    unsigned free_bufs;
+    unsigned block_duration;
+    uint64_t sampleTimestamp;
+    struct timespec sysTimestamp;
+
+    if (len > Modes.mag_buf_samples * 2) {
+        // wat?! Discard the start.
+        unsigned discard = (len - Modes.mag_buf_samples * 2 + 1) / 2;
+        *next_dropped() += discard;
+        buf += discard*2;
+        len -= discard*2;
+    }
+
+    if (feed.was_odd) {
+        // Drop a sample so we are in sync with I/Q samples again (hopefully)
+        ++buf;
+        --len;
+        ++*next_dropped();
+    }
+
+    feed.was_odd = (len & 1);
+    slen = len/2;
+
+    free_bufs = (Modes.inline_convert ? fifoFreeBuffers() : fifoRawFreeBuffers());
+    if (free_bufs == 0 || (feed.dropping && free_bufs < Modes.mag_buffer_count/2)) {
+        // FIFO is full. Drop this block.
+        feed.dropping = true;
+        rawFeedLost(slen);
+        return;
+    }
+
+    feed.dropping = false;
+
+    // Compute the sample timestamp and system timestamp for the start of the block
+    sampleTimestamp = feed.sampleCounter * 12e6 / Modes.sample_rate;
+    feed.sampleCounter += slen;
+    block_duration = 1e9 * slen / Modes.sample_rate;
+
+    // Get the approx system time for the start of this block
+    clock_gettime(CLOCK_REALTIME, &sysTimestamp);
+    sysTimestamp.tv_nsec -= block_duration;
+    normalize_timespec(&sysTimestamp);
+
+    if (Modes.inline_convert) {
+        struct mag_buf *outbuf, *lastbuf;
+
+        outbuf = fifoNextFree(&lastbuf);
+        outbuf->sampleTimestamp = sampleTimestamp;
+        outbuf->sysTimestamp = sysTimestamp;
+
+        // The overlap is the end of the last block, already in the ring
+        magRingFollow(outbuf, lastbuf);
+
+        // Convert the new data
+        outbuf->length = slen;
+        convert(buf, outbuf);
+
+        fifoAddReaderCpu(&feed.callback_cpu);
+        fifoPush();
+    } else {
+        struct raw_buf *rawbuf = fifoRawNextFree();
+
+        rawbuf->sampleTimestamp = sampleTimestamp;
+        rawbuf->sysTimestamp = sysTimestamp;
+        rawbuf->length = slen;
+        memcpy(rawbuf->data, buf, slen * 2);
+
+        fifoAddReaderCpu(&feed.callback_cpu);
+        fifoRawPush();
+    }
+}
+
+void rawFeedStop(void)
+{
+    if (!feed.thread_running)
+        return;
+
+    atomic_store(&feed.draining, true);
+    fifoWake();
+    pthread_join(feed.thread, NULL);
+    feed.thread_running = false;
+}
+
+void rawFeedClose(void)
+{
+    rawFeedStop();
+
+    if (feed.converter || feed.converter8) {
+        cleanup_converter(feed.converter_state);
+        feed.converter = NULL;
+        feed.converter8 = NULL;
+        feed.converter_state = NULL;
+    }
+
+    free(Modes.raw_buffers);
+    Modes.raw_buffers = NULL;
+    free_big(feed.raw_data);
+    feed.raw_data = NULL;
+}
@@ -0,0 +1,45 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// raw_feed.h: raw sample handoff from a device callback to a conversion thread
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_RAW_FEED_H
+#define DUMP1090_RAW_FEED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Devices that deliver UC8 blocks from a callback (rtlsdr, and the rtlsim
+// stand-in) pass each block to rawFeedBlock. That only timestamps the block
+// and copies it into Modes.raw_buffers, so the callback returns quickly and
+// the next USB transfer isn't held up; a conversion thread turns the raw
+// blocks into magnitude buffers. With --inline-convert, rawFeedBlock
+// converts straight into a magnitude buffer instead, as it used to.
+
+// Sets up the converter and raw buffers. Returns false (with a message on
+// stderr) on failure.
+bool rawFeedOpen(void);
+// Starts the conversion thread. Call from the thread that runs the callback.
+void rawFeedStart(void);
+// The body of the device callback
+void rawFeedBlock(uint8_t *buf, uint32_t len);
+// Accounts for samples the device lost before they reached the callback
+void rawFeedLost(uint32_t samples);
+// Converts whatever is still queued (unless Modes.exit is set) and stops the
+// conversion thread
+void rawFeedStop(void);
+void rawFeedClose(void);
+
+#endif
@@ -21,6 +21,7 @@
 #include "dump1090.h"
 
 #include "sdr_ifile.h"
+#include "sdr_rtlsim.h"
 #ifdef ENABLE_RTLSDR
 #  include "sdr_rtlsdr.h"
 #endif
@@ -84,6 +85,7 @@ static sdr_handler sdr_handlers[] = {
 
     {  beastInitConfig,beastHandleOption, beastOpen, noRun, noClose, "modesbeast", SDR_MODESBEAST, 0 },
     {  ifileInitConfig, ifileHandleOption, ifileOpen, ifileRun, ifileClose, "ifile", SDR_IFILE, 0 },
+    {  rtlsimInitConfig, rtlsimHandleOption, rtlsimOpen, rtlsimRun, rtlsimClose, "rtlsim", SDR_RTLSIM, 0 },
     {  noInitConfig, noHandleOption, noOpen, noRun, noClose, "none", SDR_NONE, 0 },
 
     {  NULL, NULL, NULL, NULL, NULL, NULL, SDR_NONE, 0 } /* must come last */
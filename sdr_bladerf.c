@@ -152,6 +152,11 @@ bool bladeRFOpen()
 
     int status;
 
+    if (Modes.mag8) {
+        fprintf(stderr, "bladerf: --mag8 needs UC8 input, which the bladeRF doesn't produce\n");
+        return false;
+    }
+
     bladerf_set_usb_reset_on_open(true);
     if ((status = bladerf_open(&BladeRF.device, Modes.dev_name)) < 0) {
         fprintf(stderr, "Failed to open bladeRF: %s\n", bladerf_strerror(status));
@@ -297,33 +302,24 @@ static void *handle_bladerf_samples(struct bladerf *dev,
     struct timespec entryTimestamp;
     clock_gettime(CLOCK_REALTIME, &entryTimestamp);
 
-    pthread_mutex_lock(&Modes.data_mutex);
     if (Modes.exit) {
-        pthread_mutex_unlock(&Modes.data_mutex);
         return BLADERF_STREAM_SHUTDOWN;
     }
 
-    unsigned next_free_buffer = (Modes.first_free_buffer + 1) % MODES_MAG_BUFFERS;
-    struct mag_buf *outbuf = &Modes.mag_buffers[Modes.first_free_buffer];
-    struct mag_buf *lastbuf = &Modes.mag_buffers[(Modes.first_free_buffer + MODES_MAG_BUFFERS - 1) % MODES_MAG_BUFFERS];
-    unsigned free_bufs = (Modes.first_filled_buffer - next_free_buffer + MODES_MAG_BUFFERS) % MODES_MAG_BUFFERS;
+    struct mag_buf *lastbuf;
+    struct mag_buf *outbuf = fifoNextFree(&lastbuf);
+    unsigned free_bufs = fifoFreeBuffers();
 
-    if (free_bufs == 0 || (dropping && free_bufs < MODES_MAG_BUFFERS/2)) {
+    if (free_bufs == 0 || (dropping && free_bufs < Modes.mag_buffer_count/2)) {
         // FIFO is full. Drop this block.
         dropping = true;
-        pthread_mutex_unlock(&Modes.data_mutex);
         return samples;
     }
 
     dropping = false;
-    pthread_mutex_unlock(&Modes.data_mutex);
 
-    // Copy trailing data from last block (or reset if not valid)
-    if (outbuf->dropped == 0) {
-        memcpy(outbuf->data, lastbuf->data + lastbuf->length, Modes.trailing_samples * sizeof(uint16_t));
-    } else {
-        memset(outbuf->data, 0, Modes.trailing_samples * sizeof(uint16_t));
-    }
+    // The overlap is the end of the last block, already in the ring
+    magRingFollow(outbuf, lastbuf);
 
     // start handling metadata blocks
     outbuf->dropped = 0;
@@ -335,7 +331,7 @@ static void *handle_bladerf_samples(struct bladerf *dev,
 
     static bool overrun = true; // ignore initial overruns as we get up to speed
     static bool first_buffer = true;
-    for (unsigned offset = 0; offset < MODES_MAG_BUF_SAMPLES * 4; offset += BladeRF.block_size) {
+    for (unsigned offset = 0; offset < Modes.mag_buf_samples * 4; offset += BladeRF.block_size) {
         // read the next metadata header
         uint8_t *header = ((uint8_t*)samples) + offset;
         uint64_t metadata_magic = le32toh(*(uint32_t*)(header));
@@ -383,7 +379,7 @@ static void *handle_bladerf_samples(struct bladerf *dev,
 
         // Convert a block of data
         double mean_level, mean_power;
-        BladeRF.converter(sample_data, &outbuf->data[Modes.trailing_samples + outbuf->length], samples_per_block, BladeRF.converter_state, &mean_level, &mean_power);
+        BladeRF.converter(sample_data, &outbuf->data[Modes.trailing_samples + outbuf->length], samples_per_block, BladeRF.converter_state, &mean_level, &mean_power, NULL);
         outbuf->length += samples_per_block;
         outbuf->mean_level += mean_level;
         outbuf->mean_power += mean_power;
@@ -404,19 +400,14 @@ static void *handle_bladerf_samples(struct bladerf *dev,
         outbuf->mean_level /= blocks_processed;
         outbuf->mean_power /= blocks_processed;
 
-        // Push the new data to the demodulation thread
-        pthread_mutex_lock(&Modes.data_mutex);
-
-        // accumulate CPU while holding the mutex, and restart measurement
-        end_cpu_timing(&thread_cpu, &Modes.reader_cpu_accumulator);
-        start_cpu_timing(&thread_cpu);
+        // blocks from the device don't line up with the peak map, so do that in one go
+        compute_block_max(&outbuf->data[Modes.trailing_samples], outbuf->length, outbuf->block_max);
 
-        Modes.mag_buffers[next_free_buffer].dropped = 0;
-        Modes.mag_buffers[next_free_buffer].length = 0;  // just in case
-        Modes.first_free_buffer = next_free_buffer;
+        // accumulate CPU, and restart measurement
+        fifoAddReaderCpu(&thread_cpu);
 
-        pthread_cond_signal(&Modes.data_cond);
-        pthread_mutex_unlock(&Modes.data_mutex);
+        // Push the new data to the demodulation thread
+        fifoPush();
     }
 
     return samples;
@@ -441,14 +432,14 @@ void bladeRFRun()
                                       &buffers,
                                       /* num_buffers */ transfers,
                                       BLADERF_FORMAT_SC16_Q11_META,
-                                      /* samples_per_buffer */ MODES_MAG_BUF_SAMPLES,
+                                      /* samples_per_buffer */ Modes.mag_buf_samples,
                                       /* num_transfers */ transfers,
                                       /* user_data */ NULL)) < 0) {
         fprintf(stderr, "bladerf_init_stream() failed: %s\n", bladerf_strerror(status));
         goto out;
     }
 
-    unsigned ms_per_transfer = 1000 * MODES_MAG_BUF_SAMPLES / Modes.sample_rate;
+    unsigned ms_per_transfer = 1000 * Modes.mag_buf_samples / Modes.sample_rate;
     if ((status = bladerf_set_stream_timeout(BladeRF.device, BLADERF_MODULE_RX, ms_per_transfer * (transfers + 2))) < 0) {
         fprintf(stderr, "bladerf_set_stream_timeout() failed: %s\n", bladerf_strerror(status));
         goto out;
@@ -60,6 +60,7 @@ static struct {
     uint16_t padding2;
     void *readbuf;
     iq_convert_fn converter;
+    iq_convert8_fn converter8;              // instead of converter, with --mag8
     struct converter_state *converter_state;
     const char *filename;
 } ifile;
@@ -73,6 +74,7 @@ void ifileInitConfig(void)
     ifile.bytes_per_sample = 0;
     ifile.readbuf = NULL;
     ifile.converter = NULL;
+    ifile.converter8 = NULL;
     ifile.converter_state = NULL;
 }
 
@@ -138,17 +140,29 @@ bool ifileOpen(void)
         return false;
     }
 
-    if (!(ifile.readbuf = malloc(MODES_MAG_BUF_SAMPLES * ifile.bytes_per_sample))) {
+    if (!(ifile.readbuf = alloc_big(Modes.mag_buf_samples * ifile.bytes_per_sample))) {
         fprintf(stderr, "ifile: failed to allocate read buffer\n");
         ifileClose();
         return false;
     }
 
-    ifile.converter = init_converter(ifile.input_format,
-                                     Modes.sample_rate,
-                                     Modes.dc_filter,
-                                     &ifile.converter_state);
-    if (!ifile.converter) {
+    if (Modes.mag8 && ifile.input_format != INPUT_UC8) {
+        fprintf(stderr, "ifile: --mag8 needs UC8 input\n");
+        ifileClose();
+        return false;
+    }
+
+    if (Modes.mag8)
+        ifile.converter8 = init_converter8(ifile.input_format,
+                                           Modes.sample_rate,
+                                           Modes.dc_filter,
+                                           &ifile.converter_state);
+    else
+        ifile.converter = init_converter(ifile.input_format,
+                                         Modes.sample_rate,
+                                         Modes.dc_filter,
+                                         &ifile.converter_state);
+    if (!ifile.converter && !ifile.converter8) {
         fprintf(stderr, "ifile: can't initialize sample converter\n");
         ifileClose();
         return false;
@@ -172,40 +186,31 @@ void ifileRun()
 
     clock_gettime(CLOCK_MONOTONIC, &next_buffer_delivery);
 
-    pthread_mutex_lock(&Modes.data_mutex);
     while (!Modes.exit && !eof) {
         ssize_t nread, toread;
         void *r;
         struct mag_buf *outbuf, *lastbuf;
-        unsigned next_free_buffer;
         unsigned slen;
 
-        next_free_buffer = (Modes.first_free_buffer + 1) % MODES_MAG_BUFFERS;
-        if (next_free_buffer == Modes.first_filled_buffer) {
+        if (!fifoFreeBuffers()) {
             // no space for output yet
-            pthread_cond_wait(&Modes.data_cond, &Modes.data_mutex);
+            fifoWaitForSpace(100);
             continue;
         }
 
-        outbuf = &Modes.mag_buffers[Modes.first_free_buffer];
-        lastbuf = &Modes.mag_buffers[(Modes.first_free_buffer + MODES_MAG_BUFFERS - 1) % MODES_MAG_BUFFERS];
-        pthread_mutex_unlock(&Modes.data_mutex);
+        outbuf = fifoNextFree(&lastbuf);
 
         // Compute the sample timestamp for the start of the block
         outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
-        sampleCounter += MODES_MAG_BUF_SAMPLES;
+        sampleCounter += Modes.mag_buf_samples;
 
-        // Copy trailing data from last block (or reset if not valid)
-        if (lastbuf->length >= Modes.trailing_samples) {
-            memcpy(outbuf->data, lastbuf->data + lastbuf->length, Modes.trailing_samples * sizeof(uint16_t));
-        } else {
-            memset(outbuf->data, 0, Modes.trailing_samples * sizeof(uint16_t));
-        }
+        // The overlap is the end of the last block, already in the ring
+        magRingFollow(outbuf, lastbuf);
 
         // Get the system time for the start of this block
         clock_gettime(CLOCK_REALTIME, &outbuf->sysTimestamp);
 
-        toread = MODES_MAG_BUF_SAMPLES * ifile.bytes_per_sample;
+        toread = Modes.mag_buf_samples * ifile.bytes_per_sample;
         r = ifile.readbuf;
         while (toread) {
             nread = read(ifile.fd, r, toread);
@@ -221,10 +226,13 @@ void ifileRun()
             toread -= nread;
         }
 
-        slen = outbuf->length = MODES_MAG_BUF_SAMPLES - toread / ifile.bytes_per_sample;
+        slen = outbuf->length = Modes.mag_buf_samples - toread / ifile.bytes_per_sample;
 
         // Convert the new data
-        ifile.converter(ifile.readbuf, &outbuf->data[Modes.trailing_samples], slen, ifile.converter_state, &outbuf->mean_level, &outbuf->mean_power);
+        if (ifile.converter8)
+            ifile.converter8(ifile.readbuf, &outbuf->data8[Modes.trailing_samples], slen, ifile.converter_state, &outbuf->mean_level, &outbuf->mean_power, outbuf->block_max);
+        else
+            ifile.converter(ifile.readbuf, &outbuf->data[Modes.trailing_samples], slen, ifile.converter_state, &outbuf->mean_level, &outbuf->mean_power, outbuf->block_max);
 
         if (ifile.throttle || Modes.interactive) {
             // Wait until we are allowed to release this buffer to the main thread
@@ -236,32 +244,29 @@ void ifileRun()
             normalize_timespec(&next_buffer_delivery);
         }
 
+        // accumulate CPU, and restart measurement
+        fifoAddReaderCpu(&thread_cpu);
+
         // Push the new data to the main thread
-        pthread_mutex_lock(&Modes.data_mutex);
-        Modes.first_free_buffer = next_free_buffer;
-        // accumulate CPU while holding the mutex, and restart measurement
-        end_cpu_timing(&thread_cpu, &Modes.reader_cpu_accumulator);
-        start_cpu_timing(&thread_cpu);
-        pthread_cond_signal(&Modes.data_cond);
+        fifoPush();
     }
 
     // Wait for the main thread to consume all data
-    while (!Modes.exit && Modes.first_filled_buffer != Modes.first_free_buffer)
-        pthread_cond_wait(&Modes.data_cond, &Modes.data_mutex);
-
-    pthread_mutex_unlock(&Modes.data_mutex);
+    while (!Modes.exit && fifoPeek())
+        fifoWaitForDrain(100);
 }
 
 void ifileClose()
 {
-    if (ifile.converter) {
+    if (ifile.converter || ifile.converter8) {
         cleanup_converter(ifile.converter_state);
         ifile.converter = NULL;
+        ifile.converter8 = NULL;
         ifile.converter_state = NULL;
     }
 
     if (ifile.readbuf) {
-        free(ifile.readbuf);
+        free_big(ifile.readbuf);
         ifile.readbuf = NULL;
     }
 
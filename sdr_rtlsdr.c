@@ -54,8 +54,6 @@
 #include <rtl-sdr.h>
 
 static struct {
-    iq_convert_fn converter;
-    struct converter_state *converter_state;
     rtlsdr_dev_t *dev;
     int ppm_error;
     bool digital_agc;
@@ -72,8 +70,6 @@ void rtlsdrInitConfig()
     RTLSDR.dev = NULL;
     RTLSDR.digital_agc = false;
     RTLSDR.ppm_error = 0;
-    RTLSDR.converter = NULL;
-    RTLSDR.converter_state = NULL;
 }
 
 static void show_rtlsdr_devices()
@@ -228,12 +224,7 @@ bool rtlsdrOpen(void) {
 
     rtlsdr_reset_buffer(RTLSDR.dev);
 
-    RTLSDR.converter = init_converter(INPUT_UC8,
-                                      Modes.sample_rate,
-                                      Modes.dc_filter,
-                                      &RTLSDR.converter_state);
-    if (!RTLSDR.converter) {
-        fprintf(stderr, "rtlsdr: can't initialize sample converter\n");
+    if (!rawFeedOpen()) {
         rtlsdrClose();
         return false;
     }
@@ -241,104 +232,23 @@ bool rtlsdrOpen(void) {
     return true;
 }
 
-static struct timespec rtlsdr_thread_cpu;
-
 void rtlsdrCallback(unsigned char *buf, uint32_t len, void *ctx) {
-    struct mag_buf *outbuf;
-    struct mag_buf *lastbuf;
-    uint32_t slen;
-    unsigned next_free_buffer;
-    unsigned free_bufs;
-    unsigned block_duration;
-
-    static int was_odd = 0; // paranoia!!
-    static int dropping = 0;
-    static uint64_t sampleCounter = 0;
-
     MODES_NOTUSED(ctx);
 
-    // Lock the data buffer variables before accessing them
-    pthread_mutex_lock(&Modes.data_mutex);
     if (Modes.exit) {
         rtlsdr_cancel_async(RTLSDR.dev); // ask our caller to exit
     }
 
-    next_free_buffer = (Modes.first_free_buffer + 1) % MODES_MAG_BUFFERS;
-    outbuf = &Modes.mag_buffers[Modes.first_free_buffer];
-    lastbuf = &Modes.mag_buffers[(Modes.first_free_buffer + MODES_MAG_BUFFERS - 1) % MODES_MAG_BUFFERS];
-    free_bufs = (Modes.first_filled_buffer - next_free_buffer + MODES_MAG_BUFFERS) % MODES_MAG_BUFFERS;
-
     // Paranoia! Unlikely, but let's go for belt and suspenders here
 
-    if (len != MODES_RTL_BUF_SIZE) {
+    if (len != Modes.mag_buf_samples * 2) {
         fprintf(stderr, "weirdness: rtlsdr gave us a block with an unusual size (got %u bytes, expected %u bytes)\n",
-                (unsigned)len, (unsigned)MODES_RTL_BUF_SIZE);
-
-        if (len > MODES_RTL_BUF_SIZE) {
-            // wat?! Discard the start.
-            unsigned discard = (len - MODES_RTL_BUF_SIZE + 1) / 2;
-            outbuf->dropped += discard;
-            buf += discard*2;
-            len -= discard*2;
-        }
-    }
-
-    if (was_odd) {
-        // Drop a sample so we are in sync with I/Q samples again (hopefully)
-        ++buf;
-        --len;
-        ++outbuf->dropped;
-    }
-
-    was_odd = (len & 1);
-    slen = len/2;
-
-    if (free_bufs == 0 || (dropping && free_bufs < MODES_MAG_BUFFERS/2)) {
-        // FIFO is full. Drop this block.
-        dropping = 1;
-        outbuf->dropped += slen;
-        sampleCounter += slen;
-        pthread_mutex_unlock(&Modes.data_mutex);
-        return;
+                (unsigned)len, Modes.mag_buf_samples * 2);
     }
 
-    dropping = 0;
-    pthread_mutex_unlock(&Modes.data_mutex);
-
-    // Compute the sample timestamp and system timestamp for the start of the block
-    outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
-    sampleCounter += slen;
-    block_duration = 1e9 * slen / Modes.sample_rate;
-
-    // Get the approx system time for the start of this block
-    clock_gettime(CLOCK_REALTIME, &outbuf->sysTimestamp);
-    outbuf->sysTimestamp.tv_nsec -= block_duration;
-    normalize_timespec(&outbuf->sysTimestamp);
-
-    // Copy trailing data from last block (or reset if not valid)
-    if (outbuf->dropped == 0) {
-        memcpy(outbuf->data, lastbuf->data + lastbuf->length, Modes.trailing_samples * sizeof(uint16_t));
-    } else {
-        memset(outbuf->data, 0, Modes.trailing_samples * sizeof(uint16_t));
-    }
-
-    // Convert the new data
-    outbuf->length = slen;
-    RTLSDR.converter(buf, &outbuf->data[Modes.trailing_samples], slen, RTLSDR.converter_state, &outbuf->mean_level, &outbuf->mean_power);
-
-    // Push the new data to the demodulation thread
-    pthread_mutex_lock(&Modes.data_mutex);
-
-    Modes.mag_buffers[next_free_buffer].dropped = 0;
-    Modes.mag_buffers[next_free_buffer].length = 0;  // just in case
-    Modes.first_free_buffer = next_free_buffer;
-
-    // accumulate CPU while holding the mutex, and restart measurement
-    end_cpu_timing(&rtlsdr_thread_cpu, &Modes.reader_cpu_accumulator);
-    start_cpu_timing(&rtlsdr_thread_cpu);
-
-    pthread_cond_signal(&Modes.data_cond);
-    pthread_mutex_unlock(&Modes.data_mutex);
+    // Unless --inline-convert is on, this only copies the block out, so the
+    // transfer goes back to libusb promptly
+    rawFeedBlock(buf, len);
 }
 
 void rtlsdrRun()
@@ -347,13 +257,15 @@ void rtlsdrRun()
         return;
     }
 
-    start_cpu_timing(&rtlsdr_thread_cpu);
+    rawFeedStart();
 
     while (!Modes.exit) {
         rtlsdr_read_async(RTLSDR.dev, rtlsdrCallback, NULL,
-                          MODES_RTL_BUFFERS,
-                          MODES_RTL_BUF_SIZE);
+                          Modes.mag_buffer_count + MODES_RTL_EXTRA_BUFFERS,
+                          Modes.mag_buf_samples * 2); // UC8, 2 bytes per sample
     }
+
+    rawFeedStop();
 }
 
 void rtlsdrClose()
@@ -363,9 +275,5 @@ void rtlsdrClose()
         RTLSDR.dev = NULL;
     }
 
-    if (RTLSDR.converter) {
-        cleanup_converter(RTLSDR.converter_state);
-        RTLSDR.converter = NULL;
-        RTLSDR.converter_state = NULL;
-    }
+    rawFeedClose();
 }
@@ -0,0 +1,159 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// sdr_rtlsim.c: rtlsdr stand-in that replays a sample file
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+#include "sdr_rtlsim.h"
+
+// A dongle fills USB transfers at the sample rate whether or not we keep
+// up. libusb has Modes.mag_buffer_count + MODES_RTL_EXTRA_BUFFERS transfers
+// queued; the one being handled by the callback isn't resubmitted until the
+// callback returns. If the callback runs so late that every other transfer
+// has filled up too, the dongle overruns and the samples are lost before we
+// ever see them. This replays a file the same way, so drops caused by a
+// slow callback can be measured without hardware.
+
+static struct {
+    const char *filename;
+    int fd;
+    uint8_t *readbuf;
+} rtlsim;
+
+void rtlsimInitConfig(void)
+{
+    rtlsim.filename = NULL;
+    rtlsim.fd = -1;
+    rtlsim.readbuf = NULL;
+}
+
+bool rtlsimHandleOption(int argc, char *argv)
+{
+    switch(argc){
+        case OptIfileName:
+            rtlsim.filename = strdup(argv);
+            break;
+    }
+    return true;
+}
+
+bool rtlsimOpen(void)
+{
+    if (!rtlsim.filename) {
+        fprintf(stderr, "SDR type 'rtlsim' requires an --ifile argument (UC8 samples)\n");
+        return false;
+    }
+
+    if (!strcmp(rtlsim.filename, "-")) {
+        rtlsim.fd = STDIN_FILENO;
+    } else if ((rtlsim.fd = open(rtlsim.filename, O_RDONLY)) < 0) {
+        fprintf(stderr, "rtlsim: could not open %s: %s\n",
+                rtlsim.filename, strerror(errno));
+        return false;
+    }
+
+    if (!(rtlsim.readbuf = alloc_big(Modes.mag_buf_samples * 2))) {
+        fprintf(stderr, "rtlsim: failed to allocate read buffer\n");
+        rtlsimClose();
+        return false;
+    }
+
+    if (!rawFeedOpen()) {
+        rtlsimClose();
+        return false;
+    }
+
+    return true;
+}
+
+// Reads one transfer's worth of samples; a short read means end of file
+static uint32_t read_transfer(void)
+{
+    uint32_t len = 0;
+
+    while (len < Modes.mag_buf_samples * 2) {
+        ssize_t nread = read(rtlsim.fd, rtlsim.readbuf + len, Modes.mag_buf_samples * 2 - len);
+        if (nread <= 0) {
+            if (nread < 0)
+                fprintf(stderr, "rtlsim: error reading input file: %s\n", strerror(errno));
+            break;
+        }
+        len += nread;
+    }
+
+    return len;
+}
+
+void rtlsimRun()
+{
+    unsigned transfers = Modes.mag_buffer_count + MODES_RTL_EXTRA_BUFFERS;
+    uint64_t transfer_ns = 1e9 * Modes.mag_buf_samples / Modes.sample_rate;
+    struct timespec transfer_done, now;
+    uint32_t len;
+
+    if (rtlsim.fd < 0)
+        return;
+
+    rawFeedStart();
+
+    clock_gettime(CLOCK_MONOTONIC, &transfer_done);
+
+    while (!Modes.exit && (len = read_transfer()) > 0) {
+        int64_t late_ns;
+        unsigned lost;
+
+        // The dongle finishes filling this transfer after transfer_ns
+        transfer_done.tv_nsec += transfer_ns;
+        normalize_timespec(&transfer_done);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &transfer_done, NULL) == EINTR)
+            ;
+
+        rawFeedBlock(rtlsim.readbuf, len);
+
+        // Transfers that filled up while the callback ran are waiting for
+        // us; beyond what the queued transfers hold, the dongle overran
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        late_ns = (now.tv_sec - transfer_done.tv_sec) * 1000000000LL + (now.tv_nsec - transfer_done.tv_nsec);
+        if (late_ns < 0 || late_ns / transfer_ns < transfers)
+            continue;
+
+        for (lost = late_ns / transfer_ns - (transfers - 1); lost > 0 && !Modes.exit; --lost) {
+            if ((len = read_transfer()) == 0)
+                break;
+            rawFeedLost(len / 2);
+            transfer_done.tv_nsec += transfer_ns;
+            normalize_timespec(&transfer_done);
+        }
+    }
+
+    rawFeedStop();
+
+    // Wait for the main thread to consume all data
+    while (!Modes.exit && fifoPeek())
+        fifoWaitForDrain(100);
+}
+
+void rtlsimClose()
+{
+    rawFeedClose();
+
+    free_big(rtlsim.readbuf);
+    rtlsim.readbuf = NULL;
+
+    if (rtlsim.fd >= 0 && rtlsim.fd != STDIN_FILENO) {
+        close(rtlsim.fd);
+        rtlsim.fd = -1;
+    }
+}
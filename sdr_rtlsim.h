@@ -0,0 +1,30 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// sdr_rtlsim.h: rtlsdr stand-in that replays a sample file (header)
+//
+// This file is free software: you may copy, redistribute and/or modify it  
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your  
+// option) any later version.  
+//
+// This file is distributed in the hope that it will be useful, but  
+// WITHOUT ANY WARRANTY; without even the implied warranty of  
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU  
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License  
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef SDR_RTLSIM_H
+#define SDR_RTLSIM_H
+
+// Pseudo-SDR that feeds a UC8 sample file through the rtlsdr callback path
+// at the sample rate, for testing that path without a dongle
+
+void rtlsimInitConfig();
+bool rtlsimHandleOption(int argc, char *argv);
+bool rtlsimOpen();
+void rtlsimRun();
+void rtlsimClose();
+
+#endif
@@ -86,8 +86,14 @@ void display_stats(struct stats *st) {
         printf("    %u with bad message format or invalid CRC\n",   st->demod_rejected_bad);
         printf("    %u with unrecognized ICAO address\n",           st->demod_rejected_unknown_icao);
         printf("    %u accepted with correct CRC\n",                st->demod_accepted[0]);
-        for (j = 1; j <= Modes.nfix_crc; ++j)
+        for (j = 1; j <= (Modes.soft_fix_bits ? MODES_MAX_BITERRORS : Modes.nfix_crc); ++j)
             printf("    %u accepted with %d-bit error repaired\n", st->demod_accepted[j], j);
+        if (Modes.soft_fix_bits)
+            printf("    %u repaired using bit confidences\n",     st->demod_soft_fixed);
+        if (Modes.demod_phases < 5) {
+            printf("    %u settled by the %d most likely phases\n",    st->demod_phase_ranked, Modes.demod_phases);
+            printf("    %u needed a full phase search\n",             st->demod_phase_fallback);
+        }
 
         if (st->noise_power_sum > 0 && st->noise_power_count > 0) {
             printf("  %.1f dBFS noise power\n",
@@ -267,6 +273,9 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
     target->demod_rejected_unknown_icao = st1->demod_rejected_unknown_icao + st2->demod_rejected_unknown_icao;
     for (i = 0; i < MODES_MAX_BITERRORS+1; ++i)
         target->demod_accepted[i]  = st1->demod_accepted[i] + st2->demod_accepted[i];
+    target->demod_phase_ranked = st1->demod_phase_ranked + st2->demod_phase_ranked;
+    target->demod_phase_fallback = st1->demod_phase_fallback + st2->demod_phase_fallback;
+    target->demod_soft_fixed = st1->demod_soft_fixed + st2->demod_soft_fixed;
     target->demod_modeac = st1->demod_modeac + st2->demod_modeac;
 
     target->samples_processed = st1->samples_processed + st2->samples_processed;
@@ -58,6 +58,11 @@ struct stats {
     uint32_t demod_rejected_bad;
     uint32_t demod_rejected_unknown_icao;
     uint32_t demod_accepted[MODES_MAX_BITERRORS+1];
+    // ranked phase search counts (--demod-phases):
+    uint32_t demod_phase_ranked;   // preambles settled by the ranked phases alone
+    uint32_t demod_phase_fallback; // preambles that needed the full phase search
+    // soft-decision correction counts (--soft-fix):
+    uint32_t demod_soft_fixed;     // accepted messages repaired from bit confidences
     uint64_t samples_processed;
     uint64_t samples_dropped;
     // Mode A/C demodulator counts:
@@ -0,0 +1,4777 @@
+// Generated by gentables from gentables.c; do not edit.
+
+#include "tables.h"
+
+const uint32_t crc_table[8][256] = {
+  {
+    0, 16774153, 7195, 16771090, 14390, 16763967, 9261, 16764964, 28780, 16745573, 27767, 16750718, 18522, 16759891, 21569, 16752712,
+    57560, 16717009, 64707, 16713930, 55534, 16723175, 50421, 16724220, 37044, 16737469, 36015, 16742566, 43138, 16735371, 46233, 16728208,
+    115120, 16659897, 122283, 16656802, 129414, 16649615, 124317, 16650644, 111068, 16664021, 110023, 16669134, 100842, 16678371, 103921, 16671224,
+    74088, 16700769, 81267, 16697722, 72030, 16706903, 66885, 16707916, 86276, 16688397, 85279, 16693526, 92466, 16686395, 95529, 16679200,
+    230240, 16545641, 237435, 16542578, 244566, 16535391, 239437, 16536388, 258828, 16516869, 257815, 16522014, 248634, 16531251, 251681, 16524072,
+    222136, 16553905, 229283, 16550826, 220046, 16560007, 214933, 16561052, 201684, 16574429, 200655, 16579526, 207842, 16572395, 210937, 16565232,
+    148176, 16627417, 155339, 16624322, 162534, 16617199, 157437, 16618228, 144060, 16631477, 143015, 16636590, 133770, 16645763, 136849, 16638616,
+    172552, 16602625, 179731, 16599578, 170558, 16608823, 165413, 16609836, 184932, 16590445, 183935, 16595574, 191058, 16588379, 194121, 16581184,
+    460480, 16315081, 465627, 16314066, 474870, 16304895, 467693, 16307940, 489132, 16286373, 486071, 16293566, 478874, 16300691, 479873, 16295560,
+    517656, 16257553, 522755, 16256522, 515630, 16263719, 508469, 16266812, 497268, 16278141, 494191, 16285286, 503362, 16276043, 504409, 16270928,
+    444272, 16331641, 449387, 16330594, 458566, 16321359, 451421, 16324436, 440092, 16335637, 436999, 16342798, 429866, 16349987, 430897, 16344888,
+    403368, 16372641, 408499, 16371642, 401310, 16378775, 394117, 16381836, 415684, 16360397, 412639, 16367574, 421874, 16358395, 422889, 16353248,
+    296352, 16478633, 301499, 16477618, 310678, 16468383, 303501, 16471428, 325068, 16449989, 322007, 16457182, 314874, 16464371, 315873, 16459240,
+    288120, 16486769, 293219, 16485738, 286030, 16492871, 278869, 16495964, 267540, 16507165, 264463, 16514310, 273698, 16505131, 274745, 16500016,
+    345104, 16429081, 350219, 16428034, 359462, 16418863, 352317, 16421940, 341116, 16433269, 338023, 16440430, 330826, 16447555, 331857, 16442456,
+    369864, 16404673, 374995, 16403674, 367870, 16410871, 360677, 16413932, 382116, 16392365, 379071, 16399542, 388242, 16390299, 389257, 16385152,
+  },
+  {
+    0, 920960, 1841920, 1185408, 3683840, 3554176, 2370816, 2760832, 7367680, 8282496, 7108352, 6453888, 4741632, 4609920, 5521664, 5917824,
+    14735360, 15652224, 16564992, 15912576, 14216704, 14082944, 12907776, 13301888, 9483264, 10402176, 9219840, 8561280, 11043328, 10915712, 11835648, 12227712,
+    4080649, 3164553, 2252553, 2904713, 422409, 556937, 1730825, 1336457, 5122057, 4203913, 5387017, 6045321, 7740937, 7869321, 6948105, 6555785,
+    14588937, 13668745, 12748553, 13404809, 15116809, 15247241, 16429321, 16039049, 11464713, 10550665, 11725577, 12379785, 9881097, 10013577, 9100553, 8704137,
+    8161298, 7505298, 6329106, 7249554, 4505106, 4895634, 5809426, 5679250, 844818, 190866, 1113874, 2028178, 3461650, 3858322, 2672914, 2540690,
+    10244114, 9592210, 8407826, 9324178, 10774034, 11168658, 12090642, 11956370, 15481874, 14823826, 15738642, 16657042, 13896210, 14288786, 13111570, 12983442,
+    4377627, 5030299, 6215451, 5298843, 8059419, 7665563, 6742299, 6876315, 3317787, 3976603, 3062555, 2143899, 693787, 301979, 1477915, 1605787,
+    10621979, 11278747, 12455707, 11535003, 10101275, 9711515, 8796443, 8926363, 13793307, 14448027, 13525787, 12611227, 15355419, 14959515, 16143643, 16275611,
+    16322596, 16194980, 15010596, 15402660, 12658212, 13577124, 14499108, 13840548, 9010212, 8876452, 9791268, 10185380, 11618852, 12535716, 11358500, 10706084,
+    1689636, 1557924, 381732, 777892, 2227748, 3142564, 4056356, 3401892, 6923300, 6793636, 7716644, 8106660, 5345828, 6266788, 5081380, 4424868,
+    13063213, 13195693, 14372653, 13976237, 16736813, 15822765, 14907693, 15561901, 12007469, 12137901, 11215661, 10825389, 9375277, 8455085, 9639213, 10295469,
+    2591789, 2720173, 3905325, 3513005, 2079277, 1161133, 237869, 896173, 5759021, 5893549, 4979501, 4585133, 7329325, 6413229, 7589165, 8241325,
+    8755254, 9147830, 10060598, 9932470, 12430902, 11772854, 10597686, 11516086, 16118838, 16513462, 15331126, 15196854, 13484598, 12832694, 13752630, 14668982,
+    6635574, 7032246, 7953206, 7820982, 6125110, 5471158, 4287798, 5202102, 1387574, 1778102, 603958, 473782, 2955830, 2299830, 3211574, 4132022,
+    12311615, 11915711, 10995519, 11127487, 8645183, 9299903, 10481983, 9567423, 13348927, 12959167, 14134079, 14263999, 15959615, 16616383, 15703359, 14782655,
+    5964863, 5573055, 4661055, 4788927, 6500927, 7159743, 8333631, 7414975, 2844735, 2450879, 3633983, 3767999, 1269311, 1921983, 1000767, 84159,
+  },
+  {
+    0, 906305, 1812610, 1473731, 3625220, 3835205, 2947462, 2174407, 7250440, 6518345, 7670410, 7921355, 5894924, 5515085, 4348814, 5214159,
+    14500880, 13668433, 13036690, 13318355, 15340820, 15188309, 15842710, 16542167, 11789848, 12464729, 11030170, 10853083, 8697628, 9003869, 10428318, 9620447,
+    4553769, 4761704, 6214827, 5439722, 7482669, 8386924, 6915503, 6574574, 2874913, 2493024, 3176099, 4039394, 1871653, 1137508, 468903, 717798,
+    9975865, 9825400, 8622267, 9323770, 11495741, 10665340, 11846079, 12129790, 16161329, 16469616, 15545011, 14739186, 12700469, 13377396, 14312375, 14137334,
+    9107538, 8858643, 9523408, 10257553, 12429654, 11566359, 10879444, 11261333, 14965338, 15306267, 16773848, 15869593, 13831006, 14606111, 13149148, 12941213,
+    5749826, 5924867, 4986048, 4309121, 6352198, 7158023, 8078788, 7770501, 3743306, 3459595, 2275016, 3105417, 937806, 236303, 1435596, 1586061,
+    13599867, 12734522, 13905145, 14284984, 16307583, 16056638, 14908925, 15641020, 10561139, 11334194, 12226289, 12016304, 9860983, 10199862, 9297909, 8391604,
+    1228907, 2036778, 616681, 310440, 2462063, 2639150, 4078061, 3403180, 8151651, 7452194, 6802145, 6954656, 4928359, 4646694, 5282789, 6115236,
+    15336621, 15192300, 15838255, 16545902, 14505385, 13664744, 13040939, 13314410, 8693413, 9007844, 10423847, 9624166, 11794337, 12461024, 11034403, 10849122,
+    3621053, 3839228, 2943039, 2178174, 4537, 902648, 1816891, 1469818, 5890741, 5519092, 4344375, 5217910, 7254961, 6514672, 7674675, 7917426,
+    11499652, 10661061, 11849734, 12125255, 9972096, 9829825, 8618242, 9327939, 12704396, 13373133, 14316046, 14132815, 16157576, 16474057, 15541002, 14743371,
+    7486612, 8382677, 6919190, 6570071, 4550032, 4766161, 6210834, 5443923, 1875612, 1133277, 472606, 713311, 2871192, 2497497, 3172122, 4043611,
+    6356223, 7153854, 8082557, 7766076, 5746171, 5929402, 4982137, 4313400, 941815, 232118, 1439349, 1581620, 3739635, 3464114, 2271089, 3109680,
+    12433647, 11562158, 10883181, 11256876, 9103851, 8863146, 9519465, 10261800, 13834983, 14601894, 13152869, 12936740, 14961635, 15310754, 16769889, 15873824,
+    2457814, 2643095, 4073556, 3406869, 1233362, 2033043, 620880, 306449, 4924126, 4650655, 5278300, 6118941, 8156122, 7448475, 6806360, 6950681,
+    16303302, 16060551, 14904388, 15644677, 13604290, 12730755, 13909312, 14280961, 9856718, 10203791, 9293388, 8395277, 10565578, 11330443, 12230472, 12012297,
+  },
+  {
+    0, 2882899, 5765798, 8128501, 11531596, 8652831, 16257002, 13890233, 10493585, 9167810, 16245815, 14424420, 1043421, 2365070, 5771643, 7597096,
+    12568875, 9712760, 15217549, 12832478, 1064039, 3916084, 4703937, 7093138, 2086842, 3418857, 4730140, 6541391, 11543286, 10215333, 15194192, 13378819,
+    8414815, 11246348, 14130425, 16540074, 3117843, 290368, 7891381, 5477606, 2128078, 755101, 7832168, 6061883, 9407874, 10776785, 14186276, 15960695,
+    4173684, 1331751, 6837714, 4434049, 9460280, 12298091, 13082782, 15490509, 10465765, 11816118, 13126467, 14923280, 3163305, 1817082, 6798863, 4997980,
+    16726199, 13944292, 11059729, 8601410, 5295611, 8073384, 472925, 2935310, 6235686, 7658357, 580736, 2302419, 15782762, 14364217, 10955212, 9229471,
+    4256156, 7015631, 1510202, 3995241, 15664336, 12908931, 12123766, 9634597, 14741261, 13308510, 11998635, 10283256, 5184065, 6612754, 1630439, 3349940,
+    8347368, 5546939, 2663502, 219421, 13675428, 16471799, 8868098, 11316305, 14631033, 16039210, 8960735, 10700684, 7386421, 5982310, 2576275, 832192,
+    12621763, 15428240, 9923941, 12357686, 7299727, 4497372, 3708969, 1271162, 6326610, 4944897, 3634164, 1871527, 13597726, 14975309, 9995960, 11762667,
+    99687, 2783284, 5668801, 8225426, 11431979, 8752504, 16353933, 13793246, 10591222, 9070245, 16146768, 14523395, 945850, 2462697, 5870620, 7498063,
+    12471372, 9810207, 15316714, 12733369, 1161472, 3818579, 4604838, 7192309, 1987293, 3518350, 4827259, 6444328, 11642769, 10115778, 15097143, 13475940,
+    8512312, 11148907, 14031262, 16639181, 3020404, 387879, 7990482, 5378433, 2227625, 655610, 7735055, 6158940, 9308389, 10876342, 14283331, 15863568,
+    4074003, 1431360, 6934709, 4337126, 9559903, 12198412, 12985849, 15587498, 10368130, 11913681, 13225508, 14824311, 3260878, 1719453, 6699880, 5097019,
+    16694736, 13975683, 11093878, 8567333, 5327004, 8041935, 438842, 2969449, 6202177, 7691794, 612839, 2270388, 15816205, 14330718, 10923179, 9261560,
+    4289787, 6982056, 1478237, 4027150, 15630775, 12942564, 12155665, 9602626, 14772842, 13276985, 11964620, 10317215, 5152550, 6644341, 1664384, 3315923,
+    8313743, 5580508, 2695465, 187514, 13708995, 16438160, 8836197, 11348278, 14599454, 16070733, 8994744, 10666731, 7417938, 5950721, 2542324, 866215,
+    12653220, 15396855, 9889794, 12391761, 7268328, 4528827, 3743054, 1237021, 6360117, 4911462, 3602067, 1903552, 13564281, 15008810, 10027999, 11730572,
+  },
+  {
+    0, 199374, 398748, 335698, 797496, 991734, 671396, 603242, 1594992, 1793214, 1983468, 1919266, 1342792, 1537926, 1206484, 1139226,
+    3189984, 3384878, 3586428, 3519410, 3966936, 4164886, 3838532, 3774602, 2685584, 2879582, 3075852, 3007938, 2412968, 2612070, 2278452, 2215674,
+    6379968, 6443790, 6769756, 6571666, 7172856, 7239734, 7038820, 6843818, 7933872, 7996798, 8329772, 8130786, 7677064, 7745094, 7549204, 7355354,
+    5371168, 5439470, 5759164, 5565042, 6151704, 6214870, 6015876, 5816650, 4825936, 4893086, 5224140, 5028866, 4556904, 4620966, 4431348, 4233018,
+    12759936, 12695886, 12887580, 13085906, 13539512, 13472374, 13143332, 13338602, 14345712, 14282558, 14479468, 14678690, 14077640, 14009350, 13687636, 13881754,
+    15867744, 15799726, 15993596, 16187442, 16659544, 16596630, 16261572, 16460554, 15354128, 15287262, 15490188, 15685186, 15098408, 15034598, 14710708, 14908794,
+    10742336, 10543246, 10878940, 10941714, 11518328, 11324342, 11130084, 11197994, 12303408, 12105470, 12429740, 12493666, 12031752, 11836870, 11633300, 11700314,
+    9651872, 9456750, 9786172, 9853426, 10448280, 10250070, 10057732, 10121930, 9113808, 8919582, 9241932, 9310082, 8862696, 8663334, 8466036, 8529082,
+    8033033, 7969223, 8160917, 8359003, 7780401, 7713535, 7384493, 7579491, 6473081, 6410167, 6607077, 6806059, 7269953, 7201935, 6880221, 7074067,
+    4866025, 4797735, 4991605, 5185723, 4592849, 4529695, 4194637, 4393859, 5400985, 5333847, 5536773, 5732043, 6177441, 6113391, 5789501, 5987827,
+    1821385, 1622023, 1957717, 2020763, 1565169, 1370943, 1176685, 1244835, 236729, 38519, 362789, 426987, 1030017, 834895, 631325, 698579,
+    2844201, 2649319, 2978741, 3045755, 2575633, 2377695, 2185357, 2249283, 3354713, 3160727, 3483077, 3550987, 4135777, 3936687, 3739389, 3802163,
+    12066953, 12266055, 12465429, 12402651, 11799473, 11993471, 11673133, 11605219, 10516217, 10714167, 10904421, 10840491, 11296193, 11491087, 11159645, 11092627,
+    8948841, 9143975, 9345525, 9278267, 8693585, 8891807, 8565453, 8501251, 9493017, 9687255, 9883525, 9815371, 10285345, 10484719, 10151101, 10088051,
+    14252361, 14316423, 14642389, 14444059, 13980273, 14047423, 13846509, 13651235, 12660537, 12723703, 13056677, 12857451, 13435905, 13504207, 13308317, 13114195,
+    15324585, 15392615, 15712309, 15518459, 15072913, 15135839, 14936845, 14737859, 15827929, 15894807, 16225861, 16030859, 16623841, 16687663, 16498045, 16299955,
+  },
+  {
+    0, 16066066, 1423405, 14720575, 2846810, 14571080, 4114551, 13364837, 5693620, 10733222, 4413593, 11959947, 8229102, 8959740, 6826179, 10292945,
+    11387240, 5826426, 12089669, 5070679, 8827186, 7575328, 9636127, 6696717, 16458204, 919502, 15636977, 1818595, 13652358, 2455444, 12970411, 3198905,
+    10778329, 5329099, 11652852, 4516070, 9373315, 8003729, 10141358, 7313596, 15898221, 503935, 15150656, 1181778, 14280247, 2932773, 13393434, 3766280,
+    636849, 16552355, 1839004, 15280526, 2279403, 14148089, 3637190, 12736980, 6248197, 11170071, 4910888, 12568890, 7612255, 8454477, 6397810, 9746784,
+    11999675, 4341673, 10658198, 5736324, 10250721, 6901747, 9032140, 8189918, 14809359, 1367837, 16007458, 91952, 13273429, 4173639, 14627192, 2758506,
+    1759443, 15728321, 1007870, 16402156, 3254409, 12881563, 2363556, 13711030, 4995175, 12131957, 5865546, 11314776, 6768701, 9596463, 7532560, 8902146,
+    1273698, 15092080, 448335, 15987037, 3678008, 13449514, 2991893, 14188807, 4558806, 11577796, 5257211, 10818025, 7274380, 10213790, 8079265, 9331123,
+    12496394, 4950040, 11212327, 6172725, 9821776, 6355010, 8414845, 7684207, 15224510, 1927340, 16643731, 577665, 12795620, 3545334, 14059209, 2334939,
+    9553791, 6611309, 8683346, 7428416, 12236581, 5214519, 11472648, 5908762, 13051851, 3277273, 13803494, 2603508, 15488913, 1667459, 16379836, 838062,
+    3933719, 13180933, 2735674, 14456872, 1537613, 14831711, 183904, 16246898, 7005859, 10469553, 8347278, 9074844, 4298489, 11841771, 5517012, 10553542,
+    3518886, 12621748, 2099595, 13971353, 2015740, 15460334, 752081, 16670659, 6508818, 9860864, 7792959, 8638253, 4727112, 12388186, 6134117, 11059063,
+    9990350, 7165660, 9292003, 7925489, 11731092, 4597382, 10926265, 5480107, 13537402, 3913320, 14362711, 3018309, 15065120, 1099314, 15751181, 359967,
+    2547396, 13891798, 3368681, 12992763, 896670, 16287884, 1578675, 15544481, 7356016, 8722530, 6653533, 9478223, 5983786, 11429944, 5174791, 12308501,
+    9117612, 8272318, 10397569, 7045523, 10514422, 5589476, 11917275, 4256201, 14548760, 2677002, 13125429, 4022567, 16158530, 239952, 14890863, 1446269,
+    8562717, 7835151, 9900080, 6436386, 11130951, 6094421, 12345450, 4802168, 13912233, 2191035, 12710020, 3462806, 16726259, 663265, 15368414, 2074316,
+    3107189, 14307175, 3854680, 13629258, 268591, 15810365, 1155330, 14976784, 7965121, 9220051, 7090668, 10033150, 5437851, 11001737, 4669878, 11691940,
+  },
+  {
+    0, 14449399, 4653543, 10189584, 9307086, 5404985, 13173289, 1407198, 14939029, 4163938, 10809970, 7899269, 7204955, 11635372, 2814396, 16157515,
+    3674915, 14969300, 8327876, 10709043, 11931885, 6973978, 15798538, 2976765, 14409910, 498241, 10281297, 4234150, 5628792, 9017743, 1237663, 13539432,
+    7349830, 11295921, 3614625, 15424854, 16655752, 2252671, 12133487, 6643352, 9688531, 5222180, 13947956, 569027, 1955357, 12692714, 5953530, 8826125,
+    4732261, 9719698, 996482, 13848181, 12990123, 1723484, 8468300, 6114747, 11257584, 7846919, 15517463, 3194336, 2475326, 16367561, 6472921, 12500526,
+    14699660, 3946107, 10964331, 8075164, 7229250, 11679157, 2707109, 16069714, 245529, 14665198, 4505342, 10011657, 9288919, 5359136, 13286704, 1492935,
+    14180271, 271704, 10444360, 4400319, 5659745, 9053846, 1138054, 13444977, 3910714, 15193805, 8170973, 10540842, 11907060, 6935811, 15904275, 3069156,
+    9464522, 4984893, 14117677, 725466, 1992964, 12719091, 5859555, 8720916, 7575903, 11527080, 3446968, 15262287, 16620177, 2220134, 12229494, 6742401,
+    11041257, 7602974, 15693838, 3343097, 2521639, 16384208, 6388672, 12386615, 4950652, 9957515, 822171, 13693292, 12945842, 1700677, 8554581, 6222498,
+    4156689, 14882790, 7892214, 10753537, 11628255, 7148584, 16150328, 2758095, 14458500, 58483, 10198883, 4711828, 5414218, 9365437, 1416365, 13231706,
+    491058, 14353605, 4227029, 10224930, 9010684, 5572363, 13532187, 1181420, 14978471, 3733328, 10718272, 8386231, 6983273, 11990174, 2985870, 15857017,
+    5196631, 9646496, 543408, 13905991, 12667033, 1913454, 8800638, 5911433, 11319490, 7389749, 15448357, 3654610, 2276108, 16695803, 6666987, 12173340,
+    7821428, 11215491, 3168659, 15475556, 16341946, 2433357, 12474973, 6430890, 9743329, 4772118, 13871622, 1036529, 1746991, 13030104, 6138312, 8508223,
+    14623133, 220010, 9969786, 4479629, 5317203, 9263268, 1450932, 13261123, 3985928, 14723327, 8115183, 10987800, 11719110, 7252785, 16109601, 2730710,
+    15151806, 3885129, 10498905, 8145326, 6893936, 11881351, 3027095, 15878752, 311595, 14203868, 4440268, 10467899, 9093861, 5683218, 13484802, 1161717,
+    11470811, 7568684, 15205948, 3439819, 2163733, 16613090, 6686194, 12222213, 5043278, 9473721, 783785, 14126942, 12777344, 2002295, 8779367, 5868688,
+    9901304, 4943375, 13636895, 815080, 1644342, 12938689, 6166225, 8547366, 7661421, 11050394, 3401354, 15703165, 16442531, 2530900, 12444996, 6397875,
+  },
+  {
+    0, 8313378, 16626756, 8613478, 302209, 8013475, 16328901, 8909543, 604418, 7856928, 16026950, 9066340, 894339, 7569313, 15733191, 9358309,
+    1208836, 7120934, 15713856, 9509986, 1502853, 6829223, 15424193, 9797859, 1788678, 6656292, 15138626, 9971040, 2086791, 6360485, 14836675, 10271201,
+    2417672, 5914154, 14241868, 10979950, 2128009, 6202027, 14535885, 10688239, 3005706, 5441320, 13658446, 11449196, 2703755, 5741481, 13956559, 11153389,
+    3577356, 4738094, 13312584, 11925610, 3279501, 5034159, 13614793, 11625707, 4173582, 4289836, 12720970, 12370280, 3879823, 4581805, 13010891, 12082665,
+    4835344, 3609138, 11828308, 13280886, 5067921, 3378867, 11591893, 13515511, 4256018, 4074288, 12404054, 12820340, 4484499, 3848113, 12179927, 13042677,
+    6011412, 2449462, 10882640, 14210162, 6235797, 2227383, 10654417, 14436595, 5407510, 2906420, 11482962, 13757808, 5644183, 2672053, 11250643, 13988337,
+    7154712, 1308218, 9476188, 15614590, 6926489, 1534651, 9700573, 15392511, 6559002, 1756984, 10068318, 15170428, 6326683, 1987513, 10304991, 14936061,
+    8347164, 99390, 8579672, 16527482, 8110749, 334015, 8812249, 16297211, 7759646, 572732, 9163610, 16058744, 7535519, 795069, 9392091, 15832569,
+    9670688, 15550978, 7218276, 1113670, 9899169, 15324803, 6994149, 1336007, 10135842, 14971648, 6757734, 1689412, 10368419, 14741377, 6521319, 1924037,
+    8512036, 16726022, 8148576, 166978, 8748709, 16491655, 7916257, 397507, 8968998, 16122116, 7696226, 767296, 9193383, 15900037, 7468003, 993729,
+    12022824, 13217290, 4898924, 3414606, 11790505, 13447819, 5135597, 3180239, 12471594, 12621576, 4454766, 4006732, 12243371, 12848009, 4679151, 3784653,
+    10815020, 14408718, 5812840, 2517066, 10590893, 14631055, 6041321, 2290891, 11288366, 13821196, 5344106, 3101000, 11051951, 14055821, 5576683, 2870729,
+    14309424, 10781202, 2616436, 5846614, 14599345, 10493587, 2322677, 6138583, 13852978, 11385616, 3069302, 5246804, 14155187, 11085713, 2771447, 5542869,
+    13118004, 11989014, 3513968, 4932690, 13416117, 11693207, 3212017, 5232851, 12653366, 12568852, 3975026, 4357456, 12947383, 12277141, 3685363, 4645329,
+    16694328, 8414746, 198780, 8245854, 16392377, 8714907, 496893, 7950047, 16221498, 9002776, 668030, 7662428, 15931835, 9290649, 962047, 7370717,
+    15519292, 9573406, 1145464, 7315546, 15225533, 9865375, 1435385, 7027931, 15071038, 10169628, 1590138, 6723928, 14773183, 10465693, 1892347, 6424025,
+  },
+};
+
+const uint32_t crc_single_bit_syndrome[112] = {
+    3749354, 1874677, 15841150, 7920575, 12818395, 10367465, 11592432, 5796216, 2898108, 1449054, 724527, 16416019, 8569997, 12490818, 6245409, 13655060,
+    6827530, 3413765, 15069574, 7534787, 13010533, 10271030, 5135515, 14210121, 9670688, 4835344, 2417672, 1208836, 604418, 302209, 16626756, 8313378,
+    4156689, 14699660, 7349830, 3674915, 14939029, 9307086, 4653543, 14449399, 9553791, 11999675, 10778329, 11387240, 5693620, 2846810, 1423405, 16066066,
+    8033033, 12759936, 6379968, 3189984, 1594992, 797496, 398748, 199374, 99687, 16726199, 8414815, 12568875, 10493585, 11531596, 5765798, 2882899,
+    15336621, 9107538, 4553769, 14500880, 7250440, 3625220, 1812610, 906305, 16322596, 8161298, 4080649, 14735360, 7367680, 3683840, 1841920, 920960,
+    460480, 230240, 115120, 57560, 28780, 14390, 7195, 16774153, 8388608, 4194304, 2097152, 1048576, 524288, 262144, 131072, 65536,
+    32768, 16384, 8192, 4096, 2048, 1024, 512, 256, 128, 64, 32, 16, 8, 4, 2, 1,
+};
+
+const int modeAToCTable[4096] = {
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -8, -9999, 1263, -9999, 623, -9999, 632, -9999,
+    -10, -9999, 1265, -9999, 625, -9999, 630, -9999, -9, -9999, 1264, -9999, 624, -9999, 631, -9999,
+    -12, -9999, 1267, -9999, 627, -9999, 628, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -11, -9999, 1266, -9999, 626, -9999, 629, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 23, -9999, 1232, -9999, 592, -9999, 663, -9999,
+    25, -9999, 1230, -9999, 590, -9999, 665, -9999, 24, -9999, 1231, -9999, 591, -9999, 664, -9999,
+    27, -9999, 1228, -9999, 588, -9999, 667, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    26, -9999, 1229, -9999, 589, -9999, 666, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 3, -9999, 1252, -9999, 612, -9999, 643, -9999,
+    5, -9999, 1250, -9999, 610, -9999, 645, -9999, 4, -9999, 1251, -9999, 611, -9999, 644, -9999,
+    7, -9999, 1248, -9999, 608, -9999, 647, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    6, -9999, 1249, -9999, 609, -9999, 646, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 12, -9999, 1243, -9999, 603, -9999, 652, -9999,
+    10, -9999, 1245, -9999, 605, -9999, 650, -9999, 11, -9999, 1244, -9999, 604, -9999, 651, -9999,
+    8, -9999, 1247, -9999, 607, -9999, 648, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    9, -9999, 1246, -9999, 606, -9999, 649, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -7, -9999, 1262, -9999, 622, -9999, 633, -9999,
+    -5, -9999, 1260, -9999, 620, -9999, 635, -9999, -6, -9999, 1261, -9999, 621, -9999, 634, -9999,
+    -3, -9999, 1258, -9999, 618, -9999, 637, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -4, -9999, 1259, -9999, 619, -9999, 636, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 22, -9999, 1233, -9999, 593, -9999, 662, -9999,
+    20, -9999, 1235, -9999, 595, -9999, 660, -9999, 21, -9999, 1234, -9999, 594, -9999, 661, -9999,
+    18, -9999, 1237, -9999, 597, -9999, 658, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    19, -9999, 1236, -9999, 596, -9999, 659, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 2, -9999, 1253, -9999, 613, -9999, 642, -9999,
+    0, -9999, 1255, -9999, 615, -9999, 640, -9999, 1, -9999, 1254, -9999, 614, -9999, 641, -9999,
+    -2, -9999, 1257, -9999, 617, -9999, 638, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -1, -9999, 1256, -9999, 616, -9999, 639, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 13, -9999, 1242, -9999, 602, -9999, 653, -9999,
+    15, -9999, 1240, -9999, 600, -9999, 655, -9999, 14, -9999, 1241, -9999, 601, -9999, 654, -9999,
+    17, -9999, 1238, -9999, 598, -9999, 657, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    16, -9999, 1239, -9999, 599, -9999, 656, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 303, -9999, 952, -9999, 312, -9999, 943, -9999,
+    305, -9999, 950, -9999, 310, -9999, 945, -9999, 304, -9999, 951, -9999, 311, -9999, 944, -9999,
+    307, -9999, 948, -9999, 308, -9999, 947, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    306, -9999, 949, -9999, 309, -9999, 946, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 272, -9999, 983, -9999, 343, -9999, 912, -9999,
+    270, -9999, 985, -9999, 345, -9999, 910, -9999, 271, -9999, 984, -9999, 344, -9999, 911, -9999,
+    268, -9999, 987, -9999, 347, -9999, 908, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    269, -9999, 986, -9999, 346, -9999, 909, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 292, -9999, 963, -9999, 323, -9999, 932, -9999,
+    290, -9999, 965, -9999, 325, -9999, 930, -9999, 291, -9999, 964, -9999, 324, -9999, 931, -9999,
+    288, -9999, 967, -9999, 327, -9999, 928, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    289, -9999, 966, -9999, 326, -9999, 929, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 283, -9999, 972, -9999, 332, -9999, 923, -9999,
+    285, -9999, 970, -9999, 330, -9999, 925, -9999, 284, -9999, 971, -9999, 331, -9999, 924, -9999,
+    287, -9999, 968, -9999, 328, -9999, 927, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    286, -9999, 969, -9999, 329, -9999, 926, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 302, -9999, 953, -9999, 313, -9999, 942, -9999,
+    300, -9999, 955, -9999, 315, -9999, 940, -9999, 301, -9999, 954, -9999, 314, -9999, 941, -9999,
+    298, -9999, 957, -9999, 317, -9999, 938, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    299, -9999, 956, -9999, 316, -9999, 939, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 273, -9999, 982, -9999, 342, -9999, 913, -9999,
+    275, -9999, 980, -9999, 340, -9999, 915, -9999, 274, -9999, 981, -9999, 341, -9999, 914, -9999,
+    277, -9999, 978, -9999, 338, -9999, 917, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    276, -9999, 979, -9999, 339, -9999, 916, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 293, -9999, 962, -9999, 322, -9999, 933, -9999,
+    295, -9999, 960, -9999, 320, -9999, 935, -9999, 294, -9999, 961, -9999, 321, -9999, 934, -9999,
+    297, -9999, 958, -9999, 318, -9999, 937, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    296, -9999, 959, -9999, 319, -9999, 936, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 282, -9999, 973, -9999, 333, -9999, 922, -9999,
+    280, -9999, 975, -9999, 335, -9999, 920, -9999, 281, -9999, 974, -9999, 334, -9999, 921, -9999,
+    278, -9999, 977, -9999, 337, -9999, 918, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    279, -9999, 976, -9999, 336, -9999, 919, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 143, -9999, 1112, -9999, 472, -9999, 783, -9999,
+    145, -9999, 1110, -9999, 470, -9999, 785, -9999, 144, -9999, 1111, -9999, 471, -9999, 784, -9999,
+    147, -9999, 1108, -9999, 468, -9999, 787, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    146, -9999, 1109, -9999, 469, -9999, 786, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 112, -9999, 1143, -9999, 503, -9999, 752, -9999,
+    110, -9999, 1145, -9999, 505, -9999, 750, -9999, 111, -9999, 1144, -9999, 504, -9999, 751, -9999,
+    108, -9999, 1147, -9999, 507, -9999, 748, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    109, -9999, 1146, -9999, 506, -9999, 749, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 132, -9999, 1123, -9999, 483, -9999, 772, -9999,
+    130, -9999, 1125, -9999, 485, -9999, 770, -9999, 131, -9999, 1124, -9999, 484, -9999, 771, -9999,
+    128, -9999, 1127, -9999, 487, -9999, 768, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    129, -9999, 1126, -9999, 486, -9999, 769, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 123, -9999, 1132, -9999, 492, -9999, 763, -9999,
+    125, -9999, 1130, -9999, 490, -9999, 765, -9999, 124, -9999, 1131, -9999, 491, -9999, 764, -9999,
+    127, -9999, 1128, -9999, 488, -9999, 767, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    126, -9999, 1129, -9999, 489, -9999, 766, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 142, -9999, 1113, -9999, 473, -9999, 782, -9999,
+    140, -9999, 1115, -9999, 475, -9999, 780, -9999, 141, -9999, 1114, -9999, 474, -9999, 781, -9999,
+    138, -9999, 1117, -9999, 477, -9999, 778, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    139, -9999, 1116, -9999, 476, -9999, 779, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 113, -9999, 1142, -9999, 502, -9999, 753, -9999,
+    115, -9999, 1140, -9999, 500, -9999, 755, -9999, 114, -9999, 1141, -9999, 501, -9999, 754, -9999,
+    117, -9999, 1138, -9999, 498, -9999, 757, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    116, -9999, 1139, -9999, 499, -9999, 756, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 133, -9999, 1122, -9999, 482, -9999, 773, -9999,
+    135, -9999, 1120, -9999, 480, -9999, 775, -9999, 134, -9999, 1121, -9999, 481, -9999, 774, -9999,
+    137, -9999, 1118, -9999, 478, -9999, 777, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    136, -9999, 1119, -9999, 479, -9999, 776, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 122, -9999, 1133, -9999, 493, -9999, 762, -9999,
+    120, -9999, 1135, -9999, 495, -9999, 760, -9999, 121, -9999, 1134, -9999, 494, -9999, 761, -9999,
+    118, -9999, 1137, -9999, 497, -9999, 758, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    119, -9999, 1136, -9999, 496, -9999, 759, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 152, -9999, 1103, -9999, 463, -9999, 792, -9999,
+    150, -9999, 1105, -9999, 465, -9999, 790, -9999, 151, -9999, 1104, -9999, 464, -9999, 791, -9999,
+    148, -9999, 1107, -9999, 467, -9999, 788, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    149, -9999, 1106, -9999, 466, -9999, 789, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 183, -9999, 1072, -9999, 432, -9999, 823, -9999,
+    185, -9999, 1070, -9999, 430, -9999, 825, -9999, 184, -9999, 1071, -9999, 431, -9999, 824, -9999,
+    187, -9999, 1068, -9999, 428, -9999, 827, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    186, -9999, 1069, -9999, 429, -9999, 826, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 163, -9999, 1092, -9999, 452, -9999, 803, -9999,
+    165, -9999, 1090, -9999, 450, -9999, 805, -9999, 164, -9999, 1091, -9999, 451, -9999, 804, -9999,
+    167, -9999, 1088, -9999, 448, -9999, 807, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    166, -9999, 1089, -9999, 449, -9999, 806, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 172, -9999, 1083, -9999, 443, -9999, 812, -9999,
+    170, -9999, 1085, -9999, 445, -9999, 810, -9999, 171, -9999, 1084, -9999, 444, -9999, 811, -9999,
+    168, -9999, 1087, -9999, 447, -9999, 808, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    169, -9999, 1086, -9999, 446, -9999, 809, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 153, -9999, 1102, -9999, 462, -9999, 793, -9999,
+    155, -9999, 1100, -9999, 460, -9999, 795, -9999, 154, -9999, 1101, -9999, 461, -9999, 794, -9999,
+    157, -9999, 1098, -9999, 458, -9999, 797, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    156, -9999, 1099, -9999, 459, -9999, 796, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 182, -9999, 1073, -9999, 433, -9999, 822, -9999,
+    180, -9999, 1075, -9999, 435, -9999, 820, -9999, 181, -9999, 1074, -9999, 434, -9999, 821, -9999,
+    178, -9999, 1077, -9999, 437, -9999, 818, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    179, -9999, 1076, -9999, 436, -9999, 819, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 162, -9999, 1093, -9999, 453, -9999, 802, -9999,
+    160, -9999, 1095, -9999, 455, -9999, 800, -9999, 161, -9999, 1094, -9999, 454, -9999, 801, -9999,
+    158, -9999, 1097, -9999, 457, -9999, 798, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    159, -9999, 1096, -9999, 456, -9999, 799, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 173, -9999, 1082, -9999, 442, -9999, 813, -9999,
+    175, -9999, 1080, -9999, 440, -9999, 815, -9999, 174, -9999, 1081, -9999, 441, -9999, 814, -9999,
+    177, -9999, 1078, -9999, 438, -9999, 817, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    176, -9999, 1079, -9999, 439, -9999, 816, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 63, -9999, 1192, -9999, 552, -9999, 703, -9999,
+    65, -9999, 1190, -9999, 550, -9999, 705, -9999, 64, -9999, 1191, -9999, 551, -9999, 704, -9999,
+    67, -9999, 1188, -9999, 548, -9999, 707, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    66, -9999, 1189, -9999, 549, -9999, 706, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 32, -9999, 1223, -9999, 583, -9999, 672, -9999,
+    30, -9999, 1225, -9999, 585, -9999, 670, -9999, 31, -9999, 1224, -9999, 584, -9999, 671, -9999,
+    28, -9999, 1227, -9999, 587, -9999, 668, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    29, -9999, 1226, -9999, 586, -9999, 669, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 52, -9999, 1203, -9999, 563, -9999, 692, -9999,
+    50, -9999, 1205, -9999, 565, -9999, 690, -9999, 51, -9999, 1204, -9999, 564, -9999, 691, -9999,
+    48, -9999, 1207, -9999, 567, -9999, 688, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    49, -9999, 1206, -9999, 566, -9999, 689, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 43, -9999, 1212, -9999, 572, -9999, 683, -9999,
+    45, -9999, 1210, -9999, 570, -9999, 685, -9999, 44, -9999, 1211, -9999, 571, -9999, 684, -9999,
+    47, -9999, 1208, -9999, 568, -9999, 687, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    46, -9999, 1209, -9999, 569, -9999, 686, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 62, -9999, 1193, -9999, 553, -9999, 702, -9999,
+    60, -9999, 1195, -9999, 555, -9999, 700, -9999, 61, -9999, 1194, -9999, 554, -9999, 701, -9999,
+    58, -9999, 1197, -9999, 557, -9999, 698, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    59, -9999, 1196, -9999, 556, -9999, 699, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 33, -9999, 1222, -9999, 582, -9999, 673, -9999,
+    35, -9999, 1220, -9999, 580, -9999, 675, -9999, 34, -9999, 1221, -9999, 581, -9999, 674, -9999,
+    37, -9999, 1218, -9999, 578, -9999, 677, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    36, -9999, 1219, -9999, 579, -9999, 676, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 53, -9999, 1202, -9999, 562, -9999, 693, -9999,
+    55, -9999, 1200, -9999, 560, -9999, 695, -9999, 54, -9999, 1201, -9999, 561, -9999, 694, -9999,
+    57, -9999, 1198, -9999, 558, -9999, 697, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    56, -9999, 1199, -9999, 559, -9999, 696, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 42, -9999, 1213, -9999, 573, -9999, 682, -9999,
+    40, -9999, 1215, -9999, 575, -9999, 680, -9999, 41, -9999, 1214, -9999, 574, -9999, 681, -9999,
+    38, -9999, 1217, -9999, 577, -9999, 678, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    39, -9999, 1216, -9999, 576, -9999, 679, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 232, -9999, 1023, -9999, 383, -9999, 872, -9999,
+    230, -9999, 1025, -9999, 385, -9999, 870, -9999, 231, -9999, 1024, -9999, 384, -9999, 871, -9999,
+    228, -9999, 1027, -9999, 387, -9999, 868, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    229, -9999, 1026, -9999, 386, -9999, 869, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 263, -9999, 992, -9999, 352, -9999, 903, -9999,
+    265, -9999, 990, -9999, 350, -9999, 905, -9999, 264, -9999, 991, -9999, 351, -9999, 904, -9999,
+    267, -9999, 988, -9999, 348, -9999, 907, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    266, -9999, 989, -9999, 349, -9999, 906, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 243, -9999, 1012, -9999, 372, -9999, 883, -9999,
+    245, -9999, 1010, -9999, 370, -9999, 885, -9999, 244, -9999, 1011, -9999, 371, -9999, 884, -9999,
+    247, -9999, 1008, -9999, 368, -9999, 887, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    246, -9999, 1009, -9999, 369, -9999, 886, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 252, -9999, 1003, -9999, 363, -9999, 892, -9999,
+    250, -9999, 1005, -9999, 365, -9999, 890, -9999, 251, -9999, 1004, -9999, 364, -9999, 891, -9999,
+    248, -9999, 1007, -9999, 367, -9999, 888, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    249, -9999, 1006, -9999, 366, -9999, 889, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 233, -9999, 1022, -9999, 382, -9999, 873, -9999,
+    235, -9999, 1020, -9999, 380, -9999, 875, -9999, 234, -9999, 1021, -9999, 381, -9999, 874, -9999,
+    237, -9999, 1018, -9999, 378, -9999, 877, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    236, -9999, 1019, -9999, 379, -9999, 876, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 262, -9999, 993, -9999, 353, -9999, 902, -9999,
+    260, -9999, 995, -9999, 355, -9999, 900, -9999, 261, -9999, 994, -9999, 354, -9999, 901, -9999,
+    258, -9999, 997, -9999, 357, -9999, 898, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    259, -9999, 996, -9999, 356, -9999, 899, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 242, -9999, 1013, -9999, 373, -9999, 882, -9999,
+    240, -9999, 1015, -9999, 375, -9999, 880, -9999, 241, -9999, 1014, -9999, 374, -9999, 881, -9999,
+    238, -9999, 1017, -9999, 377, -9999, 878, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    239, -9999, 1016, -9999, 376, -9999, 879, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 253, -9999, 1002, -9999, 362, -9999, 893, -9999,
+    255, -9999, 1000, -9999, 360, -9999, 895, -9999, 254, -9999, 1001, -9999, 361, -9999, 894, -9999,
+    257, -9999, 998, -9999, 358, -9999, 897, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    256, -9999, 999, -9999, 359, -9999, 896, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 72, -9999, 1183, -9999, 543, -9999, 712, -9999,
+    70, -9999, 1185, -9999, 545, -9999, 710, -9999, 71, -9999, 1184, -9999, 544, -9999, 711, -9999,
+    68, -9999, 1187, -9999, 547, -9999, 708, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    69, -9999, 1186, -9999, 546, -9999, 709, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 103, -9999, 1152, -9999, 512, -9999, 743, -9999,
+    105, -9999, 1150, -9999, 510, -9999, 745, -9999, 104, -9999, 1151, -9999, 511, -9999, 744, -9999,
+    107, -9999, 1148, -9999, 508, -9999, 747, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    106, -9999, 1149, -9999, 509, -9999, 746, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 83, -9999, 1172, -9999, 532, -9999, 723, -9999,
+    85, -9999, 1170, -9999, 530, -9999, 725, -9999, 84, -9999, 1171, -9999, 531, -9999, 724, -9999,
+    87, -9999, 1168, -9999, 528, -9999, 727, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    86, -9999, 1169, -9999, 529, -9999, 726, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 92, -9999, 1163, -9999, 523, -9999, 732, -9999,
+    90, -9999, 1165, -9999, 525, -9999, 730, -9999, 91, -9999, 1164, -9999, 524, -9999, 731, -9999,
+    88, -9999, 1167, -9999, 527, -9999, 728, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    89, -9999, 1166, -9999, 526, -9999, 729, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 73, -9999, 1182, -9999, 542, -9999, 713, -9999,
+    75, -9999, 1180, -9999, 540, -9999, 715, -9999, 74, -9999, 1181, -9999, 541, -9999, 714, -9999,
+    77, -9999, 1178, -9999, 538, -9999, 717, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    76, -9999, 1179, -9999, 539, -9999, 716, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 102, -9999, 1153, -9999, 513, -9999, 742, -9999,
+    100, -9999, 1155, -9999, 515, -9999, 740, -9999, 101, -9999, 1154, -9999, 514, -9999, 741, -9999,
+    98, -9999, 1157, -9999, 517, -9999, 738, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    99, -9999, 1156, -9999, 516, -9999, 739, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 82, -9999, 1173, -9999, 533, -9999, 722, -9999,
+    80, -9999, 1175, -9999, 535, -9999, 720, -9999, 81, -9999, 1174, -9999, 534, -9999, 721, -9999,
+    78, -9999, 1177, -9999, 537, -9999, 718, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    79, -9999, 1176, -9999, 536, -9999, 719, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 93, -9999, 1162, -9999, 522, -9999, 733, -9999,
+    95, -9999, 1160, -9999, 520, -9999, 735, -9999, 94, -9999, 1161, -9999, 521, -9999, 734, -9999,
+    97, -9999, 1158, -9999, 518, -9999, 737, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    96, -9999, 1159, -9999, 519, -9999, 736, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 223, -9999, 1032, -9999, 392, -9999, 863, -9999,
+    225, -9999, 1030, -9999, 390, -9999, 865, -9999, 224, -9999, 1031, -9999, 391, -9999, 864, -9999,
+    227, -9999, 1028, -9999, 388, -9999, 867, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    226, -9999, 1029, -9999, 389, -9999, 866, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 192, -9999, 1063, -9999, 423, -9999, 832, -9999,
+    190, -9999, 1065, -9999, 425, -9999, 830, -9999, 191, -9999, 1064, -9999, 424, -9999, 831, -9999,
+    188, -9999, 1067, -9999, 427, -9999, 828, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    189, -9999, 1066, -9999, 426, -9999, 829, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 212, -9999, 1043, -9999, 403, -9999, 852, -9999,
+    210, -9999, 1045, -9999, 405, -9999, 850, -9999, 211, -9999, 1044, -9999, 404, -9999, 851, -9999,
+    208, -9999, 1047, -9999, 407, -9999, 848, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    209, -9999, 1046, -9999, 406, -9999, 849, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 203, -9999, 1052, -9999, 412, -9999, 843, -9999,
+    205, -9999, 1050, -9999, 410, -9999, 845, -9999, 204, -9999, 1051, -9999, 411, -9999, 844, -9999,
+    207, -9999, 1048, -9999, 408, -9999, 847, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    206, -9999, 1049, -9999, 409, -9999, 846, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 222, -9999, 1033, -9999, 393, -9999, 862, -9999,
+    220, -9999, 1035, -9999, 395, -9999, 860, -9999, 221, -9999, 1034, -9999, 394, -9999, 861, -9999,
+    218, -9999, 1037, -9999, 397, -9999, 858, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    219, -9999, 1036, -9999, 396, -9999, 859, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 193, -9999, 1062, -9999, 422, -9999, 833, -9999,
+    195, -9999, 1060, -9999, 420, -9999, 835, -9999, 194, -9999, 1061, -9999, 421, -9999, 834, -9999,
+    197, -9999, 1058, -9999, 418, -9999, 837, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    196, -9999, 1059, -9999, 419, -9999, 836, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 213, -9999, 1042, -9999, 402, -9999, 853, -9999,
+    215, -9999, 1040, -9999, 400, -9999, 855, -9999, 214, -9999, 1041, -9999, 401, -9999, 854, -9999,
+    217, -9999, 1038, -9999, 398, -9999, 857, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    216, -9999, 1039, -9999, 399, -9999, 856, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, 202, -9999, 1053, -9999, 413, -9999, 842, -9999,
+    200, -9999, 1055, -9999, 415, -9999, 840, -9999, 201, -9999, 1054, -9999, 414, -9999, 841, -9999,
+    198, -9999, 1057, -9999, 417, -9999, 838, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+    199, -9999, 1056, -9999, 416, -9999, 839, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999, -9999,
+};
+
+const unsigned modeCToATable[4096] = {
+    0, 64, 96, 32, 48, 16, 1040, 1072, 1056, 1120, 1088, 1600, 1632, 1568, 1584, 1552,
+    528, 560, 544, 608, 576, 832, 864, 800, 816, 784, 1808, 1840, 1824, 1888, 1856, 1344,
+    1376, 1312, 1328, 1296, 272, 304, 288, 352, 320, 16704, 16736, 16672, 16688, 16656, 17680, 17712,
+    17696, 17760, 17728, 18240, 18272, 18208, 18224, 18192, 17168, 17200, 17184, 17248, 17216, 16960, 16992, 16928,
+    16944, 16912, 17936, 17968, 17952, 18016, 17984, 17472, 17504, 17440, 17456, 17424, 16400, 16432, 16416, 16480,
+    16448, 24640, 24672, 24608, 24624, 24592, 25616, 25648, 25632, 25696, 25664, 26176, 26208, 26144, 26160, 26128,
+    25104, 25136, 25120, 25184, 25152, 25408, 25440, 25376, 25392, 25360, 26384, 26416, 26400, 26464, 26432, 25920,
+    25952, 25888, 25904, 25872, 24848, 24880, 24864, 24928, 24896, 8512, 8544, 8480, 8496, 8464, 9488, 9520,
+    9504, 9568, 9536, 10048, 10080, 10016, 10032, 10000, 8976, 9008, 8992, 9056, 9024, 8768, 8800, 8736,
+    8752, 8720, 9744, 9776, 9760, 9824, 9792, 9280, 9312, 9248, 9264, 9232, 8208, 8240, 8224, 8288,
+    8256, 12352, 12384, 12320, 12336, 12304, 13328, 13360, 13344, 13408, 13376, 13888, 13920, 13856, 13872, 13840,
+    12816, 12848, 12832, 12896, 12864, 13120, 13152, 13088, 13104, 13072, 14096, 14128, 14112, 14176, 14144, 13632,
+    13664, 13600, 13616, 13584, 12560, 12592, 12576, 12640, 12608, 28992, 29024, 28960, 28976, 28944, 29968, 30000,
+    29984, 30048, 30016, 30528, 30560, 30496, 30512, 30480, 29456, 29488, 29472, 29536, 29504, 29248, 29280, 29216,
+    29232, 29200, 30224, 30256, 30240, 30304, 30272, 29760, 29792, 29728, 29744, 29712, 28688, 28720, 28704, 28768,
+    28736, 20544, 20576, 20512, 20528, 20496, 21520, 21552, 21536, 21600, 21568, 22080, 22112, 22048, 22064, 22032,
+    21008, 21040, 21024, 21088, 21056, 21312, 21344, 21280, 21296, 21264, 22288, 22320, 22304, 22368, 22336, 21824,
+    21856, 21792, 21808, 21776, 20752, 20784, 20768, 20832, 20800, 4416, 4448, 4384, 4400, 4368, 5392, 5424,
+    5408, 5472, 5440, 5952, 5984, 5920, 5936, 5904, 4880, 4912, 4896, 4960, 4928, 4672, 4704, 4640,
+    4656, 4624, 5648, 5680, 5664, 5728, 5696, 5184, 5216, 5152, 5168, 5136, 4112, 4144, 4128, 4192,
+    4160, 4164, 4196, 4132, 4148, 4116, 5140, 5172, 5156, 5220, 5188, 5700, 5732, 5668, 5684, 5652,
+    4628, 4660, 4644, 4708, 4676, 4932, 4964, 4900, 4916, 4884, 5908, 5940, 5924, 5988, 5956, 5444,
+    5476, 5412, 5428, 5396, 4372, 4404, 4388, 4452, 4420, 20804, 20836, 20772, 20788, 20756, 21780, 21812,
+    21796, 21860, 21828, 22340, 22372, 22308, 22324, 22292, 21268, 21300, 21284, 21348, 21316, 21060, 21092, 21028,
+    21044, 21012, 22036, 22068, 22052, 22116, 22084, 21572, 21604, 21540, 21556, 21524, 20500, 20532, 20516, 20580,
+    20548, 28740, 28772, 28708, 28724, 28692, 29716, 29748, 29732, 29796, 29764, 30276, 30308, 30244, 30260, 30228,
+    29204, 29236, 29220, 29284, 29252, 29508, 29540, 29476, 29492, 29460, 30484, 30516, 30500, 30564, 30532, 30020,
+    30052, 29988, 30004, 29972, 28948, 28980, 28964, 29028, 28996, 12612, 12644, 12580, 12596, 12564, 13588, 13620,
+    13604, 13668, 13636, 14148, 14180, 14116, 14132, 14100, 13076, 13108, 13092, 13156, 13124, 12868, 12900, 12836,
+    12852, 12820, 13844, 13876, 13860, 13924, 13892, 13380, 13412, 13348, 13364, 13332, 12308, 12340, 12324, 12388,
+    12356, 8260, 8292, 8228, 8244, 8212, 9236, 9268, 9252, 9316, 9284, 9796, 9828, 9764, 9780, 9748,
+    8724, 8756, 8740, 8804, 8772, 9028, 9060, 8996, 9012, 8980, 10004, 10036, 10020, 10084, 10052, 9540,
+    9572, 9508, 9524, 9492, 8468, 8500, 8484, 8548, 8516, 24900, 24932, 24868, 24884, 24852, 25876, 25908,
+    25892, 25956, 25924, 26436, 26468, 26404, 26420, 26388, 25364, 25396, 25380, 25444, 25412, 25156, 25188, 25124,
+    25140, 25108, 26132, 26164, 26148, 26212, 26180, 25668, 25700, 25636, 25652, 25620, 24596, 24628, 24612, 24676,
+    24644, 16452, 16484, 16420, 16436, 16404, 17428, 17460, 17444, 17508, 17476, 17988, 18020, 17956, 17972, 17940,
+    16916, 16948, 16932, 16996, 16964, 17220, 17252, 17188, 17204, 17172, 18196, 18228, 18212, 18276, 18244, 17732,
+    17764, 17700, 17716, 17684, 16660, 16692, 16676, 16740, 16708, 324, 356, 292, 308, 276, 1300, 1332,
+    1316, 1380, 1348, 1860, 1892, 1828, 1844, 1812, 788, 820, 804, 868, 836, 580, 612, 548,
+    564, 532, 1556, 1588, 1572, 1636, 1604, 1092, 1124, 1060, 1076, 1044, 20, 52, 36, 100,
+    68, 70, 102, 38, 54, 22, 1046, 1078, 1062, 1126, 1094, 1606, 1638, 1574, 1590, 1558,
+    534, 566, 550, 614, 582, 838, 870, 806, 822, 790, 1814, 1846, 1830, 1894, 1862, 1350,
+    1382, 1318, 1334, 1302, 278, 310, 294, 358, 326, 16710, 16742, 16678, 16694, 16662, 17686, 17718,
+    17702, 17766, 17734, 18246, 18278, 18214, 18230, 18198, 17174, 17206, 17190, 17254, 17222, 16966, 16998, 16934,
+    16950, 16918, 17942, 17974, 17958, 18022, 17990, 17478, 17510, 17446, 17462, 17430, 16406, 16438, 16422, 16486,
+    16454, 24646, 24678, 24614, 24630, 24598, 25622, 25654, 25638, 25702, 25670, 26182, 26214, 26150, 26166, 26134,
+    25110, 25142, 25126, 25190, 25158, 25414, 25446, 25382, 25398, 25366, 26390, 26422, 26406, 26470, 26438, 25926,
+    25958, 25894, 25910, 25878, 24854, 24886, 24870, 24934, 24902, 8518, 8550, 8486, 8502, 8470, 9494, 9526,
+    9510, 9574, 9542, 10054, 10086, 10022, 10038, 10006, 8982, 9014, 8998, 9062, 9030, 8774, 8806, 8742,
+    8758, 8726, 9750, 9782, 9766, 9830, 9798, 9286, 9318, 9254, 9270, 9238, 8214, 8246, 8230, 8294,
+    8262, 12358, 12390, 12326, 12342, 12310, 13334, 13366, 13350, 13414, 13382, 13894, 13926, 13862, 13878, 13846,
+    12822, 12854, 12838, 12902, 12870, 13126, 13158, 13094, 13110, 13078, 14102, 14134, 14118, 14182, 14150, 13638,
+    13670, 13606, 13622, 13590, 12566, 12598, 12582, 12646, 12614, 28998, 29030, 28966, 28982, 28950, 29974, 30006,
+    29990, 30054, 30022, 30534, 30566, 30502, 30518, 30486, 29462, 29494, 29478, 29542, 29510, 29254, 29286, 29222,
+    29238, 29206, 30230, 30262, 30246, 30310, 30278, 29766, 29798, 29734, 29750, 29718, 28694, 28726, 28710, 28774,
+    28742, 20550, 20582, 20518, 20534, 20502, 21526, 21558, 21542, 21606, 21574, 22086, 22118, 22054, 22070, 22038,
+    21014, 21046, 21030, 21094, 21062, 21318, 21350, 21286, 21302, 21270, 22294, 22326, 22310, 22374, 22342, 21830,
+    21862, 21798, 21814, 21782, 20758, 20790, 20774, 20838, 20806, 4422, 4454, 4390, 4406, 4374, 5398, 5430,
+    5414, 5478, 5446, 5958, 5990, 5926, 5942, 5910, 4886, 4918, 4902, 4966, 4934, 4678, 4710, 4646,
+    4662, 4630, 5654, 5686, 5670, 5734, 5702, 5190, 5222, 5158, 5174, 5142, 4118, 4150, 4134, 4198,
+    4166, 4162, 4194, 4130, 4146, 4114, 5138, 5170, 5154, 5218, 5186, 5698, 5730, 5666, 5682, 5650,
+    4626, 4658, 4642, 4706, 4674, 4930, 4962, 4898, 4914, 4882, 5906, 5938, 5922, 5986, 5954, 5442,
+    5474, 5410, 5426, 5394, 4370, 4402, 4386, 4450, 4418, 20802, 20834, 20770, 20786, 20754, 21778, 21810,
+    21794, 21858, 21826, 22338, 22370, 22306, 22322, 22290, 21266, 21298, 21282, 21346, 21314, 21058, 21090, 21026,
+    21042, 21010, 22034, 22066, 22050, 22114, 22082, 21570, 21602, 21538, 21554, 21522, 20498, 20530, 20514, 20578,
+    20546, 28738, 28770, 28706, 28722, 28690, 29714, 29746, 29730, 29794, 29762, 30274, 30306, 30242, 30258, 30226,
+    29202, 29234, 29218, 29282, 29250, 29506, 29538, 29474, 29490, 29458, 30482, 30514, 30498, 30562, 30530, 30018,
+    30050, 29986, 30002, 29970, 28946, 28978, 28962, 29026, 28994, 12610, 12642, 12578, 12594, 12562, 13586, 13618,
+    13602, 13666, 13634, 14146, 14178, 14114, 14130, 14098, 13074, 13106, 13090, 13154, 13122, 12866, 12898, 12834,
+    12850, 12818, 13842, 13874, 13858, 13922, 13890, 13378, 13410, 13346, 13362, 13330, 12306, 12338, 12322, 12386,
+    12354, 8258, 8290, 8226, 8242, 8210, 9234, 9266, 9250, 9314, 9282, 9794, 9826, 9762, 9778, 9746,
+    8722, 8754, 8738, 8802, 8770, 9026, 9058, 8994, 9010, 8978, 10002, 10034, 10018, 10082, 10050, 9538,
+    9570, 9506, 9522, 9490, 8466, 8498, 8482, 8546, 8514, 24898, 24930, 24866, 24882, 24850, 25874, 25906,
+    25890, 25954, 25922, 26434, 26466, 26402, 26418, 26386, 25362, 25394, 25378, 25442, 25410, 25154, 25186, 25122,
+    25138, 25106, 26130, 26162, 26146, 26210, 26178, 25666, 25698, 25634, 25650, 25618, 24594, 24626, 24610, 24674,
+    24642, 16450, 16482, 16418, 16434, 16402, 17426, 17458, 17442, 17506, 17474, 17986, 18018, 17954, 17970, 17938,
+    16914, 16946, 16930, 16994, 16962, 17218, 17250, 17186, 17202, 17170, 18194, 18226, 18210, 18274, 18242, 17730,
+    17762, 17698, 17714, 17682, 16658, 16690, 16674, 16738, 16706, 322, 354, 290, 306, 274, 1298, 1330,
+    1314, 1378, 1346, 1858, 1890, 1826, 1842, 1810, 786, 818, 802, 866, 834, 578, 610, 546,
+    562, 530, 1554, 1586, 1570, 1634, 1602, 1090, 1122, 1058, 1074, 1042, 18, 50, 34, 98,
+    66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const uint16_t uc8_lookup[256 * 256] = {
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65507, 65447, 65390, 65338, 65289, 65245, 65204, 65168, 65135, 65107, 65082, 65062, 65046, 65034, 65026, 65022,
+    65022, 65026, 65034, 65046, 65062, 65082, 65107, 65135, 65168, 65204, 65245, 65289, 65338, 65390, 65447, 65507,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65447, 65362, 65281, 65204, 65131, 65062,
+    64997, 64936, 64879, 64826, 64777, 64732, 64692, 64655, 64622, 64593, 64569, 64548, 64532, 64520, 64512, 64508,
+    64508, 64512, 64520, 64532, 64548, 64569, 64593, 64622, 64655, 64692, 64732, 64777, 64826, 64879, 64936, 64997,
+    65062, 65131, 65204, 65281, 65362, 65447, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65427, 65321, 65220, 65123, 65030, 64940, 64855, 64773, 64696, 64622, 64553,
+    64487, 64426, 64368, 64315, 64265, 64220, 64179, 64142, 64109, 64080, 64055, 64035, 64018, 64006, 63998, 63994,
+    63994, 63998, 64006, 64018, 64035, 64055, 64080, 64109, 64142, 64179, 64220, 64265, 64315, 64368, 64426, 64487,
+    64553, 64622, 64696, 64773, 64855, 64940, 65030, 65123, 65220, 65321, 65427, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65511, 65386, 65265, 65147, 65034, 64924, 64818, 64716, 64618, 64524, 64434, 64348, 64265, 64187, 64113, 64043,
+    63977, 63915, 63857, 63803, 63754, 63708, 63667, 63629, 63596, 63567, 63542, 63521, 63504, 63492, 63484, 63480,
+    63480, 63484, 63492, 63504, 63521, 63542, 63567, 63596, 63629, 63667, 63708, 63754, 63803, 63857, 63915, 63977,
+    64043, 64113, 64187, 64265, 64348, 64434, 64524, 64618, 64716, 64818, 64924, 65034, 65147, 65265, 65386, 65511,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65414, 65277, 65143,
+    65013, 64887, 64765, 64647, 64532, 64421, 64315, 64212, 64113, 64018, 63927, 63841, 63758, 63679, 63604, 63534,
+    63467, 63405, 63346, 63292, 63242, 63196, 63154, 63116, 63083, 63054, 63028, 63007, 62991, 62978, 62970, 62966,
+    62966, 62970, 62978, 62991, 63007, 63028, 63054, 63083, 63116, 63154, 63196, 63242, 63292, 63346, 63405, 63467,
+    63534, 63604, 63679, 63758, 63841, 63927, 64018, 64113, 64212, 64315, 64421, 64532, 64647, 64765, 64887, 65013,
+    65143, 65277, 65414, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65511, 65358, 65208, 65062, 64920, 64781, 64647,
+    64516, 64389, 64265, 64146, 64031, 63919, 63812, 63708, 63608, 63513, 63421, 63334, 63250, 63171, 63095, 63024,
+    62957, 62894, 62835, 62781, 62730, 62684, 62642, 62604, 62570, 62540, 62515, 62494, 62477, 62464, 62456, 62452,
+    62452, 62456, 62464, 62477, 62494, 62515, 62540, 62570, 62604, 62642, 62684, 62730, 62781, 62835, 62894, 62957,
+    63024, 63095, 63171, 63250, 63334, 63421, 63513, 63608, 63708, 63812, 63919, 64031, 64146, 64265, 64389, 64516,
+    64647, 64781, 64920, 65062, 65208, 65358, 65511, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65507, 65342, 65180, 65022, 64867, 64716, 64569, 64426, 64286, 64150,
+    64018, 63890, 63766, 63646, 63529, 63417, 63309, 63204, 63104, 63007, 62915, 62827, 62743, 62663, 62587, 62515,
+    62447, 62384, 62324, 62269, 62218, 62172, 62129, 62091, 62057, 62027, 62001, 61980, 61963, 61950, 61942, 61938,
+    61938, 61942, 61950, 61963, 61980, 62001, 62027, 62057, 62091, 62129, 62172, 62218, 62269, 62324, 62384, 62447,
+    62515, 62587, 62663, 62743, 62827, 62915, 63007, 63104, 63204, 63309, 63417, 63529, 63646, 63766, 63890, 64018,
+    64150, 64286, 64426, 64569, 64716, 64867, 65022, 65180, 65342, 65507, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65366, 65192, 65022, 64855, 64692, 64532, 64376, 64224, 64076, 63932, 63791, 63654,
+    63521, 63392, 63267, 63146, 63028, 62915, 62806, 62701, 62599, 62502, 62409, 62320, 62235, 62155, 62078, 62006,
+    61938, 61874, 61814, 61758, 61707, 61660, 61617, 61578, 61544, 61514, 61488, 61467, 61449, 61436, 61428, 61424,
+    61424, 61428, 61436, 61449, 61467, 61488, 61514, 61544, 61578, 61617, 61660, 61707, 61758, 61814, 61874, 61938,
+    62006, 62078, 62155, 62235, 62320, 62409, 62502, 62599, 62701, 62806, 62915, 63028, 63146, 63267, 63392, 63521,
+    63654, 63791, 63932, 64076, 64224, 64376, 64532, 64692, 64855, 65022, 65192, 65366, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65431, 65245, 65062, 64883, 64708, 64536, 64368, 64204, 64043, 63886, 63733, 63583, 63438, 63296, 63158,
+    63024, 62894, 62768, 62646, 62528, 62413, 62303, 62197, 62095, 61997, 61903, 61814, 61728, 61647, 61570, 61497,
+    61428, 61363, 61303, 61247, 61195, 61148, 61104, 61065, 61031, 61001, 60975, 60953, 60936, 60923, 60914, 60910,
+    60910, 60914, 60923, 60936, 60953, 60975, 61001, 61031, 61065, 61104, 61148, 61195, 61247, 61303, 61363, 61428,
+    61497, 61570, 61647, 61728, 61814, 61903, 61997, 62095, 62197, 62303, 62413, 62528, 62646, 62768, 62894, 63024,
+    63158, 63296, 63438, 63583, 63733, 63886, 64043, 64204, 64368, 64536, 64708, 64883, 65062, 65245, 65431, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65338,
+    65143, 64952, 64765, 64581, 64401, 64224, 64051, 63882, 63716, 63554, 63396, 63242, 63091, 62945, 62802, 62663,
+    62528, 62397, 62269, 62146, 62027, 61912, 61801, 61694, 61591, 61492, 61398, 61307, 61221, 61139, 61061, 60988,
+    60918, 60853, 60792, 60736, 60684, 60636, 60592, 60553, 60518, 60487, 60461, 60439, 60422, 60409, 60400, 60396,
+    60396, 60400, 60409, 60422, 60439, 60461, 60487, 60518, 60553, 60592, 60636, 60684, 60736, 60792, 60853, 60918,
+    60988, 61061, 61139, 61221, 61307, 61398, 61492, 61591, 61694, 61801, 61912, 62027, 62146, 62269, 62397, 62528,
+    62663, 62802, 62945, 63091, 63242, 63396, 63554, 63716, 63882, 64051, 64224, 64401, 64581, 64765, 64952, 65143,
+    65338, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65471, 65265, 65062, 64863,
+    64667, 64475, 64286, 64101, 63919, 63741, 63567, 63396, 63229, 63066, 62907, 62751, 62599, 62452, 62308, 62167,
+    62031, 61899, 61771, 61647, 61527, 61411, 61299, 61191, 61087, 60988, 60892, 60801, 60714, 60631, 60553, 60479,
+    60409, 60343, 60282, 60225, 60172, 60124, 60080, 60040, 60005, 59974, 59948, 59926, 59908, 59895, 59886, 59882,
+    59882, 59886, 59895, 59908, 59926, 59948, 59974, 60005, 60040, 60080, 60124, 60172, 60225, 60282, 60343, 60409,
+    60479, 60553, 60631, 60714, 60801, 60892, 60988, 61087, 61191, 61299, 61411, 61527, 61647, 61771, 61899, 62031,
+    62167, 62308, 62452, 62599, 62751, 62907, 63066, 63229, 63396, 63567, 63741, 63919, 64101, 64286, 64475, 64667,
+    64863, 65062, 65265, 65471, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65427, 65212, 65001, 64794, 64589, 64389,
+    64191, 63998, 63807, 63621, 63438, 63259, 63083, 62911, 62743, 62578, 62418, 62261, 62108, 61959, 61814, 61673,
+    61535, 61402, 61273, 61148, 61027, 60910, 60797, 60688, 60583, 60483, 60387, 60295, 60207, 60124, 60045, 59970,
+    59899, 59833, 59771, 59714, 59661, 59612, 59567, 59528, 59492, 59461, 59434, 59412, 59394, 59381, 59372, 59368,
+    59368, 59372, 59381, 59394, 59412, 59434, 59461, 59492, 59528, 59567, 59612, 59661, 59714, 59771, 59833, 59899,
+    59970, 60045, 60124, 60207, 60295, 60387, 60483, 60583, 60688, 60797, 60910, 61027, 61148, 61273, 61402, 61535,
+    61673, 61814, 61959, 62108, 62261, 62418, 62578, 62743, 62911, 63083, 63259, 63438, 63621, 63807, 63998, 64191,
+    64389, 64589, 64794, 65001, 65212, 65427, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65402, 65180, 64961, 64745, 64532, 64323, 64117, 63915,
+    63716, 63521, 63330, 63142, 62957, 62776, 62599, 62426, 62257, 62091, 61929, 61771, 61617, 61467, 61320, 61178,
+    61040, 60905, 60775, 60649, 60527, 60409, 60295, 60185, 60080, 59979, 59882, 59789, 59700, 59616, 59536, 59461,
+    59390, 59323, 59261, 59203, 59149, 59100, 59055, 59015, 58979, 58948, 58921, 58898, 58880, 58867, 58858, 58854,
+    58854, 58858, 58867, 58880, 58898, 58921, 58948, 58979, 59015, 59055, 59100, 59149, 59203, 59261, 59323, 59390,
+    59461, 59536, 59616, 59700, 59789, 59882, 59979, 60080, 60185, 60295, 60409, 60527, 60649, 60775, 60905, 61040,
+    61178, 61320, 61467, 61617, 61771, 61929, 62091, 62257, 62426, 62599, 62776, 62957, 63142, 63330, 63521, 63716,
+    63915, 64117, 64323, 64532, 64745, 64961, 65180, 65402, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65398, 65168, 64940, 64716, 64495, 64278, 64064, 63853, 63646, 63442,
+    63242, 63045, 62852, 62663, 62477, 62295, 62116, 61942, 61771, 61604, 61441, 61281, 61126, 60975, 60827, 60684,
+    60544, 60409, 60277, 60150, 60027, 59908, 59793, 59683, 59576, 59474, 59376, 59283, 59194, 59109, 59028, 58952,
+    58880, 58813, 58750, 58692, 58638, 58588, 58543, 58502, 58466, 58435, 58407, 58385, 58367, 58353, 58344, 58340,
+    58340, 58344, 58353, 58367, 58385, 58407, 58435, 58466, 58502, 58543, 58588, 58638, 58692, 58750, 58813, 58880,
+    58952, 59028, 59109, 59194, 59283, 59376, 59474, 59576, 59683, 59793, 59908, 60027, 60150, 60277, 60409, 60544,
+    60684, 60827, 60975, 61126, 61281, 61441, 61604, 61771, 61942, 62116, 62295, 62477, 62663, 62852, 63045, 63242,
+    63442, 63646, 63853, 64064, 64278, 64495, 64716, 64940, 65168, 65398, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65414, 65176, 64940, 64708, 64479, 64253, 64031, 63812, 63596, 63384, 63175, 62970,
+    62768, 62570, 62375, 62184, 61997, 61814, 61634, 61458, 61286, 61117, 60953, 60792, 60636, 60483, 60334, 60190,
+    60049, 59912, 59780, 59652, 59528, 59408, 59292, 59180, 59073, 58970, 58872, 58777, 58687, 58602, 58520, 58444,
+    58371, 58303, 58240, 58181, 58126, 58076, 58031, 57990, 57953, 57921, 57894, 57871, 57853, 57839, 57830, 57826,
+    57826, 57830, 57839, 57853, 57871, 57894, 57921, 57953, 57990, 58031, 58076, 58126, 58181, 58240, 58303, 58371,
+    58444, 58520, 58602, 58687, 58777, 58872, 58970, 59073, 59180, 59292, 59408, 59528, 59652, 59780, 59912, 60049,
+    60190, 60334, 60483, 60636, 60792, 60953, 61117, 61286, 61458, 61634, 61814, 61997, 62184, 62375, 62570, 62768,
+    62970, 63175, 63384, 63596, 63812, 64031, 64253, 64479, 64708, 64940, 65176, 65414, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65451, 65204, 64961, 64720, 64483, 64249, 64018, 63791, 63567, 63346, 63129, 62915, 62705, 62498,
+    62295, 62095, 61899, 61707, 61518, 61333, 61152, 60975, 60801, 60631, 60465, 60304, 60146, 59992, 59842, 59696,
+    59554, 59416, 59283, 59154, 59028, 58907, 58791, 58678, 58570, 58466, 58367, 58272, 58181, 58095, 58013, 57935,
+    57862, 57794, 57730, 57670, 57615, 57565, 57519, 57477, 57441, 57408, 57381, 57358, 57339, 57325, 57316, 57312,
+    57312, 57316, 57325, 57339, 57358, 57381, 57408, 57441, 57477, 57519, 57565, 57615, 57670, 57730, 57794, 57862,
+    57935, 58013, 58095, 58181, 58272, 58367, 58466, 58570, 58678, 58791, 58907, 59028, 59154, 59283, 59416, 59554,
+    59696, 59842, 59992, 60146, 60304, 60465, 60631, 60801, 60975, 61152, 61333, 61518, 61707, 61899, 62095, 62295,
+    62498, 62705, 62915, 63129, 63346, 63567, 63791, 64018, 64249, 64483, 64720, 64961, 65204, 65451, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65507, 65253, 65001, 64753, 64508, 64265, 64027, 63791, 63559, 63330, 63104, 62882, 62663, 62447, 62235, 62027,
+    61822, 61621, 61424, 61230, 61040, 60853, 60671, 60492, 60317, 60146, 59979, 59815, 59656, 59501, 59350, 59203,
+    59060, 58921, 58786, 58656, 58529, 58407, 58290, 58176, 58067, 57962, 57862, 57766, 57675, 57588, 57505, 57427,
+    57353, 57284, 57219, 57159, 57104, 57053, 57007, 56965, 56928, 56895, 56867, 56844, 56825, 56812, 56802, 56798,
+    56798, 56802, 56812, 56825, 56844, 56867, 56895, 56928, 56965, 57007, 57053, 57104, 57159, 57219, 57284, 57353,
+    57427, 57505, 57588, 57675, 57766, 57862, 57962, 58067, 58176, 58290, 58407, 58529, 58656, 58786, 58921, 59060,
+    59203, 59350, 59501, 59656, 59815, 59979, 60146, 60317, 60492, 60671, 60853, 61040, 61230, 61424, 61621, 61822,
+    62027, 62235, 62447, 62663, 62882, 63104, 63330, 63559, 63791, 64027, 64265, 64508, 64753, 65001, 65253, 65507,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65321,
+    65062, 64806, 64553, 64302, 64055, 63812, 63571, 63334, 63100, 62869, 62642, 62418, 62197, 61980, 61767, 61557,
+    61350, 61148, 60949, 60753, 60562, 60374, 60190, 60009, 59833, 59661, 59492, 59327, 59167, 59010, 58858, 58710,
+    58566, 58426, 58290, 58158, 58031, 57908, 57789, 57675, 57565, 57459, 57358, 57261, 57168, 57081, 56997, 56918,
+    56844, 56774, 56709, 56649, 56593, 56541, 56494, 56452, 56415, 56382, 56354, 56331, 56312, 56298, 56288, 56284,
+    56284, 56288, 56298, 56312, 56331, 56354, 56382, 56415, 56452, 56494, 56541, 56593, 56649, 56709, 56774, 56844,
+    56918, 56997, 57081, 57168, 57261, 57358, 57459, 57565, 57675, 57789, 57908, 58031, 58158, 58290, 58426, 58566,
+    58710, 58858, 59010, 59167, 59327, 59492, 59661, 59833, 60009, 60190, 60374, 60562, 60753, 60949, 61148, 61350,
+    61557, 61767, 61980, 62197, 62418, 62642, 62869, 63100, 63334, 63571, 63812, 64055, 64302, 64553, 64806, 65062,
+    65321, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65410, 65143, 64879,
+    64618, 64360, 64105, 63853, 63604, 63359, 63116, 62877, 62642, 62409, 62180, 61955, 61732, 61514, 61299, 61087,
+    60879, 60675, 60474, 60277, 60084, 59895, 59709, 59528, 59350, 59176, 59006, 58840, 58678, 58520, 58367, 58217,
+    58072, 57931, 57794, 57661, 57532, 57408, 57289, 57173, 57062, 56956, 56853, 56756, 56663, 56574, 56490, 56410,
+    56335, 56265, 56199, 56138, 56081, 56030, 55982, 55940, 55902, 55869, 55841, 55817, 55798, 55784, 55774, 55770,
+    55770, 55774, 55784, 55798, 55817, 55841, 55869, 55902, 55940, 55982, 56030, 56081, 56138, 56199, 56265, 56335,
+    56410, 56490, 56574, 56663, 56756, 56853, 56956, 57062, 57173, 57289, 57408, 57532, 57661, 57794, 57931, 58072,
+    58217, 58367, 58520, 58678, 58840, 59006, 59176, 59350, 59528, 59709, 59895, 60084, 60277, 60474, 60675, 60879,
+    61087, 61299, 61514, 61732, 61955, 62180, 62409, 62642, 62877, 63116, 63359, 63604, 63853, 64105, 64360, 64618,
+    64879, 65143, 65410, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65519, 65245, 64973, 64704, 64438,
+    64175, 63915, 63658, 63405, 63154, 62907, 62663, 62422, 62184, 61950, 61720, 61492, 61269, 61048, 60831, 60618,
+    60409, 60203, 60001, 59802, 59607, 59416, 59229, 59046, 58867, 58692, 58520, 58353, 58190, 58031, 57876, 57725,
+    57578, 57436, 57298, 57164, 57034, 56909, 56788, 56672, 56560, 56452, 56349, 56251, 56157, 56067, 55982, 55902,
+    55826, 55755, 55689, 55627, 55570, 55518, 55470, 55427, 55389, 55356, 55327, 55303, 55284, 55270, 55260, 55256,
+    55256, 55260, 55270, 55284, 55303, 55327, 55356, 55389, 55427, 55470, 55518, 55570, 55627, 55689, 55755, 55826,
+    55902, 55982, 56067, 56157, 56251, 56349, 56452, 56560, 56672, 56788, 56909, 57034, 57164, 57298, 57436, 57578,
+    57725, 57876, 58031, 58190, 58353, 58520, 58692, 58867, 59046, 59229, 59416, 59607, 59802, 60001, 60203, 60409,
+    60618, 60831, 61048, 61269, 61492, 61720, 61950, 62184, 62422, 62663, 62907, 63154, 63405, 63658, 63915, 64175,
+    64438, 64704, 64973, 65245, 65519, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65366, 65086, 64810, 64536, 64265, 63998,
+    63733, 63471, 63213, 62957, 62705, 62456, 62210, 61967, 61728, 61492, 61260, 61031, 60805, 60583, 60365, 60150,
+    59939, 59731, 59528, 59327, 59131, 58939, 58750, 58566, 58385, 58208, 58035, 57867, 57702, 57542, 57385, 57233,
+    57085, 56942, 56802, 56667, 56536, 56410, 56288, 56171, 56058, 55949, 55845, 55746, 55651, 55561, 55475, 55394,
+    55318, 55246, 55179, 55117, 55059, 55006, 54958, 54915, 54877, 54843, 54814, 54790, 54771, 54756, 54746, 54742,
+    54742, 54746, 54756, 54771, 54790, 54814, 54843, 54877, 54915, 54958, 55006, 55059, 55117, 55179, 55246, 55318,
+    55394, 55475, 55561, 55651, 55746, 55845, 55949, 56058, 56171, 56288, 56410, 56536, 56667, 56802, 56942, 57085,
+    57233, 57385, 57542, 57702, 57867, 58035, 58208, 58385, 58566, 58750, 58939, 59131, 59327, 59528, 59731, 59939,
+    60150, 60365, 60583, 60805, 61031, 61260, 61492, 61728, 61967, 62210, 62456, 62705, 62957, 63213, 63471, 63733,
+    63998, 64265, 64536, 64810, 65086, 65366, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65507, 65220, 64936, 64655, 64376, 64101, 63828, 63559,
+    63292, 63028, 62768, 62511, 62257, 62006, 61758, 61514, 61273, 61035, 60801, 60570, 60343, 60119, 59899, 59683,
+    59470, 59261, 59055, 58854, 58656, 58462, 58272, 58085, 57903, 57725, 57551, 57381, 57215, 57053, 56895, 56742,
+    56593, 56448, 56307, 56171, 56039, 55912, 55789, 55670, 55556, 55447, 55342, 55241, 55146, 55054, 54968, 54886,
+    54809, 54737, 54669, 54606, 54548, 54495, 54446, 54403, 54364, 54330, 54301, 54276, 54257, 54242, 54232, 54228,
+    54228, 54232, 54242, 54257, 54276, 54301, 54330, 54364, 54403, 54446, 54495, 54548, 54606, 54669, 54737, 54809,
+    54886, 54968, 55054, 55146, 55241, 55342, 55447, 55556, 55670, 55789, 55912, 56039, 56171, 56307, 56448, 56593,
+    56742, 56895, 57053, 57215, 57381, 57551, 57725, 57903, 58085, 58272, 58462, 58656, 58854, 59055, 59261, 59470,
+    59683, 59899, 60119, 60343, 60570, 60801, 61035, 61273, 61514, 61758, 62006, 62257, 62511, 62768, 63028, 63292,
+    63559, 63828, 64101, 64376, 64655, 64936, 65220, 65507, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65374, 65082, 64794, 64508, 64224, 63944, 63667, 63392, 63121,
+    62852, 62587, 62324, 62065, 61809, 61557, 61307, 61061, 60818, 60579, 60343, 60111, 59882, 59656, 59434, 59216,
+    59002, 58791, 58584, 58380, 58181, 57985, 57794, 57606, 57422, 57242, 57067, 56895, 56728, 56565, 56406, 56251,
+    56100, 55954, 55812, 55675, 55542, 55413, 55289, 55169, 55054, 54944, 54838, 54737, 54640, 54548, 54461, 54378,
+    54301, 54228, 54159, 54096, 54037, 53983, 53934, 53890, 53851, 53817, 53787, 53763, 53743, 53728, 53719, 53714,
+    53714, 53719, 53728, 53743, 53763, 53787, 53817, 53851, 53890, 53934, 53983, 54037, 54096, 54159, 54228, 54301,
+    54378, 54461, 54548, 54640, 54737, 54838, 54944, 55054, 55169, 55289, 55413, 55542, 55675, 55812, 55954, 56100,
+    56251, 56406, 56565, 56728, 56895, 57067, 57242, 57422, 57606, 57794, 57985, 58181, 58380, 58584, 58791, 59002,
+    59216, 59434, 59656, 59882, 60111, 60343, 60579, 60818, 61061, 61307, 61557, 61809, 62065, 62324, 62587, 62852,
+    63121, 63392, 63667, 63944, 64224, 64508, 64794, 65082, 65374, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65249, 64952, 64659, 64368, 64080, 63795, 63513, 63233, 62957, 62684,
+    62413, 62146, 61882, 61621, 61363, 61109, 60857, 60610, 60365, 60124, 59886, 59652, 59421, 59194, 58970, 58750,
+    58534, 58321, 58113, 57908, 57707, 57509, 57316, 57127, 56942, 56760, 56583, 56410, 56241, 56077, 55916, 55760,
+    55608, 55461, 55318, 55179, 55045, 54915, 54790, 54669, 54553, 54442, 54335, 54232, 54135, 54042, 53954, 53871,
+    53792, 53719, 53650, 53586, 53526, 53472, 53423, 53378, 53338, 53304, 53274, 53249, 53229, 53215, 53205, 53200,
+    53200, 53205, 53215, 53229, 53249, 53274, 53304, 53338, 53378, 53423, 53472, 53526, 53586, 53650, 53719, 53792,
+    53871, 53954, 54042, 54135, 54232, 54335, 54442, 54553, 54669, 54790, 54915, 55045, 55179, 55318, 55461, 55608,
+    55760, 55916, 56077, 56241, 56410, 56583, 56760, 56942, 57127, 57316, 57509, 57707, 57908, 58113, 58321, 58534,
+    58750, 58970, 59194, 59421, 59652, 59886, 60124, 60365, 60610, 60857, 61109, 61363, 61621, 61882, 62146, 62413,
+    62684, 62957, 63233, 63513, 63795, 64080, 64368, 64659, 64952, 65249, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65435, 65131, 64830, 64532, 64237, 63944, 63654, 63367, 63083, 62802, 62523, 62248,
+    61976, 61707, 61441, 61178, 60918, 60662, 60409, 60159, 59912, 59669, 59430, 59194, 58961, 58732, 58507, 58285,
+    58067, 57853, 57643, 57436, 57233, 57034, 56839, 56649, 56462, 56279, 56100, 55926, 55755, 55589, 55427, 55270,
+    55117, 54968, 54824, 54684, 54548, 54417, 54291, 54169, 54052, 53939, 53832, 53728, 53630, 53536, 53447, 53363,
+    53284, 53210, 53140, 53075, 53016, 52961, 52911, 52866, 52826, 52791, 52761, 52736, 52716, 52701, 52691, 52686,
+    52686, 52691, 52701, 52716, 52736, 52761, 52791, 52826, 52866, 52911, 52961, 53016, 53075, 53140, 53210, 53284,
+    53363, 53447, 53536, 53630, 53728, 53832, 53939, 54052, 54169, 54291, 54417, 54548, 54684, 54824, 54968, 55117,
+    55270, 55427, 55589, 55755, 55926, 56100, 56279, 56462, 56649, 56839, 57034, 57233, 57436, 57643, 57853, 58067,
+    58285, 58507, 58732, 58961, 59194, 59430, 59669, 59912, 60159, 60409, 60662, 60918, 61178, 61441, 61707, 61976,
+    62248, 62523, 62802, 63083, 63367, 63654, 63944, 64237, 64532, 64830, 65131, 65435, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65330, 65022, 64716, 64413, 64113, 63816, 63521, 63229, 62940, 62654, 62371, 62091, 61814,
+    61540, 61269, 61001, 60736, 60474, 60216, 59961, 59709, 59461, 59216, 58975, 58737, 58502, 58272, 58044, 57821,
+    57601, 57385, 57173, 56965, 56760, 56560, 56363, 56171, 55982, 55798, 55618, 55442, 55270, 55102, 54939, 54780,
+    54626, 54476, 54330, 54189, 54052, 53920, 53792, 53669, 53551, 53437, 53329, 53224, 53125, 53031, 52941, 52856,
+    52776, 52701, 52630, 52565, 52505, 52449, 52399, 52354, 52313, 52278, 52248, 52222, 52202, 52187, 52177, 52172,
+    52172, 52177, 52187, 52202, 52222, 52248, 52278, 52313, 52354, 52399, 52449, 52505, 52565, 52630, 52701, 52776,
+    52856, 52941, 53031, 53125, 53224, 53329, 53437, 53551, 53669, 53792, 53920, 54052, 54189, 54330, 54476, 54626,
+    54780, 54939, 55102, 55270, 55442, 55618, 55798, 55982, 56171, 56363, 56560, 56760, 56965, 57173, 57385, 57601,
+    57821, 58044, 58272, 58502, 58737, 58975, 59216, 59461, 59709, 59961, 60216, 60474, 60736, 61001, 61269, 61540,
+    61814, 62091, 62371, 62654, 62940, 63229, 63521, 63816, 64113, 64413, 64716, 65022, 65330, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65232, 64920, 64610, 64302, 63998, 63696, 63396, 63100, 62806, 62515, 62227, 61942, 61660, 61381,
+    61104, 60831, 60562, 60295, 60031, 59771, 59514, 59261, 59010, 58764, 58520, 58281, 58044, 57812, 57583, 57358,
+    57136, 56918, 56704, 56494, 56288, 56086, 55888, 55694, 55504, 55318, 55136, 54958, 54785, 54616, 54451, 54291,
+    54135, 53983, 53836, 53694, 53556, 53423, 53294, 53170, 53050, 52936, 52826, 52721, 52620, 52525, 52434, 52349,
+    52268, 52192, 52121, 52055, 51994, 51938, 51887, 51841, 51801, 51765, 51734, 51709, 51688, 51673, 51663, 51658,
+    51658, 51663, 51673, 51688, 51709, 51734, 51765, 51801, 51841, 51887, 51938, 51994, 52055, 52121, 52192, 52268,
+    52349, 52434, 52525, 52620, 52721, 52826, 52936, 53050, 53170, 53294, 53423, 53556, 53694, 53836, 53983, 54135,
+    54291, 54451, 54616, 54785, 54958, 55136, 55318, 55504, 55694, 55888, 56086, 56288, 56494, 56704, 56918, 57136,
+    57358, 57583, 57812, 58044, 58281, 58520, 58764, 59010, 59261, 59514, 59771, 60031, 60295, 60562, 60831, 61104,
+    61381, 61660, 61942, 62227, 62515, 62806, 63100, 63396, 63696, 63998, 64302, 64610, 64920, 65232, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65463, 65143, 64826, 64512, 64200, 63890, 63583, 63279, 62978, 62680, 62384, 62091, 61801, 61514, 61230, 60949,
+    60671, 60396, 60124, 59855, 59590, 59327, 59069, 58813, 58561, 58312, 58067, 57826, 57588, 57353, 57122, 56895,
+    56672, 56452, 56237, 56025, 55817, 55613, 55413, 55217, 55026, 54838, 54655, 54476, 54301, 54130, 53964, 53802,
+    53645, 53492, 53343, 53200, 53060, 52926, 52796, 52671, 52550, 52434, 52323, 52217, 52116, 52019, 51928, 51841,
+    51760, 51683, 51612, 51545, 51483, 51427, 51376, 51329, 51288, 51252, 51221, 51195, 51175, 51159, 51149, 51144,
+    51144, 51149, 51159, 51175, 51195, 51221, 51252, 51288, 51329, 51376, 51427, 51483, 51545, 51612, 51683, 51760,
+    51841, 51928, 52019, 52116, 52217, 52323, 52434, 52550, 52671, 52796, 52926, 53060, 53200, 53343, 53492, 53645,
+    53802, 53964, 54130, 54301, 54476, 54655, 54838, 55026, 55217, 55413, 55613, 55817, 56025, 56237, 56452, 56672,
+    56895, 57122, 57353, 57588, 57826, 58067, 58312, 58561, 58813, 59069, 59327, 59590, 59855, 60124, 60396, 60671,
+    60949, 61230, 61514, 61801, 62091, 62384, 62680, 62978, 63279, 63583, 63890, 64200, 64512, 64826, 65143, 65463,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65386,
+    65062, 64741, 64421, 64105, 63791, 63480, 63171, 62865, 62561, 62261, 61963, 61668, 61376, 61087, 60801, 60518,
+    60238, 59961, 59687, 59416, 59149, 58885, 58624, 58367, 58113, 57862, 57615, 57371, 57132, 56895, 56663, 56434,
+    56208, 55987, 55770, 55556, 55346, 55141, 54939, 54742, 54548, 54359, 54174, 53993, 53817, 53645, 53477, 53314,
+    53155, 53001, 52851, 52706, 52565, 52429, 52298, 52172, 52050, 51933, 51821, 51714, 51612, 51514, 51422, 51334,
+    51252, 51175, 51102, 51035, 50973, 50916, 50864, 50817, 50776, 50739, 50708, 50682, 50661, 50645, 50635, 50630,
+    50630, 50635, 50645, 50661, 50682, 50708, 50739, 50776, 50817, 50864, 50916, 50973, 51035, 51102, 51175, 51252,
+    51334, 51422, 51514, 51612, 51714, 51821, 51933, 52050, 52172, 52298, 52429, 52565, 52706, 52851, 53001, 53155,
+    53314, 53477, 53645, 53817, 53993, 54174, 54359, 54548, 54742, 54939, 55141, 55346, 55556, 55770, 55987, 56208,
+    56434, 56663, 56895, 57132, 57371, 57615, 57862, 58113, 58367, 58624, 58885, 59149, 59416, 59687, 59961, 60238,
+    60518, 60801, 61087, 61376, 61668, 61963, 62261, 62561, 62865, 63171, 63480, 63791, 64105, 64421, 64741, 65062,
+    65386, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65317, 64989,
+    64663, 64339, 64018, 63700, 63384, 63070, 62760, 62452, 62146, 61844, 61544, 61247, 60953, 60662, 60374, 60089,
+    59807, 59528, 59252, 58979, 58710, 58444, 58181, 57921, 57665, 57413, 57164, 56918, 56677, 56438, 56204, 55973,
+    55746, 55523, 55303, 55088, 54877, 54669, 54466, 54267, 54071, 53881, 53694, 53512, 53334, 53160, 52991, 52826,
+    52666, 52510, 52359, 52212, 52070, 51933, 51801, 51673, 51550, 51432, 51319, 51211, 51107, 51009, 50916, 50828,
+    50744, 50666, 50593, 50525, 50462, 50405, 50352, 50305, 50263, 50226, 50195, 50168, 50147, 50131, 50121, 50116,
+    50116, 50121, 50131, 50147, 50168, 50195, 50226, 50263, 50305, 50352, 50405, 50462, 50525, 50593, 50666, 50744,
+    50828, 50916, 51009, 51107, 51211, 51319, 51432, 51550, 51673, 51801, 51933, 52070, 52212, 52359, 52510, 52666,
+    52826, 52991, 53160, 53334, 53512, 53694, 53881, 54071, 54267, 54466, 54669, 54877, 55088, 55303, 55523, 55746,
+    55973, 56204, 56438, 56677, 56918, 57164, 57413, 57665, 57921, 58181, 58444, 58710, 58979, 59252, 59528, 59807,
+    60089, 60374, 60662, 60953, 61247, 61544, 61844, 62146, 62452, 62760, 63070, 63384, 63700, 64018, 64339, 64663,
+    64989, 65317, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65257, 64924, 64593,
+    64265, 63940, 63617, 63296, 62978, 62663, 62350, 62040, 61732, 61428, 61126, 60827, 60531, 60238, 59948, 59661,
+    59376, 59095, 58818, 58543, 58272, 58003, 57739, 57477, 57219, 56965, 56714, 56466, 56223, 55982, 55746, 55513,
+    55284, 55059, 54838, 54621, 54408, 54198, 53993, 53792, 53595, 53403, 53215, 53031, 52851, 52676, 52505, 52338,
+    52177, 52019, 51867, 51719, 51576, 51437, 51304, 51175, 51051, 50931, 50817, 50708, 50604, 50504, 50410, 50321,
+    50237, 50158, 50084, 50015, 49952, 49894, 49841, 49793, 49751, 49713, 49681, 49655, 49634, 49618, 49607, 49602,
+    49602, 49607, 49618, 49634, 49655, 49681, 49713, 49751, 49793, 49841, 49894, 49952, 50015, 50084, 50158, 50237,
+    50321, 50410, 50504, 50604, 50708, 50817, 50931, 51051, 51175, 51304, 51437, 51576, 51719, 51867, 52019, 52177,
+    52338, 52505, 52676, 52851, 53031, 53215, 53403, 53595, 53792, 53993, 54198, 54408, 54621, 54838, 55059, 55284,
+    55513, 55746, 55982, 56223, 56466, 56714, 56965, 57219, 57477, 57739, 58003, 58272, 58543, 58818, 59095, 59376,
+    59661, 59948, 60238, 60531, 60827, 61126, 61428, 61732, 62040, 62350, 62663, 62978, 63296, 63617, 63940, 64265,
+    64593, 64924, 65257, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65204, 64867, 64532, 64200,
+    63870, 63542, 63217, 62894, 62574, 62257, 61942, 61630, 61320, 61014, 60710, 60409, 60111, 59815, 59523, 59234,
+    58948, 58665, 58385, 58108, 57835, 57565, 57298, 57034, 56774, 56518, 56265, 56015, 55770, 55527, 55289, 55054,
+    54824, 54597, 54374, 54154, 53939, 53728, 53521, 53319, 53120, 52926, 52736, 52550, 52369, 52192, 52019, 51852,
+    51688, 51530, 51376, 51226, 51082, 50942, 50807, 50677, 50551, 50431, 50316, 50205, 50100, 50000, 49904, 49814,
+    49729, 49650, 49575, 49506, 49442, 49383, 49329, 49281, 49238, 49201, 49168, 49141, 49120, 49104, 49093, 49088,
+    49088, 49093, 49104, 49120, 49141, 49168, 49201, 49238, 49281, 49329, 49383, 49442, 49506, 49575, 49650, 49729,
+    49814, 49904, 50000, 50100, 50205, 50316, 50431, 50551, 50677, 50807, 50942, 51082, 51226, 51376, 51530, 51688,
+    51852, 52019, 52192, 52369, 52550, 52736, 52926, 53120, 53319, 53521, 53728, 53939, 54154, 54374, 54597, 54824,
+    55054, 55289, 55527, 55770, 56015, 56265, 56518, 56774, 57034, 57298, 57565, 57835, 58108, 58385, 58665, 58948,
+    59234, 59523, 59815, 60111, 60409, 60710, 61014, 61320, 61630, 61942, 62257, 62574, 62894, 63217, 63542, 63870,
+    64200, 64532, 64867, 65204, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65503, 65160, 64818, 64479, 64142, 63807,
+    63475, 63146, 62819, 62494, 62172, 61852, 61535, 61221, 60910, 60601, 60295, 59992, 59692, 59394, 59100, 58809,
+    58520, 58235, 57953, 57675, 57399, 57127, 56858, 56593, 56331, 56072, 55817, 55566, 55318, 55074, 54833, 54597,
+    54364, 54135, 53910, 53689, 53472, 53259, 53050, 52846, 52645, 52449, 52258, 52070, 51887, 51709, 51535, 51365,
+    51200, 51040, 50885, 50734, 50588, 50447, 50310, 50179, 50052, 49931, 49814, 49703, 49596, 49495, 49399, 49308,
+    49222, 49141, 49066, 48996, 48931, 48872, 48818, 48769, 48726, 48688, 48655, 48628, 48606, 48590, 48579, 48574,
+    48574, 48579, 48590, 48606, 48628, 48655, 48688, 48726, 48769, 48818, 48872, 48931, 48996, 49066, 49141, 49222,
+    49308, 49399, 49495, 49596, 49703, 49814, 49931, 50052, 50179, 50310, 50447, 50588, 50734, 50885, 51040, 51200,
+    51365, 51535, 51709, 51887, 52070, 52258, 52449, 52645, 52846, 53050, 53259, 53472, 53689, 53910, 54135, 54364,
+    54597, 54833, 55074, 55318, 55566, 55817, 56072, 56331, 56593, 56858, 57127, 57399, 57675, 57953, 58235, 58520,
+    58809, 59100, 59394, 59692, 59992, 60295, 60601, 60910, 61221, 61535, 61852, 62172, 62494, 62819, 63146, 63475,
+    63807, 64142, 64479, 64818, 65160, 65503, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65471, 65123, 64777, 64434, 64093, 63754, 63417,
+    63083, 62751, 62422, 62095, 61771, 61449, 61130, 60814, 60500, 60190, 59882, 59576, 59274, 58975, 58678, 58385,
+    58095, 57807, 57523, 57242, 56965, 56690, 56420, 56152, 55888, 55627, 55370, 55117, 54867, 54621, 54378, 54140,
+    53905, 53674, 53447, 53224, 53006, 52791, 52580, 52374, 52172, 51974, 51780, 51591, 51406, 51226, 51051, 50880,
+    50713, 50551, 50394, 50242, 50095, 49952, 49814, 49681, 49554, 49431, 49313, 49201, 49093, 48991, 48894, 48802,
+    48715, 48633, 48557, 48487, 48421, 48361, 48306, 48257, 48213, 48175, 48142, 48115, 48093, 48076, 48065, 48060,
+    48060, 48065, 48076, 48093, 48115, 48142, 48175, 48213, 48257, 48306, 48361, 48421, 48487, 48557, 48633, 48715,
+    48802, 48894, 48991, 49093, 49201, 49313, 49431, 49554, 49681, 49814, 49952, 50095, 50242, 50394, 50551, 50713,
+    50880, 51051, 51226, 51406, 51591, 51780, 51974, 52172, 52374, 52580, 52791, 53006, 53224, 53447, 53674, 53905,
+    54140, 54378, 54621, 54867, 55117, 55370, 55627, 55888, 56152, 56420, 56690, 56965, 57242, 57523, 57807, 58095,
+    58385, 58678, 58975, 59274, 59576, 59882, 60190, 60500, 60814, 61130, 61449, 61771, 62095, 62422, 62751, 63083,
+    63417, 63754, 64093, 64434, 64777, 65123, 65471, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65447, 65095, 64745, 64397, 64051, 63708, 63367, 63028,
+    62692, 62358, 62027, 61698, 61372, 61048, 60727, 60409, 60093, 59780, 59470, 59163, 58858, 58557, 58258, 57962,
+    57670, 57381, 57095, 56812, 56532, 56255, 55982, 55713, 55447, 55184, 54925, 54669, 54417, 54169, 53925, 53684,
+    53447, 53215, 52986, 52761, 52540, 52323, 52111, 51903, 51699, 51499, 51304, 51113, 50926, 50744, 50567, 50394,
+    50226, 50063, 49904, 49751, 49602, 49458, 49319, 49184, 49055, 48931, 48812, 48699, 48590, 48487, 48388, 48295,
+    48208, 48126, 48049, 47977, 47911, 47850, 47795, 47745, 47701, 47662, 47629, 47601, 47579, 47562, 47551, 47546,
+    47546, 47551, 47562, 47579, 47601, 47629, 47662, 47701, 47745, 47795, 47850, 47911, 47977, 48049, 48126, 48208,
+    48295, 48388, 48487, 48590, 48699, 48812, 48931, 49055, 49184, 49319, 49458, 49602, 49751, 49904, 50063, 50226,
+    50394, 50567, 50744, 50926, 51113, 51304, 51499, 51699, 51903, 52111, 52323, 52540, 52761, 52986, 53215, 53447,
+    53684, 53925, 54169, 54417, 54669, 54925, 55184, 55447, 55713, 55982, 56255, 56532, 56812, 57095, 57381, 57670,
+    57962, 58258, 58557, 58858, 59163, 59470, 59780, 60093, 60409, 60727, 61048, 61372, 61698, 62027, 62358, 62692,
+    63028, 63367, 63708, 64051, 64397, 64745, 65095, 65447, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65431, 65074, 64720, 64368, 64018, 63671, 63325, 62982, 62642,
+    62303, 61967, 61634, 61303, 60975, 60649, 60326, 60005, 59687, 59372, 59060, 58750, 58444, 58140, 57839, 57542,
+    57247, 56956, 56667, 56382, 56100, 55822, 55546, 55275, 55006, 54742, 54480, 54223, 53969, 53719, 53472, 53229,
+    52991, 52756, 52525, 52298, 52075, 51857, 51642, 51432, 51226, 51025, 50828, 50635, 50447, 50263, 50084, 49910,
+    49740, 49575, 49415, 49260, 49109, 48964, 48823, 48688, 48557, 48432, 48312, 48197, 48087, 47983, 47883, 47790,
+    47701, 47618, 47540, 47468, 47401, 47340, 47284, 47233, 47189, 47150, 47116, 47088, 47065, 47049, 47037, 47032,
+    47032, 47037, 47049, 47065, 47088, 47116, 47150, 47189, 47233, 47284, 47340, 47401, 47468, 47540, 47618, 47701,
+    47790, 47883, 47983, 48087, 48197, 48312, 48432, 48557, 48688, 48823, 48964, 49109, 49260, 49415, 49575, 49740,
+    49910, 50084, 50263, 50447, 50635, 50828, 51025, 51226, 51432, 51642, 51857, 52075, 52298, 52525, 52756, 52991,
+    53229, 53472, 53719, 53969, 54223, 54480, 54742, 55006, 55275, 55546, 55822, 56100, 56382, 56667, 56956, 57247,
+    57542, 57839, 58140, 58444, 58750, 59060, 59372, 59687, 60005, 60326, 60649, 60975, 61303, 61634, 61967, 62303,
+    62642, 62982, 63325, 63671, 64018, 64368, 64720, 65074, 65431, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65423, 65062, 64704, 64348, 63994, 63642, 63292, 62945, 62599, 62257,
+    61916, 61578, 61243, 60910, 60579, 60251, 59926, 59603, 59283, 58966, 58651, 58340, 58031, 57725, 57422, 57122,
+    56825, 56532, 56241, 55954, 55670, 55389, 55112, 54838, 54568, 54301, 54037, 53778, 53521, 53269, 53021, 52776,
+    52535, 52298, 52065, 51836, 51612, 51391, 51175, 50963, 50755, 50551, 50352, 50158, 49968, 49782, 49602, 49426,
+    49254, 49088, 48926, 48769, 48617, 48470, 48328, 48191, 48060, 47933, 47812, 47695, 47585, 47479, 47379, 47284,
+    47194, 47110, 47032, 46959, 46891, 46829, 46773, 46722, 46676, 46637, 46603, 46574, 46552, 46535, 46523, 46518,
+    46518, 46523, 46535, 46552, 46574, 46603, 46637, 46676, 46722, 46773, 46829, 46891, 46959, 47032, 47110, 47194,
+    47284, 47379, 47479, 47585, 47695, 47812, 47933, 48060, 48191, 48328, 48470, 48617, 48769, 48926, 49088, 49254,
+    49426, 49602, 49782, 49968, 50158, 50352, 50551, 50755, 50963, 51175, 51391, 51612, 51836, 52065, 52298, 52535,
+    52776, 53021, 53269, 53521, 53778, 54037, 54301, 54568, 54838, 55112, 55389, 55670, 55954, 56241, 56532, 56825,
+    57122, 57422, 57725, 58031, 58340, 58651, 58966, 59283, 59603, 59926, 60251, 60579, 60910, 61243, 61578, 61916,
+    62257, 62599, 62945, 63292, 63642, 63994, 64348, 64704, 65062, 65423, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65423, 65058, 64696, 64335, 63977, 63621, 63267, 62915, 62566, 62218, 61874,
+    61531, 61191, 60853, 60518, 60185, 59855, 59528, 59203, 58880, 58561, 58244, 57931, 57620, 57312, 57007, 56704,
+    56406, 56110, 55817, 55527, 55241, 54958, 54679, 54403, 54130, 53861, 53595, 53334, 53075, 52821, 52570, 52323,
+    52080, 51841, 51606, 51376, 51149, 50926, 50708, 50494, 50284, 50079, 49878, 49682, 49490, 49302, 49120, 48942,
+    48769, 48601, 48438, 48279, 48126, 47977, 47834, 47695, 47562, 47434, 47312, 47194, 47082, 46975, 46874, 46778,
+    46688, 46603, 46523, 46450, 46381, 46319, 46261, 46210, 46164, 46124, 46090, 46061, 46038, 46021, 46009, 46004,
+    46004, 46009, 46021, 46038, 46061, 46090, 46124, 46164, 46210, 46261, 46319, 46381, 46450, 46523, 46603, 46688,
+    46778, 46874, 46975, 47082, 47194, 47312, 47434, 47562, 47695, 47834, 47977, 48126, 48279, 48438, 48601, 48769,
+    48942, 49120, 49302, 49490, 49682, 49878, 50079, 50284, 50494, 50708, 50926, 51149, 51376, 51606, 51841, 52080,
+    52323, 52570, 52821, 53075, 53334, 53595, 53861, 54130, 54403, 54679, 54958, 55241, 55527, 55817, 56110, 56406,
+    56704, 57007, 57312, 57620, 57931, 58244, 58561, 58880, 59203, 59528, 59855, 60185, 60518, 60853, 61191, 61531,
+    61874, 62218, 62566, 62915, 63267, 63621, 63977, 64335, 64696, 65058, 65423, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65431, 65062, 64696, 64331, 63969, 63608, 63250, 62894, 62540, 62189, 61839, 61492,
+    61148, 60805, 60466, 60128, 59793, 59461, 59131, 58804, 58480, 58158, 57839, 57523, 57210, 56900, 56593, 56288,
+    55987, 55689, 55394, 55102, 54814, 54529, 54247, 53969, 53694, 53423, 53155, 52891, 52630, 52374, 52121, 51872,
+    51627, 51386, 51149, 50916, 50687, 50462, 50242, 50026, 49814, 49607, 49404, 49206, 49012, 48823, 48639, 48459,
+    48285, 48115, 47950, 47790, 47635, 47485, 47340, 47200, 47065, 46936, 46812, 46693, 46580, 46472, 46370, 46273,
+    46181, 46096, 46015, 45941, 45871, 45808, 45750, 45698, 45652, 45612, 45577, 45548, 45525, 45507, 45496, 45490,
+    45490, 45496, 45507, 45525, 45548, 45577, 45612, 45652, 45698, 45750, 45808, 45871, 45941, 46015, 46096, 46181,
+    46273, 46370, 46472, 46580, 46693, 46812, 46936, 47065, 47200, 47340, 47485, 47635, 47790, 47950, 48115, 48285,
+    48459, 48639, 48823, 49012, 49206, 49404, 49607, 49814, 50026, 50242, 50462, 50687, 50916, 51149, 51386, 51627,
+    51872, 52121, 52374, 52630, 52891, 53155, 53423, 53694, 53969, 54247, 54529, 54814, 55102, 55394, 55689, 55987,
+    56288, 56593, 56900, 57210, 57523, 57839, 58158, 58480, 58804, 59131, 59461, 59793, 60128, 60466, 60805, 61148,
+    61492, 61839, 62189, 62540, 62894, 63250, 63608, 63969, 64331, 64696, 65062, 65431, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65447, 65074, 64704, 64335, 63969, 63604, 63242, 62882, 62523, 62167, 61814, 61462, 61113,
+    60766, 60422, 60080, 59740, 59403, 59069, 58737, 58407, 58081, 57757, 57436, 57118, 56802, 56490, 56180, 55874,
+    55570, 55270, 54973, 54679, 54388, 54101, 53817, 53536, 53259, 52986, 52716, 52449, 52187, 51928, 51673, 51422,
+    51175, 50931, 50692, 50457, 50226, 50000, 49777, 49559, 49345, 49136, 48931, 48731, 48536, 48345, 48159, 47977,
+    47801, 47629, 47462, 47301, 47144, 46992, 46846, 46705, 46569, 46438, 46313, 46193, 46078, 45969, 45866, 45768,
+    45675, 45588, 45507, 45432, 45362, 45298, 45239, 45187, 45140, 45099, 45064, 45034, 45011, 44993, 44982, 44976,
+    44976, 44982, 44993, 45011, 45034, 45064, 45099, 45140, 45187, 45239, 45298, 45362, 45432, 45507, 45588, 45675,
+    45768, 45866, 45969, 46078, 46193, 46313, 46438, 46569, 46705, 46846, 46992, 47144, 47301, 47462, 47629, 47801,
+    47977, 48159, 48345, 48536, 48731, 48931, 49136, 49345, 49559, 49777, 50000, 50226, 50457, 50692, 50931, 51175,
+    51422, 51673, 51928, 52187, 52449, 52716, 52986, 53259, 53536, 53817, 54101, 54388, 54679, 54973, 55270, 55570,
+    55874, 56180, 56490, 56802, 57118, 57436, 57757, 58081, 58407, 58737, 59069, 59403, 59740, 60080, 60422, 60766,
+    61113, 61462, 61814, 62167, 62523, 62882, 63242, 63604, 63969, 64335, 64704, 65074, 65447, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65471, 65095, 64720, 64348, 63977, 63608, 63242, 62877, 62515, 62155, 61797, 61441, 61087, 60736,
+    60387, 60040, 59696, 59354, 59015, 58678, 58344, 58013, 57684, 57358, 57034, 56714, 56396, 56081, 55770, 55461,
+    55155, 54852, 54553, 54257, 53964, 53674, 53388, 53105, 52826, 52550, 52278, 52009, 51745, 51483, 51226, 50973,
+    50723, 50478, 50237, 50000, 49767, 49538, 49313, 49093, 48877, 48666, 48459, 48257, 48060, 47867, 47679, 47496,
+    47317, 47144, 46975, 46812, 46654, 46501, 46353, 46210, 46073, 45941, 45814, 45693, 45577, 45466, 45362, 45263,
+    45169, 45081, 44999, 44923, 44852, 44787, 44728, 44675, 44628, 44586, 44551, 44521, 44497, 44480, 44468, 44462,
+    44462, 44468, 44480, 44497, 44521, 44551, 44586, 44628, 44675, 44728, 44787, 44852, 44923, 44999, 45081, 45169,
+    45263, 45362, 45466, 45577, 45693, 45814, 45941, 46073, 46210, 46353, 46501, 46654, 46812, 46975, 47144, 47317,
+    47496, 47679, 47867, 48060, 48257, 48459, 48666, 48877, 49093, 49313, 49538, 49767, 50000, 50237, 50478, 50723,
+    50973, 51226, 51483, 51745, 52009, 52278, 52550, 52826, 53105, 53388, 53674, 53964, 54257, 54553, 54852, 55155,
+    55461, 55770, 56081, 56396, 56714, 57034, 57358, 57684, 58013, 58344, 58678, 59015, 59354, 59696, 60040, 60387,
+    60736, 61087, 61441, 61797, 62155, 62515, 62877, 63242, 63608, 63977, 64348, 64720, 65095, 65471, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65503, 65123, 64745, 64368, 63994, 63621, 63250, 62882, 62515, 62150, 61788, 61428, 61070, 60714, 60361,
+    60009, 59661, 59314, 58970, 58629, 58290, 57953, 57620, 57289, 56960, 56635, 56312, 55992, 55675, 55361, 55050,
+    54742, 54437, 54135, 53836, 53541, 53249, 52961, 52676, 52394, 52116, 51841, 51571, 51304, 51040, 50781, 50525,
+    50274, 50026, 49782, 49543, 49308, 49077, 48850, 48628, 48410, 48197, 47988, 47784, 47585, 47390, 47200, 47015,
+    46835, 46659, 46489, 46324, 46164, 46009, 45860, 45716, 45577, 45443, 45315, 45193, 45075, 44964, 44858, 44758,
+    44663, 44575, 44491, 44414, 44343, 44277, 44217, 44164, 44116, 44074, 44038, 44008, 43984, 43966, 43954, 43948,
+    43948, 43954, 43966, 43984, 44008, 44038, 44074, 44116, 44164, 44217, 44277, 44343, 44414, 44491, 44575, 44663,
+    44758, 44858, 44964, 45075, 45193, 45315, 45443, 45577, 45716, 45860, 46009, 46164, 46324, 46489, 46659, 46835,
+    47015, 47200, 47390, 47585, 47784, 47988, 48197, 48410, 48628, 48850, 49077, 49308, 49543, 49782, 50026, 50274,
+    50525, 50781, 51040, 51304, 51571, 51841, 52116, 52394, 52676, 52961, 53249, 53541, 53836, 54135, 54437, 54742,
+    55050, 55361, 55675, 55992, 56312, 56635, 56960, 57289, 57620, 57953, 58290, 58629, 58970, 59314, 59661, 60009,
+    60361, 60714, 61070, 61428, 61788, 62150, 62515, 62882, 63250, 63621, 63994, 64368, 64745, 65123, 65503, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65160, 64777, 64397, 64018, 63642, 63267, 62894, 62523, 62155, 61788, 61424, 61061, 60701, 60343, 59987,
+    59634, 59283, 58934, 58588, 58244, 57903, 57565, 57229, 56895, 56565, 56237, 55912, 55589, 55270, 54954, 54640,
+    54330, 54023, 53719, 53418, 53120, 52826, 52535, 52248, 51964, 51683, 51406, 51133, 50864, 50598, 50337, 50079,
+    49825, 49575, 49329, 49088, 48850, 48617, 48388, 48164, 47944, 47729, 47518, 47312, 47110, 46914, 46722, 46535,
+    46353, 46176, 46004, 45837, 45675, 45519, 45368, 45222, 45081, 44946, 44817, 44693, 44575, 44462, 44355, 44253,
+    44158, 44068, 43984, 43906, 43833, 43767, 43707, 43652, 43604, 43561, 43525, 43495, 43470, 43452, 43440, 43434,
+    43434, 43440, 43452, 43470, 43495, 43525, 43561, 43604, 43652, 43707, 43767, 43833, 43906, 43984, 44068, 44158,
+    44253, 44355, 44462, 44575, 44693, 44817, 44946, 45081, 45222, 45368, 45519, 45675, 45837, 46004, 46176, 46353,
+    46535, 46722, 46914, 47110, 47312, 47518, 47729, 47944, 48164, 48388, 48617, 48850, 49088, 49329, 49575, 49825,
+    50079, 50337, 50598, 50864, 51133, 51406, 51683, 51964, 52248, 52535, 52826, 53120, 53418, 53719, 54023, 54330,
+    54640, 54954, 55270, 55589, 55912, 56237, 56565, 56895, 57229, 57565, 57903, 58244, 58588, 58934, 59283, 59634,
+    59987, 60343, 60701, 61061, 61424, 61788, 62155, 62523, 62894, 63267, 63642, 64018, 64397, 64777, 65160, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65204, 64818, 64434, 64051, 63671, 63292, 62915, 62540, 62167, 61797, 61428, 61061, 60697, 60334, 59974, 59616,
+    59261, 58907, 58557, 58208, 57862, 57519, 57178, 56839, 56504, 56171, 55841, 55513, 55189, 54867, 54548, 54232,
+    53920, 53610, 53304, 53001, 52701, 52404, 52111, 51821, 51535, 51252, 50973, 50697, 50426, 50158, 49894, 49634,
+    49377, 49125, 48877, 48633, 48394, 48159, 47928, 47701, 47479, 47261, 47049, 46840, 46637, 46438, 46244, 46055,
+    45871, 45693, 45519, 45350, 45187, 45029, 44876, 44728, 44586, 44450, 44319, 44194, 44074, 43960, 43851, 43749,
+    43652, 43561, 43476, 43397, 43324, 43257, 43196, 43141, 43092, 43049, 43012, 42981, 42957, 42938, 42926, 42920,
+    42920, 42926, 42938, 42957, 42981, 43012, 43049, 43092, 43141, 43196, 43257, 43324, 43397, 43476, 43561, 43652,
+    43749, 43851, 43960, 44074, 44194, 44319, 44450, 44586, 44728, 44876, 45029, 45187, 45350, 45519, 45693, 45871,
+    46055, 46244, 46438, 46637, 46840, 47049, 47261, 47479, 47701, 47928, 48159, 48394, 48633, 48877, 49125, 49377,
+    49634, 49894, 50158, 50426, 50697, 50973, 51252, 51535, 51821, 52111, 52404, 52701, 53001, 53304, 53610, 53920,
+    54232, 54548, 54867, 55189, 55513, 55841, 56171, 56504, 56839, 57178, 57519, 57862, 58208, 58557, 58907, 59261,
+    59616, 59974, 60334, 60697, 61061, 61428, 61797, 62167, 62540, 62915, 63292, 63671, 64051, 64434, 64818, 65204,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65257,
+    64867, 64479, 64093, 63708, 63325, 62945, 62566, 62189, 61814, 61441, 61070, 60701, 60334, 59970, 59607, 59247,
+    58889, 58534, 58181, 57830, 57482, 57136, 56793, 56452, 56114, 55779, 55447, 55117, 54790, 54466, 54145, 53827,
+    53512, 53200, 52891, 52585, 52283, 51984, 51688, 51396, 51107, 50822, 50541, 50263, 49989, 49719, 49452, 49190,
+    48931, 48677, 48427, 48180, 47939, 47701, 47468, 47239, 47015, 46795, 46580, 46370, 46164, 45964, 45768, 45577,
+    45391, 45210, 45034, 44864, 44699, 44539, 44384, 44235, 44092, 43954, 43821, 43695, 43573, 43458, 43349, 43245,
+    43147, 43055, 42969, 42889, 42815, 42747, 42685, 42629, 42580, 42536, 42499, 42468, 42443, 42424, 42412, 42406,
+    42406, 42412, 42424, 42443, 42468, 42499, 42536, 42580, 42629, 42685, 42747, 42815, 42889, 42969, 43055, 43147,
+    43245, 43349, 43458, 43573, 43695, 43821, 43954, 44092, 44235, 44384, 44539, 44699, 44864, 45034, 45210, 45391,
+    45577, 45768, 45964, 46164, 46370, 46580, 46795, 47015, 47239, 47468, 47701, 47939, 48180, 48427, 48677, 48931,
+    49190, 49452, 49719, 49989, 50263, 50541, 50822, 51107, 51396, 51688, 51984, 52283, 52585, 52891, 53200, 53512,
+    53827, 54145, 54466, 54790, 55117, 55447, 55779, 56114, 56452, 56793, 57136, 57482, 57830, 58181, 58534, 58889,
+    59247, 59607, 59970, 60334, 60701, 61070, 61441, 61814, 62189, 62566, 62945, 63325, 63708, 64093, 64479, 64867,
+    65257, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65317, 64924,
+    64532, 64142, 63754, 63367, 62982, 62599, 62218, 61839, 61462, 61087, 60714, 60343, 59974, 59607, 59243, 58880,
+    58520, 58163, 57807, 57454, 57104, 56756, 56410, 56067, 55727, 55389, 55054, 54722, 54393, 54067, 53743, 53423,
+    53105, 52791, 52480, 52172, 51867, 51566, 51267, 50973, 50682, 50394, 50110, 49830, 49554, 49281, 49012, 48747,
+    48487, 48230, 47977, 47729, 47485, 47245, 47009, 46778, 46552, 46330, 46113, 45900, 45693, 45490, 45292, 45099,
+    44911, 44728, 44551, 44378, 44211, 44050, 43894, 43743, 43598, 43458, 43324, 43196, 43073, 42957, 42846, 42741,
+    42642, 42549, 42462, 42381, 42306, 42237, 42175, 42118, 42068, 42024, 41986, 41955, 41930, 41911, 41898, 41892,
+    41892, 41898, 41911, 41930, 41955, 41986, 42024, 42068, 42118, 42175, 42237, 42306, 42381, 42462, 42549, 42642,
+    42741, 42846, 42957, 43073, 43196, 43324, 43458, 43598, 43743, 43894, 44050, 44211, 44378, 44551, 44728, 44911,
+    45099, 45292, 45490, 45693, 45900, 46113, 46330, 46552, 46778, 47009, 47245, 47485, 47729, 47977, 48230, 48487,
+    48747, 49012, 49281, 49554, 49830, 50110, 50394, 50682, 50973, 51267, 51566, 51867, 52172, 52480, 52791, 53105,
+    53423, 53743, 54067, 54393, 54722, 55054, 55389, 55727, 56067, 56410, 56756, 57104, 57454, 57807, 58163, 58520,
+    58880, 59243, 59607, 59974, 60343, 60714, 61087, 61462, 61839, 62218, 62599, 62982, 63367, 63754, 64142, 64532,
+    64924, 65317, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65386, 64989, 64593,
+    64200, 63807, 63417, 63028, 62642, 62257, 61874, 61492, 61113, 60736, 60361, 59987, 59616, 59247, 58880, 58516,
+    58154, 57794, 57436, 57081, 56728, 56377, 56030, 55684, 55342, 55002, 54664, 54330, 53998, 53669, 53343, 53021,
+    52701, 52384, 52070, 51760, 51453, 51149, 50848, 50551, 50258, 49968, 49682, 49399, 49120, 48845, 48574, 48306,
+    48043, 47784, 47529, 47278, 47032, 46790, 46552, 46319, 46090, 45866, 45646, 45432, 45222, 45017, 44817, 44622,
+    44432, 44247, 44068, 43894, 43725, 43561, 43403, 43251, 43104, 42963, 42827, 42698, 42574, 42456, 42343, 42237,
+    42137, 42043, 41955, 41873, 41797, 41727, 41664, 41607, 41556, 41512, 41473, 41442, 41416, 41397, 41384, 41378,
+    41378, 41384, 41397, 41416, 41442, 41473, 41512, 41556, 41607, 41664, 41727, 41797, 41873, 41955, 42043, 42137,
+    42237, 42343, 42456, 42574, 42698, 42827, 42963, 43104, 43251, 43403, 43561, 43725, 43894, 44068, 44247, 44432,
+    44622, 44817, 45017, 45222, 45432, 45646, 45866, 46090, 46319, 46552, 46790, 47032, 47278, 47529, 47784, 48043,
+    48306, 48574, 48845, 49120, 49399, 49682, 49968, 50258, 50551, 50848, 51149, 51453, 51760, 52070, 52384, 52701,
+    53021, 53343, 53669, 53998, 54330, 54664, 55002, 55342, 55684, 56030, 56377, 56728, 57081, 57436, 57794, 58154,
+    58516, 58880, 59247, 59616, 59987, 60361, 60736, 61113, 61492, 61874, 62257, 62642, 63028, 63417, 63807, 64200,
+    64593, 64989, 65386, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65463, 65062, 64663, 64265,
+    63870, 63475, 63083, 62692, 62303, 61916, 61531, 61148, 60766, 60387, 60009, 59634, 59261, 58889, 58520, 58154,
+    57789, 57427, 57067, 56709, 56354, 56001, 55651, 55303, 54958, 54616, 54276, 53939, 53605, 53274, 52946, 52620,
+    52298, 51979, 51663, 51350, 51040, 50734, 50431, 50131, 49835, 49543, 49254, 48969, 48688, 48410, 48137, 47867,
+    47601, 47340, 47082, 46829, 46580, 46336, 46096, 45860, 45629, 45403, 45181, 44964, 44752, 44545, 44343, 44146,
+    43954, 43767, 43586, 43409, 43239, 43073, 42914, 42759, 42611, 42468, 42331, 42200, 42074, 41955, 41841, 41734,
+    41632, 41537, 41448, 41365, 41288, 41218, 41154, 41096, 41044, 40999, 40961, 40928, 40903, 40883, 40870, 40864,
+    40864, 40870, 40883, 40903, 40928, 40961, 40999, 41044, 41096, 41154, 41218, 41288, 41365, 41448, 41537, 41632,
+    41734, 41841, 41955, 42074, 42200, 42331, 42468, 42611, 42759, 42914, 43073, 43239, 43409, 43586, 43767, 43954,
+    44146, 44343, 44545, 44752, 44964, 45181, 45403, 45629, 45860, 46096, 46336, 46580, 46829, 47082, 47340, 47601,
+    47867, 48137, 48410, 48688, 48969, 49254, 49543, 49835, 50131, 50431, 50734, 51040, 51350, 51663, 51979, 52298,
+    52620, 52946, 53274, 53605, 53939, 54276, 54616, 54958, 55303, 55651, 56001, 56354, 56709, 57067, 57427, 57789,
+    58154, 58520, 58889, 59261, 59634, 60009, 60387, 60766, 61148, 61531, 61916, 62303, 62692, 63083, 63475, 63870,
+    64265, 64663, 65062, 65463, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65143, 64741, 64339, 63940,
+    63542, 63146, 62751, 62358, 61967, 61578, 61191, 60805, 60422, 60040, 59661, 59283, 58907, 58534, 58163, 57794,
+    57427, 57062, 56700, 56340, 55982, 55627, 55275, 54925, 54577, 54232, 53890, 53551, 53215, 52881, 52550, 52222,
+    51897, 51576, 51257, 50942, 50630, 50321, 50015, 49713, 49415, 49120, 48829, 48541, 48257, 47977, 47701, 47429,
+    47161, 46897, 46637, 46381, 46130, 45883, 45640, 45403, 45169, 44940, 44717, 44497, 44283, 44074, 43870, 43670,
+    43476, 43288, 43104, 42926, 42753, 42586, 42424, 42268, 42118, 41974, 41835, 41702, 41575, 41454, 41339, 41231,
+    41128, 41032, 40941, 40857, 40780, 40708, 40643, 40585, 40533, 40487, 40448, 40415, 40389, 40369, 40356, 40350,
+    40350, 40356, 40369, 40389, 40415, 40448, 40487, 40533, 40585, 40643, 40708, 40780, 40857, 40941, 41032, 41128,
+    41231, 41339, 41454, 41575, 41702, 41835, 41974, 42118, 42268, 42424, 42586, 42753, 42926, 43104, 43288, 43476,
+    43670, 43870, 44074, 44283, 44497, 44717, 44940, 45169, 45403, 45640, 45883, 46130, 46381, 46637, 46897, 47161,
+    47429, 47701, 47977, 48257, 48541, 48829, 49120, 49415, 49713, 50015, 50321, 50630, 50942, 51257, 51576, 51897,
+    52222, 52550, 52881, 53215, 53551, 53890, 54232, 54577, 54925, 55275, 55627, 55982, 56340, 56700, 57062, 57427,
+    57794, 58163, 58534, 58907, 59283, 59661, 60040, 60422, 60805, 61191, 61578, 61967, 62358, 62751, 63146, 63542,
+    63940, 64339, 64741, 65143, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65232, 64826, 64421, 64018, 63617,
+    63217, 62819, 62422, 62027, 61634, 61243, 60853, 60466, 60080, 59696, 59314, 58934, 58557, 58181, 57807, 57436,
+    57067, 56700, 56335, 55973, 55613, 55256, 54901, 54548, 54198, 53851, 53507, 53165, 52826, 52490, 52156, 51826,
+    51499, 51175, 50854, 50536, 50221, 49910, 49602, 49297, 48996, 48699, 48405, 48115, 47828, 47546, 47267, 46992,
+    46722, 46455, 46193, 45935, 45681, 45432, 45187, 44946, 44711, 44480, 44253, 44032, 43815, 43604, 43397, 43196,
+    43000, 42809, 42623, 42443, 42268, 42099, 41936, 41778, 41626, 41480, 41339, 41205, 41077, 40954, 40838, 40728,
+    40624, 40526, 40435, 40350, 40271, 40199, 40133, 40074, 40021, 39975, 39935, 39902, 39876, 39856, 39842, 39836,
+    39836, 39842, 39856, 39876, 39902, 39935, 39975, 40021, 40074, 40133, 40199, 40271, 40350, 40435, 40526, 40624,
+    40728, 40838, 40954, 41077, 41205, 41339, 41480, 41626, 41778, 41936, 42099, 42268, 42443, 42623, 42809, 43000,
+    43196, 43397, 43604, 43815, 44032, 44253, 44480, 44711, 44946, 45187, 45432, 45681, 45935, 46193, 46455, 46722,
+    46992, 47267, 47546, 47828, 48115, 48405, 48699, 48996, 49297, 49602, 49910, 50221, 50536, 50854, 51175, 51499,
+    51826, 52156, 52490, 52826, 53165, 53507, 53851, 54198, 54548, 54901, 55256, 55613, 55973, 56335, 56700, 57067,
+    57436, 57807, 58181, 58557, 58934, 59314, 59696, 60080, 60466, 60853, 61243, 61634, 62027, 62422, 62819, 63217,
+    63617, 64018, 64421, 64826, 65232, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65330, 64920, 64512, 64105, 63700, 63296,
+    62894, 62494, 62095, 61698, 61303, 60910, 60518, 60128, 59740, 59354, 58970, 58588, 58208, 57830, 57454, 57081,
+    56709, 56340, 55973, 55608, 55246, 54886, 54529, 54174, 53822, 53472, 53125, 52781, 52439, 52101, 51765, 51432,
+    51102, 50776, 50452, 50131, 49814, 49500, 49190, 48883, 48579, 48279, 47983, 47690, 47401, 47116, 46835, 46557,
+    46284, 46015, 45750, 45490, 45233, 44982, 44734, 44491, 44253, 44020, 43791, 43567, 43349, 43135, 42926, 42722,
+    42524, 42331, 42143, 41961, 41784, 41613, 41448, 41288, 41134, 40986, 40844, 40708, 40578, 40454, 40337, 40225,
+    40120, 40021, 39929, 39842, 39763, 39690, 39623, 39563, 39510, 39463, 39422, 39389, 39362, 39342, 39329, 39322,
+    39322, 39329, 39342, 39362, 39389, 39422, 39463, 39510, 39563, 39623, 39690, 39763, 39842, 39929, 40021, 40120,
+    40225, 40337, 40454, 40578, 40708, 40844, 40986, 41134, 41288, 41448, 41613, 41784, 41961, 42143, 42331, 42524,
+    42722, 42926, 43135, 43349, 43567, 43791, 44020, 44253, 44491, 44734, 44982, 45233, 45490, 45750, 46015, 46284,
+    46557, 46835, 47116, 47401, 47690, 47983, 48279, 48579, 48883, 49190, 49500, 49814, 50131, 50452, 50776, 51102,
+    51432, 51765, 52101, 52439, 52781, 53125, 53472, 53822, 54174, 54529, 54886, 55246, 55608, 55973, 56340, 56709,
+    57081, 57454, 57830, 58208, 58588, 58970, 59354, 59740, 60128, 60518, 60910, 61303, 61698, 62095, 62494, 62894,
+    63296, 63700, 64105, 64512, 64920, 65330, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65435, 65022, 64610, 64200, 63791, 63384, 62978,
+    62574, 62172, 61771, 61372, 60975, 60579, 60185, 59793, 59403, 59015, 58629, 58244, 57862, 57482, 57104, 56728,
+    56354, 55982, 55613, 55246, 54881, 54519, 54159, 53802, 53447, 53095, 52746, 52399, 52055, 51714, 51376, 51040,
+    50708, 50379, 50052, 49729, 49410, 49093, 48780, 48470, 48164, 47861, 47562, 47267, 46975, 46688, 46404, 46124,
+    45848, 45577, 45309, 45046, 44787, 44533, 44283, 44038, 43797, 43561, 43330, 43104, 42883, 42667, 42456, 42250,
+    42049, 41854, 41664, 41480, 41301, 41128, 40961, 40799, 40643, 40494, 40350, 40212, 40080, 39955, 39836, 39723,
+    39616, 39516, 39422, 39335, 39255, 39180, 39113, 39052, 38998, 38951, 38910, 38876, 38849, 38828, 38815, 38808,
+    38808, 38815, 38828, 38849, 38876, 38910, 38951, 38998, 39052, 39113, 39180, 39255, 39335, 39422, 39516, 39616,
+    39723, 39836, 39955, 40080, 40212, 40350, 40494, 40643, 40799, 40961, 41128, 41301, 41480, 41664, 41854, 42049,
+    42250, 42456, 42667, 42883, 43104, 43330, 43561, 43797, 44038, 44283, 44533, 44787, 45046, 45309, 45577, 45848,
+    46124, 46404, 46688, 46975, 47267, 47562, 47861, 48164, 48470, 48780, 49093, 49410, 49729, 50052, 50379, 50708,
+    51040, 51376, 51714, 52055, 52399, 52746, 53095, 53447, 53802, 54159, 54519, 54881, 55246, 55613, 55982, 56354,
+    56728, 57104, 57482, 57862, 58244, 58629, 59015, 59403, 59793, 60185, 60579, 60975, 61372, 61771, 62172, 62574,
+    62978, 63384, 63791, 64200, 64610, 65022, 65435, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65131, 64716, 64302, 63890, 63480, 63070, 62663,
+    62257, 61852, 61449, 61048, 60649, 60251, 59855, 59461, 59069, 58678, 58290, 57903, 57519, 57136, 56756, 56377,
+    56001, 55627, 55256, 54886, 54519, 54154, 53792, 53433, 53075, 52721, 52369, 52019, 51673, 51329, 50988, 50651,
+    50316, 49984, 49655, 49329, 49007, 48688, 48372, 48060, 47751, 47446, 47144, 46846, 46552, 46261, 45975, 45693,
+    45414, 45140, 44870, 44604, 44343, 44086, 43833, 43586, 43342, 43104, 42871, 42642, 42418, 42200, 41986, 41778,
+    41575, 41378, 41186, 40999, 40819, 40643, 40474, 40311, 40153, 40001, 39856, 39716, 39583, 39456, 39335, 39221,
+    39113, 39012, 38917, 38828, 38747, 38671, 38603, 38541, 38487, 38438, 38397, 38363, 38335, 38315, 38301, 38294,
+    38294, 38301, 38315, 38335, 38363, 38397, 38438, 38487, 38541, 38603, 38671, 38747, 38828, 38917, 39012, 39113,
+    39221, 39335, 39456, 39583, 39716, 39856, 40001, 40153, 40311, 40474, 40643, 40819, 40999, 41186, 41378, 41575,
+    41778, 41986, 42200, 42418, 42642, 42871, 43104, 43342, 43586, 43833, 44086, 44343, 44604, 44870, 45140, 45414,
+    45693, 45975, 46261, 46552, 46846, 47144, 47446, 47751, 48060, 48372, 48688, 49007, 49329, 49655, 49984, 50316,
+    50651, 50988, 51329, 51673, 52019, 52369, 52721, 53075, 53433, 53792, 54154, 54519, 54886, 55256, 55627, 56001,
+    56377, 56756, 57136, 57519, 57903, 58290, 58678, 59069, 59461, 59855, 60251, 60649, 61048, 61449, 61852, 62257,
+    62663, 63070, 63480, 63890, 64302, 64716, 65131, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65249, 64830, 64413, 63998, 63583, 63171, 62760, 62350,
+    61942, 61535, 61130, 60727, 60326, 59926, 59528, 59131, 58737, 58344, 57953, 57565, 57178, 56793, 56410, 56030,
+    55651, 55275, 54901, 54529, 54159, 53792, 53428, 53065, 52706, 52349, 51994, 51642, 51293, 50947, 50604, 50263,
+    49926, 49591, 49260, 48931, 48606, 48285, 47966, 47651, 47340, 47032, 46727, 46427, 46130, 45837, 45548, 45263,
+    44982, 44705, 44432, 44164, 43900, 43640, 43385, 43135, 42889, 42648, 42412, 42181, 41955, 41734, 41518, 41308,
+    41102, 40903, 40708, 40520, 40337, 40159, 39988, 39823, 39663, 39510, 39362, 39221, 39086, 38957, 38835, 38719,
+    38610, 38507, 38411, 38321, 38239, 38163, 38093, 38031, 37975, 37926, 37885, 37850, 37822, 37801, 37787, 37780,
+    37780, 37787, 37801, 37822, 37850, 37885, 37926, 37975, 38031, 38093, 38163, 38239, 38321, 38411, 38507, 38610,
+    38719, 38835, 38957, 39086, 39221, 39362, 39510, 39663, 39823, 39988, 40159, 40337, 40520, 40708, 40903, 41102,
+    41308, 41518, 41734, 41955, 42181, 42412, 42648, 42889, 43135, 43385, 43640, 43900, 44164, 44432, 44705, 44982,
+    45263, 45548, 45837, 46130, 46427, 46727, 47032, 47340, 47651, 47966, 48285, 48606, 48931, 49260, 49591, 49926,
+    50263, 50604, 50947, 51293, 51642, 51994, 52349, 52706, 53065, 53428, 53792, 54159, 54529, 54901, 55275, 55651,
+    56030, 56410, 56793, 57178, 57565, 57953, 58344, 58737, 59131, 59528, 59926, 60326, 60727, 61130, 61535, 61942,
+    62350, 62760, 63171, 63583, 63998, 64413, 64830, 65249, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65374, 64952, 64532, 64113, 63696, 63279, 62865, 62452, 62040,
+    61630, 61221, 60814, 60409, 60005, 59603, 59203, 58804, 58407, 58013, 57620, 57229, 56839, 56452, 56067, 55684,
+    55303, 54925, 54548, 54174, 53802, 53433, 53065, 52701, 52338, 51979, 51622, 51267, 50916, 50567, 50221, 49878,
+    49538, 49201, 48867, 48536, 48208, 47883, 47562, 47245, 46930, 46620, 46313, 46009, 45710, 45414, 45122, 44835,
+    44551, 44271, 43996, 43725, 43458, 43196, 42938, 42685, 42437, 42193, 41955, 41721, 41493, 41269, 41051, 40838,
+    40630, 40428, 40232, 40041, 39856, 39676, 39503, 39335, 39174, 39018, 38869, 38726, 38589, 38459, 38335, 38218,
+    38107, 38003, 37906, 37815, 37731, 37654, 37584, 37520, 37464, 37414, 37372, 37337, 37308, 37287, 37273, 37266,
+    37266, 37273, 37287, 37308, 37337, 37372, 37414, 37464, 37520, 37584, 37654, 37731, 37815, 37906, 38003, 38107,
+    38218, 38335, 38459, 38589, 38726, 38869, 39018, 39174, 39335, 39503, 39676, 39856, 40041, 40232, 40428, 40630,
+    40838, 41051, 41269, 41493, 41721, 41955, 42193, 42437, 42685, 42938, 43196, 43458, 43725, 43996, 44271, 44551,
+    44835, 45122, 45414, 45710, 46009, 46313, 46620, 46930, 47245, 47562, 47883, 48208, 48536, 48867, 49201, 49538,
+    49878, 50221, 50567, 50916, 51267, 51622, 51979, 52338, 52701, 53065, 53433, 53802, 54174, 54548, 54925, 55303,
+    55684, 56067, 56452, 56839, 57229, 57620, 58013, 58407, 58804, 59203, 59603, 60005, 60409, 60814, 61221, 61630,
+    62040, 62452, 62865, 63279, 63696, 64113, 64532, 64952, 65374, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65507, 65082, 64659, 64237, 63816, 63396, 62978, 62561, 62146, 61732,
+    61320, 60910, 60500, 60093, 59687, 59283, 58880, 58480, 58081, 57684, 57289, 56895, 56504, 56114, 55727, 55342,
+    54958, 54577, 54198, 53822, 53447, 53075, 52706, 52338, 51974, 51612, 51252, 50895, 50541, 50189, 49841, 49495,
+    49152, 48812, 48476, 48142, 47812, 47485, 47161, 46840, 46523, 46210, 45900, 45594, 45292, 44993, 44699, 44408,
+    44122, 43839, 43561, 43288, 43018, 42753, 42493, 42237, 41986, 41740, 41499, 41263, 41032, 40806, 40585, 40369,
+    40159, 39955, 39756, 39563, 39376, 39194, 39018, 38849, 38685, 38528, 38377, 38232, 38093, 37961, 37836, 37717,
+    37605, 37499, 37400, 37308, 37223, 37145, 37074, 37010, 36953, 36903, 36860, 36824, 36795, 36773, 36759, 36752,
+    36752, 36759, 36773, 36795, 36824, 36860, 36903, 36953, 37010, 37074, 37145, 37223, 37308, 37400, 37499, 37605,
+    37717, 37836, 37961, 38093, 38232, 38377, 38528, 38685, 38849, 39018, 39194, 39376, 39563, 39756, 39955, 40159,
+    40369, 40585, 40806, 41032, 41263, 41499, 41740, 41986, 42237, 42493, 42753, 43018, 43288, 43561, 43839, 44122,
+    44408, 44699, 44993, 45292, 45594, 45900, 46210, 46523, 46840, 47161, 47485, 47812, 48142, 48476, 48812, 49152,
+    49495, 49841, 50189, 50541, 50895, 51252, 51612, 51974, 52338, 52706, 53075, 53447, 53822, 54198, 54577, 54958,
+    55342, 55727, 56114, 56504, 56895, 57289, 57684, 58081, 58480, 58880, 59283, 59687, 60093, 60500, 60910, 61320,
+    61732, 62146, 62561, 62978, 63396, 63816, 64237, 64659, 65082, 65507, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65220, 64794, 64368, 63944, 63521, 63100, 62680, 62261, 61844, 61428,
+    61014, 60601, 60190, 59780, 59372, 58966, 58561, 58158, 57757, 57358, 56960, 56565, 56171, 55779, 55389, 55002,
+    54616, 54232, 53851, 53472, 53095, 52721, 52349, 51979, 51612, 51247, 50885, 50525, 50168, 49814, 49463, 49115,
+    48769, 48427, 48087, 47751, 47418, 47088, 46761, 46438, 46118, 45802, 45490, 45181, 44876, 44575, 44277, 43984,
+    43695, 43409, 43129, 42852, 42580, 42312, 42049, 41791, 41537, 41288, 41044, 40806, 40572, 40343, 40120, 39902,
+    39690, 39483, 39282, 39086, 38896, 38712, 38535, 38363, 38197, 38038, 37885, 37738, 37598, 37464, 37337, 37216,
+    37102, 36996, 36895, 36802, 36716, 36637, 36565, 36499, 36441, 36391, 36347, 36311, 36282, 36260, 36245, 36238,
+    36238, 36245, 36260, 36282, 36311, 36347, 36391, 36441, 36499, 36565, 36637, 36716, 36802, 36895, 36996, 37102,
+    37216, 37337, 37464, 37598, 37738, 37885, 38038, 38197, 38363, 38535, 38712, 38896, 39086, 39282, 39483, 39690,
+    39902, 40120, 40343, 40572, 40806, 41044, 41288, 41537, 41791, 42049, 42312, 42580, 42852, 43129, 43409, 43695,
+    43984, 44277, 44575, 44876, 45181, 45490, 45802, 46118, 46438, 46761, 47088, 47418, 47751, 48087, 48427, 48769,
+    49115, 49463, 49814, 50168, 50525, 50885, 51247, 51612, 51979, 52349, 52721, 53095, 53472, 53851, 54232, 54616,
+    55002, 55389, 55779, 56171, 56565, 56960, 57358, 57757, 58158, 58561, 58966, 59372, 59780, 60190, 60601, 61014,
+    61428, 61844, 62261, 62680, 63100, 63521, 63944, 64368, 64794, 65220, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65366, 64936, 64508, 64080, 63654, 63229, 62806, 62384, 61963, 61544, 61126,
+    60710, 60295, 59882, 59470, 59060, 58651, 58244, 57839, 57436, 57034, 56635, 56237, 55841, 55447, 55054, 54664,
+    54276, 53890, 53507, 53125, 52746, 52369, 51994, 51622, 51252, 50885, 50520, 50158, 49798, 49442, 49088, 48737,
+    48388, 48043, 47701, 47362, 47026, 46693, 46364, 46038, 45716, 45397, 45081, 44770, 44462, 44158, 43857, 43561,
+    43269, 42981, 42698, 42418, 42143, 41873, 41607, 41346, 41089, 40838, 40591, 40350, 40113, 39882, 39656, 39436,
+    39221, 39012, 38808, 38610, 38418, 38232, 38052, 37878, 37710, 37548, 37393, 37245, 37102, 36967, 36838, 36716,
+    36601, 36492, 36391, 36296, 36209, 36128, 36055, 35989, 35930, 35879, 35835, 35798, 35768, 35746, 35731, 35724,
+    35724, 35731, 35746, 35768, 35798, 35835, 35879, 35930, 35989, 36055, 36128, 36209, 36296, 36391, 36492, 36601,
+    36716, 36838, 36967, 37102, 37245, 37393, 37548, 37710, 37878, 38052, 38232, 38418, 38610, 38808, 39012, 39221,
+    39436, 39656, 39882, 40113, 40350, 40591, 40838, 41089, 41346, 41607, 41873, 42143, 42418, 42698, 42981, 43269,
+    43561, 43857, 44158, 44462, 44770, 45081, 45397, 45716, 46038, 46364, 46693, 47026, 47362, 47701, 48043, 48388,
+    48737, 49088, 49442, 49798, 50158, 50520, 50885, 51252, 51622, 51994, 52369, 52746, 53125, 53507, 53890, 54276,
+    54664, 55054, 55447, 55841, 56237, 56635, 57034, 57436, 57839, 58244, 58651, 59060, 59470, 59882, 60295, 60710,
+    61126, 61544, 61963, 62384, 62806, 63229, 63654, 64080, 64508, 64936, 65366, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65519, 65086, 64655, 64224, 63795, 63367, 62940, 62515, 62091, 61668, 61247, 60827,
+    60409, 59992, 59576, 59163, 58750, 58340, 57931, 57523, 57118, 56714, 56312, 55912, 55513, 55117, 54722, 54330,
+    53939, 53551, 53165, 52781, 52399, 52019, 51642, 51267, 50895, 50525, 50158, 49793, 49431, 49072, 48715, 48361,
+    48010, 47662, 47317, 46975, 46637, 46301, 45969, 45640, 45315, 44993, 44675, 44361, 44050, 43743, 43440, 43141,
+    42846, 42555, 42268, 41986, 41708, 41435, 41167, 40903, 40643, 40389, 40140, 39895, 39656, 39422, 39194, 38971,
+    38753, 38541, 38335, 38135, 37940, 37752, 37569, 37393, 37223, 37060, 36903, 36752, 36608, 36470, 36340, 36216,
+    36099, 35989, 35886, 35790, 35702, 35620, 35546, 35479, 35419, 35367, 35322, 35285, 35255, 35232, 35217, 35210,
+    35210, 35217, 35232, 35255, 35285, 35322, 35367, 35419, 35479, 35546, 35620, 35702, 35790, 35886, 35989, 36099,
+    36216, 36340, 36470, 36608, 36752, 36903, 37060, 37223, 37393, 37569, 37752, 37940, 38135, 38335, 38541, 38753,
+    38971, 39194, 39422, 39656, 39895, 40140, 40389, 40643, 40903, 41167, 41435, 41708, 41986, 42268, 42555, 42846,
+    43141, 43440, 43743, 44050, 44361, 44675, 44993, 45315, 45640, 45969, 46301, 46637, 46975, 47317, 47662, 48010,
+    48361, 48715, 49072, 49431, 49793, 50158, 50525, 50895, 51267, 51642, 52019, 52399, 52781, 53165, 53551, 53939,
+    54330, 54722, 55117, 55513, 55912, 56312, 56714, 57118, 57523, 57931, 58340, 58750, 59163, 59576, 59992, 60409,
+    60827, 61247, 61668, 62091, 62515, 62940, 63367, 63795, 64224, 64655, 65086, 65519, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65245, 64810, 64376, 63944, 63513, 63083, 62654, 62227, 61801, 61376, 60953, 60531,
+    60111, 59692, 59274, 58858, 58444, 58031, 57620, 57210, 56802, 56396, 55992, 55589, 55189, 54790, 54393, 53998,
+    53605, 53215, 52826, 52439, 52055, 51673, 51293, 50916, 50541, 50168, 49798, 49431, 49066, 48704, 48345, 47988,
+    47635, 47284, 46936, 46591, 46250, 45912, 45577, 45245, 44917, 44592, 44271, 43954, 43640, 43330, 43024, 42722,
+    42424, 42131, 41841, 41556, 41276, 40999, 40728, 40461, 40199, 39942, 39690, 39443, 39201, 38964, 38733, 38507,
+    38287, 38072, 37864, 37661, 37464, 37273, 37088, 36910, 36738, 36572, 36412, 36260, 36114, 35974, 35842, 35717,
+    35598, 35486, 35382, 35285, 35195, 35112, 35037, 34969, 34909, 34855, 34810, 34772, 34742, 34719, 34704, 34696,
+    34696, 34704, 34719, 34742, 34772, 34810, 34855, 34909, 34969, 35037, 35112, 35195, 35285, 35382, 35486, 35598,
+    35717, 35842, 35974, 36114, 36260, 36412, 36572, 36738, 36910, 37088, 37273, 37464, 37661, 37864, 38072, 38287,
+    38507, 38733, 38964, 39201, 39443, 39690, 39942, 40199, 40461, 40728, 40999, 41276, 41556, 41841, 42131, 42424,
+    42722, 43024, 43330, 43640, 43954, 44271, 44592, 44917, 45245, 45577, 45912, 46250, 46591, 46936, 47284, 47635,
+    47988, 48345, 48704, 49066, 49431, 49798, 50168, 50541, 50916, 51293, 51673, 52055, 52439, 52826, 53215, 53605,
+    53998, 54393, 54790, 55189, 55589, 55992, 56396, 56802, 57210, 57620, 58031, 58444, 58858, 59274, 59692, 60111,
+    60531, 60953, 61376, 61801, 62227, 62654, 63083, 63513, 63944, 64376, 64810, 65245, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65410, 64973, 64536, 64101, 63667, 63233, 62802, 62371, 61942, 61514, 61087, 60662, 60238,
+    59815, 59394, 58975, 58557, 58140, 57725, 57312, 56900, 56490, 56081, 55675, 55270, 54867, 54466, 54067, 53669,
+    53274, 52881, 52490, 52101, 51714, 51329, 50947, 50567, 50189, 49814, 49442, 49072, 48704, 48339, 47977, 47618,
+    47261, 46908, 46557, 46210, 45866, 45525, 45187, 44852, 44521, 44194, 43870, 43549, 43233, 42920, 42611, 42306,
+    42005, 41708, 41416, 41128, 40844, 40565, 40291, 40021, 39756, 39496, 39241, 38991, 38747, 38507, 38273, 38045,
+    37822, 37605, 37393, 37188, 36988, 36795, 36608, 36427, 36252, 36084, 35923, 35768, 35620, 35479, 35345, 35217,
+    35097, 34984, 34878, 34780, 34688, 34604, 34528, 34459, 34398, 34344, 34298, 34259, 34228, 34205, 34190, 34182,
+    34182, 34190, 34205, 34228, 34259, 34298, 34344, 34398, 34459, 34528, 34604, 34688, 34780, 34878, 34984, 35097,
+    35217, 35345, 35479, 35620, 35768, 35923, 36084, 36252, 36427, 36608, 36795, 36988, 37188, 37393, 37605, 37822,
+    38045, 38273, 38507, 38747, 38991, 39241, 39496, 39756, 40021, 40291, 40565, 40844, 41128, 41416, 41708, 42005,
+    42306, 42611, 42920, 43233, 43549, 43870, 44194, 44521, 44852, 45187, 45525, 45866, 46210, 46557, 46908, 47261,
+    47618, 47977, 48339, 48704, 49072, 49442, 49814, 50189, 50567, 50947, 51329, 51714, 52101, 52490, 52881, 53274,
+    53669, 54067, 54466, 54867, 55270, 55675, 56081, 56490, 56900, 57312, 57725, 58140, 58557, 58975, 59394, 59815,
+    60238, 60662, 61087, 61514, 61942, 62371, 62802, 63233, 63667, 64101, 64536, 64973, 65410, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65143, 64704, 64265, 63828, 63392, 62957, 62523, 62091, 61660, 61230, 60801, 60374, 59948,
+    59523, 59100, 58678, 58258, 57839, 57422, 57007, 56593, 56180, 55770, 55361, 54954, 54548, 54145, 53743, 53343,
+    52946, 52550, 52156, 51765, 51376, 50988, 50604, 50221, 49841, 49463, 49088, 48715, 48345, 47977, 47612, 47250,
+    46891, 46535, 46181, 45831, 45484, 45140, 44799, 44462, 44128, 43797, 43470, 43147, 42827, 42512, 42200, 41892,
+    41588, 41288, 40993, 40702, 40415, 40133, 39856, 39583, 39315, 39052, 38794, 38541, 38294, 38052, 37815, 37584,
+    37358, 37138, 36924, 36716, 36514, 36318, 36128, 35945, 35768, 35598, 35434, 35277, 35127, 34984, 34848, 34719,
+    34597, 34482, 34375, 34275, 34182, 34097, 34019, 33949, 33887, 33832, 33785, 33746, 33715, 33692, 33676, 33668,
+    33668, 33676, 33692, 33715, 33746, 33785, 33832, 33887, 33949, 34019, 34097, 34182, 34275, 34375, 34482, 34597,
+    34719, 34848, 34984, 35127, 35277, 35434, 35598, 35768, 35945, 36128, 36318, 36514, 36716, 36924, 37138, 37358,
+    37584, 37815, 38052, 38294, 38541, 38794, 39052, 39315, 39583, 39856, 40133, 40415, 40702, 40993, 41288, 41588,
+    41892, 42200, 42512, 42827, 43147, 43470, 43797, 44128, 44462, 44799, 45140, 45484, 45831, 46181, 46535, 46891,
+    47250, 47612, 47977, 48345, 48715, 49088, 49463, 49841, 50221, 50604, 50988, 51376, 51765, 52156, 52550, 52946,
+    53343, 53743, 54145, 54548, 54954, 55361, 55770, 56180, 56593, 57007, 57422, 57839, 58258, 58678, 59100, 59523,
+    59948, 60374, 60801, 61230, 61660, 62091, 62523, 62957, 63392, 63828, 64265, 64704, 65143, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65321, 64879, 64438, 63998, 63559, 63121, 62684, 62248, 61814, 61381, 60949, 60518, 60089, 59661,
+    59234, 58809, 58385, 57962, 57542, 57122, 56704, 56288, 55874, 55461, 55050, 54640, 54232, 53827, 53423, 53021,
+    52620, 52222, 51826, 51432, 51040, 50651, 50263, 49878, 49495, 49115, 48737, 48361, 47988, 47618, 47250, 46885,
+    46523, 46164, 45808, 45455, 45105, 44758, 44414, 44074, 43737, 43403, 43073, 42747, 42424, 42106, 41791, 41480,
+    41173, 40870, 40572, 40278, 39988, 39703, 39422, 39147, 38876, 38610, 38349, 38093, 37843, 37598, 37358, 37124,
+    36895, 36673, 36456, 36245, 36041, 35842, 35650, 35464, 35285, 35112, 34946, 34787, 34635, 34490, 34352, 34221,
+    34097, 33980, 33871, 33770, 33676, 33589, 33511, 33440, 33376, 33321, 33273, 33234, 33202, 33178, 33162, 33154,
+    33154, 33162, 33178, 33202, 33234, 33273, 33321, 33376, 33440, 33511, 33589, 33676, 33770, 33871, 33980, 34097,
+    34221, 34352, 34490, 34635, 34787, 34946, 35112, 35285, 35464, 35650, 35842, 36041, 36245, 36456, 36673, 36895,
+    37124, 37358, 37598, 37843, 38093, 38349, 38610, 38876, 39147, 39422, 39703, 39988, 40278, 40572, 40870, 41173,
+    41480, 41791, 42106, 42424, 42747, 43073, 43403, 43737, 44074, 44414, 44758, 45105, 45455, 45808, 46164, 46523,
+    46885, 47250, 47618, 47988, 48361, 48737, 49115, 49495, 49878, 50263, 50651, 51040, 51432, 51826, 52222, 52620,
+    53021, 53423, 53827, 54232, 54640, 55050, 55461, 55874, 56288, 56704, 57122, 57542, 57962, 58385, 58809, 59234,
+    59661, 60089, 60518, 60949, 61381, 61814, 62248, 62684, 63121, 63559, 63998, 64438, 64879, 65321, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65507, 65062, 64618, 64175, 63733, 63292, 62852, 62413, 61976, 61540, 61104, 60671, 60238, 59807, 59376,
+    58948, 58520, 58095, 57670, 57247, 56825, 56406, 55987, 55570, 55155, 54742, 54330, 53920, 53512, 53105, 52701,
+    52298, 51897, 51499, 51102, 50708, 50316, 49926, 49538, 49152, 48769, 48388, 48010, 47635, 47261, 46891, 46523,
+    46159, 45797, 45437, 45081, 44728, 44378, 44032, 43688, 43349, 43012, 42679, 42350, 42024, 41702, 41384, 41070,
+    40760, 40454, 40153, 39856, 39563, 39275, 38991, 38712, 38438, 38169, 37906, 37647, 37393, 37145, 36903, 36666,
+    36434, 36209, 35989, 35776, 35568, 35367, 35172, 34984, 34802, 34627, 34459, 34298, 34143, 33996, 33856, 33723,
+    33597, 33479, 33368, 33265, 33170, 33082, 33002, 32930, 32866, 32810, 32761, 32721, 32689, 32664, 32648, 32640,
+    32640, 32648, 32664, 32689, 32721, 32761, 32810, 32866, 32930, 33002, 33082, 33170, 33265, 33368, 33479, 33597,
+    33723, 33856, 33996, 34143, 34298, 34459, 34627, 34802, 34984, 35172, 35367, 35568, 35776, 35989, 36209, 36434,
+    36666, 36903, 37145, 37393, 37647, 37906, 38169, 38438, 38712, 38991, 39275, 39563, 39856, 40153, 40454, 40760,
+    41070, 41384, 41702, 42024, 42350, 42679, 43012, 43349, 43688, 44032, 44378, 44728, 45081, 45437, 45797, 46159,
+    46523, 46891, 47261, 47635, 48010, 48388, 48769, 49152, 49538, 49926, 50316, 50708, 51102, 51499, 51897, 52298,
+    52701, 53105, 53512, 53920, 54330, 54742, 55155, 55570, 55987, 56406, 56825, 57247, 57670, 58095, 58520, 58948,
+    59376, 59807, 60238, 60671, 61104, 61540, 61976, 62413, 62852, 63292, 63733, 64175, 64618, 65062, 65507, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65253, 64806, 64360, 63915, 63471, 63028, 62587, 62146, 61707, 61269, 60831, 60396, 59961, 59528, 59095,
+    58665, 58235, 57807, 57381, 56956, 56532, 56110, 55689, 55270, 54852, 54437, 54023, 53610, 53200, 52791, 52384,
+    51979, 51576, 51175, 50776, 50379, 49984, 49591, 49201, 48812, 48427, 48043, 47662, 47284, 46908, 46535, 46164,
+    45797, 45432, 45070, 44711, 44355, 44002, 43652, 43306, 42963, 42623, 42287, 41955, 41626, 41301, 40980, 40663,
+    40350, 40041, 39736, 39436, 39140, 38849, 38562, 38280, 38003, 37731, 37464, 37202, 36945, 36694, 36449, 36209,
+    35974, 35746, 35524, 35307, 35097, 34893, 34696, 34505, 34321, 34143, 33973, 33809, 33652, 33503, 33361, 33226,
+    33098, 32978, 32866, 32761, 32664, 32575, 32494, 32421, 32355, 32298, 32249, 32208, 32175, 32151, 32134, 32126,
+    32126, 32134, 32151, 32175, 32208, 32249, 32298, 32355, 32421, 32494, 32575, 32664, 32761, 32866, 32978, 33098,
+    33226, 33361, 33503, 33652, 33809, 33973, 34143, 34321, 34505, 34696, 34893, 35097, 35307, 35524, 35746, 35974,
+    36209, 36449, 36694, 36945, 37202, 37464, 37731, 38003, 38280, 38562, 38849, 39140, 39436, 39736, 40041, 40350,
+    40663, 40980, 41301, 41626, 41955, 42287, 42623, 42963, 43306, 43652, 44002, 44355, 44711, 45070, 45432, 45797,
+    46164, 46535, 46908, 47284, 47662, 48043, 48427, 48812, 49201, 49591, 49984, 50379, 50776, 51175, 51576, 51979,
+    52384, 52791, 53200, 53610, 54023, 54437, 54852, 55270, 55689, 56110, 56532, 56956, 57381, 57807, 58235, 58665,
+    59095, 59528, 59961, 60396, 60831, 61269, 61707, 62146, 62587, 63028, 63471, 63915, 64360, 64806, 65253, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65451, 65001, 64553, 64105, 63658, 63213, 62768, 62324, 61882, 61441, 61001, 60562, 60124, 59687, 59252, 58818,
+    58385, 57953, 57523, 57095, 56667, 56241, 55817, 55394, 54973, 54553, 54135, 53719, 53304, 52891, 52480, 52070,
+    51663, 51257, 50854, 50452, 50052, 49655, 49260, 48867, 48476, 48087, 47701, 47317, 46936, 46557, 46181, 45808,
+    45437, 45070, 44705, 44343, 43984, 43628, 43275, 42926, 42580, 42237, 41898, 41563, 41231, 40903, 40578, 40258,
+    39942, 39630, 39322, 39018, 38719, 38425, 38135, 37850, 37569, 37294, 37024, 36759, 36499, 36245, 35997, 35753,
+    35516, 35285, 35060, 34840, 34627, 34421, 34221, 34027, 33840, 33660, 33487, 33321, 33162, 33010, 32866, 32729,
+    32600, 32478, 32364, 32257, 32159, 32068, 31986, 31911, 31845, 31787, 31737, 31696, 31662, 31637, 31620, 31612,
+    31612, 31620, 31637, 31662, 31696, 31737, 31787, 31845, 31911, 31986, 32068, 32159, 32257, 32364, 32478, 32600,
+    32729, 32866, 33010, 33162, 33321, 33487, 33660, 33840, 34027, 34221, 34421, 34627, 34840, 35060, 35285, 35516,
+    35753, 35997, 36245, 36499, 36759, 37024, 37294, 37569, 37850, 38135, 38425, 38719, 39018, 39322, 39630, 39942,
+    40258, 40578, 40903, 41231, 41563, 41898, 42237, 42580, 42926, 43275, 43628, 43984, 44343, 44705, 45070, 45437,
+    45808, 46181, 46557, 46936, 47317, 47701, 48087, 48476, 48867, 49260, 49655, 50052, 50452, 50854, 51257, 51663,
+    52070, 52480, 52891, 53304, 53719, 54135, 54553, 54973, 55394, 55817, 56241, 56667, 57095, 57523, 57953, 58385,
+    58818, 59252, 59687, 60124, 60562, 61001, 61441, 61882, 62324, 62768, 63213, 63658, 64105, 64553, 65001, 65451,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65204, 64753, 64302, 63853, 63405, 62957, 62511, 62065, 61621, 61178, 60736, 60295, 59855, 59416, 58979, 58543,
+    58108, 57675, 57242, 56812, 56382, 55954, 55527, 55102, 54679, 54257, 53836, 53418, 53001, 52585, 52172, 51760,
+    51350, 50942, 50536, 50131, 49729, 49329, 48931, 48536, 48142, 47751, 47362, 46975, 46591, 46210, 45831, 45455,
+    45081, 44711, 44343, 43978, 43616, 43257, 42901, 42549, 42200, 41854, 41512, 41173, 40838, 40507, 40179, 39856,
+    39536, 39221, 38910, 38603, 38301, 38003, 37710, 37422, 37138, 36860, 36586, 36318, 36055, 35798, 35546, 35300,
+    35060, 34825, 34597, 34375, 34159, 33949, 33746, 33550, 33361, 33178, 33002, 32834, 32672, 32518, 32372, 32233,
+    32101, 31978, 31862, 31754, 31654, 31562, 31478, 31402, 31335, 31276, 31225, 31183, 31149, 31124, 31107, 31098,
+    31098, 31107, 31124, 31149, 31183, 31225, 31276, 31335, 31402, 31478, 31562, 31654, 31754, 31862, 31978, 32101,
+    32233, 32372, 32518, 32672, 32834, 33002, 33178, 33361, 33550, 33746, 33949, 34159, 34375, 34597, 34825, 35060,
+    35300, 35546, 35798, 36055, 36318, 36586, 36860, 37138, 37422, 37710, 38003, 38301, 38603, 38910, 39221, 39536,
+    39856, 40179, 40507, 40838, 41173, 41512, 41854, 42200, 42549, 42901, 43257, 43616, 43978, 44343, 44711, 45081,
+    45455, 45831, 46210, 46591, 46975, 47362, 47751, 48142, 48536, 48931, 49329, 49729, 50131, 50536, 50942, 51350,
+    51760, 52172, 52585, 53001, 53418, 53836, 54257, 54679, 55102, 55527, 55954, 56382, 56812, 57242, 57675, 58108,
+    58543, 58979, 59416, 59855, 60295, 60736, 61178, 61621, 62065, 62511, 62957, 63405, 63853, 64302, 64753, 65204,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65414,
+    64961, 64508, 64055, 63604, 63154, 62705, 62257, 61809, 61363, 60918, 60474, 60031, 59590, 59149, 58710, 58272,
+    57835, 57399, 56965, 56532, 56100, 55670, 55241, 54814, 54388, 53964, 53541, 53120, 52701, 52283, 51867, 51453,
+    51040, 50630, 50221, 49814, 49410, 49007, 48606, 48208, 47812, 47418, 47026, 46637, 46250, 45866, 45484, 45105,
+    44728, 44355, 43984, 43616, 43251, 42889, 42530, 42175, 41822, 41473, 41128, 40786, 40448, 40113, 39783, 39456,
+    39133, 38815, 38500, 38190, 37885, 37584, 37287, 36996, 36709, 36427, 36150, 35879, 35613, 35352, 35097, 34848,
+    34604, 34367, 34136, 33910, 33692, 33479, 33273, 33074, 32882, 32697, 32518, 32347, 32184, 32027, 31878, 31737,
+    31604, 31478, 31360, 31251, 31149, 31056, 30970, 30893, 30825, 30765, 30713, 30670, 30636, 30610, 30593, 30584,
+    30584, 30593, 30610, 30636, 30670, 30713, 30765, 30825, 30893, 30970, 31056, 31149, 31251, 31360, 31478, 31604,
+    31737, 31878, 32027, 32184, 32347, 32518, 32697, 32882, 33074, 33273, 33479, 33692, 33910, 34136, 34367, 34604,
+    34848, 35097, 35352, 35613, 35879, 36150, 36427, 36709, 36996, 37287, 37584, 37885, 38190, 38500, 38815, 39133,
+    39456, 39783, 40113, 40448, 40786, 41128, 41473, 41822, 42175, 42530, 42889, 43251, 43616, 43984, 44355, 44728,
+    45105, 45484, 45866, 46250, 46637, 47026, 47418, 47812, 48208, 48606, 49007, 49410, 49814, 50221, 50630, 51040,
+    51453, 51867, 52283, 52701, 53120, 53541, 53964, 54388, 54814, 55241, 55670, 56100, 56532, 56965, 57399, 57835,
+    58272, 58710, 59149, 59590, 60031, 60474, 60918, 61363, 61809, 62257, 62705, 63154, 63604, 64055, 64508, 64961,
+    65414, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65176,
+    64720, 64265, 63812, 63359, 62907, 62456, 62006, 61557, 61109, 60662, 60216, 59771, 59327, 58885, 58444, 58003,
+    57565, 57127, 56690, 56255, 55822, 55389, 54958, 54529, 54101, 53674, 53249, 52826, 52404, 51984, 51566, 51149,
+    50734, 50321, 49910, 49500, 49093, 48688, 48285, 47883, 47485, 47088, 46693, 46301, 45912, 45525, 45140, 44758,
+    44378, 44002, 43628, 43257, 42889, 42524, 42162, 41803, 41448, 41096, 40747, 40402, 40061, 39723, 39389, 39059,
+    38733, 38411, 38093, 37780, 37471, 37167, 36867, 36572, 36282, 35997, 35717, 35442, 35172, 34909, 34650, 34398,
+    34151, 33910, 33676, 33448, 33226, 33010, 32801, 32600, 32404, 32216, 32035, 31862, 31696, 31537, 31386, 31242,
+    31107, 30979, 30859, 30748, 30644, 30550, 30463, 30385, 30315, 30254, 30202, 30158, 30123, 30096, 30079, 30070,
+    30070, 30079, 30096, 30123, 30158, 30202, 30254, 30315, 30385, 30463, 30550, 30644, 30748, 30859, 30979, 31107,
+    31242, 31386, 31537, 31696, 31862, 32035, 32216, 32404, 32600, 32801, 33010, 33226, 33448, 33676, 33910, 34151,
+    34398, 34650, 34909, 35172, 35442, 35717, 35997, 36282, 36572, 36867, 37167, 37471, 37780, 38093, 38411, 38733,
+    39059, 39389, 39723, 40061, 40402, 40747, 41096, 41448, 41803, 42162, 42524, 42889, 43257, 43628, 44002, 44378,
+    44758, 45140, 45525, 45912, 46301, 46693, 47088, 47485, 47883, 48285, 48688, 49093, 49500, 49910, 50321, 50734,
+    51149, 51566, 51984, 52404, 52826, 53249, 53674, 54101, 54529, 54958, 55389, 55822, 56255, 56690, 57127, 57565,
+    58003, 58444, 58885, 59327, 59771, 60216, 60662, 61109, 61557, 62006, 62456, 62907, 63359, 63812, 64265, 64720,
+    65176, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65398, 64940,
+    64483, 64027, 63571, 63116, 62663, 62210, 61758, 61307, 60857, 60409, 59961, 59514, 59069, 58624, 58181, 57739,
+    57298, 56858, 56420, 55982, 55546, 55112, 54679, 54247, 53817, 53388, 52961, 52535, 52111, 51688, 51267, 50848,
+    50431, 50015, 49602, 49190, 48780, 48372, 47966, 47562, 47161, 46761, 46364, 45969, 45577, 45187, 44799, 44414,
+    44032, 43652, 43275, 42901, 42530, 42162, 41797, 41435, 41077, 40721, 40369, 40021, 39676, 39335, 38998, 38665,
+    38335, 38010, 37689, 37372, 37060, 36752, 36449, 36150, 35857, 35568, 35285, 35007, 34734, 34467, 34205, 33949,
+    33699, 33455, 33218, 32986, 32761, 32543, 32331, 32126, 31928, 31737, 31553, 31377, 31208, 31047, 30893, 30748,
+    30610, 30480, 30359, 30245, 30140, 30044, 29956, 29876, 29805, 29743, 29690, 29645, 29610, 29583, 29565, 29556,
+    29556, 29565, 29583, 29610, 29645, 29690, 29743, 29805, 29876, 29956, 30044, 30140, 30245, 30359, 30480, 30610,
+    30748, 30893, 31047, 31208, 31377, 31553, 31737, 31928, 32126, 32331, 32543, 32761, 32986, 33218, 33455, 33699,
+    33949, 34205, 34467, 34734, 35007, 35285, 35568, 35857, 36150, 36449, 36752, 37060, 37372, 37689, 38010, 38335,
+    38665, 38998, 39335, 39676, 40021, 40369, 40721, 41077, 41435, 41797, 42162, 42530, 42901, 43275, 43652, 44032,
+    44414, 44799, 45187, 45577, 45969, 46364, 46761, 47161, 47562, 47966, 48372, 48780, 49190, 49602, 50015, 50431,
+    50848, 51267, 51688, 52111, 52535, 52961, 53388, 53817, 54247, 54679, 55112, 55546, 55982, 56420, 56858, 57298,
+    57739, 58181, 58624, 59069, 59514, 59961, 60409, 60857, 61307, 61758, 62210, 62663, 63116, 63571, 64027, 64483,
+    64940, 65398, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65168, 64708,
+    64249, 63791, 63334, 62877, 62422, 61967, 61514, 61061, 60610, 60159, 59709, 59261, 58813, 58367, 57921, 57477,
+    57034, 56593, 56152, 55713, 55275, 54838, 54403, 53969, 53536, 53105, 52676, 52248, 51821, 51396, 50973, 50551,
+    50131, 49713, 49297, 48883, 48470, 48060, 47651, 47245, 46840, 46438, 46038, 45640, 45245, 44852, 44462, 44074,
+    43688, 43306, 42926, 42549, 42175, 41803, 41435, 41070, 40708, 40350, 39995, 39643, 39295, 38951, 38610, 38273,
+    37940, 37612, 37287, 36967, 36651, 36340, 36033, 35731, 35434, 35142, 34855, 34574, 34298, 34027, 33762, 33503,
+    33249, 33002, 32761, 32526, 32298, 32077, 31862, 31654, 31453, 31259, 31073, 30893, 30722, 30558, 30402, 30254,
+    30114, 29982, 29858, 29743, 29636, 29538, 29449, 29368, 29296, 29233, 29178, 29133, 29097, 29069, 29051, 29042,
+    29042, 29051, 29069, 29097, 29133, 29178, 29233, 29296, 29368, 29449, 29538, 29636, 29743, 29858, 29982, 30114,
+    30254, 30402, 30558, 30722, 30893, 31073, 31259, 31453, 31654, 31862, 32077, 32298, 32526, 32761, 33002, 33249,
+    33503, 33762, 34027, 34298, 34574, 34855, 35142, 35434, 35731, 36033, 36340, 36651, 36967, 37287, 37612, 37940,
+    38273, 38610, 38951, 39295, 39643, 39995, 40350, 40708, 41070, 41435, 41803, 42175, 42549, 42926, 43306, 43688,
+    44074, 44462, 44852, 45245, 45640, 46038, 46438, 46840, 47245, 47651, 48060, 48470, 48883, 49297, 49713, 50131,
+    50551, 50973, 51396, 51821, 52248, 52676, 53105, 53536, 53969, 54403, 54838, 55275, 55713, 56152, 56593, 57034,
+    57477, 57921, 58367, 58813, 59261, 59709, 60159, 60610, 61061, 61514, 61967, 62422, 62877, 63334, 63791, 64249,
+    64708, 65168, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65402, 64940, 64479,
+    64018, 63559, 63100, 62642, 62184, 61728, 61273, 60818, 60365, 59912, 59461, 59010, 58561, 58113, 57665, 57219,
+    56774, 56331, 55888, 55447, 55006, 54568, 54130, 53694, 53259, 52826, 52394, 51964, 51535, 51107, 50682, 50258,
+    49835, 49415, 48996, 48579, 48164, 47751, 47340, 46930, 46523, 46118, 45716, 45315, 44917, 44521, 44128, 43737,
+    43349, 42963, 42580, 42200, 41822, 41448, 41077, 40708, 40343, 39981, 39623, 39268, 38917, 38569, 38225, 37885,
+    37548, 37216, 36888, 36565, 36245, 35930, 35620, 35315, 35014, 34719, 34428, 34143, 33864, 33589, 33321, 33058,
+    32801, 32551, 32306, 32068, 31837, 31612, 31394, 31183, 30979, 30782, 30593, 30411, 30237, 30070, 29912, 29761,
+    29619, 29485, 29359, 29242, 29133, 29033, 28942, 28860, 28786, 28722, 28667, 28621, 28584, 28556, 28537, 28528,
+    28528, 28537, 28556, 28584, 28621, 28667, 28722, 28786, 28860, 28942, 29033, 29133, 29242, 29359, 29485, 29619,
+    29761, 29912, 30070, 30237, 30411, 30593, 30782, 30979, 31183, 31394, 31612, 31837, 32068, 32306, 32551, 32801,
+    33058, 33321, 33589, 33864, 34143, 34428, 34719, 35014, 35315, 35620, 35930, 36245, 36565, 36888, 37216, 37548,
+    37885, 38225, 38569, 38917, 39268, 39623, 39981, 40343, 40708, 41077, 41448, 41822, 42200, 42580, 42963, 43349,
+    43737, 44128, 44521, 44917, 45315, 45716, 46118, 46523, 46930, 47340, 47751, 48164, 48579, 48996, 49415, 49835,
+    50258, 50682, 51107, 51535, 51964, 52394, 52826, 53259, 53694, 54130, 54568, 55006, 55447, 55888, 56331, 56774,
+    57219, 57665, 58113, 58561, 59010, 59461, 59912, 60365, 60818, 61273, 61728, 62184, 62642, 63100, 63559, 64018,
+    64479, 64940, 65402, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65180, 64716, 64253,
+    63791, 63330, 62869, 62409, 61950, 61492, 61035, 60579, 60124, 59669, 59216, 58764, 58312, 57862, 57413, 56965,
+    56518, 56072, 55627, 55184, 54742, 54301, 53861, 53423, 52986, 52550, 52116, 51683, 51252, 50822, 50394, 49968,
+    49543, 49120, 48699, 48279, 47861, 47446, 47032, 46620, 46210, 45802, 45397, 44993, 44592, 44194, 43797, 43403,
+    43012, 42623, 42237, 41854, 41473, 41096, 40721, 40350, 39981, 39616, 39255, 38896, 38541, 38190, 37843, 37499,
+    37159, 36824, 36492, 36165, 35842, 35524, 35210, 34901, 34597, 34298, 34004, 33715, 33432, 33154, 32882, 32616,
+    32355, 32101, 31853, 31612, 31377, 31149, 30928, 30713, 30506, 30306, 30114, 29929, 29752, 29583, 29422, 29269,
+    29124, 28988, 28860, 28740, 28630, 28528, 28435, 28352, 28277, 28212, 28155, 28108, 28071, 28042, 28024, 28014,
+    28014, 28024, 28042, 28071, 28108, 28155, 28212, 28277, 28352, 28435, 28528, 28630, 28740, 28860, 28988, 29124,
+    29269, 29422, 29583, 29752, 29929, 30114, 30306, 30506, 30713, 30928, 31149, 31377, 31612, 31853, 32101, 32355,
+    32616, 32882, 33154, 33432, 33715, 34004, 34298, 34597, 34901, 35210, 35524, 35842, 36165, 36492, 36824, 37159,
+    37499, 37843, 38190, 38541, 38896, 39255, 39616, 39981, 40350, 40721, 41096, 41473, 41854, 42237, 42623, 43012,
+    43403, 43797, 44194, 44592, 44993, 45397, 45802, 46210, 46620, 47032, 47446, 47861, 48279, 48699, 49120, 49543,
+    49968, 50394, 50822, 51252, 51683, 52116, 52550, 52986, 53423, 53861, 54301, 54742, 55184, 55627, 56072, 56518,
+    56965, 57413, 57862, 58312, 58764, 59216, 59669, 60124, 60579, 61035, 61492, 61950, 62409, 62869, 63330, 63791,
+    64253, 64716, 65180, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65427, 64961, 64495, 64031,
+    63567, 63104, 62642, 62180, 61720, 61260, 60801, 60343, 59886, 59430, 58975, 58520, 58067, 57615, 57164, 56714,
+    56265, 55817, 55370, 54925, 54480, 54037, 53595, 53155, 52716, 52278, 51841, 51406, 50973, 50541, 50110, 49682,
+    49254, 48829, 48405, 47983, 47562, 47144, 46727, 46313, 45900, 45490, 45081, 44675, 44271, 43870, 43470, 43073,
+    42679, 42287, 41898, 41512, 41128, 40747, 40369, 39995, 39623, 39255, 38889, 38528, 38169, 37815, 37464, 37117,
+    36773, 36434, 36099, 35768, 35442, 35120, 34802, 34490, 34182, 33879, 33582, 33289, 33002, 32721, 32445, 32175,
+    31911, 31654, 31402, 31157, 30919, 30688, 30463, 30245, 30035, 29832, 29636, 29449, 29269, 29097, 28933, 28777,
+    28630, 28491, 28361, 28240, 28127, 28024, 27929, 27844, 27768, 27701, 27644, 27596, 27558, 27529, 27510, 27500,
+    27500, 27510, 27529, 27558, 27596, 27644, 27701, 27768, 27844, 27929, 28024, 28127, 28240, 28361, 28491, 28630,
+    28777, 28933, 29097, 29269, 29449, 29636, 29832, 30035, 30245, 30463, 30688, 30919, 31157, 31402, 31654, 31911,
+    32175, 32445, 32721, 33002, 33289, 33582, 33879, 34182, 34490, 34802, 35120, 35442, 35768, 36099, 36434, 36773,
+    37117, 37464, 37815, 38169, 38528, 38889, 39255, 39623, 39995, 40369, 40747, 41128, 41512, 41898, 42287, 42679,
+    43073, 43470, 43870, 44271, 44675, 45081, 45490, 45900, 46313, 46727, 47144, 47562, 47983, 48405, 48829, 49254,
+    49682, 50110, 50541, 50973, 51406, 51841, 52278, 52716, 53155, 53595, 54037, 54480, 54925, 55370, 55817, 56265,
+    56714, 57164, 57615, 58067, 58520, 58975, 59430, 59886, 60343, 60801, 61260, 61720, 62180, 62642, 63104, 63567,
+    64031, 64495, 64961, 65427, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65212, 64745, 64278, 63812,
+    63346, 62882, 62418, 61955, 61492, 61031, 60570, 60111, 59652, 59194, 58737, 58281, 57826, 57371, 56918, 56466,
+    56015, 55566, 55117, 54669, 54223, 53778, 53334, 52891, 52449, 52009, 51571, 51133, 50697, 50263, 49830, 49399,
+    48969, 48541, 48115, 47690, 47267, 46846, 46427, 46009, 45594, 45181, 44770, 44361, 43954, 43549, 43147, 42747,
+    42350, 41955, 41563, 41173, 40786, 40402, 40021, 39643, 39268, 38896, 38528, 38163, 37801, 37443, 37088, 36738,
+    36391, 36048, 35709, 35375, 35044, 34719, 34398, 34081, 33770, 33463, 33162, 32866, 32575, 32290, 32011, 31737,
+    31470, 31208, 30953, 30705, 30463, 30228, 30000, 29779, 29565, 29359, 29160, 28969, 28786, 28611, 28445, 28286,
+    28137, 27995, 27863, 27739, 27625, 27519, 27423, 27336, 27259, 27191, 27133, 27084, 27045, 27016, 26996, 26986,
+    26986, 26996, 27016, 27045, 27084, 27133, 27191, 27259, 27336, 27423, 27519, 27625, 27739, 27863, 27995, 28137,
+    28286, 28445, 28611, 28786, 28969, 29160, 29359, 29565, 29779, 30000, 30228, 30463, 30705, 30953, 31208, 31470,
+    31737, 32011, 32290, 32575, 32866, 33162, 33463, 33770, 34081, 34398, 34719, 35044, 35375, 35709, 36048, 36391,
+    36738, 37088, 37443, 37801, 38163, 38528, 38896, 39268, 39643, 40021, 40402, 40786, 41173, 41563, 41955, 42350,
+    42747, 43147, 43549, 43954, 44361, 44770, 45181, 45594, 46009, 46427, 46846, 47267, 47690, 48115, 48541, 48969,
+    49399, 49830, 50263, 50697, 51133, 51571, 52009, 52449, 52891, 53334, 53778, 54223, 54669, 55117, 55566, 56015,
+    56466, 56918, 57371, 57826, 58281, 58737, 59194, 59652, 60111, 60570, 61031, 61492, 61955, 62418, 62882, 63346,
+    63812, 64278, 64745, 65212, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65471, 65001, 64532, 64064, 63596,
+    63129, 62663, 62197, 61732, 61269, 60805, 60343, 59882, 59421, 58961, 58502, 58044, 57588, 57132, 56677, 56223,
+    55770, 55318, 54867, 54417, 53969, 53521, 53075, 52630, 52187, 51745, 51304, 50864, 50426, 49989, 49554, 49120,
+    48688, 48257, 47828, 47401, 46975, 46552, 46130, 45710, 45292, 44876, 44462, 44050, 43640, 43233, 42827, 42424,
+    42024, 41626, 41231, 40838, 40448, 40061, 39676, 39295, 38917, 38541, 38169, 37801, 37436, 37074, 36716, 36362,
+    36011, 35665, 35322, 34984, 34650, 34321, 33996, 33676, 33361, 33050, 32745, 32445, 32151, 31862, 31579, 31301,
+    31030, 30765, 30506, 30254, 30009, 29770, 29538, 29314, 29097, 28887, 28685, 28491, 28305, 28127, 27958, 27796,
+    27644, 27500, 27365, 27240, 27123, 27016, 26918, 26829, 26750, 26681, 26622, 26572, 26532, 26502, 26482, 26472,
+    26472, 26482, 26502, 26532, 26572, 26622, 26681, 26750, 26829, 26918, 27016, 27123, 27240, 27365, 27500, 27644,
+    27796, 27958, 28127, 28305, 28491, 28685, 28887, 29097, 29314, 29538, 29770, 30009, 30254, 30506, 30765, 31030,
+    31301, 31579, 31862, 32151, 32445, 32745, 33050, 33361, 33676, 33996, 34321, 34650, 34984, 35322, 35665, 36011,
+    36362, 36716, 37074, 37436, 37801, 38169, 38541, 38917, 39295, 39676, 40061, 40448, 40838, 41231, 41626, 42024,
+    42424, 42827, 43233, 43640, 44050, 44462, 44876, 45292, 45710, 46130, 46552, 46975, 47401, 47828, 48257, 48688,
+    49120, 49554, 49989, 50426, 50864, 51304, 51745, 52187, 52630, 53075, 53521, 53969, 54417, 54867, 55318, 55770,
+    56223, 56677, 57132, 57588, 58044, 58502, 58961, 59421, 59882, 60343, 60805, 61269, 61732, 62197, 62663, 63129,
+    63596, 64064, 64532, 65001, 65471, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65265, 64794, 64323, 63853, 63384,
+    62915, 62447, 61980, 61514, 61048, 60583, 60119, 59656, 59194, 58732, 58272, 57812, 57353, 56895, 56438, 55982,
+    55527, 55074, 54621, 54169, 53719, 53269, 52821, 52374, 51928, 51483, 51040, 50598, 50158, 49719, 49281, 48845,
+    48410, 47977, 47546, 47116, 46688, 46261, 45837, 45414, 44993, 44575, 44158, 43743, 43330, 42920, 42512, 42106,
+    41702, 41301, 40903, 40507, 40113, 39723, 39335, 38951, 38569, 38190, 37815, 37443, 37074, 36709, 36347, 35989,
+    35635, 35285, 34939, 34597, 34259, 33926, 33597, 33273, 32954, 32640, 32331, 32027, 31729, 31436, 31149, 30868,
+    30593, 30324, 30061, 29805, 29556, 29314, 29079, 28850, 28630, 28417, 28212, 28014, 27825, 27644, 27471, 27307,
+    27152, 27006, 26868, 26740, 26622, 26512, 26412, 26322, 26242, 26171, 26110, 26060, 26019, 25989, 25968, 25958,
+    25958, 25968, 25989, 26019, 26060, 26110, 26171, 26242, 26322, 26412, 26512, 26622, 26740, 26868, 27006, 27152,
+    27307, 27471, 27644, 27825, 28014, 28212, 28417, 28630, 28850, 29079, 29314, 29556, 29805, 30061, 30324, 30593,
+    30868, 31149, 31436, 31729, 32027, 32331, 32640, 32954, 33273, 33597, 33926, 34259, 34597, 34939, 35285, 35635,
+    35989, 36347, 36709, 37074, 37443, 37815, 38190, 38569, 38951, 39335, 39723, 40113, 40507, 40903, 41301, 41702,
+    42106, 42512, 42920, 43330, 43743, 44158, 44575, 44993, 45414, 45837, 46261, 46688, 47116, 47546, 47977, 48410,
+    48845, 49281, 49719, 50158, 50598, 51040, 51483, 51928, 52374, 52821, 53269, 53719, 54169, 54621, 55074, 55527,
+    55982, 56438, 56895, 57353, 57812, 58272, 58732, 59194, 59656, 60119, 60583, 61048, 61514, 61980, 62447, 62915,
+    63384, 63853, 64323, 64794, 65265, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65062, 64589, 64117, 63646, 63175,
+    62705, 62235, 61767, 61299, 60831, 60365, 59899, 59434, 58970, 58507, 58044, 57583, 57122, 56663, 56204, 55746,
+    55289, 54833, 54378, 53925, 53472, 53021, 52570, 52121, 51673, 51226, 50781, 50337, 49894, 49452, 49012, 48574,
+    48137, 47701, 47267, 46835, 46404, 45975, 45548, 45122, 44699, 44277, 43857, 43440, 43024, 42611, 42200, 41791,
+    41384, 40980, 40578, 40179, 39783, 39389, 38998, 38610, 38225, 37843, 37464, 37088, 36716, 36347, 35982, 35620,
+    35262, 34909, 34559, 34213, 33871, 33534, 33202, 32874, 32551, 32233, 31920, 31612, 31310, 31013, 30722, 30437,
+    30158, 29885, 29619, 29359, 29106, 28860, 28621, 28389, 28165, 27948, 27739, 27539, 27346, 27162, 26986, 26819,
+    26661, 26512, 26372, 26242, 26121, 26009, 25907, 25815, 25733, 25661, 25600, 25548, 25507, 25475, 25455, 25444,
+    25444, 25455, 25475, 25507, 25548, 25600, 25661, 25733, 25815, 25907, 26009, 26121, 26242, 26372, 26512, 26661,
+    26819, 26986, 27162, 27346, 27539, 27739, 27948, 28165, 28389, 28621, 28860, 29106, 29359, 29619, 29885, 30158,
+    30437, 30722, 31013, 31310, 31612, 31920, 32233, 32551, 32874, 33202, 33534, 33871, 34213, 34559, 34909, 35262,
+    35620, 35982, 36347, 36716, 37088, 37464, 37843, 38225, 38610, 38998, 39389, 39783, 40179, 40578, 40980, 41384,
+    41791, 42200, 42611, 43024, 43440, 43857, 44277, 44699, 45122, 45548, 45975, 46404, 46835, 47267, 47701, 48137,
+    48574, 49012, 49452, 49894, 50337, 50781, 51226, 51673, 52121, 52570, 53021, 53472, 53925, 54378, 54833, 55289,
+    55746, 56204, 56663, 57122, 57583, 58044, 58507, 58970, 59434, 59899, 60365, 60831, 61299, 61767, 62235, 62705,
+    63175, 63646, 64117, 64589, 65062, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65338, 64863, 64389, 63915, 63442, 62970,
+    62498, 62027, 61557, 61087, 60618, 60150, 59683, 59216, 58750, 58285, 57821, 57358, 56895, 56434, 55973, 55513,
+    55054, 54597, 54140, 53684, 53229, 52776, 52323, 51872, 51422, 50973, 50525, 50079, 49634, 49190, 48747, 48306,
+    47867, 47429, 46992, 46557, 46124, 45693, 45263, 44835, 44408, 43984, 43561, 43141, 42722, 42306, 41892, 41480,
+    41070, 40663, 40258, 39856, 39456, 39059, 38665, 38273, 37885, 37499, 37117, 36738, 36362, 35989, 35620, 35255,
+    34893, 34536, 34182, 33832, 33487, 33146, 32810, 32478, 32151, 31829, 31512, 31200, 30893, 30593, 30298, 30009,
+    29725, 29449, 29178, 28915, 28658, 28408, 28165, 27929, 27701, 27481, 27269, 27064, 26868, 26681, 26502, 26332,
+    26171, 26019, 25877, 25744, 25620, 25507, 25403, 25309, 25225, 25152, 25089, 25036, 24994, 24962, 24941, 24930,
+    24930, 24941, 24962, 24994, 25036, 25089, 25152, 25225, 25309, 25403, 25507, 25620, 25744, 25877, 26019, 26171,
+    26332, 26502, 26681, 26868, 27064, 27269, 27481, 27701, 27929, 28165, 28408, 28658, 28915, 29178, 29449, 29725,
+    30009, 30298, 30593, 30893, 31200, 31512, 31829, 32151, 32478, 32810, 33146, 33487, 33832, 34182, 34536, 34893,
+    35255, 35620, 35989, 36362, 36738, 37117, 37499, 37885, 38273, 38665, 39059, 39456, 39856, 40258, 40663, 41070,
+    41480, 41892, 42306, 42722, 43141, 43561, 43984, 44408, 44835, 45263, 45693, 46124, 46557, 46992, 47429, 47867,
+    48306, 48747, 49190, 49634, 50079, 50525, 50973, 51422, 51872, 52323, 52776, 53229, 53684, 54140, 54597, 55054,
+    55513, 55973, 56434, 56895, 57358, 57821, 58285, 58750, 59216, 59683, 60150, 60618, 61087, 61557, 62027, 62498,
+    62970, 63442, 63915, 64389, 64863, 65338, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65143, 64667, 64191, 63716, 63242, 62768,
+    62295, 61822, 61350, 60879, 60409, 59939, 59470, 59002, 58534, 58067, 57601, 57136, 56672, 56208, 55746, 55284,
+    54824, 54364, 53905, 53447, 52991, 52535, 52080, 51627, 51175, 50723, 50274, 49825, 49377, 48931, 48487, 48043,
+    47601, 47161, 46722, 46284, 45848, 45414, 44982, 44551, 44122, 43695, 43269, 42846, 42424, 42005, 41588, 41173,
+    40760, 40350, 39942, 39536, 39133, 38733, 38335, 37940, 37548, 37159, 36773, 36391, 36011, 35635, 35262, 34893,
+    34528, 34167, 33809, 33455, 33106, 32761, 32421, 32085, 31754, 31428, 31107, 30791, 30480, 30175, 29876, 29583,
+    29296, 29015, 28740, 28473, 28212, 27958, 27711, 27471, 27240, 27016, 26800, 26592, 26392, 26201, 26019, 25846,
+    25682, 25527, 25382, 25246, 25120, 25004, 24899, 24803, 24717, 24643, 24578, 24524, 24481, 24449, 24427, 24416,
+    24416, 24427, 24449, 24481, 24524, 24578, 24643, 24717, 24803, 24899, 25004, 25120, 25246, 25382, 25527, 25682,
+    25846, 26019, 26201, 26392, 26592, 26800, 27016, 27240, 27471, 27711, 27958, 28212, 28473, 28740, 29015, 29296,
+    29583, 29876, 30175, 30480, 30791, 31107, 31428, 31754, 32085, 32421, 32761, 33106, 33455, 33809, 34167, 34528,
+    34893, 35262, 35635, 36011, 36391, 36773, 37159, 37548, 37940, 38335, 38733, 39133, 39536, 39942, 40350, 40760,
+    41173, 41588, 42005, 42424, 42846, 43269, 43695, 44122, 44551, 44982, 45414, 45848, 46284, 46722, 47161, 47601,
+    48043, 48487, 48931, 49377, 49825, 50274, 50723, 51175, 51627, 52080, 52535, 52991, 53447, 53905, 54364, 54824,
+    55284, 55746, 56208, 56672, 57136, 57601, 58067, 58534, 59002, 59470, 59939, 60409, 60879, 61350, 61822, 62295,
+    62768, 63242, 63716, 64191, 64667, 65143, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65431, 64952, 64475, 63998, 63521, 63045, 62570,
+    62095, 61621, 61148, 60675, 60203, 59731, 59261, 58791, 58321, 57853, 57385, 56918, 56452, 55987, 55523, 55059,
+    54597, 54135, 53674, 53215, 52756, 52298, 51841, 51386, 50931, 50478, 50026, 49575, 49125, 48677, 48230, 47784,
+    47340, 46897, 46455, 46015, 45577, 45140, 44705, 44271, 43839, 43409, 42981, 42555, 42131, 41708, 41288, 40870,
+    40454, 40041, 39630, 39221, 38815, 38411, 38010, 37612, 37216, 36824, 36434, 36048, 35665, 35285, 34909, 34536,
+    34167, 33801, 33440, 33082, 32729, 32380, 32035, 31696, 31360, 31030, 30705, 30385, 30070, 29761, 29458, 29160,
+    28869, 28584, 28305, 28033, 27768, 27510, 27259, 27016, 26780, 26552, 26332, 26121, 25918, 25723, 25538, 25361,
+    25194, 25036, 24888, 24750, 24621, 24503, 24395, 24297, 24210, 24133, 24068, 24013, 23969, 23936, 23913, 23902,
+    23902, 23913, 23936, 23969, 24013, 24068, 24133, 24210, 24297, 24395, 24503, 24621, 24750, 24888, 25036, 25194,
+    25361, 25538, 25723, 25918, 26121, 26332, 26552, 26780, 27016, 27259, 27510, 27768, 28033, 28305, 28584, 28869,
+    29160, 29458, 29761, 30070, 30385, 30705, 31030, 31360, 31696, 32035, 32380, 32729, 33082, 33440, 33801, 34167,
+    34536, 34909, 35285, 35665, 36048, 36434, 36824, 37216, 37612, 38010, 38411, 38815, 39221, 39630, 40041, 40454,
+    40870, 41288, 41708, 42131, 42555, 42981, 43409, 43839, 44271, 44705, 45140, 45577, 46015, 46455, 46897, 47340,
+    47784, 48230, 48677, 49125, 49575, 50026, 50478, 50931, 51386, 51841, 52298, 52756, 53215, 53674, 54135, 54597,
+    55059, 55523, 55987, 56452, 56918, 57385, 57853, 58321, 58791, 59261, 59731, 60203, 60675, 61148, 61621, 62095,
+    62570, 63045, 63521, 63998, 64475, 64952, 65431, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65245, 64765, 64286, 63807, 63330, 62852, 62375,
+    61899, 61424, 60949, 60474, 60001, 59528, 59055, 58584, 58113, 57643, 57173, 56704, 56237, 55770, 55303, 54838,
+    54374, 53910, 53447, 52986, 52525, 52065, 51606, 51149, 50692, 50237, 49782, 49329, 48877, 48427, 47977, 47529,
+    47082, 46637, 46193, 45750, 45309, 44870, 44432, 43996, 43561, 43129, 42698, 42268, 41841, 41416, 40993, 40572,
+    40153, 39736, 39322, 38910, 38500, 38093, 37689, 37287, 36888, 36492, 36099, 35709, 35322, 34939, 34559, 34182,
+    33809, 33440, 33074, 32713, 32355, 32002, 31654, 31310, 30970, 30636, 30306, 29982, 29663, 29350, 29042, 28740,
+    28445, 28155, 27872, 27596, 27327, 27064, 26809, 26562, 26322, 26090, 25867, 25651, 25444, 25246, 25057, 24877,
+    24707, 24546, 24395, 24254, 24122, 24002, 23891, 23792, 23703, 23624, 23557, 23501, 23456, 23422, 23400, 23388,
+    23388, 23400, 23422, 23456, 23501, 23557, 23624, 23703, 23792, 23891, 24002, 24122, 24254, 24395, 24546, 24707,
+    24877, 25057, 25246, 25444, 25651, 25867, 26090, 26322, 26562, 26809, 27064, 27327, 27596, 27872, 28155, 28445,
+    28740, 29042, 29350, 29663, 29982, 30306, 30636, 30970, 31310, 31654, 32002, 32355, 32713, 33074, 33440, 33809,
+    34182, 34559, 34939, 35322, 35709, 36099, 36492, 36888, 37287, 37689, 38093, 38500, 38910, 39322, 39736, 40153,
+    40572, 40993, 41416, 41841, 42268, 42698, 43129, 43561, 43996, 44432, 44870, 45309, 45750, 46193, 46637, 47082,
+    47529, 47977, 48427, 48877, 49329, 49782, 50237, 50692, 51149, 51606, 52065, 52525, 52986, 53447, 53910, 54374,
+    54838, 55303, 55770, 56237, 56704, 57173, 57643, 58113, 58584, 59055, 59528, 60001, 60474, 60949, 61424, 61899,
+    62375, 62852, 63330, 63807, 64286, 64765, 65245, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65062, 64581, 64101, 63621, 63142, 62663, 62184,
+    61707, 61230, 60753, 60277, 59802, 59327, 58854, 58380, 57908, 57436, 56965, 56494, 56025, 55556, 55088, 54621,
+    54154, 53689, 53224, 52761, 52298, 51836, 51376, 50916, 50457, 50000, 49543, 49088, 48633, 48180, 47729, 47278,
+    46829, 46381, 45935, 45490, 45046, 44604, 44164, 43725, 43288, 42852, 42418, 41986, 41556, 41128, 40702, 40278,
+    39856, 39436, 39018, 38603, 38190, 37780, 37372, 36967, 36565, 36165, 35768, 35375, 34984, 34597, 34213, 33832,
+    33455, 33082, 32713, 32347, 31986, 31629, 31276, 30928, 30584, 30245, 29912, 29583, 29260, 28942, 28630, 28324,
+    28024, 27730, 27443, 27162, 26888, 26622, 26362, 26110, 25867, 25631, 25403, 25183, 24973, 24771, 24578, 24395,
+    24221, 24057, 23902, 23758, 23624, 23501, 23388, 23287, 23196, 23116, 23047, 22990, 22944, 22909, 22886, 22874,
+    22874, 22886, 22909, 22944, 22990, 23047, 23116, 23196, 23287, 23388, 23501, 23624, 23758, 23902, 24057, 24221,
+    24395, 24578, 24771, 24973, 25183, 25403, 25631, 25867, 26110, 26362, 26622, 26888, 27162, 27443, 27730, 28024,
+    28324, 28630, 28942, 29260, 29583, 29912, 30245, 30584, 30928, 31276, 31629, 31986, 32347, 32713, 33082, 33455,
+    33832, 34213, 34597, 34984, 35375, 35768, 36165, 36565, 36967, 37372, 37780, 38190, 38603, 39018, 39436, 39856,
+    40278, 40702, 41128, 41556, 41986, 42418, 42852, 43288, 43725, 44164, 44604, 45046, 45490, 45935, 46381, 46829,
+    47278, 47729, 48180, 48633, 49088, 49543, 50000, 50457, 50916, 51376, 51836, 52298, 52761, 53224, 53689, 54154,
+    54621, 55088, 55556, 56025, 56494, 56965, 57436, 57908, 58380, 58854, 59327, 59802, 60277, 60753, 61230, 61707,
+    62184, 62663, 63142, 63621, 64101, 64581, 65062, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65366, 64883, 64401, 63919, 63438, 62957, 62477, 61997,
+    61518, 61040, 60562, 60084, 59607, 59131, 58656, 58181, 57707, 57233, 56760, 56288, 55817, 55346, 54877, 54408,
+    53939, 53472, 53006, 52540, 52075, 51612, 51149, 50687, 50226, 49767, 49308, 48850, 48394, 47939, 47485, 47032,
+    46580, 46130, 45681, 45233, 44787, 44343, 43900, 43458, 43018, 42580, 42143, 41708, 41276, 40844, 40415, 39988,
+    39563, 39140, 38719, 38301, 37885, 37471, 37060, 36651, 36245, 35842, 35442, 35044, 34650, 34259, 33871, 33487,
+    33106, 32729, 32355, 31986, 31620, 31259, 30902, 30550, 30202, 29858, 29520, 29187, 28860, 28537, 28221, 27910,
+    27606, 27307, 27016, 26730, 26452, 26181, 25918, 25661, 25413, 25173, 24941, 24717, 24503, 24297, 24101, 23913,
+    23736, 23568, 23411, 23264, 23127, 23001, 22886, 22782, 22689, 22607, 22537, 22478, 22431, 22396, 22372, 22360,
+    22360, 22372, 22396, 22431, 22478, 22537, 22607, 22689, 22782, 22886, 23001, 23127, 23264, 23411, 23568, 23736,
+    23913, 24101, 24297, 24503, 24717, 24941, 25173, 25413, 25661, 25918, 26181, 26452, 26730, 27016, 27307, 27606,
+    27910, 28221, 28537, 28860, 29187, 29520, 29858, 30202, 30550, 30902, 31259, 31620, 31986, 32355, 32729, 33106,
+    33487, 33871, 34259, 34650, 35044, 35442, 35842, 36245, 36651, 37060, 37471, 37885, 38301, 38719, 39140, 39563,
+    39988, 40415, 40844, 41276, 41708, 42143, 42580, 43018, 43458, 43900, 44343, 44787, 45233, 45681, 46130, 46580,
+    47032, 47485, 47939, 48394, 48850, 49308, 49767, 50226, 50687, 51149, 51612, 52075, 52540, 53006, 53472, 53939,
+    54408, 54877, 55346, 55817, 56288, 56760, 57233, 57707, 58181, 58656, 59131, 59607, 60084, 60562, 61040, 61518,
+    61997, 62477, 62957, 63438, 63919, 64401, 64883, 65366, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65192, 64708, 64224, 63741, 63259, 62776, 62295, 61814,
+    61333, 60853, 60374, 59895, 59416, 58939, 58462, 57985, 57509, 57034, 56560, 56086, 55613, 55141, 54669, 54198,
+    53728, 53259, 52791, 52323, 51857, 51391, 50926, 50462, 50000, 49538, 49077, 48617, 48159, 47701, 47245, 46790,
+    46336, 45883, 45432, 44982, 44533, 44086, 43640, 43196, 42753, 42312, 41873, 41435, 40999, 40565, 40133, 39703,
+    39275, 38849, 38425, 38003, 37584, 37167, 36752, 36340, 35930, 35524, 35120, 34719, 34321, 33926, 33534, 33146,
+    32761, 32380, 32002, 31629, 31259, 30893, 30532, 30175, 29823, 29476, 29133, 28795, 28463, 28137, 27815, 27500,
+    27191, 26888, 26592, 26302, 26019, 25744, 25475, 25215, 24962, 24717, 24481, 24254, 24035, 23825, 23624, 23434,
+    23252, 23081, 22921, 22770, 22631, 22502, 22384, 22278, 22183, 22099, 22027, 21967, 21919, 21883, 21859, 21847,
+    21847, 21859, 21883, 21919, 21967, 22027, 22099, 22183, 22278, 22384, 22502, 22631, 22770, 22921, 23081, 23252,
+    23434, 23624, 23825, 24035, 24254, 24481, 24717, 24962, 25215, 25475, 25744, 26019, 26302, 26592, 26888, 27191,
+    27500, 27815, 28137, 28463, 28795, 29133, 29476, 29823, 30175, 30532, 30893, 31259, 31629, 32002, 32380, 32761,
+    33146, 33534, 33926, 34321, 34719, 35120, 35524, 35930, 36340, 36752, 37167, 37584, 38003, 38425, 38849, 39275,
+    39703, 40133, 40565, 40999, 41435, 41873, 42312, 42753, 43196, 43640, 44086, 44533, 44982, 45432, 45883, 46336,
+    46790, 47245, 47701, 48159, 48617, 49077, 49538, 50000, 50462, 50926, 51391, 51857, 52323, 52791, 53259, 53728,
+    54198, 54669, 55141, 55613, 56086, 56560, 57034, 57509, 57985, 58462, 58939, 59416, 59895, 60374, 60853, 61333,
+    61814, 62295, 62776, 63259, 63741, 64224, 64708, 65192, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65507, 65022, 64536, 64051, 63567, 63083, 62599, 62116, 61634,
+    61152, 60671, 60190, 59709, 59229, 58750, 58272, 57794, 57316, 56839, 56363, 55888, 55413, 54939, 54466, 53993,
+    53521, 53050, 52580, 52111, 51642, 51175, 50708, 50242, 49777, 49313, 48850, 48388, 47928, 47468, 47009, 46552,
+    46096, 45640, 45187, 44734, 44283, 43833, 43385, 42938, 42493, 42049, 41607, 41167, 40728, 40291, 39856, 39422,
+    38991, 38562, 38135, 37710, 37287, 36867, 36449, 36033, 35620, 35210, 34802, 34398, 33996, 33597, 33202, 32810,
+    32421, 32035, 31654, 31276, 30902, 30532, 30167, 29805, 29449, 29097, 28750, 28408, 28071, 27739, 27414, 27094,
+    26780, 26472, 26171, 25877, 25589, 25309, 25036, 24771, 24514, 24264, 24024, 23792, 23568, 23355, 23150, 22955,
+    22770, 22596, 22431, 22278, 22135, 22003, 21883, 21774, 21677, 21591, 21518, 21456, 21407, 21370, 21345, 21333,
+    21333, 21345, 21370, 21407, 21456, 21518, 21591, 21677, 21774, 21883, 22003, 22135, 22278, 22431, 22596, 22770,
+    22955, 23150, 23355, 23568, 23792, 24024, 24264, 24514, 24771, 25036, 25309, 25589, 25877, 26171, 26472, 26780,
+    27094, 27414, 27739, 28071, 28408, 28750, 29097, 29449, 29805, 30167, 30532, 30902, 31276, 31654, 32035, 32421,
+    32810, 33202, 33597, 33996, 34398, 34802, 35210, 35620, 36033, 36449, 36867, 37287, 37710, 38135, 38562, 38991,
+    39422, 39856, 40291, 40728, 41167, 41607, 42049, 42493, 42938, 43385, 43833, 44283, 44734, 45187, 45640, 46096,
+    46552, 47009, 47468, 47928, 48388, 48850, 49313, 49777, 50242, 50708, 51175, 51642, 52111, 52580, 53050, 53521,
+    53993, 54466, 54939, 55413, 55888, 56363, 56839, 57316, 57794, 58272, 58750, 59229, 59709, 60190, 60671, 61152,
+    61634, 62116, 62599, 63083, 63567, 64051, 64536, 65022, 65507, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65342, 64855, 64368, 63882, 63396, 62911, 62426, 61942, 61458,
+    60975, 60492, 60009, 59528, 59046, 58566, 58085, 57606, 57127, 56649, 56171, 55694, 55217, 54742, 54267, 53792,
+    53319, 52846, 52374, 51903, 51432, 50963, 50494, 50026, 49559, 49093, 48628, 48164, 47701, 47239, 46778, 46319,
+    45860, 45403, 44946, 44491, 44038, 43586, 43135, 42685, 42237, 41791, 41346, 40903, 40461, 40021, 39583, 39147,
+    38712, 38280, 37850, 37422, 36996, 36572, 36150, 35731, 35315, 34901, 34490, 34081, 33676, 33273, 32874, 32478,
+    32085, 31696, 31310, 30928, 30550, 30175, 29805, 29440, 29079, 28722, 28370, 28024, 27682, 27346, 27016, 26691,
+    26372, 26060, 25754, 25455, 25162, 24877, 24600, 24330, 24068, 23814, 23568, 23332, 23104, 22886, 22677, 22478,
+    22289, 22111, 21943, 21786, 21640, 21505, 21382, 21271, 21171, 21083, 21008, 20945, 20895, 20857, 20831, 20819,
+    20819, 20831, 20857, 20895, 20945, 21008, 21083, 21171, 21271, 21382, 21505, 21640, 21786, 21943, 22111, 22289,
+    22478, 22677, 22886, 23104, 23332, 23568, 23814, 24068, 24330, 24600, 24877, 25162, 25455, 25754, 26060, 26372,
+    26691, 27016, 27346, 27682, 28024, 28370, 28722, 29079, 29440, 29805, 30175, 30550, 30928, 31310, 31696, 32085,
+    32478, 32874, 33273, 33676, 34081, 34490, 34901, 35315, 35731, 36150, 36572, 36996, 37422, 37850, 38280, 38712,
+    39147, 39583, 40021, 40461, 40903, 41346, 41791, 42237, 42685, 43135, 43586, 44038, 44491, 44946, 45403, 45860,
+    46319, 46778, 47239, 47701, 48164, 48628, 49093, 49559, 50026, 50494, 50963, 51432, 51903, 52374, 52846, 53319,
+    53792, 54267, 54742, 55217, 55694, 56171, 56649, 57127, 57606, 58085, 58566, 59046, 59528, 60009, 60492, 60975,
+    61458, 61942, 62426, 62911, 63396, 63882, 64368, 64855, 65342, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65180, 64692, 64204, 63716, 63229, 62743, 62257, 61771, 61286,
+    60801, 60317, 59833, 59350, 58867, 58385, 57903, 57422, 56942, 56462, 55982, 55504, 55026, 54548, 54071, 53595,
+    53120, 52645, 52172, 51699, 51226, 50755, 50284, 49814, 49345, 48877, 48410, 47944, 47479, 47015, 46552, 46090,
+    45629, 45169, 44711, 44253, 43797, 43342, 42889, 42437, 41986, 41537, 41089, 40643, 40199, 39756, 39315, 38876,
+    38438, 38003, 37569, 37138, 36709, 36282, 35857, 35434, 35014, 34597, 34182, 33770, 33361, 32954, 32551, 32151,
+    31754, 31360, 30970, 30584, 30202, 29823, 29449, 29079, 28713, 28352, 27995, 27644, 27298, 26957, 26622, 26292,
+    25968, 25651, 25340, 25036, 24739, 24449, 24166, 23891, 23624, 23366, 23116, 22874, 22642, 22419, 22206, 22003,
+    21810, 21628, 21456, 21295, 21146, 21008, 20882, 20768, 20666, 20576, 20499, 20434, 20383, 20344, 20318, 20305,
+    20305, 20318, 20344, 20383, 20434, 20499, 20576, 20666, 20768, 20882, 21008, 21146, 21295, 21456, 21628, 21810,
+    22003, 22206, 22419, 22642, 22874, 23116, 23366, 23624, 23891, 24166, 24449, 24739, 25036, 25340, 25651, 25968,
+    26292, 26622, 26957, 27298, 27644, 27995, 28352, 28713, 29079, 29449, 29823, 30202, 30584, 30970, 31360, 31754,
+    32151, 32551, 32954, 33361, 33770, 34182, 34597, 35014, 35434, 35857, 36282, 36709, 37138, 37569, 38003, 38438,
+    38876, 39315, 39756, 40199, 40643, 41089, 41537, 41986, 42437, 42889, 43342, 43797, 44253, 44711, 45169, 45629,
+    46090, 46552, 47015, 47479, 47944, 48410, 48877, 49345, 49814, 50284, 50755, 51226, 51699, 52172, 52645, 53120,
+    53595, 54071, 54548, 55026, 55504, 55982, 56462, 56942, 57422, 57903, 58385, 58867, 59350, 59833, 60317, 60801,
+    61286, 61771, 62257, 62743, 63229, 63716, 64204, 64692, 65180, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65511, 65022, 64532, 64043, 63554, 63066, 62578, 62091, 61604, 61117,
+    60631, 60146, 59661, 59176, 58692, 58208, 57725, 57242, 56760, 56279, 55798, 55318, 54838, 54359, 53881, 53403,
+    52926, 52449, 51974, 51499, 51025, 50551, 50079, 49607, 49136, 48666, 48197, 47729, 47261, 46795, 46330, 45866,
+    45403, 44940, 44480, 44020, 43561, 43104, 42648, 42193, 41740, 41288, 40838, 40389, 39942, 39496, 39052, 38610,
+    38169, 37731, 37294, 36860, 36427, 35997, 35568, 35142, 34719, 34298, 33879, 33463, 33050, 32640, 32233, 31829,
+    31428, 31030, 30636, 30245, 29858, 29476, 29097, 28722, 28352, 27986, 27625, 27269, 26918, 26572, 26232, 25897,
+    25569, 25246, 24930, 24621, 24319, 24024, 23736, 23456, 23184, 22921, 22666, 22419, 22183, 21955, 21737, 21530,
+    21333, 21146, 20970, 20806, 20653, 20512, 20383, 20266, 20161, 20069, 19990, 19924, 19871, 19831, 19804, 19791,
+    19791, 19804, 19831, 19871, 19924, 19990, 20069, 20161, 20266, 20383, 20512, 20653, 20806, 20970, 21146, 21333,
+    21530, 21737, 21955, 22183, 22419, 22666, 22921, 23184, 23456, 23736, 24024, 24319, 24621, 24930, 25246, 25569,
+    25897, 26232, 26572, 26918, 27269, 27625, 27986, 28352, 28722, 29097, 29476, 29858, 30245, 30636, 31030, 31428,
+    31829, 32233, 32640, 33050, 33463, 33879, 34298, 34719, 35142, 35568, 35997, 36427, 36860, 37294, 37731, 38169,
+    38610, 39052, 39496, 39942, 40389, 40838, 41288, 41740, 42193, 42648, 43104, 43561, 44020, 44480, 44940, 45403,
+    45866, 46330, 46795, 47261, 47729, 48197, 48666, 49136, 49607, 50079, 50551, 51025, 51499, 51974, 52449, 52926,
+    53403, 53881, 54359, 54838, 55318, 55798, 56279, 56760, 57242, 57725, 58208, 58692, 59176, 59661, 60146, 60631,
+    61117, 61604, 62091, 62578, 63066, 63554, 64043, 64532, 65022, 65511, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65358, 64867, 64376, 63886, 63396, 62907, 62418, 61929, 61441, 60953,
+    60465, 59979, 59492, 59006, 58520, 58035, 57551, 57067, 56583, 56100, 55618, 55136, 54655, 54174, 53694, 53215,
+    52736, 52258, 51780, 51304, 50828, 50352, 49878, 49404, 48931, 48459, 47988, 47518, 47049, 46580, 46113, 45646,
+    45181, 44717, 44253, 43791, 43330, 42871, 42412, 41955, 41499, 41044, 40591, 40140, 39690, 39241, 38794, 38349,
+    37906, 37464, 37024, 36586, 36150, 35717, 35285, 34855, 34428, 34004, 33582, 33162, 32745, 32331, 31920, 31512,
+    31107, 30705, 30306, 29912, 29520, 29133, 28750, 28370, 27995, 27625, 27259, 26898, 26542, 26191, 25846, 25507,
+    25173, 24845, 24524, 24210, 23902, 23602, 23309, 23024, 22747, 22478, 22218, 21967, 21725, 21493, 21271, 21058,
+    20857, 20666, 20486, 20318, 20161, 20016, 19884, 19764, 19657, 19562, 19481, 19413, 19359, 19318, 19290, 19277,
+    19277, 19290, 19318, 19359, 19413, 19481, 19562, 19657, 19764, 19884, 20016, 20161, 20318, 20486, 20666, 20857,
+    21058, 21271, 21493, 21725, 21967, 22218, 22478, 22747, 23024, 23309, 23602, 23902, 24210, 24524, 24845, 25173,
+    25507, 25846, 26191, 26542, 26898, 27259, 27625, 27995, 28370, 28750, 29133, 29520, 29912, 30306, 30705, 31107,
+    31512, 31920, 32331, 32745, 33162, 33582, 34004, 34428, 34855, 35285, 35717, 36150, 36586, 37024, 37464, 37906,
+    38349, 38794, 39241, 39690, 40140, 40591, 41044, 41499, 41955, 42412, 42871, 43330, 43791, 44253, 44717, 45181,
+    45646, 46113, 46580, 47049, 47518, 47988, 48459, 48931, 49404, 49878, 50352, 50828, 51304, 51780, 52258, 52736,
+    53215, 53694, 54174, 54655, 55136, 55618, 56100, 56583, 57067, 57551, 58035, 58520, 59006, 59492, 59979, 60465,
+    60953, 61441, 61929, 62418, 62907, 63396, 63886, 64376, 64867, 65358, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65208, 64716, 64224, 63733, 63242, 62751, 62261, 61771, 61281, 60792,
+    60304, 59815, 59327, 58840, 58353, 57867, 57381, 56895, 56410, 55926, 55442, 54958, 54476, 53993, 53512, 53031,
+    52550, 52070, 51591, 51113, 50635, 50158, 49682, 49206, 48731, 48257, 47784, 47312, 46840, 46370, 45900, 45432,
+    44964, 44497, 44032, 43567, 43104, 42642, 42181, 41721, 41263, 40806, 40350, 39895, 39443, 38991, 38541, 38093,
+    37647, 37202, 36759, 36318, 35879, 35442, 35007, 34574, 34143, 33715, 33289, 32866, 32445, 32027, 31612, 31200,
+    30791, 30385, 29982, 29583, 29187, 28795, 28408, 28024, 27644, 27269, 26898, 26532, 26171, 25815, 25465, 25120,
+    24782, 24449, 24122, 23803, 23490, 23184, 22886, 22596, 22313, 22039, 21774, 21518, 21271, 21033, 20806, 20589,
+    20383, 20187, 20003, 19831, 19670, 19522, 19386, 19263, 19153, 19056, 18973, 18903, 18847, 18805, 18777, 18763,
+    18763, 18777, 18805, 18847, 18903, 18973, 19056, 19153, 19263, 19386, 19522, 19670, 19831, 20003, 20187, 20383,
+    20589, 20806, 21033, 21271, 21518, 21774, 22039, 22313, 22596, 22886, 23184, 23490, 23803, 24122, 24449, 24782,
+    25120, 25465, 25815, 26171, 26532, 26898, 27269, 27644, 28024, 28408, 28795, 29187, 29583, 29982, 30385, 30791,
+    31200, 31612, 32027, 32445, 32866, 33289, 33715, 34143, 34574, 35007, 35442, 35879, 36318, 36759, 37202, 37647,
+    38093, 38541, 38991, 39443, 39895, 40350, 40806, 41263, 41721, 42181, 42642, 43104, 43567, 44032, 44497, 44964,
+    45432, 45900, 46370, 46840, 47312, 47784, 48257, 48731, 49206, 49682, 50158, 50635, 51113, 51591, 52070, 52550,
+    53031, 53512, 53993, 54476, 54958, 55442, 55926, 56410, 56895, 57381, 57867, 58353, 58840, 59327, 59815, 60304,
+    60792, 61281, 61771, 62261, 62751, 63242, 63733, 64224, 64716, 65208, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65062, 64569, 64076, 63583, 63091, 62599, 62108, 61617, 61126, 60636,
+    60146, 59656, 59167, 58678, 58190, 57702, 57215, 56728, 56241, 55755, 55270, 54785, 54301, 53817, 53334, 52851,
+    52369, 51887, 51406, 50926, 50447, 49968, 49490, 49012, 48536, 48060, 47585, 47110, 46637, 46164, 45693, 45222,
+    44752, 44283, 43815, 43349, 42883, 42418, 41955, 41493, 41032, 40572, 40113, 39656, 39201, 38747, 38294, 37843,
+    37393, 36945, 36499, 36055, 35613, 35172, 34734, 34298, 33864, 33432, 33002, 32575, 32151, 31729, 31310, 30893,
+    30480, 30070, 29663, 29260, 28860, 28463, 28071, 27682, 27298, 26918, 26542, 26171, 25805, 25444, 25089, 24739,
+    24395, 24057, 23725, 23400, 23081, 22770, 22467, 22171, 21883, 21603, 21333, 21071, 20819, 20576, 20344, 20122,
+    19910, 19710, 19522, 19345, 19181, 19028, 18889, 18763, 18650, 18550, 18465, 18393, 18335, 18292, 18263, 18249,
+    18249, 18263, 18292, 18335, 18393, 18465, 18550, 18650, 18763, 18889, 19028, 19181, 19345, 19522, 19710, 19910,
+    20122, 20344, 20576, 20819, 21071, 21333, 21603, 21883, 22171, 22467, 22770, 23081, 23400, 23725, 24057, 24395,
+    24739, 25089, 25444, 25805, 26171, 26542, 26918, 27298, 27682, 28071, 28463, 28860, 29260, 29663, 30070, 30480,
+    30893, 31310, 31729, 32151, 32575, 33002, 33432, 33864, 34298, 34734, 35172, 35613, 36055, 36499, 36945, 37393,
+    37843, 38294, 38747, 39201, 39656, 40113, 40572, 41032, 41493, 41955, 42418, 42883, 43349, 43815, 44283, 44752,
+    45222, 45693, 46164, 46637, 47110, 47585, 48060, 48536, 49012, 49490, 49968, 50447, 50926, 51406, 51887, 52369,
+    52851, 53334, 53817, 54301, 54785, 55270, 55755, 56241, 56728, 57215, 57702, 58190, 58678, 59167, 59656, 60146,
+    60636, 61126, 61617, 62108, 62599, 63091, 63583, 64076, 64569, 65062, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65414, 64920, 64426, 63932, 63438, 62945, 62452, 61959, 61467, 60975, 60483,
+    59992, 59501, 59010, 58520, 58031, 57542, 57053, 56565, 56077, 55589, 55102, 54616, 54130, 53645, 53160, 52676,
+    52192, 51709, 51226, 50744, 50263, 49782, 49302, 48823, 48345, 47867, 47390, 46914, 46438, 45964, 45490, 45017,
+    44545, 44074, 43604, 43135, 42667, 42200, 41734, 41269, 40806, 40343, 39882, 39422, 38964, 38507, 38052, 37598,
+    37145, 36694, 36245, 35798, 35352, 34909, 34467, 34027, 33589, 33154, 32721, 32290, 31862, 31436, 31013, 30593,
+    30175, 29761, 29350, 28942, 28537, 28137, 27739, 27346, 26957, 26572, 26191, 25815, 25444, 25078, 24717, 24362,
+    24013, 23669, 23332, 23001, 22677, 22360, 22051, 21750, 21456, 21171, 20895, 20627, 20370, 20122, 19884, 19657,
+    19440, 19236, 19042, 18861, 18692, 18536, 18393, 18263, 18147, 18045, 17957, 17883, 17824, 17779, 17750, 17735,
+    17735, 17750, 17779, 17824, 17883, 17957, 18045, 18147, 18263, 18393, 18536, 18692, 18861, 19042, 19236, 19440,
+    19657, 19884, 20122, 20370, 20627, 20895, 21171, 21456, 21750, 22051, 22360, 22677, 23001, 23332, 23669, 24013,
+    24362, 24717, 25078, 25444, 25815, 26191, 26572, 26957, 27346, 27739, 28137, 28537, 28942, 29350, 29761, 30175,
+    30593, 31013, 31436, 31862, 32290, 32721, 33154, 33589, 34027, 34467, 34909, 35352, 35798, 36245, 36694, 37145,
+    37598, 38052, 38507, 38964, 39422, 39882, 40343, 40806, 41269, 41734, 42200, 42667, 43135, 43604, 44074, 44545,
+    45017, 45490, 45964, 46438, 46914, 47390, 47867, 48345, 48823, 49302, 49782, 50263, 50744, 51226, 51709, 52192,
+    52676, 53160, 53645, 54130, 54616, 55102, 55589, 56077, 56565, 57053, 57542, 58031, 58520, 59010, 59501, 59992,
+    60483, 60975, 61467, 61959, 62452, 62945, 63438, 63932, 64426, 64920, 65414, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65277, 64781, 64286, 63791, 63296, 62802, 62308, 61814, 61320, 60827, 60334,
+    59842, 59350, 58858, 58367, 57876, 57385, 56895, 56406, 55916, 55427, 54939, 54451, 53964, 53477, 52991, 52505,
+    52019, 51535, 51051, 50567, 50084, 49602, 49120, 48639, 48159, 47679, 47200, 46722, 46244, 45768, 45292, 44817,
+    44343, 43870, 43397, 42926, 42456, 41986, 41518, 41051, 40585, 40120, 39656, 39194, 38733, 38273, 37815, 37358,
+    36903, 36449, 35997, 35546, 35097, 34650, 34205, 33762, 33321, 32882, 32445, 32011, 31579, 31149, 30722, 30298,
+    29876, 29458, 29042, 28630, 28221, 27815, 27414, 27016, 26622, 26232, 25846, 25465, 25089, 24717, 24351, 23991,
+    23636, 23287, 22944, 22607, 22278, 21955, 21640, 21333, 21033, 20742, 20460, 20187, 19924, 19670, 19427, 19194,
+    18973, 18763, 18565, 18379, 18205, 18045, 17898, 17765, 17645, 17540, 17450, 17374, 17313, 17267, 17236, 17221,
+    17221, 17236, 17267, 17313, 17374, 17450, 17540, 17645, 17765, 17898, 18045, 18205, 18379, 18565, 18763, 18973,
+    19194, 19427, 19670, 19924, 20187, 20460, 20742, 21033, 21333, 21640, 21955, 22278, 22607, 22944, 23287, 23636,
+    23991, 24351, 24717, 25089, 25465, 25846, 26232, 26622, 27016, 27414, 27815, 28221, 28630, 29042, 29458, 29876,
+    30298, 30722, 31149, 31579, 32011, 32445, 32882, 33321, 33762, 34205, 34650, 35097, 35546, 35997, 36449, 36903,
+    37358, 37815, 38273, 38733, 39194, 39656, 40120, 40585, 41051, 41518, 41986, 42456, 42926, 43397, 43870, 44343,
+    44817, 45292, 45768, 46244, 46722, 47200, 47679, 48159, 48639, 49120, 49602, 50084, 50567, 51051, 51535, 52019,
+    52505, 52991, 53477, 53964, 54451, 54939, 55427, 55916, 56406, 56895, 57385, 57876, 58367, 58858, 59350, 59842,
+    60334, 60827, 61320, 61814, 62308, 62802, 63296, 63791, 64286, 64781, 65277, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65143, 64647, 64150, 63654, 63158, 62663, 62167, 61673, 61178, 60684, 60190,
+    59696, 59203, 58710, 58217, 57725, 57233, 56742, 56251, 55760, 55270, 54780, 54291, 53802, 53314, 52826, 52338,
+    51852, 51365, 50880, 50394, 49910, 49426, 48942, 48459, 47977, 47496, 47015, 46535, 46055, 45577, 45099, 44622,
+    44146, 43670, 43196, 42722, 42250, 41778, 41308, 40838, 40369, 39902, 39436, 38971, 38507, 38045, 37584, 37124,
+    36666, 36209, 35753, 35300, 34848, 34398, 33949, 33503, 33058, 32616, 32175, 31737, 31301, 30868, 30437, 30009,
+    29583, 29160, 28740, 28324, 27910, 27500, 27094, 26691, 26292, 25897, 25507, 25120, 24739, 24362, 23991, 23624,
+    23264, 22909, 22560, 22218, 21883, 21554, 21233, 20920, 20615, 20318, 20030, 19751, 19481, 19222, 18973, 18735,
+    18508, 18292, 18089, 17898, 17720, 17555, 17404, 17267, 17144, 17036, 16943, 16864, 16802, 16754, 16723, 16707,
+    16707, 16723, 16754, 16802, 16864, 16943, 17036, 17144, 17267, 17404, 17555, 17720, 17898, 18089, 18292, 18508,
+    18735, 18973, 19222, 19481, 19751, 20030, 20318, 20615, 20920, 21233, 21554, 21883, 22218, 22560, 22909, 23264,
+    23624, 23991, 24362, 24739, 25120, 25507, 25897, 26292, 26691, 27094, 27500, 27910, 28324, 28740, 29160, 29583,
+    30009, 30437, 30868, 31301, 31737, 32175, 32616, 33058, 33503, 33949, 34398, 34848, 35300, 35753, 36209, 36666,
+    37124, 37584, 38045, 38507, 38971, 39436, 39902, 40369, 40838, 41308, 41778, 42250, 42722, 43196, 43670, 44146,
+    44622, 45099, 45577, 46055, 46535, 47015, 47496, 47977, 48459, 48942, 49426, 49910, 50394, 50880, 51365, 51852,
+    52338, 52826, 53314, 53802, 54291, 54780, 55270, 55760, 56251, 56742, 57233, 57725, 58217, 58710, 59203, 59696,
+    60190, 60684, 61178, 61673, 62167, 62663, 63158, 63654, 64150, 64647, 65143, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65511, 65013, 64516, 64018, 63521, 63024, 62528, 62031, 61535, 61040, 60544, 60049,
+    59554, 59060, 58566, 58072, 57578, 57085, 56593, 56100, 55608, 55117, 54626, 54135, 53645, 53155, 52666, 52177,
+    51688, 51200, 50713, 50226, 49740, 49254, 48769, 48285, 47801, 47317, 46835, 46353, 45871, 45391, 44911, 44432,
+    43954, 43476, 43000, 42524, 42049, 41575, 41102, 40630, 40159, 39690, 39221, 38753, 38287, 37822, 37358, 36895,
+    36434, 35974, 35516, 35060, 34604, 34151, 33699, 33249, 32801, 32355, 31911, 31470, 31030, 30593, 30158, 29725,
+    29296, 28869, 28445, 28024, 27606, 27191, 26780, 26372, 25968, 25569, 25173, 24782, 24395, 24013, 23636, 23264,
+    22898, 22537, 22183, 21834, 21493, 21158, 20831, 20512, 20200, 19897, 19603, 19318, 19042, 18777, 18522, 18278,
+    18045, 17824, 17615, 17419, 17236, 17067, 16911, 16770, 16644, 16532, 16436, 16355, 16291, 16242, 16209, 16193,
+    16193, 16209, 16242, 16291, 16355, 16436, 16532, 16644, 16770, 16911, 17067, 17236, 17419, 17615, 17824, 18045,
+    18278, 18522, 18777, 19042, 19318, 19603, 19897, 20200, 20512, 20831, 21158, 21493, 21834, 22183, 22537, 22898,
+    23264, 23636, 24013, 24395, 24782, 25173, 25569, 25968, 26372, 26780, 27191, 27606, 28024, 28445, 28869, 29296,
+    29725, 30158, 30593, 31030, 31470, 31911, 32355, 32801, 33249, 33699, 34151, 34604, 35060, 35516, 35974, 36434,
+    36895, 37358, 37822, 38287, 38753, 39221, 39690, 40159, 40630, 41102, 41575, 42049, 42524, 43000, 43476, 43954,
+    44432, 44911, 45391, 45871, 46353, 46835, 47317, 47801, 48285, 48769, 49254, 49740, 50226, 50713, 51200, 51688,
+    52177, 52666, 53155, 53645, 54135, 54626, 55117, 55608, 56100, 56593, 57085, 57578, 58072, 58566, 59060, 59554,
+    60049, 60544, 61040, 61535, 62031, 62528, 63024, 63521, 64018, 64516, 65013, 65511, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65386, 64887, 64389, 63890, 63392, 62894, 62397, 61899, 61402, 60905, 60409, 59912,
+    59416, 58921, 58426, 57931, 57436, 56942, 56448, 55954, 55461, 54968, 54476, 53983, 53492, 53001, 52510, 52019,
+    51530, 51040, 50551, 50063, 49575, 49088, 48601, 48115, 47629, 47144, 46659, 46176, 45693, 45210, 44728, 44247,
+    43767, 43288, 42809, 42331, 41854, 41378, 40903, 40428, 39955, 39483, 39012, 38541, 38072, 37605, 37138, 36673,
+    36209, 35746, 35285, 34825, 34367, 33910, 33455, 33002, 32551, 32101, 31654, 31208, 30765, 30324, 29885, 29449,
+    29015, 28584, 28155, 27730, 27307, 26888, 26472, 26060, 25651, 25246, 24845, 24449, 24057, 23669, 23287, 22909,
+    22537, 22171, 21810, 21456, 21108, 20768, 20434, 20109, 19791, 19481, 19181, 18889, 18607, 18335, 18074, 17824,
+    17585, 17358, 17144, 16943, 16754, 16580, 16420, 16274, 16144, 16029, 15930, 15847, 15780, 15730, 15696, 15679,
+    15679, 15696, 15730, 15780, 15847, 15930, 16029, 16144, 16274, 16420, 16580, 16754, 16943, 17144, 17358, 17585,
+    17824, 18074, 18335, 18607, 18889, 19181, 19481, 19791, 20109, 20434, 20768, 21108, 21456, 21810, 22171, 22537,
+    22909, 23287, 23669, 24057, 24449, 24845, 25246, 25651, 26060, 26472, 26888, 27307, 27730, 28155, 28584, 29015,
+    29449, 29885, 30324, 30765, 31208, 31654, 32101, 32551, 33002, 33455, 33910, 34367, 34825, 35285, 35746, 36209,
+    36673, 37138, 37605, 38072, 38541, 39012, 39483, 39955, 40428, 40903, 41378, 41854, 42331, 42809, 43288, 43767,
+    44247, 44728, 45210, 45693, 46176, 46659, 47144, 47629, 48115, 48601, 49088, 49575, 50063, 50551, 51040, 51530,
+    52019, 52510, 53001, 53492, 53983, 54476, 54968, 55461, 55954, 56448, 56942, 57436, 57931, 58426, 58921, 59416,
+    59912, 60409, 60905, 61402, 61899, 62397, 62894, 63392, 63890, 64389, 64887, 65386, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65265, 64765, 64265, 63766, 63267, 62768, 62269, 61771, 61273, 60775, 60277, 59780,
+    59283, 58786, 58290, 57794, 57298, 56802, 56307, 55812, 55318, 54824, 54330, 53836, 53343, 52851, 52359, 51867,
+    51376, 50885, 50394, 49904, 49415, 48926, 48438, 47950, 47462, 46975, 46489, 46004, 45519, 45034, 44551, 44068,
+    43586, 43104, 42623, 42143, 41664, 41186, 40708, 40232, 39756, 39282, 38808, 38335, 37864, 37393, 36924, 36456,
+    35989, 35524, 35060, 34597, 34136, 33676, 33218, 32761, 32306, 31853, 31402, 30953, 30506, 30061, 29619, 29178,
+    28740, 28305, 27872, 27443, 27016, 26592, 26171, 25754, 25340, 24930, 24524, 24122, 23725, 23332, 22944, 22560,
+    22183, 21810, 21444, 21083, 20730, 20383, 20043, 19710, 19386, 19070, 18763, 18465, 18176, 17898, 17630, 17374,
+    17129, 16896, 16675, 16468, 16274, 16095, 15930, 15780, 15645, 15527, 15424, 15338, 15269, 15217, 15183, 15165,
+    15165, 15183, 15217, 15269, 15338, 15424, 15527, 15645, 15780, 15930, 16095, 16274, 16468, 16675, 16896, 17129,
+    17374, 17630, 17898, 18176, 18465, 18763, 19070, 19386, 19710, 20043, 20383, 20730, 21083, 21444, 21810, 22183,
+    22560, 22944, 23332, 23725, 24122, 24524, 24930, 25340, 25754, 26171, 26592, 27016, 27443, 27872, 28305, 28740,
+    29178, 29619, 30061, 30506, 30953, 31402, 31853, 32306, 32761, 33218, 33676, 34136, 34597, 35060, 35524, 35989,
+    36456, 36924, 37393, 37864, 38335, 38808, 39282, 39756, 40232, 40708, 41186, 41664, 42143, 42623, 43104, 43586,
+    44068, 44551, 45034, 45519, 46004, 46489, 46975, 47462, 47950, 48438, 48926, 49415, 49904, 50394, 50885, 51376,
+    51867, 52359, 52851, 53343, 53836, 54330, 54824, 55318, 55812, 56307, 56802, 57298, 57794, 58290, 58786, 59283,
+    59780, 60277, 60775, 61273, 61771, 62269, 62768, 63267, 63766, 64265, 64765, 65265, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65147, 64647, 64146, 63646, 63146, 62646, 62146, 61647, 61148, 60649, 60150, 59652,
+    59154, 58656, 58158, 57661, 57164, 56667, 56171, 55675, 55179, 54684, 54189, 53694, 53200, 52706, 52212, 51719,
+    51226, 50734, 50242, 49751, 49260, 48769, 48279, 47790, 47301, 46812, 46324, 45837, 45350, 44864, 44378, 43894,
+    43409, 42926, 42443, 41961, 41480, 40999, 40520, 40041, 39563, 39086, 38610, 38135, 37661, 37188, 36716, 36245,
+    35776, 35307, 34840, 34375, 33910, 33448, 32986, 32526, 32068, 31612, 31157, 30705, 30254, 29805, 29359, 28915,
+    28473, 28033, 27596, 27162, 26730, 26302, 25877, 25455, 25036, 24621, 24210, 23803, 23400, 23001, 22607, 22218,
+    21834, 21456, 21083, 20717, 20357, 20003, 19657, 19318, 18987, 18664, 18350, 18045, 17750, 17465, 17190, 16927,
+    16675, 16436, 16209, 15996, 15797, 15612, 15441, 15287, 15148, 15025, 14919, 14830, 14759, 14705, 14669, 14651,
+    14651, 14669, 14705, 14759, 14830, 14919, 15025, 15148, 15287, 15441, 15612, 15797, 15996, 16209, 16436, 16675,
+    16927, 17190, 17465, 17750, 18045, 18350, 18664, 18987, 19318, 19657, 20003, 20357, 20717, 21083, 21456, 21834,
+    22218, 22607, 23001, 23400, 23803, 24210, 24621, 25036, 25455, 25877, 26302, 26730, 27162, 27596, 28033, 28473,
+    28915, 29359, 29805, 30254, 30705, 31157, 31612, 32068, 32526, 32986, 33448, 33910, 34375, 34840, 35307, 35776,
+    36245, 36716, 37188, 37661, 38135, 38610, 39086, 39563, 40041, 40520, 40999, 41480, 41961, 42443, 42926, 43409,
+    43894, 44378, 44864, 45350, 45837, 46324, 46812, 47301, 47790, 48279, 48769, 49260, 49751, 50242, 50734, 51226,
+    51719, 52212, 52706, 53200, 53694, 54189, 54684, 55179, 55675, 56171, 56667, 57164, 57661, 58158, 58656, 59154,
+    59652, 60150, 60649, 61148, 61647, 62146, 62646, 63146, 63646, 64146, 64647, 65147, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65034, 64532, 64031, 63529, 63028, 62528, 62027, 61527, 61027, 60527, 60027, 59528,
+    59028, 58529, 58031, 57532, 57034, 56536, 56039, 55542, 55045, 54548, 54052, 53556, 53060, 52565, 52070, 51576,
+    51082, 50588, 50095, 49602, 49109, 48617, 48126, 47635, 47144, 46654, 46164, 45675, 45187, 44699, 44211, 43725,
+    43239, 42753, 42268, 41784, 41301, 40819, 40337, 39856, 39376, 38896, 38418, 37940, 37464, 36988, 36514, 36041,
+    35568, 35097, 34627, 34159, 33692, 33226, 32761, 32298, 31837, 31377, 30919, 30463, 30009, 29556, 29106, 28658,
+    28212, 27768, 27327, 26888, 26452, 26019, 25589, 25162, 24739, 24319, 23902, 23490, 23081, 22677, 22278, 21883,
+    21493, 21108, 20730, 20357, 19990, 19630, 19277, 18931, 18593, 18263, 17942, 17630, 17328, 17036, 16754, 16484,
+    16226, 15980, 15746, 15527, 15321, 15130, 14955, 14795, 14651, 14524, 14415, 14323, 14249, 14193, 14156, 14137,
+    14137, 14156, 14193, 14249, 14323, 14415, 14524, 14651, 14795, 14955, 15130, 15321, 15527, 15746, 15980, 16226,
+    16484, 16754, 17036, 17328, 17630, 17942, 18263, 18593, 18931, 19277, 19630, 19990, 20357, 20730, 21108, 21493,
+    21883, 22278, 22677, 23081, 23490, 23902, 24319, 24739, 25162, 25589, 26019, 26452, 26888, 27327, 27768, 28212,
+    28658, 29106, 29556, 30009, 30463, 30919, 31377, 31837, 32298, 32761, 33226, 33692, 34159, 34627, 35097, 35568,
+    36041, 36514, 36988, 37464, 37940, 38418, 38896, 39376, 39856, 40337, 40819, 41301, 41784, 42268, 42753, 43239,
+    43725, 44211, 44699, 45187, 45675, 46164, 46654, 47144, 47635, 48126, 48617, 49109, 49602, 50095, 50588, 51082,
+    51576, 52070, 52565, 53060, 53556, 54052, 54548, 55045, 55542, 56039, 56536, 57034, 57532, 58031, 58529, 59028,
+    59528, 60027, 60527, 61027, 61527, 62027, 62528, 63028, 63529, 64031, 64532, 65034, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65427, 64924, 64421, 63919, 63417, 62915, 62413, 61912, 61411, 60910, 60409, 59908, 59408,
+    58907, 58407, 57908, 57408, 56909, 56410, 55912, 55413, 54915, 54417, 53920, 53423, 52926, 52429, 51933, 51437,
+    50942, 50447, 49952, 49458, 48964, 48470, 47977, 47485, 46992, 46501, 46009, 45519, 45029, 44539, 44050, 43561,
+    43073, 42586, 42099, 41613, 41128, 40643, 40159, 39676, 39194, 38712, 38232, 37752, 37273, 36795, 36318, 35842,
+    35367, 34893, 34421, 33949, 33479, 33010, 32543, 32077, 31612, 31149, 30688, 30228, 29770, 29314, 28860, 28408,
+    27958, 27510, 27064, 26622, 26181, 25744, 25309, 24877, 24449, 24024, 23602, 23184, 22770, 22360, 21955, 21554,
+    21158, 20768, 20383, 20003, 19630, 19263, 18903, 18550, 18205, 17868, 17540, 17221, 16911, 16612, 16323, 16046,
+    15780, 15527, 15287, 15060, 14848, 14651, 14470, 14305, 14156, 14025, 13911, 13816, 13739, 13681, 13643, 13623,
+    13623, 13643, 13681, 13739, 13816, 13911, 14025, 14156, 14305, 14470, 14651, 14848, 15060, 15287, 15527, 15780,
+    16046, 16323, 16612, 16911, 17221, 17540, 17868, 18205, 18550, 18903, 19263, 19630, 20003, 20383, 20768, 21158,
+    21554, 21955, 22360, 22770, 23184, 23602, 24024, 24449, 24877, 25309, 25744, 26181, 26622, 27064, 27510, 27958,
+    28408, 28860, 29314, 29770, 30228, 30688, 31149, 31612, 32077, 32543, 33010, 33479, 33949, 34421, 34893, 35367,
+    35842, 36318, 36795, 37273, 37752, 38232, 38712, 39194, 39676, 40159, 40643, 41128, 41613, 42099, 42586, 43073,
+    43561, 44050, 44539, 45029, 45519, 46009, 46501, 46992, 47485, 47977, 48470, 48964, 49458, 49952, 50447, 50942,
+    51437, 51933, 52429, 52926, 53423, 53920, 54417, 54915, 55413, 55912, 56410, 56909, 57408, 57908, 58407, 58907,
+    59408, 59908, 60409, 60910, 61411, 61912, 62413, 62915, 63417, 63919, 64421, 64924, 65427, 65535, 65535, 65535,
+    65535, 65535, 65535, 65321, 64818, 64315, 63812, 63309, 62806, 62303, 61801, 61299, 60797, 60295, 59793, 59292,
+    58791, 58290, 57789, 57289, 56788, 56288, 55789, 55289, 54790, 54291, 53792, 53294, 52796, 52298, 51801, 51304,
+    50807, 50310, 49814, 49319, 48823, 48328, 47834, 47340, 46846, 46353, 45860, 45368, 44876, 44384, 43894, 43403,
+    42914, 42424, 41936, 41448, 40961, 40474, 39988, 39503, 39018, 38535, 38052, 37569, 37088, 36608, 36128, 35650,
+    35172, 34696, 34221, 33746, 33273, 32801, 32331, 31862, 31394, 30928, 30463, 30000, 29538, 29079, 28621, 28165,
+    27711, 27259, 26809, 26362, 25918, 25475, 25036, 24600, 24166, 23736, 23309, 22886, 22467, 22051, 21640, 21233,
+    20831, 20434, 20043, 19657, 19277, 18903, 18536, 18176, 17824, 17480, 17144, 16817, 16500, 16193, 15897, 15612,
+    15338, 15078, 14830, 14597, 14378, 14175, 13987, 13816, 13662, 13526, 13408, 13310, 13230, 13170, 13130, 13110,
+    13110, 13130, 13170, 13230, 13310, 13408, 13526, 13662, 13816, 13987, 14175, 14378, 14597, 14830, 15078, 15338,
+    15612, 15897, 16193, 16500, 16817, 17144, 17480, 17824, 18176, 18536, 18903, 19277, 19657, 20043, 20434, 20831,
+    21233, 21640, 22051, 22467, 22886, 23309, 23736, 24166, 24600, 25036, 25475, 25918, 26362, 26809, 27259, 27711,
+    28165, 28621, 29079, 29538, 30000, 30463, 30928, 31394, 31862, 32331, 32801, 33273, 33746, 34221, 34696, 35172,
+    35650, 36128, 36608, 37088, 37569, 38052, 38535, 39018, 39503, 39988, 40474, 40961, 41448, 41936, 42424, 42914,
+    43403, 43894, 44384, 44876, 45368, 45860, 46353, 46846, 47340, 47834, 48328, 48823, 49319, 49814, 50310, 50807,
+    51304, 51801, 52298, 52796, 53294, 53792, 54291, 54790, 55289, 55789, 56288, 56788, 57289, 57789, 58290, 58791,
+    59292, 59793, 60295, 60797, 61299, 61801, 62303, 62806, 63309, 63812, 64315, 64818, 65321, 65535, 65535, 65535,
+    65535, 65535, 65535, 65220, 64716, 64212, 63708, 63204, 62701, 62197, 61694, 61191, 60688, 60185, 59683, 59180,
+    58678, 58176, 57675, 57173, 56672, 56171, 55670, 55169, 54669, 54169, 53669, 53170, 52671, 52172, 51673, 51175,
+    50677, 50179, 49681, 49184, 48688, 48191, 47695, 47200, 46705, 46210, 45716, 45222, 44728, 44235, 43743, 43251,
+    42759, 42268, 41778, 41288, 40799, 40311, 39823, 39335, 38849, 38363, 37878, 37393, 36910, 36427, 35945, 35464,
+    34984, 34505, 34027, 33550, 33074, 32600, 32126, 31654, 31183, 30713, 30245, 29779, 29314, 28850, 28389, 27929,
+    27471, 27016, 26562, 26110, 25661, 25215, 24771, 24330, 23891, 23456, 23024, 22596, 22171, 21750, 21333, 20920,
+    20512, 20109, 19710, 19318, 18931, 18550, 18176, 17809, 17450, 17098, 16754, 16420, 16095, 15780, 15476, 15183,
+    14902, 14633, 14378, 14137, 13911, 13701, 13507, 13329, 13170, 13029, 12906, 12804, 12721, 12658, 12617, 12596,
+    12596, 12617, 12658, 12721, 12804, 12906, 13029, 13170, 13329, 13507, 13701, 13911, 14137, 14378, 14633, 14902,
+    15183, 15476, 15780, 16095, 16420, 16754, 17098, 17450, 17809, 18176, 18550, 18931, 19318, 19710, 20109, 20512,
+    20920, 21333, 21750, 22171, 22596, 23024, 23456, 23891, 24330, 24771, 25215, 25661, 26110, 26562, 27016, 27471,
+    27929, 28389, 28850, 29314, 29779, 30245, 30713, 31183, 31654, 32126, 32600, 33074, 33550, 34027, 34505, 34984,
+    35464, 35945, 36427, 36910, 37393, 37878, 38363, 38849, 39335, 39823, 40311, 40799, 41288, 41778, 42268, 42759,
+    43251, 43743, 44235, 44728, 45222, 45716, 46210, 46705, 47200, 47695, 48191, 48688, 49184, 49681, 50179, 50677,
+    51175, 51673, 52172, 52671, 53170, 53669, 54169, 54669, 55169, 55670, 56171, 56672, 57173, 57675, 58176, 58678,
+    59180, 59683, 60185, 60688, 61191, 61694, 62197, 62701, 63204, 63708, 64212, 64716, 65220, 65535, 65535, 65535,
+    65535, 65535, 65535, 65123, 64618, 64113, 63608, 63104, 62599, 62095, 61591, 61087, 60583, 60080, 59576, 59073,
+    58570, 58067, 57565, 57062, 56560, 56058, 55556, 55054, 54553, 54052, 53551, 53050, 52550, 52050, 51550, 51051,
+    50551, 50052, 49554, 49055, 48557, 48060, 47562, 47065, 46569, 46073, 45577, 45081, 44586, 44092, 43598, 43104,
+    42611, 42118, 41626, 41134, 40643, 40153, 39663, 39174, 38685, 38197, 37710, 37223, 36738, 36252, 35768, 35285,
+    34802, 34321, 33840, 33361, 32882, 32404, 31928, 31453, 30979, 30506, 30035, 29565, 29097, 28630, 28165, 27701,
+    27240, 26780, 26322, 25867, 25413, 24962, 24514, 24068, 23624, 23184, 22747, 22313, 21883, 21456, 21033, 20615,
+    20200, 19791, 19386, 18987, 18593, 18205, 17824, 17450, 17082, 16723, 16372, 16029, 15696, 15373, 15060, 14759,
+    14470, 14193, 13930, 13681, 13448, 13230, 13029, 12845, 12679, 12533, 12405, 12298, 12212, 12147, 12104, 12082,
+    12082, 12104, 12147, 12212, 12298, 12405, 12533, 12679, 12845, 13029, 13230, 13448, 13681, 13930, 14193, 14470,
+    14759, 15060, 15373, 15696, 16029, 16372, 16723, 17082, 17450, 17824, 18205, 18593, 18987, 19386, 19791, 20200,
+    20615, 21033, 21456, 21883, 22313, 22747, 23184, 23624, 24068, 24514, 24962, 25413, 25867, 26322, 26780, 27240,
+    27701, 28165, 28630, 29097, 29565, 30035, 30506, 30979, 31453, 31928, 32404, 32882, 33361, 33840, 34321, 34802,
+    35285, 35768, 36252, 36738, 37223, 37710, 38197, 38685, 39174, 39663, 40153, 40643, 41134, 41626, 42118, 42611,
+    43104, 43598, 44092, 44586, 45081, 45577, 46073, 46569, 47065, 47562, 48060, 48557, 49055, 49554, 50052, 50551,
+    51051, 51550, 52050, 52550, 53050, 53551, 54052, 54553, 55054, 55556, 56058, 56560, 57062, 57565, 58067, 58570,
+    59073, 59576, 60080, 60583, 61087, 61591, 62095, 62599, 63104, 63608, 64113, 64618, 65123, 65535, 65535, 65535,
+    65535, 65535, 65535, 65030, 64524, 64018, 63513, 63007, 62502, 61997, 61492, 60988, 60483, 59979, 59474, 58970,
+    58466, 57962, 57459, 56956, 56452, 55949, 55447, 54944, 54442, 53939, 53437, 52936, 52434, 51933, 51432, 50931,
+    50431, 49931, 49431, 48931, 48432, 47933, 47434, 46936, 46438, 45941, 45443, 44946, 44450, 43954, 43458, 42963,
+    42468, 41974, 41480, 40986, 40494, 40001, 39510, 39018, 38528, 38038, 37548, 37060, 36572, 36084, 35598, 35112,
+    34627, 34143, 33660, 33178, 32697, 32216, 31737, 31259, 30782, 30306, 29832, 29359, 28887, 28417, 27948, 27481,
+    27016, 26552, 26090, 25631, 25173, 24717, 24264, 23814, 23366, 22921, 22478, 22039, 21603, 21171, 20742, 20318,
+    19897, 19481, 19070, 18664, 18263, 17868, 17480, 17098, 16723, 16355, 15996, 15645, 15304, 14972, 14651, 14341,
+    14044, 13759, 13487, 13230, 12988, 12762, 12554, 12363, 12191, 12038, 11906, 11794, 11704, 11636, 11591, 11568,
+    11568, 11591, 11636, 11704, 11794, 11906, 12038, 12191, 12363, 12554, 12762, 12988, 13230, 13487, 13759, 14044,
+    14341, 14651, 14972, 15304, 15645, 15996, 16355, 16723, 17098, 17480, 17868, 18263, 18664, 19070, 19481, 19897,
+    20318, 20742, 21171, 21603, 22039, 22478, 22921, 23366, 23814, 24264, 24717, 25173, 25631, 26090, 26552, 27016,
+    27481, 27948, 28417, 28887, 29359, 29832, 30306, 30782, 31259, 31737, 32216, 32697, 33178, 33660, 34143, 34627,
+    35112, 35598, 36084, 36572, 37060, 37548, 38038, 38528, 39018, 39510, 40001, 40494, 40986, 41480, 41974, 42468,
+    42963, 43458, 43954, 44450, 44946, 45443, 45941, 46438, 46936, 47434, 47933, 48432, 48931, 49431, 49931, 50431,
+    50931, 51432, 51933, 52434, 52936, 53437, 53939, 54442, 54944, 55447, 55949, 56452, 56956, 57459, 57962, 58466,
+    58970, 59474, 59979, 60483, 60988, 61492, 61997, 62502, 63007, 63513, 64018, 64524, 65030, 65535, 65535, 65535,
+    65535, 65535, 65447, 64940, 64434, 63927, 63421, 62915, 62409, 61903, 61398, 60892, 60387, 59882, 59376, 58872,
+    58367, 57862, 57358, 56853, 56349, 55845, 55342, 54838, 54335, 53832, 53329, 52826, 52323, 51821, 51319, 50817,
+    50316, 49814, 49313, 48812, 48312, 47812, 47312, 46812, 46313, 45814, 45315, 44817, 44319, 43821, 43324, 42827,
+    42331, 41835, 41339, 40844, 40350, 39856, 39362, 38869, 38377, 37885, 37393, 36903, 36412, 35923, 35434, 34946,
+    34459, 33973, 33487, 33002, 32518, 32035, 31553, 31073, 30593, 30114, 29636, 29160, 28685, 28212, 27739, 27269,
+    26800, 26332, 25867, 25403, 24941, 24481, 24024, 23568, 23116, 22666, 22218, 21774, 21333, 20895, 20460, 20030,
+    19603, 19181, 18763, 18350, 17942, 17540, 17144, 16754, 16372, 15996, 15628, 15269, 14919, 14579, 14249, 13930,
+    13623, 13329, 13049, 12783, 12533, 12298, 12082, 11883, 11704, 11545, 11407, 11290, 11196, 11125, 11078, 11054,
+    11054, 11078, 11125, 11196, 11290, 11407, 11545, 11704, 11883, 12082, 12298, 12533, 12783, 13049, 13329, 13623,
+    13930, 14249, 14579, 14919, 15269, 15628, 15996, 16372, 16754, 17144, 17540, 17942, 18350, 18763, 19181, 19603,
+    20030, 20460, 20895, 21333, 21774, 22218, 22666, 23116, 23568, 24024, 24481, 24941, 25403, 25867, 26332, 26800,
+    27269, 27739, 28212, 28685, 29160, 29636, 30114, 30593, 31073, 31553, 32035, 32518, 33002, 33487, 33973, 34459,
+    34946, 35434, 35923, 36412, 36903, 37393, 37885, 38377, 38869, 39362, 39856, 40350, 40844, 41339, 41835, 42331,
+    42827, 43324, 43821, 44319, 44817, 45315, 45814, 46313, 46812, 47312, 47812, 48312, 48812, 49313, 49814, 50316,
+    50817, 51319, 51821, 52323, 52826, 53329, 53832, 54335, 54838, 55342, 55845, 56349, 56853, 57358, 57862, 58367,
+    58872, 59376, 59882, 60387, 60892, 61398, 61903, 62409, 62915, 63421, 63927, 64434, 64940, 65447, 65535, 65535,
+    65535, 65535, 65362, 64855, 64348, 63841, 63334, 62827, 62320, 61814, 61307, 60801, 60295, 59789, 59283, 58777,
+    58272, 57766, 57261, 56756, 56251, 55746, 55241, 54737, 54232, 53728, 53224, 52721, 52217, 51714, 51211, 50708,
+    50205, 49703, 49201, 48699, 48197, 47695, 47194, 46693, 46193, 45693, 45193, 44693, 44194, 43695, 43196, 42698,
+    42200, 41702, 41205, 40708, 40212, 39716, 39221, 38726, 38232, 37738, 37245, 36752, 36260, 35768, 35277, 34787,
+    34298, 33809, 33321, 32834, 32347, 31862, 31377, 30893, 30411, 29929, 29449, 28969, 28491, 28014, 27539, 27064,
+    26592, 26121, 25651, 25183, 24717, 24254, 23792, 23332, 22874, 22419, 21967, 21518, 21071, 20627, 20187, 19751,
+    19318, 18889, 18465, 18045, 17630, 17221, 16817, 16420, 16029, 15645, 15269, 14902, 14543, 14193, 13854, 13526,
+    13210, 12906, 12617, 12341, 12082, 11839, 11613, 11407, 11220, 11054, 10910, 10788, 10689, 10615, 10565, 10540,
+    10540, 10565, 10615, 10689, 10788, 10910, 11054, 11220, 11407, 11613, 11839, 12082, 12341, 12617, 12906, 13210,
+    13526, 13854, 14193, 14543, 14902, 15269, 15645, 16029, 16420, 16817, 17221, 17630, 18045, 18465, 18889, 19318,
+    19751, 20187, 20627, 21071, 21518, 21967, 22419, 22874, 23332, 23792, 24254, 24717, 25183, 25651, 26121, 26592,
+    27064, 27539, 28014, 28491, 28969, 29449, 29929, 30411, 30893, 31377, 31862, 32347, 32834, 33321, 33809, 34298,
+    34787, 35277, 35768, 36260, 36752, 37245, 37738, 38232, 38726, 39221, 39716, 40212, 40708, 41205, 41702, 42200,
+    42698, 43196, 43695, 44194, 44693, 45193, 45693, 46193, 46693, 47194, 47695, 48197, 48699, 49201, 49703, 50205,
+    50708, 51211, 51714, 52217, 52721, 53224, 53728, 54232, 54737, 55241, 55746, 56251, 56756, 57261, 57766, 58272,
+    58777, 59283, 59789, 60295, 60801, 61307, 61814, 62320, 62827, 63334, 63841, 64348, 64855, 65362, 65535, 65535,
+    65535, 65535, 65281, 64773, 64265, 63758, 63250, 62743, 62235, 61728, 61221, 60714, 60207, 59700, 59194, 58687,
+    58181, 57675, 57168, 56663, 56157, 55651, 55146, 54640, 54135, 53630, 53125, 52620, 52116, 51612, 51107, 50604,
+    50100, 49596, 49093, 48590, 48087, 47585, 47082, 46580, 46078, 45577, 45075, 44575, 44074, 43573, 43073, 42574,
+    42074, 41575, 41077, 40578, 40080, 39583, 39086, 38589, 38093, 37598, 37102, 36608, 36114, 35620, 35127, 34635,
+    34143, 33652, 33162, 32672, 32184, 31696, 31208, 30722, 30237, 29752, 29269, 28786, 28305, 27825, 27346, 26868,
+    26392, 25918, 25444, 24973, 24503, 24035, 23568, 23104, 22642, 22183, 21725, 21271, 20819, 20370, 19924, 19481,
+    19042, 18607, 18176, 17750, 17328, 16911, 16500, 16095, 15696, 15304, 14919, 14543, 14175, 13816, 13467, 13130,
+    12804, 12490, 12191, 11906, 11636, 11384, 11149, 10934, 10739, 10565, 10414, 10286, 10183, 10105, 10053, 10026,
+    10026, 10053, 10105, 10183, 10286, 10414, 10565, 10739, 10934, 11149, 11384, 11636, 11906, 12191, 12490, 12804,
+    13130, 13467, 13816, 14175, 14543, 14919, 15304, 15696, 16095, 16500, 16911, 17328, 17750, 18176, 18607, 19042,
+    19481, 19924, 20370, 20819, 21271, 21725, 22183, 22642, 23104, 23568, 24035, 24503, 24973, 25444, 25918, 26392,
+    26868, 27346, 27825, 28305, 28786, 29269, 29752, 30237, 30722, 31208, 31696, 32184, 32672, 33162, 33652, 34143,
+    34635, 35127, 35620, 36114, 36608, 37102, 37598, 38093, 38589, 39086, 39583, 40080, 40578, 41077, 41575, 42074,
+    42574, 43073, 43573, 44074, 44575, 45075, 45577, 46078, 46580, 47082, 47585, 48087, 48590, 49093, 49596, 50100,
+    50604, 51107, 51612, 52116, 52620, 53125, 53630, 54135, 54640, 55146, 55651, 56157, 56663, 57168, 57675, 58181,
+    58687, 59194, 59700, 60207, 60714, 61221, 61728, 62235, 62743, 63250, 63758, 64265, 64773, 65281, 65535, 65535,
+    65535, 65535, 65204, 64696, 64187, 63679, 63171, 62663, 62155, 61647, 61139, 60631, 60124, 59616, 59109, 58602,
+    58095, 57588, 57081, 56574, 56067, 55561, 55054, 54548, 54042, 53536, 53031, 52525, 52019, 51514, 51009, 50504,
+    50000, 49495, 48991, 48487, 47983, 47479, 46975, 46472, 45969, 45466, 44964, 44462, 43960, 43458, 42957, 42456,
+    41955, 41454, 40954, 40454, 39955, 39456, 38957, 38459, 37961, 37464, 36967, 36470, 35974, 35479, 34984, 34490,
+    33996, 33503, 33010, 32518, 32027, 31537, 31047, 30558, 30070, 29583, 29097, 28611, 28127, 27644, 27162, 26681,
+    26201, 25723, 25246, 24771, 24297, 23825, 23355, 22886, 22419, 21955, 21493, 21033, 20576, 20122, 19670, 19222,
+    18777, 18335, 17898, 17465, 17036, 16612, 16193, 15780, 15373, 14972, 14579, 14193, 13816, 13448, 13089, 12742,
+    12405, 12082, 11772, 11476, 11196, 10934, 10689, 10465, 10261, 10079, 9920, 9786, 9678, 9595, 9540, 9512,
+    9512, 9540, 9595, 9678, 9786, 9920, 10079, 10261, 10465, 10689, 10934, 11196, 11476, 11772, 12082, 12405,
+    12742, 13089, 13448, 13816, 14193, 14579, 14972, 15373, 15780, 16193, 16612, 17036, 17465, 17898, 18335, 18777,
+    19222, 19670, 20122, 20576, 21033, 21493, 21955, 22419, 22886, 23355, 23825, 24297, 24771, 25246, 25723, 26201,
+    26681, 27162, 27644, 28127, 28611, 29097, 29583, 30070, 30558, 31047, 31537, 32027, 32518, 33010, 33503, 33996,
+    34490, 34984, 35479, 35974, 36470, 36967, 37464, 37961, 38459, 38957, 39456, 39955, 40454, 40954, 41454, 41955,
+    42456, 42957, 43458, 43960, 44462, 44964, 45466, 45969, 46472, 46975, 47479, 47983, 48487, 48991, 49495, 50000,
+    50504, 51009, 51514, 52019, 52525, 53031, 53536, 54042, 54548, 55054, 55561, 56067, 56574, 57081, 57588, 58095,
+    58602, 59109, 59616, 60124, 60631, 61139, 61647, 62155, 62663, 63171, 63679, 64187, 64696, 65204, 65535, 65535,
+    65535, 65535, 65131, 64622, 64113, 63604, 63095, 62587, 62078, 61570, 61061, 60553, 60045, 59536, 59028, 58520,
+    58013, 57505, 56997, 56490, 55982, 55475, 54968, 54461, 53954, 53447, 52941, 52434, 51928, 51422, 50916, 50410,
+    49904, 49399, 48894, 48388, 47883, 47379, 46874, 46370, 45866, 45362, 44858, 44355, 43851, 43349, 42846, 42343,
+    41841, 41339, 40838, 40337, 39836, 39335, 38835, 38335, 37836, 37337, 36838, 36340, 35842, 35345, 34848, 34352,
+    33856, 33361, 32866, 32372, 31878, 31386, 30893, 30402, 29912, 29422, 28933, 28445, 27958, 27471, 26986, 26502,
+    26019, 25538, 25057, 24578, 24101, 23624, 23150, 22677, 22206, 21737, 21271, 20806, 20344, 19884, 19427, 18973,
+    18522, 18074, 17630, 17190, 16754, 16323, 15897, 15476, 15060, 14651, 14249, 13854, 13467, 13089, 12721, 12363,
+    12016, 11681, 11360, 11054, 10763, 10490, 10235, 10000, 9786, 9595, 9429, 9288, 9173, 9086, 9028, 8999,
+    8999, 9028, 9086, 9173, 9288, 9429, 9595, 9786, 10000, 10235, 10490, 10763, 11054, 11360, 11681, 12016,
+    12363, 12721, 13089, 13467, 13854, 14249, 14651, 15060, 15476, 15897, 16323, 16754, 17190, 17630, 18074, 18522,
+    18973, 19427, 19884, 20344, 20806, 21271, 21737, 22206, 22677, 23150, 23624, 24101, 24578, 25057, 25538, 26019,
+    26502, 26986, 27471, 27958, 28445, 28933, 29422, 29912, 30402, 30893, 31386, 31878, 32372, 32866, 33361, 33856,
+    34352, 34848, 35345, 35842, 36340, 36838, 37337, 37836, 38335, 38835, 39335, 39836, 40337, 40838, 41339, 41841,
+    42343, 42846, 43349, 43851, 44355, 44858, 45362, 45866, 46370, 46874, 47379, 47883, 48388, 48894, 49399, 49904,
+    50410, 50916, 51422, 51928, 52434, 52941, 53447, 53954, 54461, 54968, 55475, 55982, 56490, 56997, 57505, 58013,
+    58520, 59028, 59536, 60045, 60553, 61061, 61570, 62078, 62587, 63095, 63604, 64113, 64622, 65131, 65535, 65535,
+    65535, 65535, 65062, 64553, 64043, 63534, 63024, 62515, 62006, 61497, 60988, 60479, 59970, 59461, 58952, 58444,
+    57935, 57427, 56918, 56410, 55902, 55394, 54886, 54378, 53871, 53363, 52856, 52349, 51841, 51334, 50828, 50321,
+    49814, 49308, 48802, 48295, 47790, 47284, 46778, 46273, 45768, 45263, 44758, 44253, 43749, 43245, 42741, 42237,
+    41734, 41231, 40728, 40225, 39723, 39221, 38719, 38218, 37717, 37216, 36716, 36216, 35717, 35217, 34719, 34221,
+    33723, 33226, 32729, 32233, 31737, 31242, 30748, 30254, 29761, 29269, 28777, 28286, 27796, 27307, 26819, 26332,
+    25846, 25361, 24877, 24395, 23913, 23434, 22955, 22478, 22003, 21530, 21058, 20589, 20122, 19657, 19194, 18735,
+    18278, 17824, 17374, 16927, 16484, 16046, 15612, 15183, 14759, 14341, 13930, 13526, 13130, 12742, 12363, 11994,
+    11636, 11290, 10958, 10640, 10338, 10053, 9786, 9540, 9316, 9115, 8940, 8791, 8670, 8578, 8516, 8485,
+    8485, 8516, 8578, 8670, 8791, 8940, 9115, 9316, 9540, 9786, 10053, 10338, 10640, 10958, 11290, 11636,
+    11994, 12363, 12742, 13130, 13526, 13930, 14341, 14759, 15183, 15612, 16046, 16484, 16927, 17374, 17824, 18278,
+    18735, 19194, 19657, 20122, 20589, 21058, 21530, 22003, 22478, 22955, 23434, 23913, 24395, 24877, 25361, 25846,
+    26332, 26819, 27307, 27796, 28286, 28777, 29269, 29761, 30254, 30748, 31242, 31737, 32233, 32729, 33226, 33723,
+    34221, 34719, 35217, 35717, 36216, 36716, 37216, 37717, 38218, 38719, 39221, 39723, 40225, 40728, 41231, 41734,
+    42237, 42741, 43245, 43749, 44253, 44758, 45263, 45768, 46273, 46778, 47284, 47790, 48295, 48802, 49308, 49814,
+    50321, 50828, 51334, 51841, 52349, 52856, 53363, 53871, 54378, 54886, 55394, 55902, 56410, 56918, 57427, 57935,
+    58444, 58952, 59461, 59970, 60479, 60988, 61497, 62006, 62515, 63024, 63534, 64043, 64553, 65062, 65535, 65535,
+    65535, 65507, 64997, 64487, 63977, 63467, 62957, 62447, 61938, 61428, 60918, 60409, 59899, 59390, 58880, 58371,
+    57862, 57353, 56844, 56335, 55826, 55318, 54809, 54301, 53792, 53284, 52776, 52268, 51760, 51252, 50744, 50237,
+    49729, 49222, 48715, 48208, 47701, 47194, 46688, 46181, 45675, 45169, 44663, 44158, 43652, 43147, 42642, 42137,
+    41632, 41128, 40624, 40120, 39616, 39113, 38610, 38107, 37605, 37102, 36601, 36099, 35598, 35097, 34597, 34097,
+    33597, 33098, 32600, 32101, 31604, 31107, 30610, 30114, 29619, 29124, 28630, 28137, 27644, 27152, 26661, 26171,
+    25682, 25194, 24707, 24221, 23736, 23252, 22770, 22289, 21810, 21333, 20857, 20383, 19910, 19440, 18973, 18508,
+    18045, 17585, 17129, 16675, 16226, 15780, 15338, 14902, 14470, 14044, 13623, 13210, 12804, 12405, 12016, 11636,
+    11267, 10910, 10565, 10235, 9920, 9623, 9344, 9086, 8851, 8639, 8454, 8296, 8168, 8070, 8004, 7971,
+    7971, 8004, 8070, 8168, 8296, 8454, 8639, 8851, 9086, 9344, 9623, 9920, 10235, 10565, 10910, 11267,
+    11636, 12016, 12405, 12804, 13210, 13623, 14044, 14470, 14902, 15338, 15780, 16226, 16675, 17129, 17585, 18045,
+    18508, 18973, 19440, 19910, 20383, 20857, 21333, 21810, 22289, 22770, 23252, 23736, 24221, 24707, 25194, 25682,
+    26171, 26661, 27152, 27644, 28137, 28630, 29124, 29619, 30114, 30610, 31107, 31604, 32101, 32600, 33098, 33597,
+    34097, 34597, 35097, 35598, 36099, 36601, 37102, 37605, 38107, 38610, 39113, 39616, 40120, 40624, 41128, 41632,
+    42137, 42642, 43147, 43652, 44158, 44663, 45169, 45675, 46181, 46688, 47194, 47701, 48208, 48715, 49222, 49729,
+    50237, 50744, 51252, 51760, 52268, 52776, 53284, 53792, 54301, 54809, 55318, 55826, 56335, 56844, 57353, 57862,
+    58371, 58880, 59390, 59899, 60409, 60918, 61428, 61938, 62447, 62957, 63467, 63977, 64487, 64997, 65507, 65535,
+    65535, 65447, 64936, 64426, 63915, 63405, 62894, 62384, 61874, 61363, 60853, 60343, 59833, 59323, 58813, 58303,
+    57794, 57284, 56774, 56265, 55755, 55246, 54737, 54228, 53719, 53210, 52701, 52192, 51683, 51175, 50666, 50158,
+    49650, 49141, 48633, 48126, 47618, 47110, 46603, 46096, 45588, 45081, 44575, 44068, 43561, 43055, 42549, 42043,
+    41537, 41032, 40526, 40021, 39516, 39012, 38507, 38003, 37499, 36996, 36492, 35989, 35486, 34984, 34482, 33980,
+    33479, 32978, 32478, 31978, 31478, 30979, 30480, 29982, 29485, 28988, 28491, 27995, 27500, 27006, 26512, 26019,
+    25527, 25036, 24546, 24057, 23568, 23081, 22596, 22111, 21628, 21146, 20666, 20187, 19710, 19236, 18763, 18292,
+    17824, 17358, 16896, 16436, 15980, 15527, 15078, 14633, 14193, 13759, 13329, 12906, 12490, 12082, 11681, 11290,
+    10910, 10540, 10183, 9840, 9512, 9202, 8910, 8639, 8391, 8168, 7971, 7804, 7667, 7563, 7493, 7457,
+    7457, 7493, 7563, 7667, 7804, 7971, 8168, 8391, 8639, 8910, 9202, 9512, 9840, 10183, 10540, 10910,
+    11290, 11681, 12082, 12490, 12906, 13329, 13759, 14193, 14633, 15078, 15527, 15980, 16436, 16896, 17358, 17824,
+    18292, 18763, 19236, 19710, 20187, 20666, 21146, 21628, 22111, 22596, 23081, 23568, 24057, 24546, 25036, 25527,
+    26019, 26512, 27006, 27500, 27995, 28491, 28988, 29485, 29982, 30480, 30979, 31478, 31978, 32478, 32978, 33479,
+    33980, 34482, 34984, 35486, 35989, 36492, 36996, 37499, 38003, 38507, 39012, 39516, 40021, 40526, 41032, 41537,
+    42043, 42549, 43055, 43561, 44068, 44575, 45081, 45588, 46096, 46603, 47110, 47618, 48126, 48633, 49141, 49650,
+    50158, 50666, 51175, 51683, 52192, 52701, 53210, 53719, 54228, 54737, 55246, 55755, 56265, 56774, 57284, 57794,
+    58303, 58813, 59323, 59833, 60343, 60853, 61363, 61874, 62384, 62894, 63405, 63915, 64426, 64936, 65447, 65535,
+    65535, 65390, 64879, 64368, 63857, 63346, 62835, 62324, 61814, 61303, 60792, 60282, 59771, 59261, 58750, 58240,
+    57730, 57219, 56709, 56199, 55689, 55179, 54669, 54159, 53650, 53140, 52630, 52121, 51612, 51102, 50593, 50084,
+    49575, 49066, 48557, 48049, 47540, 47032, 46523, 46015, 45507, 44999, 44491, 43984, 43476, 42969, 42462, 41955,
+    41448, 40941, 40435, 39929, 39422, 38917, 38411, 37906, 37400, 36895, 36391, 35886, 35382, 34878, 34375, 33871,
+    33368, 32866, 32364, 31862, 31360, 30859, 30359, 29858, 29359, 28860, 28361, 27863, 27365, 26868, 26372, 25877,
+    25382, 24888, 24395, 23902, 23411, 22921, 22431, 21943, 21456, 20970, 20486, 20003, 19522, 19042, 18565, 18089,
+    17615, 17144, 16675, 16209, 15746, 15287, 14830, 14378, 13930, 13487, 13049, 12617, 12191, 11772, 11360, 10958,
+    10565, 10183, 9813, 9457, 9115, 8791, 8485, 8200, 7938, 7701, 7493, 7314, 7168, 7057, 6982, 6944,
+    6944, 6982, 7057, 7168, 7314, 7493, 7701, 7938, 8200, 8485, 8791, 9115, 9457, 9813, 10183, 10565,
+    10958, 11360, 11772, 12191, 12617, 13049, 13487, 13930, 14378, 14830, 15287, 15746, 16209, 16675, 17144, 17615,
+    18089, 18565, 19042, 19522, 20003, 20486, 20970, 21456, 21943, 22431, 22921, 23411, 23902, 24395, 24888, 25382,
+    25877, 26372, 26868, 27365, 27863, 28361, 28860, 29359, 29858, 30359, 30859, 31360, 31862, 32364, 32866, 33368,
+    33871, 34375, 34878, 35382, 35886, 36391, 36895, 37400, 37906, 38411, 38917, 39422, 39929, 40435, 40941, 41448,
+    41955, 42462, 42969, 43476, 43984, 44491, 44999, 45507, 46015, 46523, 47032, 47540, 48049, 48557, 49066, 49575,
+    50084, 50593, 51102, 51612, 52121, 52630, 53140, 53650, 54159, 54669, 55179, 55689, 56199, 56709, 57219, 57730,
+    58240, 58750, 59261, 59771, 60282, 60792, 61303, 61814, 62324, 62835, 63346, 63857, 64368, 64879, 65390, 65535,
+    65535, 65338, 64826, 64315, 63803, 63292, 62781, 62269, 61758, 61247, 60736, 60225, 59714, 59203, 58692, 58181,
+    57670, 57159, 56649, 56138, 55627, 55117, 54606, 54096, 53586, 53075, 52565, 52055, 51545, 51035, 50525, 50015,
+    49506, 48996, 48487, 47977, 47468, 46959, 46450, 45941, 45432, 44923, 44414, 43906, 43397, 42889, 42381, 41873,
+    41365, 40857, 40350, 39842, 39335, 38828, 38321, 37815, 37308, 36802, 36296, 35790, 35285, 34780, 34275, 33770,
+    33265, 32761, 32257, 31754, 31251, 30748, 30245, 29743, 29242, 28740, 28240, 27739, 27240, 26740, 26242, 25744,
+    25246, 24750, 24254, 23758, 23264, 22770, 22278, 21786, 21295, 20806, 20318, 19831, 19345, 18861, 18379, 17898,
+    17419, 16943, 16468, 15996, 15527, 15060, 14597, 14137, 13681, 13230, 12783, 12341, 11906, 11476, 11054, 10640,
+    10235, 9840, 9457, 9086, 8730, 8391, 8070, 7770, 7493, 7242, 7019, 6829, 6672, 6552, 6471, 6430,
+    6430, 6471, 6552, 6672, 6829, 7019, 7242, 7493, 7770, 8070, 8391, 8730, 9086, 9457, 9840, 10235,
+    10640, 11054, 11476, 11906, 12341, 12783, 13230, 13681, 14137, 14597, 15060, 15527, 15996, 16468, 16943, 17419,
+    17898, 18379, 18861, 19345, 19831, 20318, 20806, 21295, 21786, 22278, 22770, 23264, 23758, 24254, 24750, 25246,
+    25744, 26242, 26740, 27240, 27739, 28240, 28740, 29242, 29743, 30245, 30748, 31251, 31754, 32257, 32761, 33265,
+    33770, 34275, 34780, 35285, 35790, 36296, 36802, 37308, 37815, 38321, 38828, 39335, 39842, 40350, 40857, 41365,
+    41873, 42381, 42889, 43397, 43906, 44414, 44923, 45432, 45941, 46450, 46959, 47468, 47977, 48487, 48996, 49506,
+    50015, 50525, 51035, 51545, 52055, 52565, 53075, 53586, 54096, 54606, 55117, 55627, 56138, 56649, 57159, 57670,
+    58181, 58692, 59203, 59714, 60225, 60736, 61247, 61758, 62269, 62781, 63292, 63803, 64315, 64826, 65338, 65535,
+    65535, 65289, 64777, 64265, 63754, 63242, 62730, 62218, 61707, 61195, 60684, 60172, 59661, 59149, 58638, 58126,
+    57615, 57104, 56593, 56081, 55570, 55059, 54548, 54037, 53526, 53016, 52505, 51994, 51483, 50973, 50462, 49952,
+    49442, 48931, 48421, 47911, 47401, 46891, 46381, 45871, 45362, 44852, 44343, 43833, 43324, 42815, 42306, 41797,
+    41288, 40780, 40271, 39763, 39255, 38747, 38239, 37731, 37223, 36716, 36209, 35702, 35195, 34688, 34182, 33676,
+    33170, 32664, 32159, 31654, 31149, 30644, 30140, 29636, 29133, 28630, 28127, 27625, 27123, 26622, 26121, 25620,
+    25120, 24621, 24122, 23624, 23127, 22631, 22135, 21640, 21146, 20653, 20161, 19670, 19181, 18692, 18205, 17720,
+    17236, 16754, 16274, 15797, 15321, 14848, 14378, 13911, 13448, 12988, 12533, 12082, 11636, 11196, 10763, 10338,
+    9920, 9512, 9115, 8730, 8359, 8004, 7667, 7350, 7057, 6790, 6552, 6347, 6179, 6049, 5961, 5917,
+    5917, 5961, 6049, 6179, 6347, 6552, 6790, 7057, 7350, 7667, 8004, 8359, 8730, 9115, 9512, 9920,
+    10338, 10763, 11196, 11636, 12082, 12533, 12988, 13448, 13911, 14378, 14848, 15321, 15797, 16274, 16754, 17236,
+    17720, 18205, 18692, 19181, 19670, 20161, 20653, 21146, 21640, 22135, 22631, 23127, 23624, 24122, 24621, 25120,
+    25620, 26121, 26622, 27123, 27625, 28127, 28630, 29133, 29636, 30140, 30644, 31149, 31654, 32159, 32664, 33170,
+    33676, 34182, 34688, 35195, 35702, 36209, 36716, 37223, 37731, 38239, 38747, 39255, 39763, 40271, 40780, 41288,
+    41797, 42306, 42815, 43324, 43833, 44343, 44852, 45362, 45871, 46381, 46891, 47401, 47911, 48421, 48931, 49442,
+    49952, 50462, 50973, 51483, 51994, 52505, 53016, 53526, 54037, 54548, 55059, 55570, 56081, 56593, 57104, 57615,
+    58126, 58638, 59149, 59661, 60172, 60684, 61195, 61707, 62218, 62730, 63242, 63754, 64265, 64777, 65289, 65535,
+    65535, 65245, 64732, 64220, 63708, 63196, 62684, 62172, 61660, 61148, 60636, 60124, 59612, 59100, 58588, 58076,
+    57565, 57053, 56541, 56030, 55518, 55006, 54495, 53983, 53472, 52961, 52449, 51938, 51427, 50916, 50405, 49894,
+    49383, 48872, 48361, 47850, 47340, 46829, 46319, 45808, 45298, 44787, 44277, 43767, 43257, 42747, 42237, 41727,
+    41218, 40708, 40199, 39690, 39180, 38671, 38163, 37654, 37145, 36637, 36128, 35620, 35112, 34604, 34097, 33589,
+    33082, 32575, 32068, 31562, 31056, 30550, 30044, 29538, 29033, 28528, 28024, 27519, 27016, 26512, 26009, 25507,
+    25004, 24503, 24002, 23501, 23001, 22502, 22003, 21505, 21008, 20512, 20016, 19522, 19028, 18536, 18045, 17555,
+    17067, 16580, 16095, 15612, 15130, 14651, 14175, 13701, 13230, 12762, 12298, 11839, 11384, 10934, 10490, 10053,
+    9623, 9202, 8791, 8391, 8004, 7633, 7278, 6944, 6632, 6347, 6093, 5872, 5689, 5548, 5452, 5403,
+    5403, 5452, 5548, 5689, 5872, 6093, 6347, 6632, 6944, 7278, 7633, 8004, 8391, 8791, 9202, 9623,
+    10053, 10490, 10934, 11384, 11839, 12298, 12762, 13230, 13701, 14175, 14651, 15130, 15612, 16095, 16580, 17067,
+    17555, 18045, 18536, 19028, 19522, 20016, 20512, 21008, 21505, 22003, 22502, 23001, 23501, 24002, 24503, 25004,
+    25507, 26009, 26512, 27016, 27519, 28024, 28528, 29033, 29538, 30044, 30550, 31056, 31562, 32068, 32575, 33082,
+    33589, 34097, 34604, 35112, 35620, 36128, 36637, 37145, 37654, 38163, 38671, 39180, 39690, 40199, 40708, 41218,
+    41727, 42237, 42747, 43257, 43767, 44277, 44787, 45298, 45808, 46319, 46829, 47340, 47850, 48361, 48872, 49383,
+    49894, 50405, 50916, 51427, 51938, 52449, 52961, 53472, 53983, 54495, 55006, 55518, 56030, 56541, 57053, 57565,
+    58076, 58588, 59100, 59612, 60124, 60636, 61148, 61660, 62172, 62684, 63196, 63708, 64220, 64732, 65245, 65535,
+    65535, 65204, 64692, 64179, 63667, 63154, 62642, 62129, 61617, 61104, 60592, 60080, 59567, 59055, 58543, 58031,
+    57519, 57007, 56494, 55982, 55470, 54958, 54446, 53934, 53423, 52911, 52399, 51887, 51376, 50864, 50352, 49841,
+    49329, 48818, 48306, 47795, 47284, 46773, 46261, 45750, 45239, 44728, 44217, 43707, 43196, 42685, 42175, 41664,
+    41154, 40643, 40133, 39623, 39113, 38603, 38093, 37584, 37074, 36565, 36055, 35546, 35037, 34528, 34019, 33511,
+    33002, 32494, 31986, 31478, 30970, 30463, 29956, 29449, 28942, 28435, 27929, 27423, 26918, 26412, 25907, 25403,
+    24899, 24395, 23891, 23388, 22886, 22384, 21883, 21382, 20882, 20383, 19884, 19386, 18889, 18393, 17898, 17404,
+    16911, 16420, 15930, 15441, 14955, 14470, 13987, 13507, 13029, 12554, 12082, 11613, 11149, 10689, 10235, 9786,
+    9344, 8910, 8485, 8070, 7667, 7278, 6906, 6552, 6221, 5917, 5642, 5403, 5204, 5049, 4943, 4890,
+    4890, 4943, 5049, 5204, 5403, 5642, 5917, 6221, 6552, 6906, 7278, 7667, 8070, 8485, 8910, 9344,
+    9786, 10235, 10689, 11149, 11613, 12082, 12554, 13029, 13507, 13987, 14470, 14955, 15441, 15930, 16420, 16911,
+    17404, 17898, 18393, 18889, 19386, 19884, 20383, 20882, 21382, 21883, 22384, 22886, 23388, 23891, 24395, 24899,
+    25403, 25907, 26412, 26918, 27423, 27929, 28435, 28942, 29449, 29956, 30463, 30970, 31478, 31986, 32494, 33002,
+    33511, 34019, 34528, 35037, 35546, 36055, 36565, 37074, 37584, 38093, 38603, 39113, 39623, 40133, 40643, 41154,
+    41664, 42175, 42685, 43196, 43707, 44217, 44728, 45239, 45750, 46261, 46773, 47284, 47795, 48306, 48818, 49329,
+    49841, 50352, 50864, 51376, 51887, 52399, 52911, 53423, 53934, 54446, 54958, 55470, 55982, 56494, 57007, 57519,
+    58031, 58543, 59055, 59567, 60080, 60592, 61104, 61617, 62129, 62642, 63154, 63667, 64179, 64692, 65204, 65535,
+    65535, 65168, 64655, 64142, 63629, 63116, 62604, 62091, 61578, 61065, 60553, 60040, 59528, 59015, 58502, 57990,
+    57477, 56965, 56452, 55940, 55427, 54915, 54403, 53890, 53378, 52866, 52354, 51841, 51329, 50817, 50305, 49793,
+    49281, 48769, 48257, 47745, 47233, 46722, 46210, 45698, 45187, 44675, 44164, 43652, 43141, 42629, 42118, 41607,
+    41096, 40585, 40074, 39563, 39052, 38541, 38031, 37520, 37010, 36499, 35989, 35479, 34969, 34459, 33949, 33440,
+    32930, 32421, 31911, 31402, 30893, 30385, 29876, 29368, 28860, 28352, 27844, 27336, 26829, 26322, 25815, 25309,
+    24803, 24297, 23792, 23287, 22782, 22278, 21774, 21271, 20768, 20266, 19764, 19263, 18763, 18263, 17765, 17267,
+    16770, 16274, 15780, 15287, 14795, 14305, 13816, 13329, 12845, 12363, 11883, 11407, 10934, 10465, 10000, 9540,
+    9086, 8639, 8200, 7770, 7350, 6944, 6552, 6179, 5827, 5500, 5204, 4943, 4725, 4554, 4437, 4377,
+    4377, 4437, 4554, 4725, 4943, 5204, 5500, 5827, 6179, 6552, 6944, 7350, 7770, 8200, 8639, 9086,
+    9540, 10000, 10465, 10934, 11407, 11883, 12363, 12845, 13329, 13816, 14305, 14795, 15287, 15780, 16274, 16770,
+    17267, 17765, 18263, 18763, 19263, 19764, 20266, 20768, 21271, 21774, 22278, 22782, 23287, 23792, 24297, 24803,
+    25309, 25815, 26322, 26829, 27336, 27844, 28352, 28860, 29368, 29876, 30385, 30893, 31402, 31911, 32421, 32930,
+    33440, 33949, 34459, 34969, 35479, 35989, 36499, 37010, 37520, 38031, 38541, 39052, 39563, 40074, 40585, 41096,
+    41607, 42118, 42629, 43141, 43652, 44164, 44675, 45187, 45698, 46210, 46722, 47233, 47745, 48257, 48769, 49281,
+    49793, 50305, 50817, 51329, 51841, 52354, 52866, 53378, 53890, 54403, 54915, 55427, 55940, 56452, 56965, 57477,
+    57990, 58502, 59015, 59528, 60040, 60553, 61065, 61578, 62091, 62604, 63116, 63629, 64142, 64655, 65168, 65535,
+    65535, 65135, 64622, 64109, 63596, 63083, 62570, 62057, 61544, 61031, 60518, 60005, 59492, 58979, 58466, 57953,
+    57441, 56928, 56415, 55902, 55389, 54877, 54364, 53851, 53338, 52826, 52313, 51801, 51288, 50776, 50263, 49751,
+    49238, 48726, 48213, 47701, 47189, 46676, 46164, 45652, 45140, 44628, 44116, 43604, 43092, 42580, 42068, 41556,
+    41044, 40533, 40021, 39510, 38998, 38487, 37975, 37464, 36953, 36441, 35930, 35419, 34909, 34398, 33887, 33376,
+    32866, 32355, 31845, 31335, 30825, 30315, 29805, 29296, 28786, 28277, 27768, 27259, 26750, 26242, 25733, 25225,
+    24717, 24210, 23703, 23196, 22689, 22183, 21677, 21171, 20666, 20161, 19657, 19153, 18650, 18147, 17645, 17144,
+    16644, 16144, 15645, 15148, 14651, 14156, 13662, 13170, 12679, 12191, 11704, 11220, 10739, 10261, 9786, 9316,
+    8851, 8391, 7938, 7493, 7057, 6632, 6221, 5827, 5452, 5101, 4780, 4496, 4254, 4064, 3931, 3864,
+    3864, 3931, 4064, 4254, 4496, 4780, 5101, 5452, 5827, 6221, 6632, 7057, 7493, 7938, 8391, 8851,
+    9316, 9786, 10261, 10739, 11220, 11704, 12191, 12679, 13170, 13662, 14156, 14651, 15148, 15645, 16144, 16644,
+    17144, 17645, 18147, 18650, 19153, 19657, 20161, 20666, 21171, 21677, 22183, 22689, 23196, 23703, 24210, 24717,
+    25225, 25733, 26242, 26750, 27259, 27768, 28277, 28786, 29296, 29805, 30315, 30825, 31335, 31845, 32355, 32866,
+    33376, 33887, 34398, 34909, 35419, 35930, 36441, 36953, 37464, 37975, 38487, 38998, 39510, 40021, 40533, 41044,
+    41556, 42068, 42580, 43092, 43604, 44116, 44628, 45140, 45652, 46164, 46676, 47189, 47701, 48213, 48726, 49238,
+    49751, 50263, 50776, 51288, 51801, 52313, 52826, 53338, 53851, 54364, 54877, 55389, 55902, 56415, 56928, 57441,
+    57953, 58466, 58979, 59492, 60005, 60518, 61031, 61544, 62057, 62570, 63083, 63596, 64109, 64622, 65135, 65535,
+    65535, 65107, 64593, 64080, 63567, 63054, 62540, 62027, 61514, 61001, 60487, 59974, 59461, 58948, 58435, 57921,
+    57408, 56895, 56382, 55869, 55356, 54843, 54330, 53817, 53304, 52791, 52278, 51765, 51252, 50739, 50226, 49713,
+    49201, 48688, 48175, 47662, 47150, 46637, 46124, 45612, 45099, 44586, 44074, 43561, 43049, 42536, 42024, 41512,
+    40999, 40487, 39975, 39463, 38951, 38438, 37926, 37414, 36903, 36391, 35879, 35367, 34855, 34344, 33832, 33321,
+    32810, 32298, 31787, 31276, 30765, 30254, 29743, 29233, 28722, 28212, 27701, 27191, 26681, 26171, 25661, 25152,
+    24643, 24133, 23624, 23116, 22607, 22099, 21591, 21083, 20576, 20069, 19562, 19056, 18550, 18045, 17540, 17036,
+    16532, 16029, 15527, 15025, 14524, 14025, 13526, 13029, 12533, 12038, 11545, 11054, 10565, 10079, 9595, 9115,
+    8639, 8168, 7701, 7242, 6790, 6347, 5917, 5500, 5101, 4725, 4377, 4064, 3795, 3580, 3429, 3351,
+    3351, 3429, 3580, 3795, 4064, 4377, 4725, 5101, 5500, 5917, 6347, 6790, 7242, 7701, 8168, 8639,
+    9115, 9595, 10079, 10565, 11054, 11545, 12038, 12533, 13029, 13526, 14025, 14524, 15025, 15527, 16029, 16532,
+    17036, 17540, 18045, 18550, 19056, 19562, 20069, 20576, 21083, 21591, 22099, 22607, 23116, 23624, 24133, 24643,
+    25152, 25661, 26171, 26681, 27191, 27701, 28212, 28722, 29233, 29743, 30254, 30765, 31276, 31787, 32298, 32810,
+    33321, 33832, 34344, 34855, 35367, 35879, 36391, 36903, 37414, 37926, 38438, 38951, 39463, 39975, 40487, 40999,
+    41512, 42024, 42536, 43049, 43561, 44074, 44586, 45099, 45612, 46124, 46637, 47150, 47662, 48175, 48688, 49201,
+    49713, 50226, 50739, 51252, 51765, 52278, 52791, 53304, 53817, 54330, 54843, 55356, 55869, 56382, 56895, 57408,
+    57921, 58435, 58948, 59461, 59974, 60487, 61001, 61514, 62027, 62540, 63054, 63567, 64080, 64593, 65107, 65535,
+    65535, 65082, 64569, 64055, 63542, 63028, 62515, 62001, 61488, 60975, 60461, 59948, 59434, 58921, 58407, 57894,
+    57381, 56867, 56354, 55841, 55327, 54814, 54301, 53787, 53274, 52761, 52248, 51734, 51221, 50708, 50195, 49681,
+    49168, 48655, 48142, 47629, 47116, 46603, 46090, 45577, 45064, 44551, 44038, 43525, 43012, 42499, 41986, 41473,
+    40961, 40448, 39935, 39422, 38910, 38397, 37885, 37372, 36860, 36347, 35835, 35322, 34810, 34298, 33785, 33273,
+    32761, 32249, 31737, 31225, 30713, 30202, 29690, 29178, 28667, 28155, 27644, 27133, 26622, 26110, 25600, 25089,
+    24578, 24068, 23557, 23047, 22537, 22027, 21518, 21008, 20499, 19990, 19481, 18973, 18465, 17957, 17450, 16943,
+    16436, 15930, 15424, 14919, 14415, 13911, 13408, 12906, 12405, 11906, 11407, 10910, 10414, 9920, 9429, 8940,
+    8454, 7971, 7493, 7019, 6552, 6093, 5642, 5204, 4780, 4377, 3998, 3653, 3351, 3105, 2930, 2839,
+    2839, 2930, 3105, 3351, 3653, 3998, 4377, 4780, 5204, 5642, 6093, 6552, 7019, 7493, 7971, 8454,
+    8940, 9429, 9920, 10414, 10910, 11407, 11906, 12405, 12906, 13408, 13911, 14415, 14919, 15424, 15930, 16436,
+    16943, 17450, 17957, 18465, 18973, 19481, 19990, 20499, 21008, 21518, 22027, 22537, 23047, 23557, 24068, 24578,
+    25089, 25600, 26110, 26622, 27133, 27644, 28155, 28667, 29178, 29690, 30202, 30713, 31225, 31737, 32249, 32761,
+    33273, 33785, 34298, 34810, 35322, 35835, 36347, 36860, 37372, 37885, 38397, 38910, 39422, 39935, 40448, 40961,
+    41473, 41986, 42499, 43012, 43525, 44038, 44551, 45064, 45577, 46090, 46603, 47116, 47629, 48142, 48655, 49168,
+    49681, 50195, 50708, 51221, 51734, 52248, 52761, 53274, 53787, 54301, 54814, 55327, 55841, 56354, 56867, 57381,
+    57894, 58407, 58921, 59434, 59948, 60461, 60975, 61488, 62001, 62515, 63028, 63542, 64055, 64569, 65082, 65535,
+    65535, 65062, 64548, 64035, 63521, 63007, 62494, 61980, 61467, 60953, 60439, 59926, 59412, 58898, 58385, 57871,
+    57358, 56844, 56331, 55817, 55303, 54790, 54276, 53763, 53249, 52736, 52222, 51709, 51195, 50682, 50168, 49655,
+    49141, 48628, 48115, 47601, 47088, 46574, 46061, 45548, 45034, 44521, 44008, 43495, 42981, 42468, 41955, 41442,
+    40928, 40415, 39902, 39389, 38876, 38363, 37850, 37337, 36824, 36311, 35798, 35285, 34772, 34259, 33746, 33234,
+    32721, 32208, 31696, 31183, 30670, 30158, 29645, 29133, 28621, 28108, 27596, 27084, 26572, 26060, 25548, 25036,
+    24524, 24013, 23501, 22990, 22478, 21967, 21456, 20945, 20434, 19924, 19413, 18903, 18393, 17883, 17374, 16864,
+    16355, 15847, 15338, 14830, 14323, 13816, 13310, 12804, 12298, 11794, 11290, 10788, 10286, 9786, 9288, 8791,
+    8296, 7804, 7314, 6829, 6347, 5872, 5403, 4943, 4496, 4064, 3653, 3271, 2930, 2646, 2438, 2327,
+    2327, 2438, 2646, 2930, 3271, 3653, 4064, 4496, 4943, 5403, 5872, 6347, 6829, 7314, 7804, 8296,
+    8791, 9288, 9786, 10286, 10788, 11290, 11794, 12298, 12804, 13310, 13816, 14323, 14830, 15338, 15847, 16355,
+    16864, 17374, 17883, 18393, 18903, 19413, 19924, 20434, 20945, 21456, 21967, 22478, 22990, 23501, 24013, 24524,
+    25036, 25548, 26060, 26572, 27084, 27596, 28108, 28621, 29133, 29645, 30158, 30670, 31183, 31696, 32208, 32721,
+    33234, 33746, 34259, 34772, 35285, 35798, 36311, 36824, 37337, 37850, 38363, 38876, 39389, 39902, 40415, 40928,
+    41442, 41955, 42468, 42981, 43495, 44008, 44521, 45034, 45548, 46061, 46574, 47088, 47601, 48115, 48628, 49141,
+    49655, 50168, 50682, 51195, 51709, 52222, 52736, 53249, 53763, 54276, 54790, 55303, 55817, 56331, 56844, 57358,
+    57871, 58385, 58898, 59412, 59926, 60439, 60953, 61467, 61980, 62494, 63007, 63521, 64035, 64548, 65062, 65535,
+    65535, 65046, 64532, 64018, 63504, 62991, 62477, 61963, 61449, 60936, 60422, 59908, 59394, 58880, 58367, 57853,
+    57339, 56825, 56312, 55798, 55284, 54771, 54257, 53743, 53229, 52716, 52202, 51688, 51175, 50661, 50147, 49634,
+    49120, 48606, 48093, 47579, 47065, 46552, 46038, 45525, 45011, 44497, 43984, 43470, 42957, 42443, 41930, 41416,
+    40903, 40389, 39876, 39362, 38849, 38335, 37822, 37308, 36795, 36282, 35768, 35255, 34742, 34228, 33715, 33202,
+    32689, 32175, 31662, 31149, 30636, 30123, 29610, 29097, 28584, 28071, 27558, 27045, 26532, 26019, 25507, 24994,
+    24481, 23969, 23456, 22944, 22431, 21919, 21407, 20895, 20383, 19871, 19359, 18847, 18335, 17824, 17313, 16802,
+    16291, 15780, 15269, 14759, 14249, 13739, 13230, 12721, 12212, 11704, 11196, 10689, 10183, 9678, 9173, 8670,
+    8168, 7667, 7168, 6672, 6179, 5689, 5204, 4725, 4254, 3795, 3351, 2930, 2544, 2211, 1957, 1817,
+    1817, 1957, 2211, 2544, 2930, 3351, 3795, 4254, 4725, 5204, 5689, 6179, 6672, 7168, 7667, 8168,
+    8670, 9173, 9678, 10183, 10689, 11196, 11704, 12212, 12721, 13230, 13739, 14249, 14759, 15269, 15780, 16291,
+    16802, 17313, 17824, 18335, 18847, 19359, 19871, 20383, 20895, 21407, 21919, 22431, 22944, 23456, 23969, 24481,
+    24994, 25507, 26019, 26532, 27045, 27558, 28071, 28584, 29097, 29610, 30123, 30636, 31149, 31662, 32175, 32689,
+    33202, 33715, 34228, 34742, 35255, 35768, 36282, 36795, 37308, 37822, 38335, 38849, 39362, 39876, 40389, 40903,
+    41416, 41930, 42443, 42957, 43470, 43984, 44497, 45011, 45525, 46038, 46552, 47065, 47579, 48093, 48606, 49120,
+    49634, 50147, 50661, 51175, 51688, 52202, 52716, 53229, 53743, 54257, 54771, 55284, 55798, 56312, 56825, 57339,
+    57853, 58367, 58880, 59394, 59908, 60422, 60936, 61449, 61963, 62477, 62991, 63504, 64018, 64532, 65046, 65535,
+    65535, 65034, 64520, 64006, 63492, 62978, 62464, 61950, 61436, 60923, 60409, 59895, 59381, 58867, 58353, 57839,
+    57325, 56812, 56298, 55784, 55270, 54756, 54242, 53728, 53215, 52701, 52187, 51673, 51159, 50645, 50131, 49618,
+    49104, 48590, 48076, 47562, 47049, 46535, 46021, 45507, 44993, 44480, 43966, 43452, 42938, 42424, 41911, 41397,
+    40883, 40369, 39856, 39342, 38828, 38315, 37801, 37287, 36773, 36260, 35746, 35232, 34719, 34205, 33692, 33178,
+    32664, 32151, 31637, 31124, 30610, 30096, 29583, 29069, 28556, 28042, 27529, 27016, 26502, 25989, 25475, 24962,
+    24449, 23936, 23422, 22909, 22396, 21883, 21370, 20857, 20344, 19831, 19318, 18805, 18292, 17779, 17267, 16754,
+    16242, 15730, 15217, 14705, 14193, 13681, 13170, 12658, 12147, 11636, 11125, 10615, 10105, 9595, 9086, 8578,
+    8070, 7563, 7057, 6552, 6049, 5548, 5049, 4554, 4064, 3580, 3105, 2646, 2211, 1817, 1499, 1310,
+    1310, 1499, 1817, 2211, 2646, 3105, 3580, 4064, 4554, 5049, 5548, 6049, 6552, 7057, 7563, 8070,
+    8578, 9086, 9595, 10105, 10615, 11125, 11636, 12147, 12658, 13170, 13681, 14193, 14705, 15217, 15730, 16242,
+    16754, 17267, 17779, 18292, 18805, 19318, 19831, 20344, 20857, 21370, 21883, 22396, 22909, 23422, 23936, 24449,
+    24962, 25475, 25989, 26502, 27016, 27529, 28042, 28556, 29069, 29583, 30096, 30610, 31124, 31637, 32151, 32664,
+    33178, 33692, 34205, 34719, 35232, 35746, 36260, 36773, 37287, 37801, 38315, 38828, 39342, 39856, 40369, 40883,
+    41397, 41911, 42424, 42938, 43452, 43966, 44480, 44993, 45507, 46021, 46535, 47049, 47562, 48076, 48590, 49104,
+    49618, 50131, 50645, 51159, 51673, 52187, 52701, 53215, 53728, 54242, 54756, 55270, 55784, 56298, 56812, 57325,
+    57839, 58353, 58867, 59381, 59895, 60409, 60923, 61436, 61950, 62464, 62978, 63492, 64006, 64520, 65034, 65535,
+    65535, 65026, 64512, 63998, 63484, 62970, 62456, 61942, 61428, 60914, 60400, 59886, 59372, 58858, 58344, 57830,
+    57316, 56802, 56288, 55774, 55260, 54746, 54232, 53719, 53205, 52691, 52177, 51663, 51149, 50635, 50121, 49607,
+    49093, 48579, 48065, 47551, 47037, 46523, 46009, 45496, 44982, 44468, 43954, 43440, 42926, 42412, 41898, 41384,
+    40870, 40356, 39842, 39329, 38815, 38301, 37787, 37273, 36759, 36245, 35731, 35217, 34704, 34190, 33676, 33162,
+    32648, 32134, 31620, 31107, 30593, 30079, 29565, 29051, 28537, 28024, 27510, 26996, 26482, 25968, 25455, 24941,
+    24427, 23913, 23400, 22886, 22372, 21859, 21345, 20831, 20318, 19804, 19290, 18777, 18263, 17750, 17236, 16723,
+    16209, 15696, 15183, 14669, 14156, 13643, 13130, 12617, 12104, 11591, 11078, 10565, 10053, 9540, 9028, 8516,
+    8004, 7493, 6982, 6471, 5961, 5452, 4943, 4437, 3931, 3429, 2930, 2438, 1957, 1499, 1090, 813,
+    813, 1090, 1499, 1957, 2438, 2930, 3429, 3931, 4437, 4943, 5452, 5961, 6471, 6982, 7493, 8004,
+    8516, 9028, 9540, 10053, 10565, 11078, 11591, 12104, 12617, 13130, 13643, 14156, 14669, 15183, 15696, 16209,
+    16723, 17236, 17750, 18263, 18777, 19290, 19804, 20318, 20831, 21345, 21859, 22372, 22886, 23400, 23913, 24427,
+    24941, 25455, 25968, 26482, 26996, 27510, 28024, 28537, 29051, 29565, 30079, 30593, 31107, 31620, 32134, 32648,
+    33162, 33676, 34190, 34704, 35217, 35731, 36245, 36759, 37273, 37787, 38301, 38815, 39329, 39842, 40356, 40870,
+    41384, 41898, 42412, 42926, 43440, 43954, 44468, 44982, 45496, 46009, 46523, 47037, 47551, 48065, 48579, 49093,
+    49607, 50121, 50635, 51149, 51663, 52177, 52691, 53205, 53719, 54232, 54746, 55260, 55774, 56288, 56802, 57316,
+    57830, 58344, 58858, 59372, 59886, 60400, 60914, 61428, 61942, 62456, 62970, 63484, 63998, 64512, 65026, 65535,
+    65535, 65022, 64508, 63994, 63480, 62966, 62452, 61938, 61424, 60910, 60396, 59882, 59368, 58854, 58340, 57826,
+    57312, 56798, 56284, 55770, 55256, 54742, 54228, 53714, 53200, 52686, 52172, 51658, 51144, 50630, 50116, 49602,
+    49088, 48574, 48060, 47546, 47032, 46518, 46004, 45490, 44976, 44462, 43948, 43434, 42920, 42406, 41892, 41378,
+    40864, 40350, 39836, 39322, 38808, 38294, 37780, 37266, 36752, 36238, 35724, 35210, 34696, 34182, 33668, 33154,
+    32640, 32126, 31612, 31098, 30584, 30070, 29556, 29042, 28528, 28014, 27500, 26986, 26472, 25958, 25444, 24930,
+    24416, 23902, 23388, 22874, 22360, 21847, 21333, 20819, 20305, 19791, 19277, 18763, 18249, 17735, 17221, 16707,
+    16193, 15679, 15165, 14651, 14137, 13623, 13110, 12596, 12082, 11568, 11054, 10540, 10026, 9512, 8999, 8485,
+    7971, 7457, 6944, 6430, 5917, 5403, 4890, 4377, 3864, 3351, 2839, 2327, 1817, 1310, 813, 363,
+    363, 813, 1310, 1817, 2327, 2839, 3351, 3864, 4377, 4890, 5403, 5917, 6430, 6944, 7457, 7971,
+    8485, 8999, 9512, 10026, 10540, 11054, 11568, 12082, 12596, 13110, 13623, 14137, 14651, 15165, 15679, 16193,
+    16707, 17221, 17735, 18249, 18763, 19277, 19791, 20305, 20819, 21333, 21847, 22360, 22874, 23388, 23902, 24416,
+    24930, 25444, 25958, 26472, 26986, 27500, 28014, 28528, 29042, 29556, 30070, 30584, 31098, 31612, 32126, 32640,
+    33154, 33668, 34182, 34696, 35210, 35724, 36238, 36752, 37266, 37780, 38294, 38808, 39322, 39836, 40350, 40864,
+    41378, 41892, 42406, 42920, 43434, 43948, 44462, 44976, 45490, 46004, 46518, 47032, 47546, 48060, 48574, 49088,
+    49602, 50116, 50630, 51144, 51658, 52172, 52686, 53200, 53714, 54228, 54742, 55256, 55770, 56284, 56798, 57312,
+    57826, 58340, 58854, 59368, 59882, 60396, 60910, 61424, 61938, 62452, 62966, 63480, 63994, 64508, 65022, 65535,
+    65535, 65022, 64508, 63994, 63480, 62966, 62452, 61938, 61424, 60910, 60396, 59882, 59368, 58854, 58340, 57826,
+    57312, 56798, 56284, 55770, 55256, 54742, 54228, 53714, 53200, 52686, 52172, 51658, 51144, 50630, 50116, 49602,
+    49088, 48574, 48060, 47546, 47032, 46518, 46004, 45490, 44976, 44462, 43948, 43434, 42920, 42406, 41892, 41378,
+    40864, 40350, 39836, 39322, 38808, 38294, 37780, 37266, 36752, 36238, 35724, 35210, 34696, 34182, 33668, 33154,
+    32640, 32126, 31612, 31098, 30584, 30070, 29556, 29042, 28528, 28014, 27500, 26986, 26472, 25958, 25444, 24930,
+    24416, 23902, 23388, 22874, 22360, 21847, 21333, 20819, 20305, 19791, 19277, 18763, 18249, 17735, 17221, 16707,
+    16193, 15679, 15165, 14651, 14137, 13623, 13110, 12596, 12082, 11568, 11054, 10540, 10026, 9512, 8999, 8485,
+    7971, 7457, 6944, 6430, 5917, 5403, 4890, 4377, 3864, 3351, 2839, 2327, 1817, 1310, 813, 363,
+    363, 813, 1310, 1817, 2327, 2839, 3351, 3864, 4377, 4890, 5403, 5917, 6430, 6944, 7457, 7971,
+    8485, 8999, 9512, 10026, 10540, 11054, 11568, 12082, 12596, 13110, 13623, 14137, 14651, 15165, 15679, 16193,
+    16707, 17221, 17735, 18249, 18763, 19277, 19791, 20305, 20819, 21333, 21847, 22360, 22874, 23388, 23902, 24416,
+    24930, 25444, 25958, 26472, 26986, 27500, 28014, 28528, 29042, 29556, 30070, 30584, 31098, 31612, 32126, 32640,
+    33154, 33668, 34182, 34696, 35210, 35724, 36238, 36752, 37266, 37780, 38294, 38808, 39322, 39836, 40350, 40864,
+    41378, 41892, 42406, 42920, 43434, 43948, 44462, 44976, 45490, 46004, 46518, 47032, 47546, 48060, 48574, 49088,
+    49602, 50116, 50630, 51144, 51658, 52172, 52686, 53200, 53714, 54228, 54742, 55256, 55770, 56284, 56798, 57312,
+    57826, 58340, 58854, 59368, 59882, 60396, 60910, 61424, 61938, 62452, 62966, 63480, 63994, 64508, 65022, 65535,
+    65535, 65026, 64512, 63998, 63484, 62970, 62456, 61942, 61428, 60914, 60400, 59886, 59372, 58858, 58344, 57830,
+    57316, 56802, 56288, 55774, 55260, 54746, 54232, 53719, 53205, 52691, 52177, 51663, 51149, 50635, 50121, 49607,
+    49093, 48579, 48065, 47551, 47037, 46523, 46009, 45496, 44982, 44468, 43954, 43440, 42926, 42412, 41898, 41384,
+    40870, 40356, 39842, 39329, 38815, 38301, 37787, 37273, 36759, 36245, 35731, 35217, 34704, 34190, 33676, 33162,
+    32648, 32134, 31620, 31107, 30593, 30079, 29565, 29051, 28537, 28024, 27510, 26996, 26482, 25968, 25455, 24941,
+    24427, 23913, 23400, 22886, 22372, 21859, 21345, 20831, 20318, 19804, 19290, 18777, 18263, 17750, 17236, 16723,
+    16209, 15696, 15183, 14669, 14156, 13643, 13130, 12617, 12104, 11591, 11078, 10565, 10053, 9540, 9028, 8516,
+    8004, 7493, 6982, 6471, 5961, 5452, 4943, 4437, 3931, 3429, 2930, 2438, 1957, 1499, 1090, 813,
+    813, 1090, 1499, 1957, 2438, 2930, 3429, 3931, 4437, 4943, 5452, 5961, 6471, 6982, 7493, 8004,
+    8516, 9028, 9540, 10053, 10565, 11078, 11591, 12104, 12617, 13130, 13643, 14156, 14669, 15183, 15696, 16209,
+    16723, 17236, 17750, 18263, 18777, 19290, 19804, 20318, 20831, 21345, 21859, 22372, 22886, 23400, 23913, 24427,
+    24941, 25455, 25968, 26482, 26996, 27510, 28024, 28537, 29051, 29565, 30079, 30593, 31107, 31620, 32134, 32648,
+    33162, 33676, 34190, 34704, 35217, 35731, 36245, 36759, 37273, 37787, 38301, 38815, 39329, 39842, 40356, 40870,
+    41384, 41898, 42412, 42926, 43440, 43954, 44468, 44982, 45496, 46009, 46523, 47037, 47551, 48065, 48579, 49093,
+    49607, 50121, 50635, 51149, 51663, 52177, 52691, 53205, 53719, 54232, 54746, 55260, 55774, 56288, 56802, 57316,
+    57830, 58344, 58858, 59372, 59886, 60400, 60914, 61428, 61942, 62456, 62970, 63484, 63998, 64512, 65026, 65535,
+    65535, 65034, 64520, 64006, 63492, 62978, 62464, 61950, 61436, 60923, 60409, 59895, 59381, 58867, 58353, 57839,
+    57325, 56812, 56298, 55784, 55270, 54756, 54242, 53728, 53215, 52701, 52187, 51673, 51159, 50645, 50131, 49618,
+    49104, 48590, 48076, 47562, 47049, 46535, 46021, 45507, 44993, 44480, 43966, 43452, 42938, 42424, 41911, 41397,
+    40883, 40369, 39856, 39342, 38828, 38315, 37801, 37287, 36773, 36260, 35746, 35232, 34719, 34205, 33692, 33178,
+    32664, 32151, 31637, 31124, 30610, 30096, 29583, 29069, 28556, 28042, 27529, 27016, 26502, 25989, 25475, 24962,
+    24449, 23936, 23422, 22909, 22396, 21883, 21370, 20857, 20344, 19831, 19318, 18805, 18292, 17779, 17267, 16754,
+    16242, 15730, 15217, 14705, 14193, 13681, 13170, 12658, 12147, 11636, 11125, 10615, 10105, 9595, 9086, 8578,
+    8070, 7563, 7057, 6552, 6049, 5548, 5049, 4554, 4064, 3580, 3105, 2646, 2211, 1817, 1499, 1310,
+    1310, 1499, 1817, 2211, 2646, 3105, 3580, 4064, 4554, 5049, 5548, 6049, 6552, 7057, 7563, 8070,
+    8578, 9086, 9595, 10105, 10615, 11125, 11636, 12147, 12658, 13170, 13681, 14193, 14705, 15217, 15730, 16242,
+    16754, 17267, 17779, 18292, 18805, 19318, 19831, 20344, 20857, 21370, 21883, 22396, 22909, 23422, 23936, 24449,
+    24962, 25475, 25989, 26502, 27016, 27529, 28042, 28556, 29069, 29583, 30096, 30610, 31124, 31637, 32151, 32664,
+    33178, 33692, 34205, 34719, 35232, 35746, 36260, 36773, 37287, 37801, 38315, 38828, 39342, 39856, 40369, 40883,
+    41397, 41911, 42424, 42938, 43452, 43966, 44480, 44993, 45507, 46021, 46535, 47049, 47562, 48076, 48590, 49104,
+    49618, 50131, 50645, 51159, 51673, 52187, 52701, 53215, 53728, 54242, 54756, 55270, 55784, 56298, 56812, 57325,
+    57839, 58353, 58867, 59381, 59895, 60409, 60923, 61436, 61950, 62464, 62978, 63492, 64006, 64520, 65034, 65535,
+    65535, 65046, 64532, 64018, 63504, 62991, 62477, 61963, 61449, 60936, 60422, 59908, 59394, 58880, 58367, 57853,
+    57339, 56825, 56312, 55798, 55284, 54771, 54257, 53743, 53229, 52716, 52202, 51688, 51175, 50661, 50147, 49634,
+    49120, 48606, 48093, 47579, 47065, 46552, 46038, 45525, 45011, 44497, 43984, 43470, 42957, 42443, 41930, 41416,
+    40903, 40389, 39876, 39362, 38849, 38335, 37822, 37308, 36795, 36282, 35768, 35255, 34742, 34228, 33715, 33202,
+    32689, 32175, 31662, 31149, 30636, 30123, 29610, 29097, 28584, 28071, 27558, 27045, 26532, 26019, 25507, 24994,
+    24481, 23969, 23456, 22944, 22431, 21919, 21407, 20895, 20383, 19871, 19359, 18847, 18335, 17824, 17313, 16802,
+    16291, 15780, 15269, 14759, 14249, 13739, 13230, 12721, 12212, 11704, 11196, 10689, 10183, 9678, 9173, 8670,
+    8168, 7667, 7168, 6672, 6179, 5689, 5204, 4725, 4254, 3795, 3351, 2930, 2544, 2211, 1957, 1817,
+    1817, 1957, 2211, 2544, 2930, 3351, 3795, 4254, 4725, 5204, 5689, 6179, 6672, 7168, 7667, 8168,
+    8670, 9173, 9678, 10183, 10689, 11196, 11704, 12212, 12721, 13230, 13739, 14249, 14759, 15269, 15780, 16291,
+    16802, 17313, 17824, 18335, 18847, 19359, 19871, 20383, 20895, 21407, 21919, 22431, 22944, 23456, 23969, 24481,
+    24994, 25507, 26019, 26532, 27045, 27558, 28071, 28584, 29097, 29610, 30123, 30636, 31149, 31662, 32175, 32689,
+    33202, 33715, 34228, 34742, 35255, 35768, 36282, 36795, 37308, 37822, 38335, 38849, 39362, 39876, 40389, 40903,
+    41416, 41930, 42443, 42957, 43470, 43984, 44497, 45011, 45525, 46038, 46552, 47065, 47579, 48093, 48606, 49120,
+    49634, 50147, 50661, 51175, 51688, 52202, 52716, 53229, 53743, 54257, 54771, 55284, 55798, 56312, 56825, 57339,
+    57853, 58367, 58880, 59394, 59908, 60422, 60936, 61449, 61963, 62477, 62991, 63504, 64018, 64532, 65046, 65535,
+    65535, 65062, 64548, 64035, 63521, 63007, 62494, 61980, 61467, 60953, 60439, 59926, 59412, 58898, 58385, 57871,
+    57358, 56844, 56331, 55817, 55303, 54790, 54276, 53763, 53249, 52736, 52222, 51709, 51195, 50682, 50168, 49655,
+    49141, 48628, 48115, 47601, 47088, 46574, 46061, 45548, 45034, 44521, 44008, 43495, 42981, 42468, 41955, 41442,
+    40928, 40415, 39902, 39389, 38876, 38363, 37850, 37337, 36824, 36311, 35798, 35285, 34772, 34259, 33746, 33234,
+    32721, 32208, 31696, 31183, 30670, 30158, 29645, 29133, 28621, 28108, 27596, 27084, 26572, 26060, 25548, 25036,
+    24524, 24013, 23501, 22990, 22478, 21967, 21456, 20945, 20434, 19924, 19413, 18903, 18393, 17883, 17374, 16864,
+    16355, 15847, 15338, 14830, 14323, 13816, 13310, 12804, 12298, 11794, 11290, 10788, 10286, 9786, 9288, 8791,
+    8296, 7804, 7314, 6829, 6347, 5872, 5403, 4943, 4496, 4064, 3653, 3271, 2930, 2646, 2438, 2327,
+    2327, 2438, 2646, 2930, 3271, 3653, 4064, 4496, 4943, 5403, 5872, 6347, 6829, 7314, 7804, 8296,
+    8791, 9288, 9786, 10286, 10788, 11290, 11794, 12298, 12804, 13310, 13816, 14323, 14830, 15338, 15847, 16355,
+    16864, 17374, 17883, 18393, 18903, 19413, 19924, 20434, 20945, 21456, 21967, 22478, 22990, 23501, 24013, 24524,
+    25036, 25548, 26060, 26572, 27084, 27596, 28108, 28621, 29133, 29645, 30158, 30670, 31183, 31696, 32208, 32721,
+    33234, 33746, 34259, 34772, 35285, 35798, 36311, 36824, 37337, 37850, 38363, 38876, 39389, 39902, 40415, 40928,
+    41442, 41955, 42468, 42981, 43495, 44008, 44521, 45034, 45548, 46061, 46574, 47088, 47601, 48115, 48628, 49141,
+    49655, 50168, 50682, 51195, 51709, 52222, 52736, 53249, 53763, 54276, 54790, 55303, 55817, 56331, 56844, 57358,
+    57871, 58385, 58898, 59412, 59926, 60439, 60953, 61467, 61980, 62494, 63007, 63521, 64035, 64548, 65062, 65535,
+    65535, 65082, 64569, 64055, 63542, 63028, 62515, 62001, 61488, 60975, 60461, 59948, 59434, 58921, 58407, 57894,
+    57381, 56867, 56354, 55841, 55327, 54814, 54301, 53787, 53274, 52761, 52248, 51734, 51221, 50708, 50195, 49681,
+    49168, 48655, 48142, 47629, 47116, 46603, 46090, 45577, 45064, 44551, 44038, 43525, 43012, 42499, 41986, 41473,
+    40961, 40448, 39935, 39422, 38910, 38397, 37885, 37372, 36860, 36347, 35835, 35322, 34810, 34298, 33785, 33273,
+    32761, 32249, 31737, 31225, 30713, 30202, 29690, 29178, 28667, 28155, 27644, 27133, 26622, 26110, 25600, 25089,
+    24578, 24068, 23557, 23047, 22537, 22027, 21518, 21008, 20499, 19990, 19481, 18973, 18465, 17957, 17450, 16943,
+    16436, 15930, 15424, 14919, 14415, 13911, 13408, 12906, 12405, 11906, 11407, 10910, 10414, 9920, 9429, 8940,
+    8454, 7971, 7493, 7019, 6552, 6093, 5642, 5204, 4780, 4377, 3998, 3653, 3351, 3105, 2930, 2839,
+    2839, 2930, 3105, 3351, 3653, 3998, 4377, 4780, 5204, 5642, 6093, 6552, 7019, 7493, 7971, 8454,
+    8940, 9429, 9920, 10414, 10910, 11407, 11906, 12405, 12906, 13408, 13911, 14415, 14919, 15424, 15930, 16436,
+    16943, 17450, 17957, 18465, 18973, 19481, 19990, 20499, 21008, 21518, 22027, 22537, 23047, 23557, 24068, 24578,
+    25089, 25600, 26110, 26622, 27133, 27644, 28155, 28667, 29178, 29690, 30202, 30713, 31225, 31737, 32249, 32761,
+    33273, 33785, 34298, 34810, 35322, 35835, 36347, 36860, 37372, 37885, 38397, 38910, 39422, 39935, 40448, 40961,
+    41473, 41986, 42499, 43012, 43525, 44038, 44551, 45064, 45577, 46090, 46603, 47116, 47629, 48142, 48655, 49168,
+    49681, 50195, 50708, 51221, 51734, 52248, 52761, 53274, 53787, 54301, 54814, 55327, 55841, 56354, 56867, 57381,
+    57894, 58407, 58921, 59434, 59948, 60461, 60975, 61488, 62001, 62515, 63028, 63542, 64055, 64569, 65082, 65535,
+    65535, 65107, 64593, 64080, 63567, 63054, 62540, 62027, 61514, 61001, 60487, 59974, 59461, 58948, 58435, 57921,
+    57408, 56895, 56382, 55869, 55356, 54843, 54330, 53817, 53304, 52791, 52278, 51765, 51252, 50739, 50226, 49713,
+    49201, 48688, 48175, 47662, 47150, 46637, 46124, 45612, 45099, 44586, 44074, 43561, 43049, 42536, 42024, 41512,
+    40999, 40487, 39975, 39463, 38951, 38438, 37926, 37414, 36903, 36391, 35879, 35367, 34855, 34344, 33832, 33321,
+    32810, 32298, 31787, 31276, 30765, 30254, 29743, 29233, 28722, 28212, 27701, 27191, 26681, 26171, 25661, 25152,
+    24643, 24133, 23624, 23116, 22607, 22099, 21591, 21083, 20576, 20069, 19562, 19056, 18550, 18045, 17540, 17036,
+    16532, 16029, 15527, 15025, 14524, 14025, 13526, 13029, 12533, 12038, 11545, 11054, 10565, 10079, 9595, 9115,
+    8639, 8168, 7701, 7242, 6790, 6347, 5917, 5500, 5101, 4725, 4377, 4064, 3795, 3580, 3429, 3351,
+    3351, 3429, 3580, 3795, 4064, 4377, 4725, 5101, 5500, 5917, 6347, 6790, 7242, 7701, 8168, 8639,
+    9115, 9595, 10079, 10565, 11054, 11545, 12038, 12533, 13029, 13526, 14025, 14524, 15025, 15527, 16029, 16532,
+    17036, 17540, 18045, 18550, 19056, 19562, 20069, 20576, 21083, 21591, 22099, 22607, 23116, 23624, 24133, 24643,
+    25152, 25661, 26171, 26681, 27191, 27701, 28212, 28722, 29233, 29743, 30254, 30765, 31276, 31787, 32298, 32810,
+    33321, 33832, 34344, 34855, 35367, 35879, 36391, 36903, 37414, 37926, 38438, 38951, 39463, 39975, 40487, 40999,
+    41512, 42024, 42536, 43049, 43561, 44074, 44586, 45099, 45612, 46124, 46637, 47150, 47662, 48175, 48688, 49201,
+    49713, 50226, 50739, 51252, 51765, 52278, 52791, 53304, 53817, 54330, 54843, 55356, 55869, 56382, 56895, 57408,
+    57921, 58435, 58948, 59461, 59974, 60487, 61001, 61514, 62027, 62540, 63054, 63567, 64080, 64593, 65107, 65535,
+    65535, 65135, 64622, 64109, 63596, 63083, 62570, 62057, 61544, 61031, 60518, 60005, 59492, 58979, 58466, 57953,
+    57441, 56928, 56415, 55902, 55389, 54877, 54364, 53851, 53338, 52826, 52313, 51801, 51288, 50776, 50263, 49751,
+    49238, 48726, 48213, 47701, 47189, 46676, 46164, 45652, 45140, 44628, 44116, 43604, 43092, 42580, 42068, 41556,
+    41044, 40533, 40021, 39510, 38998, 38487, 37975, 37464, 36953, 36441, 35930, 35419, 34909, 34398, 33887, 33376,
+    32866, 32355, 31845, 31335, 30825, 30315, 29805, 29296, 28786, 28277, 27768, 27259, 26750, 26242, 25733, 25225,
+    24717, 24210, 23703, 23196, 22689, 22183, 21677, 21171, 20666, 20161, 19657, 19153, 18650, 18147, 17645, 17144,
+    16644, 16144, 15645, 15148, 14651, 14156, 13662, 13170, 12679, 12191, 11704, 11220, 10739, 10261, 9786, 9316,
+    8851, 8391, 7938, 7493, 7057, 6632, 6221, 5827, 5452, 5101, 4780, 4496, 4254, 4064, 3931, 3864,
+    3864, 3931, 4064, 4254, 4496, 4780, 5101, 5452, 5827, 6221, 6632, 7057, 7493, 7938, 8391, 8851,
+    9316, 9786, 10261, 10739, 11220, 11704, 12191, 12679, 13170, 13662, 14156, 14651, 15148, 15645, 16144, 16644,
+    17144, 17645, 18147, 18650, 19153, 19657, 20161, 20666, 21171, 21677, 22183, 22689, 23196, 23703, 24210, 24717,
+    25225, 25733, 26242, 26750, 27259, 27768, 28277, 28786, 29296, 29805, 30315, 30825, 31335, 31845, 32355, 32866,
+    33376, 33887, 34398, 34909, 35419, 35930, 36441, 36953, 37464, 37975, 38487, 38998, 39510, 40021, 40533, 41044,
+    41556, 42068, 42580, 43092, 43604, 44116, 44628, 45140, 45652, 46164, 46676, 47189, 47701, 48213, 48726, 49238,
+    49751, 50263, 50776, 51288, 51801, 52313, 52826, 53338, 53851, 54364, 54877, 55389, 55902, 56415, 56928, 57441,
+    57953, 58466, 58979, 59492, 60005, 60518, 61031, 61544, 62057, 62570, 63083, 63596, 64109, 64622, 65135, 65535,
+    65535, 65168, 64655, 64142, 63629, 63116, 62604, 62091, 61578, 61065, 60553, 60040, 59528, 59015, 58502, 57990,
+    57477, 56965, 56452, 55940, 55427, 54915, 54403, 53890, 53378, 52866, 52354, 51841, 51329, 50817, 50305, 49793,
+    49281, 48769, 48257, 47745, 47233, 46722, 46210, 45698, 45187, 44675, 44164, 43652, 43141, 42629, 42118, 41607,
+    41096, 40585, 40074, 39563, 39052, 38541, 38031, 37520, 37010, 36499, 35989, 35479, 34969, 34459, 33949, 33440,
+    32930, 32421, 31911, 31402, 30893, 30385, 29876, 29368, 28860, 28352, 27844, 27336, 26829, 26322, 25815, 25309,
+    24803, 24297, 23792, 23287, 22782, 22278, 21774, 21271, 20768, 20266, 19764, 19263, 18763, 18263, 17765, 17267,
+    16770, 16274, 15780, 15287, 14795, 14305, 13816, 13329, 12845, 12363, 11883, 11407, 10934, 10465, 10000, 9540,
+    9086, 8639, 8200, 7770, 7350, 6944, 6552, 6179, 5827, 5500, 5204, 4943, 4725, 4554, 4437, 4377,
+    4377, 4437, 4554, 4725, 4943, 5204, 5500, 5827, 6179, 6552, 6944, 7350, 7770, 8200, 8639, 9086,
+    9540, 10000, 10465, 10934, 11407, 11883, 12363, 12845, 13329, 13816, 14305, 14795, 15287, 15780, 16274, 16770,
+    17267, 17765, 18263, 18763, 19263, 19764, 20266, 20768, 21271, 21774, 22278, 22782, 23287, 23792, 24297, 24803,
+    25309, 25815, 26322, 26829, 27336, 27844, 28352, 28860, 29368, 29876, 30385, 30893, 31402, 31911, 32421, 32930,
+    33440, 33949, 34459, 34969, 35479, 35989, 36499, 37010, 37520, 38031, 38541, 39052, 39563, 40074, 40585, 41096,
+    41607, 42118, 42629, 43141, 43652, 44164, 44675, 45187, 45698, 46210, 46722, 47233, 47745, 48257, 48769, 49281,
+    49793, 50305, 50817, 51329, 51841, 52354, 52866, 53378, 53890, 54403, 54915, 55427, 55940, 56452, 56965, 57477,
+    57990, 58502, 59015, 59528, 60040, 60553, 61065, 61578, 62091, 62604, 63116, 63629, 64142, 64655, 65168, 65535,
+    65535, 65204, 64692, 64179, 63667, 63154, 62642, 62129, 61617, 61104, 60592, 60080, 59567, 59055, 58543, 58031,
+    57519, 57007, 56494, 55982, 55470, 54958, 54446, 53934, 53423, 52911, 52399, 51887, 51376, 50864, 50352, 49841,
+    49329, 48818, 48306, 47795, 47284, 46773, 46261, 45750, 45239, 44728, 44217, 43707, 43196, 42685, 42175, 41664,
+    41154, 40643, 40133, 39623, 39113, 38603, 38093, 37584, 37074, 36565, 36055, 35546, 35037, 34528, 34019, 33511,
+    33002, 32494, 31986, 31478, 30970, 30463, 29956, 29449, 28942, 28435, 27929, 27423, 26918, 26412, 25907, 25403,
+    24899, 24395, 23891, 23388, 22886, 22384, 21883, 21382, 20882, 20383, 19884, 19386, 18889, 18393, 17898, 17404,
+    16911, 16420, 15930, 15441, 14955, 14470, 13987, 13507, 13029, 12554, 12082, 11613, 11149, 10689, 10235, 9786,
+    9344, 8910, 8485, 8070, 7667, 7278, 6906, 6552, 6221, 5917, 5642, 5403, 5204, 5049, 4943, 4890,
+    4890, 4943, 5049, 5204, 5403, 5642, 5917, 6221, 6552, 6906, 7278, 7667, 8070, 8485, 8910, 9344,
+    9786, 10235, 10689, 11149, 11613, 12082, 12554, 13029, 13507, 13987, 14470, 14955, 15441, 15930, 16420, 16911,
+    17404, 17898, 18393, 18889, 19386, 19884, 20383, 20882, 21382, 21883, 22384, 22886, 23388, 23891, 24395, 24899,
+    25403, 25907, 26412, 26918, 27423, 27929, 28435, 28942, 29449, 29956, 30463, 30970, 31478, 31986, 32494, 33002,
+    33511, 34019, 34528, 35037, 35546, 36055, 36565, 37074, 37584, 38093, 38603, 39113, 39623, 40133, 40643, 41154,
+    41664, 42175, 42685, 43196, 43707, 44217, 44728, 45239, 45750, 46261, 46773, 47284, 47795, 48306, 48818, 49329,
+    49841, 50352, 50864, 51376, 51887, 52399, 52911, 53423, 53934, 54446, 54958, 55470, 55982, 56494, 57007, 57519,
+    58031, 58543, 59055, 59567, 60080, 60592, 61104, 61617, 62129, 62642, 63154, 63667, 64179, 64692, 65204, 65535,
+    65535, 65245, 64732, 64220, 63708, 63196, 62684, 62172, 61660, 61148, 60636, 60124, 59612, 59100, 58588, 58076,
+    57565, 57053, 56541, 56030, 55518, 55006, 54495, 53983, 53472, 52961, 52449, 51938, 51427, 50916, 50405, 49894,
+    49383, 48872, 48361, 47850, 47340, 46829, 46319, 45808, 45298, 44787, 44277, 43767, 43257, 42747, 42237, 41727,
+    41218, 40708, 40199, 39690, 39180, 38671, 38163, 37654, 37145, 36637, 36128, 35620, 35112, 34604, 34097, 33589,
+    33082, 32575, 32068, 31562, 31056, 30550, 30044, 29538, 29033, 28528, 28024, 27519, 27016, 26512, 26009, 25507,
+    25004, 24503, 24002, 23501, 23001, 22502, 22003, 21505, 21008, 20512, 20016, 19522, 19028, 18536, 18045, 17555,
+    17067, 16580, 16095, 15612, 15130, 14651, 14175, 13701, 13230, 12762, 12298, 11839, 11384, 10934, 10490, 10053,
+    9623, 9202, 8791, 8391, 8004, 7633, 7278, 6944, 6632, 6347, 6093, 5872, 5689, 5548, 5452, 5403,
+    5403, 5452, 5548, 5689, 5872, 6093, 6347, 6632, 6944, 7278, 7633, 8004, 8391, 8791, 9202, 9623,
+    10053, 10490, 10934, 11384, 11839, 12298, 12762, 13230, 13701, 14175, 14651, 15130, 15612, 16095, 16580, 17067,
+    17555, 18045, 18536, 19028, 19522, 20016, 20512, 21008, 21505, 22003, 22502, 23001, 23501, 24002, 24503, 25004,
+    25507, 26009, 26512, 27016, 27519, 28024, 28528, 29033, 29538, 30044, 30550, 31056, 31562, 32068, 32575, 33082,
+    33589, 34097, 34604, 35112, 35620, 36128, 36637, 37145, 37654, 38163, 38671, 39180, 39690, 40199, 40708, 41218,
+    41727, 42237, 42747, 43257, 43767, 44277, 44787, 45298, 45808, 46319, 46829, 47340, 47850, 48361, 48872, 49383,
+    49894, 50405, 50916, 51427, 51938, 52449, 52961, 53472, 53983, 54495, 55006, 55518, 56030, 56541, 57053, 57565,
+    58076, 58588, 59100, 59612, 60124, 60636, 61148, 61660, 62172, 62684, 63196, 63708, 64220, 64732, 65245, 65535,
+    65535, 65289, 64777, 64265, 63754, 63242, 62730, 62218, 61707, 61195, 60684, 60172, 59661, 59149, 58638, 58126,
+    57615, 57104, 56593, 56081, 55570, 55059, 54548, 54037, 53526, 53016, 52505, 51994, 51483, 50973, 50462, 49952,
+    49442, 48931, 48421, 47911, 47401, 46891, 46381, 45871, 45362, 44852, 44343, 43833, 43324, 42815, 42306, 41797,
+    41288, 40780, 40271, 39763, 39255, 38747, 38239, 37731, 37223, 36716, 36209, 35702, 35195, 34688, 34182, 33676,
+    33170, 32664, 32159, 31654, 31149, 30644, 30140, 29636, 29133, 28630, 28127, 27625, 27123, 26622, 26121, 25620,
+    25120, 24621, 24122, 23624, 23127, 22631, 22135, 21640, 21146, 20653, 20161, 19670, 19181, 18692, 18205, 17720,
+    17236, 16754, 16274, 15797, 15321, 14848, 14378, 13911, 13448, 12988, 12533, 12082, 11636, 11196, 10763, 10338,
+    9920, 9512, 9115, 8730, 8359, 8004, 7667, 7350, 7057, 6790, 6552, 6347, 6179, 6049, 5961, 5917,
+    5917, 5961, 6049, 6179, 6347, 6552, 6790, 7057, 7350, 7667, 8004, 8359, 8730, 9115, 9512, 9920,
+    10338, 10763, 11196, 11636, 12082, 12533, 12988, 13448, 13911, 14378, 14848, 15321, 15797, 16274, 16754, 17236,
+    17720, 18205, 18692, 19181, 19670, 20161, 20653, 21146, 21640, 22135, 22631, 23127, 23624, 24122, 24621, 25120,
+    25620, 26121, 26622, 27123, 27625, 28127, 28630, 29133, 29636, 30140, 30644, 31149, 31654, 32159, 32664, 33170,
+    33676, 34182, 34688, 35195, 35702, 36209, 36716, 37223, 37731, 38239, 38747, 39255, 39763, 40271, 40780, 41288,
+    41797, 42306, 42815, 43324, 43833, 44343, 44852, 45362, 45871, 46381, 46891, 47401, 47911, 48421, 48931, 49442,
+    49952, 50462, 50973, 51483, 51994, 52505, 53016, 53526, 54037, 54548, 55059, 55570, 56081, 56593, 57104, 57615,
+    58126, 58638, 59149, 59661, 60172, 60684, 61195, 61707, 62218, 62730, 63242, 63754, 64265, 64777, 65289, 65535,
+    65535, 65338, 64826, 64315, 63803, 63292, 62781, 62269, 61758, 61247, 60736, 60225, 59714, 59203, 58692, 58181,
+    57670, 57159, 56649, 56138, 55627, 55117, 54606, 54096, 53586, 53075, 52565, 52055, 51545, 51035, 50525, 50015,
+    49506, 48996, 48487, 47977, 47468, 46959, 46450, 45941, 45432, 44923, 44414, 43906, 43397, 42889, 42381, 41873,
+    41365, 40857, 40350, 39842, 39335, 38828, 38321, 37815, 37308, 36802, 36296, 35790, 35285, 34780, 34275, 33770,
+    33265, 32761, 32257, 31754, 31251, 30748, 30245, 29743, 29242, 28740, 28240, 27739, 27240, 26740, 26242, 25744,
+    25246, 24750, 24254, 23758, 23264, 22770, 22278, 21786, 21295, 20806, 20318, 19831, 19345, 18861, 18379, 17898,
+    17419, 16943, 16468, 15996, 15527, 15060, 14597, 14137, 13681, 13230, 12783, 12341, 11906, 11476, 11054, 10640,
+    10235, 9840, 9457, 9086, 8730, 8391, 8070, 7770, 7493, 7242, 7019, 6829, 6672, 6552, 6471, 6430,
+    6430, 6471, 6552, 6672, 6829, 7019, 7242, 7493, 7770, 8070, 8391, 8730, 9086, 9457, 9840, 10235,
+    10640, 11054, 11476, 11906, 12341, 12783, 13230, 13681, 14137, 14597, 15060, 15527, 15996, 16468, 16943, 17419,
+    17898, 18379, 18861, 19345, 19831, 20318, 20806, 21295, 21786, 22278, 22770, 23264, 23758, 24254, 24750, 25246,
+    25744, 26242, 26740, 27240, 27739, 28240, 28740, 29242, 29743, 30245, 30748, 31251, 31754, 32257, 32761, 33265,
+    33770, 34275, 34780, 35285, 35790, 36296, 36802, 37308, 37815, 38321, 38828, 39335, 39842, 40350, 40857, 41365,
+    41873, 42381, 42889, 43397, 43906, 44414, 44923, 45432, 45941, 46450, 46959, 47468, 47977, 48487, 48996, 49506,
+    50015, 50525, 51035, 51545, 52055, 52565, 53075, 53586, 54096, 54606, 55117, 55627, 56138, 56649, 57159, 57670,
+    58181, 58692, 59203, 59714, 60225, 60736, 61247, 61758, 62269, 62781, 63292, 63803, 64315, 64826, 65338, 65535,
+    65535, 65390, 64879, 64368, 63857, 63346, 62835, 62324, 61814, 61303, 60792, 60282, 59771, 59261, 58750, 58240,
+    57730, 57219, 56709, 56199, 55689, 55179, 54669, 54159, 53650, 53140, 52630, 52121, 51612, 51102, 50593, 50084,
+    49575, 49066, 48557, 48049, 47540, 47032, 46523, 46015, 45507, 44999, 44491, 43984, 43476, 42969, 42462, 41955,
+    41448, 40941, 40435, 39929, 39422, 38917, 38411, 37906, 37400, 36895, 36391, 35886, 35382, 34878, 34375, 33871,
+    33368, 32866, 32364, 31862, 31360, 30859, 30359, 29858, 29359, 28860, 28361, 27863, 27365, 26868, 26372, 25877,
+    25382, 24888, 24395, 23902, 23411, 22921, 22431, 21943, 21456, 20970, 20486, 20003, 19522, 19042, 18565, 18089,
+    17615, 17144, 16675, 16209, 15746, 15287, 14830, 14378, 13930, 13487, 13049, 12617, 12191, 11772, 11360, 10958,
+    10565, 10183, 9813, 9457, 9115, 8791, 8485, 8200, 7938, 7701, 7493, 7314, 7168, 7057, 6982, 6944,
+    6944, 6982, 7057, 7168, 7314, 7493, 7701, 7938, 8200, 8485, 8791, 9115, 9457, 9813, 10183, 10565,
+    10958, 11360, 11772, 12191, 12617, 13049, 13487, 13930, 14378, 14830, 15287, 15746, 16209, 16675, 17144, 17615,
+    18089, 18565, 19042, 19522, 20003, 20486, 20970, 21456, 21943, 22431, 22921, 23411, 23902, 24395, 24888, 25382,
+    25877, 26372, 26868, 27365, 27863, 28361, 28860, 29359, 29858, 30359, 30859, 31360, 31862, 32364, 32866, 33368,
+    33871, 34375, 34878, 35382, 35886, 36391, 36895, 37400, 37906, 38411, 38917, 39422, 39929, 40435, 40941, 41448,
+    41955, 42462, 42969, 43476, 43984, 44491, 44999, 45507, 46015, 46523, 47032, 47540, 48049, 48557, 49066, 49575,
+    50084, 50593, 51102, 51612, 52121, 52630, 53140, 53650, 54159, 54669, 55179, 55689, 56199, 56709, 57219, 57730,
+    58240, 58750, 59261, 59771, 60282, 60792, 61303, 61814, 62324, 62835, 63346, 63857, 64368, 64879, 65390, 65535,
+    65535, 65447, 64936, 64426, 63915, 63405, 62894, 62384, 61874, 61363, 60853, 60343, 59833, 59323, 58813, 58303,
+    57794, 57284, 56774, 56265, 55755, 55246, 54737, 54228, 53719, 53210, 52701, 52192, 51683, 51175, 50666, 50158,
+    49650, 49141, 48633, 48126, 47618, 47110, 46603, 46096, 45588, 45081, 44575, 44068, 43561, 43055, 42549, 42043,
+    41537, 41032, 40526, 40021, 39516, 39012, 38507, 38003, 37499, 36996, 36492, 35989, 35486, 34984, 34482, 33980,
+    33479, 32978, 32478, 31978, 31478, 30979, 30480, 29982, 29485, 28988, 28491, 27995, 27500, 27006, 26512, 26019,
+    25527, 25036, 24546, 24057, 23568, 23081, 22596, 22111, 21628, 21146, 20666, 20187, 19710, 19236, 18763, 18292,
+    17824, 17358, 16896, 16436, 15980, 15527, 15078, 14633, 14193, 13759, 13329, 12906, 12490, 12082, 11681, 11290,
+    10910, 10540, 10183, 9840, 9512, 9202, 8910, 8639, 8391, 8168, 7971, 7804, 7667, 7563, 7493, 7457,
+    7457, 7493, 7563, 7667, 7804, 7971, 8168, 8391, 8639, 8910, 9202, 9512, 9840, 10183, 10540, 10910,
+    11290, 11681, 12082, 12490, 12906, 13329, 13759, 14193, 14633, 15078, 15527, 15980, 16436, 16896, 17358, 17824,
+    18292, 18763, 19236, 19710, 20187, 20666, 21146, 21628, 22111, 22596, 23081, 23568, 24057, 24546, 25036, 25527,
+    26019, 26512, 27006, 27500, 27995, 28491, 28988, 29485, 29982, 30480, 30979, 31478, 31978, 32478, 32978, 33479,
+    33980, 34482, 34984, 35486, 35989, 36492, 36996, 37499, 38003, 38507, 39012, 39516, 40021, 40526, 41032, 41537,
+    42043, 42549, 43055, 43561, 44068, 44575, 45081, 45588, 46096, 46603, 47110, 47618, 48126, 48633, 49141, 49650,
+    50158, 50666, 51175, 51683, 52192, 52701, 53210, 53719, 54228, 54737, 55246, 55755, 56265, 56774, 57284, 57794,
+    58303, 58813, 59323, 59833, 60343, 60853, 61363, 61874, 62384, 62894, 63405, 63915, 64426, 64936, 65447, 65535,
+    65535, 65507, 64997, 64487, 63977, 63467, 62957, 62447, 61938, 61428, 60918, 60409, 59899, 59390, 58880, 58371,
+    57862, 57353, 56844, 56335, 55826, 55318, 54809, 54301, 53792, 53284, 52776, 52268, 51760, 51252, 50744, 50237,
+    49729, 49222, 48715, 48208, 47701, 47194, 46688, 46181, 45675, 45169, 44663, 44158, 43652, 43147, 42642, 42137,
+    41632, 41128, 40624, 40120, 39616, 39113, 38610, 38107, 37605, 37102, 36601, 36099, 35598, 35097, 34597, 34097,
+    33597, 33098, 32600, 32101, 31604, 31107, 30610, 30114, 29619, 29124, 28630, 28137, 27644, 27152, 26661, 26171,
+    25682, 25194, 24707, 24221, 23736, 23252, 22770, 22289, 21810, 21333, 20857, 20383, 19910, 19440, 18973, 18508,
+    18045, 17585, 17129, 16675, 16226, 15780, 15338, 14902, 14470, 14044, 13623, 13210, 12804, 12405, 12016, 11636,
+    11267, 10910, 10565, 10235, 9920, 9623, 9344, 9086, 8851, 8639, 8454, 8296, 8168, 8070, 8004, 7971,
+    7971, 8004, 8070, 8168, 8296, 8454, 8639, 8851, 9086, 9344, 9623, 9920, 10235, 10565, 10910, 11267,
+    11636, 12016, 12405, 12804, 13210, 13623, 14044, 14470, 14902, 15338, 15780, 16226, 16675, 17129, 17585, 18045,
+    18508, 18973, 19440, 19910, 20383, 20857, 21333, 21810, 22289, 22770, 23252, 23736, 24221, 24707, 25194, 25682,
+    26171, 26661, 27152, 27644, 28137, 28630, 29124, 29619, 30114, 30610, 31107, 31604, 32101, 32600, 33098, 33597,
+    34097, 34597, 35097, 35598, 36099, 36601, 37102, 37605, 38107, 38610, 39113, 39616, 40120, 40624, 41128, 41632,
+    42137, 42642, 43147, 43652, 44158, 44663, 45169, 45675, 46181, 46688, 47194, 47701, 48208, 48715, 49222, 49729,
+    50237, 50744, 51252, 51760, 52268, 52776, 53284, 53792, 54301, 54809, 55318, 55826, 56335, 56844, 57353, 57862,
+    58371, 58880, 59390, 59899, 60409, 60918, 61428, 61938, 62447, 62957, 63467, 63977, 64487, 64997, 65507, 65535,
+    65535, 65535, 65062, 64553, 64043, 63534, 63024, 62515, 62006, 61497, 60988, 60479, 59970, 59461, 58952, 58444,
+    57935, 57427, 56918, 56410, 55902, 55394, 54886, 54378, 53871, 53363, 52856, 52349, 51841, 51334, 50828, 50321,
+    49814, 49308, 48802, 48295, 47790, 47284, 46778, 46273, 45768, 45263, 44758, 44253, 43749, 43245, 42741, 42237,
+    41734, 41231, 40728, 40225, 39723, 39221, 38719, 38218, 37717, 37216, 36716, 36216, 35717, 35217, 34719, 34221,
+    33723, 33226, 32729, 32233, 31737, 31242, 30748, 30254, 29761, 29269, 28777, 28286, 27796, 27307, 26819, 26332,
+    25846, 25361, 24877, 24395, 23913, 23434, 22955, 22478, 22003, 21530, 21058, 20589, 20122, 19657, 19194, 18735,
+    18278, 17824, 17374, 16927, 16484, 16046, 15612, 15183, 14759, 14341, 13930, 13526, 13130, 12742, 12363, 11994,
+    11636, 11290, 10958, 10640, 10338, 10053, 9786, 9540, 9316, 9115, 8940, 8791, 8670, 8578, 8516, 8485,
+    8485, 8516, 8578, 8670, 8791, 8940, 9115, 9316, 9540, 9786, 10053, 10338, 10640, 10958, 11290, 11636,
+    11994, 12363, 12742, 13130, 13526, 13930, 14341, 14759, 15183, 15612, 16046, 16484, 16927, 17374, 17824, 18278,
+    18735, 19194, 19657, 20122, 20589, 21058, 21530, 22003, 22478, 22955, 23434, 23913, 24395, 24877, 25361, 25846,
+    26332, 26819, 27307, 27796, 28286, 28777, 29269, 29761, 30254, 30748, 31242, 31737, 32233, 32729, 33226, 33723,
+    34221, 34719, 35217, 35717, 36216, 36716, 37216, 37717, 38218, 38719, 39221, 39723, 40225, 40728, 41231, 41734,
+    42237, 42741, 43245, 43749, 44253, 44758, 45263, 45768, 46273, 46778, 47284, 47790, 48295, 48802, 49308, 49814,
+    50321, 50828, 51334, 51841, 52349, 52856, 53363, 53871, 54378, 54886, 55394, 55902, 56410, 56918, 57427, 57935,
+    58444, 58952, 59461, 59970, 60479, 60988, 61497, 62006, 62515, 63024, 63534, 64043, 64553, 65062, 65535, 65535,
+    65535, 65535, 65131, 64622, 64113, 63604, 63095, 62587, 62078, 61570, 61061, 60553, 60045, 59536, 59028, 58520,
+    58013, 57505, 56997, 56490, 55982, 55475, 54968, 54461, 53954, 53447, 52941, 52434, 51928, 51422, 50916, 50410,
+    49904, 49399, 48894, 48388, 47883, 47379, 46874, 46370, 45866, 45362, 44858, 44355, 43851, 43349, 42846, 42343,
+    41841, 41339, 40838, 40337, 39836, 39335, 38835, 38335, 37836, 37337, 36838, 36340, 35842, 35345, 34848, 34352,
+    33856, 33361, 32866, 32372, 31878, 31386, 30893, 30402, 29912, 29422, 28933, 28445, 27958, 27471, 26986, 26502,
+    26019, 25538, 25057, 24578, 24101, 23624, 23150, 22677, 22206, 21737, 21271, 20806, 20344, 19884, 19427, 18973,
+    18522, 18074, 17630, 17190, 16754, 16323, 15897, 15476, 15060, 14651, 14249, 13854, 13467, 13089, 12721, 12363,
+    12016, 11681, 11360, 11054, 10763, 10490, 10235, 10000, 9786, 9595, 9429, 9288, 9173, 9086, 9028, 8999,
+    8999, 9028, 9086, 9173, 9288, 9429, 9595, 9786, 10000, 10235, 10490, 10763, 11054, 11360, 11681, 12016,
+    12363, 12721, 13089, 13467, 13854, 14249, 14651, 15060, 15476, 15897, 16323, 16754, 17190, 17630, 18074, 18522,
+    18973, 19427, 19884, 20344, 20806, 21271, 21737, 22206, 22677, 23150, 23624, 24101, 24578, 25057, 25538, 26019,
+    26502, 26986, 27471, 27958, 28445, 28933, 29422, 29912, 30402, 30893, 31386, 31878, 32372, 32866, 33361, 33856,
+    34352, 34848, 35345, 35842, 36340, 36838, 37337, 37836, 38335, 38835, 39335, 39836, 40337, 40838, 41339, 41841,
+    42343, 42846, 43349, 43851, 44355, 44858, 45362, 45866, 46370, 46874, 47379, 47883, 48388, 48894, 49399, 49904,
+    50410, 50916, 51422, 51928, 52434, 52941, 53447, 53954, 54461, 54968, 55475, 55982, 56490, 56997, 57505, 58013,
+    58520, 59028, 59536, 60045, 60553, 61061, 61570, 62078, 62587, 63095, 63604, 64113, 64622, 65131, 65535, 65535,
+    65535, 65535, 65204, 64696, 64187, 63679, 63171, 62663, 62155, 61647, 61139, 60631, 60124, 59616, 59109, 58602,
+    58095, 57588, 57081, 56574, 56067, 55561, 55054, 54548, 54042, 53536, 53031, 52525, 52019, 51514, 51009, 50504,
+    50000, 49495, 48991, 48487, 47983, 47479, 46975, 46472, 45969, 45466, 44964, 44462, 43960, 43458, 42957, 42456,
+    41955, 41454, 40954, 40454, 39955, 39456, 38957, 38459, 37961, 37464, 36967, 36470, 35974, 35479, 34984, 34490,
+    33996, 33503, 33010, 32518, 32027, 31537, 31047, 30558, 30070, 29583, 29097, 28611, 28127, 27644, 27162, 26681,
+    26201, 25723, 25246, 24771, 24297, 23825, 23355, 22886, 22419, 21955, 21493, 21033, 20576, 20122, 19670, 19222,
+    18777, 18335, 17898, 17465, 17036, 16612, 16193, 15780, 15373, 14972, 14579, 14193, 13816, 13448, 13089, 12742,
+    12405, 12082, 11772, 11476, 11196, 10934, 10689, 10465, 10261, 10079, 9920, 9786, 9678, 9595, 9540, 9512,
+    9512, 9540, 9595, 9678, 9786, 9920, 10079, 10261, 10465, 10689, 10934, 11196, 11476, 11772, 12082, 12405,
+    12742, 13089, 13448, 13816, 14193, 14579, 14972, 15373, 15780, 16193, 16612, 17036, 17465, 17898, 18335, 18777,
+    19222, 19670, 20122, 20576, 21033, 21493, 21955, 22419, 22886, 23355, 23825, 24297, 24771, 25246, 25723, 26201,
+    26681, 27162, 27644, 28127, 28611, 29097, 29583, 30070, 30558, 31047, 31537, 32027, 32518, 33010, 33503, 33996,
+    34490, 34984, 35479, 35974, 36470, 36967, 37464, 37961, 38459, 38957, 39456, 39955, 40454, 40954, 41454, 41955,
+    42456, 42957, 43458, 43960, 44462, 44964, 45466, 45969, 46472, 46975, 47479, 47983, 48487, 48991, 49495, 50000,
+    50504, 51009, 51514, 52019, 52525, 53031, 53536, 54042, 54548, 55054, 55561, 56067, 56574, 57081, 57588, 58095,
+    58602, 59109, 59616, 60124, 60631, 61139, 61647, 62155, 62663, 63171, 63679, 64187, 64696, 65204, 65535, 65535,
+    65535, 65535, 65281, 64773, 64265, 63758, 63250, 62743, 62235, 61728, 61221, 60714, 60207, 59700, 59194, 58687,
+    58181, 57675, 57168, 56663, 56157, 55651, 55146, 54640, 54135, 53630, 53125, 52620, 52116, 51612, 51107, 50604,
+    50100, 49596, 49093, 48590, 48087, 47585, 47082, 46580, 46078, 45577, 45075, 44575, 44074, 43573, 43073, 42574,
+    42074, 41575, 41077, 40578, 40080, 39583, 39086, 38589, 38093, 37598, 37102, 36608, 36114, 35620, 35127, 34635,
+    34143, 33652, 33162, 32672, 32184, 31696, 31208, 30722, 30237, 29752, 29269, 28786, 28305, 27825, 27346, 26868,
+    26392, 25918, 25444, 24973, 24503, 24035, 23568, 23104, 22642, 22183, 21725, 21271, 20819, 20370, 19924, 19481,
+    19042, 18607, 18176, 17750, 17328, 16911, 16500, 16095, 15696, 15304, 14919, 14543, 14175, 13816, 13467, 13130,
+    12804, 12490, 12191, 11906, 11636, 11384, 11149, 10934, 10739, 10565, 10414, 10286, 10183, 10105, 10053, 10026,
+    10026, 10053, 10105, 10183, 10286, 10414, 10565, 10739, 10934, 11149, 11384, 11636, 11906, 12191, 12490, 12804,
+    13130, 13467, 13816, 14175, 14543, 14919, 15304, 15696, 16095, 16500, 16911, 17328, 17750, 18176, 18607, 19042,
+    19481, 19924, 20370, 20819, 21271, 21725, 22183, 22642, 23104, 23568, 24035, 24503, 24973, 25444, 25918, 26392,
+    26868, 27346, 27825, 28305, 28786, 29269, 29752, 30237, 30722, 31208, 31696, 32184, 32672, 33162, 33652, 34143,
+    34635, 35127, 35620, 36114, 36608, 37102, 37598, 38093, 38589, 39086, 39583, 40080, 40578, 41077, 41575, 42074,
+    42574, 43073, 43573, 44074, 44575, 45075, 45577, 46078, 46580, 47082, 47585, 48087, 48590, 49093, 49596, 50100,
+    50604, 51107, 51612, 52116, 52620, 53125, 53630, 54135, 54640, 55146, 55651, 56157, 56663, 57168, 57675, 58181,
+    58687, 59194, 59700, 60207, 60714, 61221, 61728, 62235, 62743, 63250, 63758, 64265, 64773, 65281, 65535, 65535,
+    65535, 65535, 65362, 64855, 64348, 63841, 63334, 62827, 62320, 61814, 61307, 60801, 60295, 59789, 59283, 58777,
+    58272, 57766, 57261, 56756, 56251, 55746, 55241, 54737, 54232, 53728, 53224, 52721, 52217, 51714, 51211, 50708,
+    50205, 49703, 49201, 48699, 48197, 47695, 47194, 46693, 46193, 45693, 45193, 44693, 44194, 43695, 43196, 42698,
+    42200, 41702, 41205, 40708, 40212, 39716, 39221, 38726, 38232, 37738, 37245, 36752, 36260, 35768, 35277, 34787,
+    34298, 33809, 33321, 32834, 32347, 31862, 31377, 30893, 30411, 29929, 29449, 28969, 28491, 28014, 27539, 27064,
+    26592, 26121, 25651, 25183, 24717, 24254, 23792, 23332, 22874, 22419, 21967, 21518, 21071, 20627, 20187, 19751,
+    19318, 18889, 18465, 18045, 17630, 17221, 16817, 16420, 16029, 15645, 15269, 14902, 14543, 14193, 13854, 13526,
+    13210, 12906, 12617, 12341, 12082, 11839, 11613, 11407, 11220, 11054, 10910, 10788, 10689, 10615, 10565, 10540,
+    10540, 10565, 10615, 10689, 10788, 10910, 11054, 11220, 11407, 11613, 11839, 12082, 12341, 12617, 12906, 13210,
+    13526, 13854, 14193, 14543, 14902, 15269, 15645, 16029, 16420, 16817, 17221, 17630, 18045, 18465, 18889, 19318,
+    19751, 20187, 20627, 21071, 21518, 21967, 22419, 22874, 23332, 23792, 24254, 24717, 25183, 25651, 26121, 26592,
+    27064, 27539, 28014, 28491, 28969, 29449, 29929, 30411, 30893, 31377, 31862, 32347, 32834, 33321, 33809, 34298,
+    34787, 35277, 35768, 36260, 36752, 37245, 37738, 38232, 38726, 39221, 39716, 40212, 40708, 41205, 41702, 42200,
+    42698, 43196, 43695, 44194, 44693, 45193, 45693, 46193, 46693, 47194, 47695, 48197, 48699, 49201, 49703, 50205,
+    50708, 51211, 51714, 52217, 52721, 53224, 53728, 54232, 54737, 55241, 55746, 56251, 56756, 57261, 57766, 58272,
+    58777, 59283, 59789, 60295, 60801, 61307, 61814, 62320, 62827, 63334, 63841, 64348, 64855, 65362, 65535, 65535,
+    65535, 65535, 65447, 64940, 64434, 63927, 63421, 62915, 62409, 61903, 61398, 60892, 60387, 59882, 59376, 58872,
+    58367, 57862, 57358, 56853, 56349, 55845, 55342, 54838, 54335, 53832, 53329, 52826, 52323, 51821, 51319, 50817,
+    50316, 49814, 49313, 48812, 48312, 47812, 47312, 46812, 46313, 45814, 45315, 44817, 44319, 43821, 43324, 42827,
+    42331, 41835, 41339, 40844, 40350, 39856, 39362, 38869, 38377, 37885, 37393, 36903, 36412, 35923, 35434, 34946,
+    34459, 33973, 33487, 33002, 32518, 32035, 31553, 31073, 30593, 30114, 29636, 29160, 28685, 28212, 27739, 27269,
+    26800, 26332, 25867, 25403, 24941, 24481, 24024, 23568, 23116, 22666, 22218, 21774, 21333, 20895, 20460, 20030,
+    19603, 19181, 18763, 18350, 17942, 17540, 17144, 16754, 16372, 15996, 15628, 15269, 14919, 14579, 14249, 13930,
+    13623, 13329, 13049, 12783, 12533, 12298, 12082, 11883, 11704, 11545, 11407, 11290, 11196, 11125, 11078, 11054,
+    11054, 11078, 11125, 11196, 11290, 11407, 11545, 11704, 11883, 12082, 12298, 12533, 12783, 13049, 13329, 13623,
+    13930, 14249, 14579, 14919, 15269, 15628, 15996, 16372, 16754, 17144, 17540, 17942, 18350, 18763, 19181, 19603,
+    20030, 20460, 20895, 21333, 21774, 22218, 22666, 23116, 23568, 24024, 24481, 24941, 25403, 25867, 26332, 26800,
+    27269, 27739, 28212, 28685, 29160, 29636, 30114, 30593, 31073, 31553, 32035, 32518, 33002, 33487, 33973, 34459,
+    34946, 35434, 35923, 36412, 36903, 37393, 37885, 38377, 38869, 39362, 39856, 40350, 40844, 41339, 41835, 42331,
+    42827, 43324, 43821, 44319, 44817, 45315, 45814, 46313, 46812, 47312, 47812, 48312, 48812, 49313, 49814, 50316,
+    50817, 51319, 51821, 52323, 52826, 53329, 53832, 54335, 54838, 55342, 55845, 56349, 56853, 57358, 57862, 58367,
+    58872, 59376, 59882, 60387, 60892, 61398, 61903, 62409, 62915, 63421, 63927, 64434, 64940, 65447, 65535, 65535,
+    65535, 65535, 65535, 65030, 64524, 64018, 63513, 63007, 62502, 61997, 61492, 60988, 60483, 59979, 59474, 58970,
+    58466, 57962, 57459, 56956, 56452, 55949, 55447, 54944, 54442, 53939, 53437, 52936, 52434, 51933, 51432, 50931,
+    50431, 49931, 49431, 48931, 48432, 47933, 47434, 46936, 46438, 45941, 45443, 44946, 44450, 43954, 43458, 42963,
+    42468, 41974, 41480, 40986, 40494, 40001, 39510, 39018, 38528, 38038, 37548, 37060, 36572, 36084, 35598, 35112,
+    34627, 34143, 33660, 33178, 32697, 32216, 31737, 31259, 30782, 30306, 29832, 29359, 28887, 28417, 27948, 27481,
+    27016, 26552, 26090, 25631, 25173, 24717, 24264, 23814, 23366, 22921, 22478, 22039, 21603, 21171, 20742, 20318,
+    19897, 19481, 19070, 18664, 18263, 17868, 17480, 17098, 16723, 16355, 15996, 15645, 15304, 14972, 14651, 14341,
+    14044, 13759, 13487, 13230, 12988, 12762, 12554, 12363, 12191, 12038, 11906, 11794, 11704, 11636, 11591, 11568,
+    11568, 11591, 11636, 11704, 11794, 11906, 12038, 12191, 12363, 12554, 12762, 12988, 13230, 13487, 13759, 14044,
+    14341, 14651, 14972, 15304, 15645, 15996, 16355, 16723, 17098, 17480, 17868, 18263, 18664, 19070, 19481, 19897,
+    20318, 20742, 21171, 21603, 22039, 22478, 22921, 23366, 23814, 24264, 24717, 25173, 25631, 26090, 26552, 27016,
+    27481, 27948, 28417, 28887, 29359, 29832, 30306, 30782, 31259, 31737, 32216, 32697, 33178, 33660, 34143, 34627,
+    35112, 35598, 36084, 36572, 37060, 37548, 38038, 38528, 39018, 39510, 40001, 40494, 40986, 41480, 41974, 42468,
+    42963, 43458, 43954, 44450, 44946, 45443, 45941, 46438, 46936, 47434, 47933, 48432, 48931, 49431, 49931, 50431,
+    50931, 51432, 51933, 52434, 52936, 53437, 53939, 54442, 54944, 55447, 55949, 56452, 56956, 57459, 57962, 58466,
+    58970, 59474, 59979, 60483, 60988, 61492, 61997, 62502, 63007, 63513, 64018, 64524, 65030, 65535, 65535, 65535,
+    65535, 65535, 65535, 65123, 64618, 64113, 63608, 63104, 62599, 62095, 61591, 61087, 60583, 60080, 59576, 59073,
+    58570, 58067, 57565, 57062, 56560, 56058, 55556, 55054, 54553, 54052, 53551, 53050, 52550, 52050, 51550, 51051,
+    50551, 50052, 49554, 49055, 48557, 48060, 47562, 47065, 46569, 46073, 45577, 45081, 44586, 44092, 43598, 43104,
+    42611, 42118, 41626, 41134, 40643, 40153, 39663, 39174, 38685, 38197, 37710, 37223, 36738, 36252, 35768, 35285,
+    34802, 34321, 33840, 33361, 32882, 32404, 31928, 31453, 30979, 30506, 30035, 29565, 29097, 28630, 28165, 27701,
+    27240, 26780, 26322, 25867, 25413, 24962, 24514, 24068, 23624, 23184, 22747, 22313, 21883, 21456, 21033, 20615,
+    20200, 19791, 19386, 18987, 18593, 18205, 17824, 17450, 17082, 16723, 16372, 16029, 15696, 15373, 15060, 14759,
+    14470, 14193, 13930, 13681, 13448, 13230, 13029, 12845, 12679, 12533, 12405, 12298, 12212, 12147, 12104, 12082,
+    12082, 12104, 12147, 12212, 12298, 12405, 12533, 12679, 12845, 13029, 13230, 13448, 13681, 13930, 14193, 14470,
+    14759, 15060, 15373, 15696, 16029, 16372, 16723, 17082, 17450, 17824, 18205, 18593, 18987, 19386, 19791, 20200,
+    20615, 21033, 21456, 21883, 22313, 22747, 23184, 23624, 24068, 24514, 24962, 25413, 25867, 26322, 26780, 27240,
+    27701, 28165, 28630, 29097, 29565, 30035, 30506, 30979, 31453, 31928, 32404, 32882, 33361, 33840, 34321, 34802,
+    35285, 35768, 36252, 36738, 37223, 37710, 38197, 38685, 39174, 39663, 40153, 40643, 41134, 41626, 42118, 42611,
+    43104, 43598, 44092, 44586, 45081, 45577, 46073, 46569, 47065, 47562, 48060, 48557, 49055, 49554, 50052, 50551,
+    51051, 51550, 52050, 52550, 53050, 53551, 54052, 54553, 55054, 55556, 56058, 56560, 57062, 57565, 58067, 58570,
+    59073, 59576, 60080, 60583, 61087, 61591, 62095, 62599, 63104, 63608, 64113, 64618, 65123, 65535, 65535, 65535,
+    65535, 65535, 65535, 65220, 64716, 64212, 63708, 63204, 62701, 62197, 61694, 61191, 60688, 60185, 59683, 59180,
+    58678, 58176, 57675, 57173, 56672, 56171, 55670, 55169, 54669, 54169, 53669, 53170, 52671, 52172, 51673, 51175,
+    50677, 50179, 49681, 49184, 48688, 48191, 47695, 47200, 46705, 46210, 45716, 45222, 44728, 44235, 43743, 43251,
+    42759, 42268, 41778, 41288, 40799, 40311, 39823, 39335, 38849, 38363, 37878, 37393, 36910, 36427, 35945, 35464,
+    34984, 34505, 34027, 33550, 33074, 32600, 32126, 31654, 31183, 30713, 30245, 29779, 29314, 28850, 28389, 27929,
+    27471, 27016, 26562, 26110, 25661, 25215, 24771, 24330, 23891, 23456, 23024, 22596, 22171, 21750, 21333, 20920,
+    20512, 20109, 19710, 19318, 18931, 18550, 18176, 17809, 17450, 17098, 16754, 16420, 16095, 15780, 15476, 15183,
+    14902, 14633, 14378, 14137, 13911, 13701, 13507, 13329, 13170, 13029, 12906, 12804, 12721, 12658, 12617, 12596,
+    12596, 12617, 12658, 12721, 12804, 12906, 13029, 13170, 13329, 13507, 13701, 13911, 14137, 14378, 14633, 14902,
+    15183, 15476, 15780, 16095, 16420, 16754, 17098, 17450, 17809, 18176, 18550, 18931, 19318, 19710, 20109, 20512,
+    20920, 21333, 21750, 22171, 22596, 23024, 23456, 23891, 24330, 24771, 25215, 25661, 26110, 26562, 27016, 27471,
+    27929, 28389, 28850, 29314, 29779, 30245, 30713, 31183, 31654, 32126, 32600, 33074, 33550, 34027, 34505, 34984,
+    35464, 35945, 36427, 36910, 37393, 37878, 38363, 38849, 39335, 39823, 40311, 40799, 41288, 41778, 42268, 42759,
+    43251, 43743, 44235, 44728, 45222, 45716, 46210, 46705, 47200, 47695, 48191, 48688, 49184, 49681, 50179, 50677,
+    51175, 51673, 52172, 52671, 53170, 53669, 54169, 54669, 55169, 55670, 56171, 56672, 57173, 57675, 58176, 58678,
+    59180, 59683, 60185, 60688, 61191, 61694, 62197, 62701, 63204, 63708, 64212, 64716, 65220, 65535, 65535, 65535,
+    65535, 65535, 65535, 65321, 64818, 64315, 63812, 63309, 62806, 62303, 61801, 61299, 60797, 60295, 59793, 59292,
+    58791, 58290, 57789, 57289, 56788, 56288, 55789, 55289, 54790, 54291, 53792, 53294, 52796, 52298, 51801, 51304,
+    50807, 50310, 49814, 49319, 48823, 48328, 47834, 47340, 46846, 46353, 45860, 45368, 44876, 44384, 43894, 43403,
+    42914, 42424, 41936, 41448, 40961, 40474, 39988, 39503, 39018, 38535, 38052, 37569, 37088, 36608, 36128, 35650,
+    35172, 34696, 34221, 33746, 33273, 32801, 32331, 31862, 31394, 30928, 30463, 30000, 29538, 29079, 28621, 28165,
+    27711, 27259, 26809, 26362, 25918, 25475, 25036, 24600, 24166, 23736, 23309, 22886, 22467, 22051, 21640, 21233,
+    20831, 20434, 20043, 19657, 19277, 18903, 18536, 18176, 17824, 17480, 17144, 16817, 16500, 16193, 15897, 15612,
+    15338, 15078, 14830, 14597, 14378, 14175, 13987, 13816, 13662, 13526, 13408, 13310, 13230, 13170, 13130, 13110,
+    13110, 13130, 13170, 13230, 13310, 13408, 13526, 13662, 13816, 13987, 14175, 14378, 14597, 14830, 15078, 15338,
+    15612, 15897, 16193, 16500, 16817, 17144, 17480, 17824, 18176, 18536, 18903, 19277, 19657, 20043, 20434, 20831,
+    21233, 21640, 22051, 22467, 22886, 23309, 23736, 24166, 24600, 25036, 25475, 25918, 26362, 26809, 27259, 27711,
+    28165, 28621, 29079, 29538, 30000, 30463, 30928, 31394, 31862, 32331, 32801, 33273, 33746, 34221, 34696, 35172,
+    35650, 36128, 36608, 37088, 37569, 38052, 38535, 39018, 39503, 39988, 40474, 40961, 41448, 41936, 42424, 42914,
+    43403, 43894, 44384, 44876, 45368, 45860, 46353, 46846, 47340, 47834, 48328, 48823, 49319, 49814, 50310, 50807,
+    51304, 51801, 52298, 52796, 53294, 53792, 54291, 54790, 55289, 55789, 56288, 56788, 57289, 57789, 58290, 58791,
+    59292, 59793, 60295, 60797, 61299, 61801, 62303, 62806, 63309, 63812, 64315, 64818, 65321, 65535, 65535, 65535,
+    65535, 65535, 65535, 65427, 64924, 64421, 63919, 63417, 62915, 62413, 61912, 61411, 60910, 60409, 59908, 59408,
+    58907, 58407, 57908, 57408, 56909, 56410, 55912, 55413, 54915, 54417, 53920, 53423, 52926, 52429, 51933, 51437,
+    50942, 50447, 49952, 49458, 48964, 48470, 47977, 47485, 46992, 46501, 46009, 45519, 45029, 44539, 44050, 43561,
+    43073, 42586, 42099, 41613, 41128, 40643, 40159, 39676, 39194, 38712, 38232, 37752, 37273, 36795, 36318, 35842,
+    35367, 34893, 34421, 33949, 33479, 33010, 32543, 32077, 31612, 31149, 30688, 30228, 29770, 29314, 28860, 28408,
+    27958, 27510, 27064, 26622, 26181, 25744, 25309, 24877, 24449, 24024, 23602, 23184, 22770, 22360, 21955, 21554,
+    21158, 20768, 20383, 20003, 19630, 19263, 18903, 18550, 18205, 17868, 17540, 17221, 16911, 16612, 16323, 16046,
+    15780, 15527, 15287, 15060, 14848, 14651, 14470, 14305, 14156, 14025, 13911, 13816, 13739, 13681, 13643, 13623,
+    13623, 13643, 13681, 13739, 13816, 13911, 14025, 14156, 14305, 14470, 14651, 14848, 15060, 15287, 15527, 15780,
+    16046, 16323, 16612, 16911, 17221, 17540, 17868, 18205, 18550, 18903, 19263, 19630, 20003, 20383, 20768, 21158,
+    21554, 21955, 22360, 22770, 23184, 23602, 24024, 24449, 24877, 25309, 25744, 26181, 26622, 27064, 27510, 27958,
+    28408, 28860, 29314, 29770, 30228, 30688, 31149, 31612, 32077, 32543, 33010, 33479, 33949, 34421, 34893, 35367,
+    35842, 36318, 36795, 37273, 37752, 38232, 38712, 39194, 39676, 40159, 40643, 41128, 41613, 42099, 42586, 43073,
+    43561, 44050, 44539, 45029, 45519, 46009, 46501, 46992, 47485, 47977, 48470, 48964, 49458, 49952, 50447, 50942,
+    51437, 51933, 52429, 52926, 53423, 53920, 54417, 54915, 55413, 55912, 56410, 56909, 57408, 57908, 58407, 58907,
+    59408, 59908, 60409, 60910, 61411, 61912, 62413, 62915, 63417, 63919, 64421, 64924, 65427, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65034, 64532, 64031, 63529, 63028, 62528, 62027, 61527, 61027, 60527, 60027, 59528,
+    59028, 58529, 58031, 57532, 57034, 56536, 56039, 55542, 55045, 54548, 54052, 53556, 53060, 52565, 52070, 51576,
+    51082, 50588, 50095, 49602, 49109, 48617, 48126, 47635, 47144, 46654, 46164, 45675, 45187, 44699, 44211, 43725,
+    43239, 42753, 42268, 41784, 41301, 40819, 40337, 39856, 39376, 38896, 38418, 37940, 37464, 36988, 36514, 36041,
+    35568, 35097, 34627, 34159, 33692, 33226, 32761, 32298, 31837, 31377, 30919, 30463, 30009, 29556, 29106, 28658,
+    28212, 27768, 27327, 26888, 26452, 26019, 25589, 25162, 24739, 24319, 23902, 23490, 23081, 22677, 22278, 21883,
+    21493, 21108, 20730, 20357, 19990, 19630, 19277, 18931, 18593, 18263, 17942, 17630, 17328, 17036, 16754, 16484,
+    16226, 15980, 15746, 15527, 15321, 15130, 14955, 14795, 14651, 14524, 14415, 14323, 14249, 14193, 14156, 14137,
+    14137, 14156, 14193, 14249, 14323, 14415, 14524, 14651, 14795, 14955, 15130, 15321, 15527, 15746, 15980, 16226,
+    16484, 16754, 17036, 17328, 17630, 17942, 18263, 18593, 18931, 19277, 19630, 19990, 20357, 20730, 21108, 21493,
+    21883, 22278, 22677, 23081, 23490, 23902, 24319, 24739, 25162, 25589, 26019, 26452, 26888, 27327, 27768, 28212,
+    28658, 29106, 29556, 30009, 30463, 30919, 31377, 31837, 32298, 32761, 33226, 33692, 34159, 34627, 35097, 35568,
+    36041, 36514, 36988, 37464, 37940, 38418, 38896, 39376, 39856, 40337, 40819, 41301, 41784, 42268, 42753, 43239,
+    43725, 44211, 44699, 45187, 45675, 46164, 46654, 47144, 47635, 48126, 48617, 49109, 49602, 50095, 50588, 51082,
+    51576, 52070, 52565, 53060, 53556, 54052, 54548, 55045, 55542, 56039, 56536, 57034, 57532, 58031, 58529, 59028,
+    59528, 60027, 60527, 61027, 61527, 62027, 62528, 63028, 63529, 64031, 64532, 65034, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65147, 64647, 64146, 63646, 63146, 62646, 62146, 61647, 61148, 60649, 60150, 59652,
+    59154, 58656, 58158, 57661, 57164, 56667, 56171, 55675, 55179, 54684, 54189, 53694, 53200, 52706, 52212, 51719,
+    51226, 50734, 50242, 49751, 49260, 48769, 48279, 47790, 47301, 46812, 46324, 45837, 45350, 44864, 44378, 43894,
+    43409, 42926, 42443, 41961, 41480, 40999, 40520, 40041, 39563, 39086, 38610, 38135, 37661, 37188, 36716, 36245,
+    35776, 35307, 34840, 34375, 33910, 33448, 32986, 32526, 32068, 31612, 31157, 30705, 30254, 29805, 29359, 28915,
+    28473, 28033, 27596, 27162, 26730, 26302, 25877, 25455, 25036, 24621, 24210, 23803, 23400, 23001, 22607, 22218,
+    21834, 21456, 21083, 20717, 20357, 20003, 19657, 19318, 18987, 18664, 18350, 18045, 17750, 17465, 17190, 16927,
+    16675, 16436, 16209, 15996, 15797, 15612, 15441, 15287, 15148, 15025, 14919, 14830, 14759, 14705, 14669, 14651,
+    14651, 14669, 14705, 14759, 14830, 14919, 15025, 15148, 15287, 15441, 15612, 15797, 15996, 16209, 16436, 16675,
+    16927, 17190, 17465, 17750, 18045, 18350, 18664, 18987, 19318, 19657, 20003, 20357, 20717, 21083, 21456, 21834,
+    22218, 22607, 23001, 23400, 23803, 24210, 24621, 25036, 25455, 25877, 26302, 26730, 27162, 27596, 28033, 28473,
+    28915, 29359, 29805, 30254, 30705, 31157, 31612, 32068, 32526, 32986, 33448, 33910, 34375, 34840, 35307, 35776,
+    36245, 36716, 37188, 37661, 38135, 38610, 39086, 39563, 40041, 40520, 40999, 41480, 41961, 42443, 42926, 43409,
+    43894, 44378, 44864, 45350, 45837, 46324, 46812, 47301, 47790, 48279, 48769, 49260, 49751, 50242, 50734, 51226,
+    51719, 52212, 52706, 53200, 53694, 54189, 54684, 55179, 55675, 56171, 56667, 57164, 57661, 58158, 58656, 59154,
+    59652, 60150, 60649, 61148, 61647, 62146, 62646, 63146, 63646, 64146, 64647, 65147, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65265, 64765, 64265, 63766, 63267, 62768, 62269, 61771, 61273, 60775, 60277, 59780,
+    59283, 58786, 58290, 57794, 57298, 56802, 56307, 55812, 55318, 54824, 54330, 53836, 53343, 52851, 52359, 51867,
+    51376, 50885, 50394, 49904, 49415, 48926, 48438, 47950, 47462, 46975, 46489, 46004, 45519, 45034, 44551, 44068,
+    43586, 43104, 42623, 42143, 41664, 41186, 40708, 40232, 39756, 39282, 38808, 38335, 37864, 37393, 36924, 36456,
+    35989, 35524, 35060, 34597, 34136, 33676, 33218, 32761, 32306, 31853, 31402, 30953, 30506, 30061, 29619, 29178,
+    28740, 28305, 27872, 27443, 27016, 26592, 26171, 25754, 25340, 24930, 24524, 24122, 23725, 23332, 22944, 22560,
+    22183, 21810, 21444, 21083, 20730, 20383, 20043, 19710, 19386, 19070, 18763, 18465, 18176, 17898, 17630, 17374,
+    17129, 16896, 16675, 16468, 16274, 16095, 15930, 15780, 15645, 15527, 15424, 15338, 15269, 15217, 15183, 15165,
+    15165, 15183, 15217, 15269, 15338, 15424, 15527, 15645, 15780, 15930, 16095, 16274, 16468, 16675, 16896, 17129,
+    17374, 17630, 17898, 18176, 18465, 18763, 19070, 19386, 19710, 20043, 20383, 20730, 21083, 21444, 21810, 22183,
+    22560, 22944, 23332, 23725, 24122, 24524, 24930, 25340, 25754, 26171, 26592, 27016, 27443, 27872, 28305, 28740,
+    29178, 29619, 30061, 30506, 30953, 31402, 31853, 32306, 32761, 33218, 33676, 34136, 34597, 35060, 35524, 35989,
+    36456, 36924, 37393, 37864, 38335, 38808, 39282, 39756, 40232, 40708, 41186, 41664, 42143, 42623, 43104, 43586,
+    44068, 44551, 45034, 45519, 46004, 46489, 46975, 47462, 47950, 48438, 48926, 49415, 49904, 50394, 50885, 51376,
+    51867, 52359, 52851, 53343, 53836, 54330, 54824, 55318, 55812, 56307, 56802, 57298, 57794, 58290, 58786, 59283,
+    59780, 60277, 60775, 61273, 61771, 62269, 62768, 63267, 63766, 64265, 64765, 65265, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65386, 64887, 64389, 63890, 63392, 62894, 62397, 61899, 61402, 60905, 60409, 59912,
+    59416, 58921, 58426, 57931, 57436, 56942, 56448, 55954, 55461, 54968, 54476, 53983, 53492, 53001, 52510, 52019,
+    51530, 51040, 50551, 50063, 49575, 49088, 48601, 48115, 47629, 47144, 46659, 46176, 45693, 45210, 44728, 44247,
+    43767, 43288, 42809, 42331, 41854, 41378, 40903, 40428, 39955, 39483, 39012, 38541, 38072, 37605, 37138, 36673,
+    36209, 35746, 35285, 34825, 34367, 33910, 33455, 33002, 32551, 32101, 31654, 31208, 30765, 30324, 29885, 29449,
+    29015, 28584, 28155, 27730, 27307, 26888, 26472, 26060, 25651, 25246, 24845, 24449, 24057, 23669, 23287, 22909,
+    22537, 22171, 21810, 21456, 21108, 20768, 20434, 20109, 19791, 19481, 19181, 18889, 18607, 18335, 18074, 17824,
+    17585, 17358, 17144, 16943, 16754, 16580, 16420, 16274, 16144, 16029, 15930, 15847, 15780, 15730, 15696, 15679,
+    15679, 15696, 15730, 15780, 15847, 15930, 16029, 16144, 16274, 16420, 16580, 16754, 16943, 17144, 17358, 17585,
+    17824, 18074, 18335, 18607, 18889, 19181, 19481, 19791, 20109, 20434, 20768, 21108, 21456, 21810, 22171, 22537,
+    22909, 23287, 23669, 24057, 24449, 24845, 25246, 25651, 26060, 26472, 26888, 27307, 27730, 28155, 28584, 29015,
+    29449, 29885, 30324, 30765, 31208, 31654, 32101, 32551, 33002, 33455, 33910, 34367, 34825, 35285, 35746, 36209,
+    36673, 37138, 37605, 38072, 38541, 39012, 39483, 39955, 40428, 40903, 41378, 41854, 42331, 42809, 43288, 43767,
+    44247, 44728, 45210, 45693, 46176, 46659, 47144, 47629, 48115, 48601, 49088, 49575, 50063, 50551, 51040, 51530,
+    52019, 52510, 53001, 53492, 53983, 54476, 54968, 55461, 55954, 56448, 56942, 57436, 57931, 58426, 58921, 59416,
+    59912, 60409, 60905, 61402, 61899, 62397, 62894, 63392, 63890, 64389, 64887, 65386, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65511, 65013, 64516, 64018, 63521, 63024, 62528, 62031, 61535, 61040, 60544, 60049,
+    59554, 59060, 58566, 58072, 57578, 57085, 56593, 56100, 55608, 55117, 54626, 54135, 53645, 53155, 52666, 52177,
+    51688, 51200, 50713, 50226, 49740, 49254, 48769, 48285, 47801, 47317, 46835, 46353, 45871, 45391, 44911, 44432,
+    43954, 43476, 43000, 42524, 42049, 41575, 41102, 40630, 40159, 39690, 39221, 38753, 38287, 37822, 37358, 36895,
+    36434, 35974, 35516, 35060, 34604, 34151, 33699, 33249, 32801, 32355, 31911, 31470, 31030, 30593, 30158, 29725,
+    29296, 28869, 28445, 28024, 27606, 27191, 26780, 26372, 25968, 25569, 25173, 24782, 24395, 24013, 23636, 23264,
+    22898, 22537, 22183, 21834, 21493, 21158, 20831, 20512, 20200, 19897, 19603, 19318, 19042, 18777, 18522, 18278,
+    18045, 17824, 17615, 17419, 17236, 17067, 16911, 16770, 16644, 16532, 16436, 16355, 16291, 16242, 16209, 16193,
+    16193, 16209, 16242, 16291, 16355, 16436, 16532, 16644, 16770, 16911, 17067, 17236, 17419, 17615, 17824, 18045,
+    18278, 18522, 18777, 19042, 19318, 19603, 19897, 20200, 20512, 20831, 21158, 21493, 21834, 22183, 22537, 22898,
+    23264, 23636, 24013, 24395, 24782, 25173, 25569, 25968, 26372, 26780, 27191, 27606, 28024, 28445, 28869, 29296,
+    29725, 30158, 30593, 31030, 31470, 31911, 32355, 32801, 33249, 33699, 34151, 34604, 35060, 35516, 35974, 36434,
+    36895, 37358, 37822, 38287, 38753, 39221, 39690, 40159, 40630, 41102, 41575, 42049, 42524, 43000, 43476, 43954,
+    44432, 44911, 45391, 45871, 46353, 46835, 47317, 47801, 48285, 48769, 49254, 49740, 50226, 50713, 51200, 51688,
+    52177, 52666, 53155, 53645, 54135, 54626, 55117, 55608, 56100, 56593, 57085, 57578, 58072, 58566, 59060, 59554,
+    60049, 60544, 61040, 61535, 62031, 62528, 63024, 63521, 64018, 64516, 65013, 65511, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65143, 64647, 64150, 63654, 63158, 62663, 62167, 61673, 61178, 60684, 60190,
+    59696, 59203, 58710, 58217, 57725, 57233, 56742, 56251, 55760, 55270, 54780, 54291, 53802, 53314, 52826, 52338,
+    51852, 51365, 50880, 50394, 49910, 49426, 48942, 48459, 47977, 47496, 47015, 46535, 46055, 45577, 45099, 44622,
+    44146, 43670, 43196, 42722, 42250, 41778, 41308, 40838, 40369, 39902, 39436, 38971, 38507, 38045, 37584, 37124,
+    36666, 36209, 35753, 35300, 34848, 34398, 33949, 33503, 33058, 32616, 32175, 31737, 31301, 30868, 30437, 30009,
+    29583, 29160, 28740, 28324, 27910, 27500, 27094, 26691, 26292, 25897, 25507, 25120, 24739, 24362, 23991, 23624,
+    23264, 22909, 22560, 22218, 21883, 21554, 21233, 20920, 20615, 20318, 20030, 19751, 19481, 19222, 18973, 18735,
+    18508, 18292, 18089, 17898, 17720, 17555, 17404, 17267, 17144, 17036, 16943, 16864, 16802, 16754, 16723, 16707,
+    16707, 16723, 16754, 16802, 16864, 16943, 17036, 17144, 17267, 17404, 17555, 17720, 17898, 18089, 18292, 18508,
+    18735, 18973, 19222, 19481, 19751, 20030, 20318, 20615, 20920, 21233, 21554, 21883, 22218, 22560, 22909, 23264,
+    23624, 23991, 24362, 24739, 25120, 25507, 25897, 26292, 26691, 27094, 27500, 27910, 28324, 28740, 29160, 29583,
+    30009, 30437, 30868, 31301, 31737, 32175, 32616, 33058, 33503, 33949, 34398, 34848, 35300, 35753, 36209, 36666,
+    37124, 37584, 38045, 38507, 38971, 39436, 39902, 40369, 40838, 41308, 41778, 42250, 42722, 43196, 43670, 44146,
+    44622, 45099, 45577, 46055, 46535, 47015, 47496, 47977, 48459, 48942, 49426, 49910, 50394, 50880, 51365, 51852,
+    52338, 52826, 53314, 53802, 54291, 54780, 55270, 55760, 56251, 56742, 57233, 57725, 58217, 58710, 59203, 59696,
+    60190, 60684, 61178, 61673, 62167, 62663, 63158, 63654, 64150, 64647, 65143, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65277, 64781, 64286, 63791, 63296, 62802, 62308, 61814, 61320, 60827, 60334,
+    59842, 59350, 58858, 58367, 57876, 57385, 56895, 56406, 55916, 55427, 54939, 54451, 53964, 53477, 52991, 52505,
+    52019, 51535, 51051, 50567, 50084, 49602, 49120, 48639, 48159, 47679, 47200, 46722, 46244, 45768, 45292, 44817,
+    44343, 43870, 43397, 42926, 42456, 41986, 41518, 41051, 40585, 40120, 39656, 39194, 38733, 38273, 37815, 37358,
+    36903, 36449, 35997, 35546, 35097, 34650, 34205, 33762, 33321, 32882, 32445, 32011, 31579, 31149, 30722, 30298,
+    29876, 29458, 29042, 28630, 28221, 27815, 27414, 27016, 26622, 26232, 25846, 25465, 25089, 24717, 24351, 23991,
+    23636, 23287, 22944, 22607, 22278, 21955, 21640, 21333, 21033, 20742, 20460, 20187, 19924, 19670, 19427, 19194,
+    18973, 18763, 18565, 18379, 18205, 18045, 17898, 17765, 17645, 17540, 17450, 17374, 17313, 17267, 17236, 17221,
+    17221, 17236, 17267, 17313, 17374, 17450, 17540, 17645, 17765, 17898, 18045, 18205, 18379, 18565, 18763, 18973,
+    19194, 19427, 19670, 19924, 20187, 20460, 20742, 21033, 21333, 21640, 21955, 22278, 22607, 22944, 23287, 23636,
+    23991, 24351, 24717, 25089, 25465, 25846, 26232, 26622, 27016, 27414, 27815, 28221, 28630, 29042, 29458, 29876,
+    30298, 30722, 31149, 31579, 32011, 32445, 32882, 33321, 33762, 34205, 34650, 35097, 35546, 35997, 36449, 36903,
+    37358, 37815, 38273, 38733, 39194, 39656, 40120, 40585, 41051, 41518, 41986, 42456, 42926, 43397, 43870, 44343,
+    44817, 45292, 45768, 46244, 46722, 47200, 47679, 48159, 48639, 49120, 49602, 50084, 50567, 51051, 51535, 52019,
+    52505, 52991, 53477, 53964, 54451, 54939, 55427, 55916, 56406, 56895, 57385, 57876, 58367, 58858, 59350, 59842,
+    60334, 60827, 61320, 61814, 62308, 62802, 63296, 63791, 64286, 64781, 65277, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65414, 64920, 64426, 63932, 63438, 62945, 62452, 61959, 61467, 60975, 60483,
+    59992, 59501, 59010, 58520, 58031, 57542, 57053, 56565, 56077, 55589, 55102, 54616, 54130, 53645, 53160, 52676,
+    52192, 51709, 51226, 50744, 50263, 49782, 49302, 48823, 48345, 47867, 47390, 46914, 46438, 45964, 45490, 45017,
+    44545, 44074, 43604, 43135, 42667, 42200, 41734, 41269, 40806, 40343, 39882, 39422, 38964, 38507, 38052, 37598,
+    37145, 36694, 36245, 35798, 35352, 34909, 34467, 34027, 33589, 33154, 32721, 32290, 31862, 31436, 31013, 30593,
+    30175, 29761, 29350, 28942, 28537, 28137, 27739, 27346, 26957, 26572, 26191, 25815, 25444, 25078, 24717, 24362,
+    24013, 23669, 23332, 23001, 22677, 22360, 22051, 21750, 21456, 21171, 20895, 20627, 20370, 20122, 19884, 19657,
+    19440, 19236, 19042, 18861, 18692, 18536, 18393, 18263, 18147, 18045, 17957, 17883, 17824, 17779, 17750, 17735,
+    17735, 17750, 17779, 17824, 17883, 17957, 18045, 18147, 18263, 18393, 18536, 18692, 18861, 19042, 19236, 19440,
+    19657, 19884, 20122, 20370, 20627, 20895, 21171, 21456, 21750, 22051, 22360, 22677, 23001, 23332, 23669, 24013,
+    24362, 24717, 25078, 25444, 25815, 26191, 26572, 26957, 27346, 27739, 28137, 28537, 28942, 29350, 29761, 30175,
+    30593, 31013, 31436, 31862, 32290, 32721, 33154, 33589, 34027, 34467, 34909, 35352, 35798, 36245, 36694, 37145,
+    37598, 38052, 38507, 38964, 39422, 39882, 40343, 40806, 41269, 41734, 42200, 42667, 43135, 43604, 44074, 44545,
+    45017, 45490, 45964, 46438, 46914, 47390, 47867, 48345, 48823, 49302, 49782, 50263, 50744, 51226, 51709, 52192,
+    52676, 53160, 53645, 54130, 54616, 55102, 55589, 56077, 56565, 57053, 57542, 58031, 58520, 59010, 59501, 59992,
+    60483, 60975, 61467, 61959, 62452, 62945, 63438, 63932, 64426, 64920, 65414, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65062, 64569, 64076, 63583, 63091, 62599, 62108, 61617, 61126, 60636,
+    60146, 59656, 59167, 58678, 58190, 57702, 57215, 56728, 56241, 55755, 55270, 54785, 54301, 53817, 53334, 52851,
+    52369, 51887, 51406, 50926, 50447, 49968, 49490, 49012, 48536, 48060, 47585, 47110, 46637, 46164, 45693, 45222,
+    44752, 44283, 43815, 43349, 42883, 42418, 41955, 41493, 41032, 40572, 40113, 39656, 39201, 38747, 38294, 37843,
+    37393, 36945, 36499, 36055, 35613, 35172, 34734, 34298, 33864, 33432, 33002, 32575, 32151, 31729, 31310, 30893,
+    30480, 30070, 29663, 29260, 28860, 28463, 28071, 27682, 27298, 26918, 26542, 26171, 25805, 25444, 25089, 24739,
+    24395, 24057, 23725, 23400, 23081, 22770, 22467, 22171, 21883, 21603, 21333, 21071, 20819, 20576, 20344, 20122,
+    19910, 19710, 19522, 19345, 19181, 19028, 18889, 18763, 18650, 18550, 18465, 18393, 18335, 18292, 18263, 18249,
+    18249, 18263, 18292, 18335, 18393, 18465, 18550, 18650, 18763, 18889, 19028, 19181, 19345, 19522, 19710, 19910,
+    20122, 20344, 20576, 20819, 21071, 21333, 21603, 21883, 22171, 22467, 22770, 23081, 23400, 23725, 24057, 24395,
+    24739, 25089, 25444, 25805, 26171, 26542, 26918, 27298, 27682, 28071, 28463, 28860, 29260, 29663, 30070, 30480,
+    30893, 31310, 31729, 32151, 32575, 33002, 33432, 33864, 34298, 34734, 35172, 35613, 36055, 36499, 36945, 37393,
+    37843, 38294, 38747, 39201, 39656, 40113, 40572, 41032, 41493, 41955, 42418, 42883, 43349, 43815, 44283, 44752,
+    45222, 45693, 46164, 46637, 47110, 47585, 48060, 48536, 49012, 49490, 49968, 50447, 50926, 51406, 51887, 52369,
+    52851, 53334, 53817, 54301, 54785, 55270, 55755, 56241, 56728, 57215, 57702, 58190, 58678, 59167, 59656, 60146,
+    60636, 61126, 61617, 62108, 62599, 63091, 63583, 64076, 64569, 65062, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65208, 64716, 64224, 63733, 63242, 62751, 62261, 61771, 61281, 60792,
+    60304, 59815, 59327, 58840, 58353, 57867, 57381, 56895, 56410, 55926, 55442, 54958, 54476, 53993, 53512, 53031,
+    52550, 52070, 51591, 51113, 50635, 50158, 49682, 49206, 48731, 48257, 47784, 47312, 46840, 46370, 45900, 45432,
+    44964, 44497, 44032, 43567, 43104, 42642, 42181, 41721, 41263, 40806, 40350, 39895, 39443, 38991, 38541, 38093,
+    37647, 37202, 36759, 36318, 35879, 35442, 35007, 34574, 34143, 33715, 33289, 32866, 32445, 32027, 31612, 31200,
+    30791, 30385, 29982, 29583, 29187, 28795, 28408, 28024, 27644, 27269, 26898, 26532, 26171, 25815, 25465, 25120,
+    24782, 24449, 24122, 23803, 23490, 23184, 22886, 22596, 22313, 22039, 21774, 21518, 21271, 21033, 20806, 20589,
+    20383, 20187, 20003, 19831, 19670, 19522, 19386, 19263, 19153, 19056, 18973, 18903, 18847, 18805, 18777, 18763,
+    18763, 18777, 18805, 18847, 18903, 18973, 19056, 19153, 19263, 19386, 19522, 19670, 19831, 20003, 20187, 20383,
+    20589, 20806, 21033, 21271, 21518, 21774, 22039, 22313, 22596, 22886, 23184, 23490, 23803, 24122, 24449, 24782,
+    25120, 25465, 25815, 26171, 26532, 26898, 27269, 27644, 28024, 28408, 28795, 29187, 29583, 29982, 30385, 30791,
+    31200, 31612, 32027, 32445, 32866, 33289, 33715, 34143, 34574, 35007, 35442, 35879, 36318, 36759, 37202, 37647,
+    38093, 38541, 38991, 39443, 39895, 40350, 40806, 41263, 41721, 42181, 42642, 43104, 43567, 44032, 44497, 44964,
+    45432, 45900, 46370, 46840, 47312, 47784, 48257, 48731, 49206, 49682, 50158, 50635, 51113, 51591, 52070, 52550,
+    53031, 53512, 53993, 54476, 54958, 55442, 55926, 56410, 56895, 57381, 57867, 58353, 58840, 59327, 59815, 60304,
+    60792, 61281, 61771, 62261, 62751, 63242, 63733, 64224, 64716, 65208, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65358, 64867, 64376, 63886, 63396, 62907, 62418, 61929, 61441, 60953,
+    60465, 59979, 59492, 59006, 58520, 58035, 57551, 57067, 56583, 56100, 55618, 55136, 54655, 54174, 53694, 53215,
+    52736, 52258, 51780, 51304, 50828, 50352, 49878, 49404, 48931, 48459, 47988, 47518, 47049, 46580, 46113, 45646,
+    45181, 44717, 44253, 43791, 43330, 42871, 42412, 41955, 41499, 41044, 40591, 40140, 39690, 39241, 38794, 38349,
+    37906, 37464, 37024, 36586, 36150, 35717, 35285, 34855, 34428, 34004, 33582, 33162, 32745, 32331, 31920, 31512,
+    31107, 30705, 30306, 29912, 29520, 29133, 28750, 28370, 27995, 27625, 27259, 26898, 26542, 26191, 25846, 25507,
+    25173, 24845, 24524, 24210, 23902, 23602, 23309, 23024, 22747, 22478, 22218, 21967, 21725, 21493, 21271, 21058,
+    20857, 20666, 20486, 20318, 20161, 20016, 19884, 19764, 19657, 19562, 19481, 19413, 19359, 19318, 19290, 19277,
+    19277, 19290, 19318, 19359, 19413, 19481, 19562, 19657, 19764, 19884, 20016, 20161, 20318, 20486, 20666, 20857,
+    21058, 21271, 21493, 21725, 21967, 22218, 22478, 22747, 23024, 23309, 23602, 23902, 24210, 24524, 24845, 25173,
+    25507, 25846, 26191, 26542, 26898, 27259, 27625, 27995, 28370, 28750, 29133, 29520, 29912, 30306, 30705, 31107,
+    31512, 31920, 32331, 32745, 33162, 33582, 34004, 34428, 34855, 35285, 35717, 36150, 36586, 37024, 37464, 37906,
+    38349, 38794, 39241, 39690, 40140, 40591, 41044, 41499, 41955, 42412, 42871, 43330, 43791, 44253, 44717, 45181,
+    45646, 46113, 46580, 47049, 47518, 47988, 48459, 48931, 49404, 49878, 50352, 50828, 51304, 51780, 52258, 52736,
+    53215, 53694, 54174, 54655, 55136, 55618, 56100, 56583, 57067, 57551, 58035, 58520, 59006, 59492, 59979, 60465,
+    60953, 61441, 61929, 62418, 62907, 63396, 63886, 64376, 64867, 65358, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65511, 65022, 64532, 64043, 63554, 63066, 62578, 62091, 61604, 61117,
+    60631, 60146, 59661, 59176, 58692, 58208, 57725, 57242, 56760, 56279, 55798, 55318, 54838, 54359, 53881, 53403,
+    52926, 52449, 51974, 51499, 51025, 50551, 50079, 49607, 49136, 48666, 48197, 47729, 47261, 46795, 46330, 45866,
+    45403, 44940, 44480, 44020, 43561, 43104, 42648, 42193, 41740, 41288, 40838, 40389, 39942, 39496, 39052, 38610,
+    38169, 37731, 37294, 36860, 36427, 35997, 35568, 35142, 34719, 34298, 33879, 33463, 33050, 32640, 32233, 31829,
+    31428, 31030, 30636, 30245, 29858, 29476, 29097, 28722, 28352, 27986, 27625, 27269, 26918, 26572, 26232, 25897,
+    25569, 25246, 24930, 24621, 24319, 24024, 23736, 23456, 23184, 22921, 22666, 22419, 22183, 21955, 21737, 21530,
+    21333, 21146, 20970, 20806, 20653, 20512, 20383, 20266, 20161, 20069, 19990, 19924, 19871, 19831, 19804, 19791,
+    19791, 19804, 19831, 19871, 19924, 19990, 20069, 20161, 20266, 20383, 20512, 20653, 20806, 20970, 21146, 21333,
+    21530, 21737, 21955, 22183, 22419, 22666, 22921, 23184, 23456, 23736, 24024, 24319, 24621, 24930, 25246, 25569,
+    25897, 26232, 26572, 26918, 27269, 27625, 27986, 28352, 28722, 29097, 29476, 29858, 30245, 30636, 31030, 31428,
+    31829, 32233, 32640, 33050, 33463, 33879, 34298, 34719, 35142, 35568, 35997, 36427, 36860, 37294, 37731, 38169,
+    38610, 39052, 39496, 39942, 40389, 40838, 41288, 41740, 42193, 42648, 43104, 43561, 44020, 44480, 44940, 45403,
+    45866, 46330, 46795, 47261, 47729, 48197, 48666, 49136, 49607, 50079, 50551, 51025, 51499, 51974, 52449, 52926,
+    53403, 53881, 54359, 54838, 55318, 55798, 56279, 56760, 57242, 57725, 58208, 58692, 59176, 59661, 60146, 60631,
+    61117, 61604, 62091, 62578, 63066, 63554, 64043, 64532, 65022, 65511, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65180, 64692, 64204, 63716, 63229, 62743, 62257, 61771, 61286,
+    60801, 60317, 59833, 59350, 58867, 58385, 57903, 57422, 56942, 56462, 55982, 55504, 55026, 54548, 54071, 53595,
+    53120, 52645, 52172, 51699, 51226, 50755, 50284, 49814, 49345, 48877, 48410, 47944, 47479, 47015, 46552, 46090,
+    45629, 45169, 44711, 44253, 43797, 43342, 42889, 42437, 41986, 41537, 41089, 40643, 40199, 39756, 39315, 38876,
+    38438, 38003, 37569, 37138, 36709, 36282, 35857, 35434, 35014, 34597, 34182, 33770, 33361, 32954, 32551, 32151,
+    31754, 31360, 30970, 30584, 30202, 29823, 29449, 29079, 28713, 28352, 27995, 27644, 27298, 26957, 26622, 26292,
+    25968, 25651, 25340, 25036, 24739, 24449, 24166, 23891, 23624, 23366, 23116, 22874, 22642, 22419, 22206, 22003,
+    21810, 21628, 21456, 21295, 21146, 21008, 20882, 20768, 20666, 20576, 20499, 20434, 20383, 20344, 20318, 20305,
+    20305, 20318, 20344, 20383, 20434, 20499, 20576, 20666, 20768, 20882, 21008, 21146, 21295, 21456, 21628, 21810,
+    22003, 22206, 22419, 22642, 22874, 23116, 23366, 23624, 23891, 24166, 24449, 24739, 25036, 25340, 25651, 25968,
+    26292, 26622, 26957, 27298, 27644, 27995, 28352, 28713, 29079, 29449, 29823, 30202, 30584, 30970, 31360, 31754,
+    32151, 32551, 32954, 33361, 33770, 34182, 34597, 35014, 35434, 35857, 36282, 36709, 37138, 37569, 38003, 38438,
+    38876, 39315, 39756, 40199, 40643, 41089, 41537, 41986, 42437, 42889, 43342, 43797, 44253, 44711, 45169, 45629,
+    46090, 46552, 47015, 47479, 47944, 48410, 48877, 49345, 49814, 50284, 50755, 51226, 51699, 52172, 52645, 53120,
+    53595, 54071, 54548, 55026, 55504, 55982, 56462, 56942, 57422, 57903, 58385, 58867, 59350, 59833, 60317, 60801,
+    61286, 61771, 62257, 62743, 63229, 63716, 64204, 64692, 65180, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65342, 64855, 64368, 63882, 63396, 62911, 62426, 61942, 61458,
+    60975, 60492, 60009, 59528, 59046, 58566, 58085, 57606, 57127, 56649, 56171, 55694, 55217, 54742, 54267, 53792,
+    53319, 52846, 52374, 51903, 51432, 50963, 50494, 50026, 49559, 49093, 48628, 48164, 47701, 47239, 46778, 46319,
+    45860, 45403, 44946, 44491, 44038, 43586, 43135, 42685, 42237, 41791, 41346, 40903, 40461, 40021, 39583, 39147,
+    38712, 38280, 37850, 37422, 36996, 36572, 36150, 35731, 35315, 34901, 34490, 34081, 33676, 33273, 32874, 32478,
+    32085, 31696, 31310, 30928, 30550, 30175, 29805, 29440, 29079, 28722, 28370, 28024, 27682, 27346, 27016, 26691,
+    26372, 26060, 25754, 25455, 25162, 24877, 24600, 24330, 24068, 23814, 23568, 23332, 23104, 22886, 22677, 22478,
+    22289, 22111, 21943, 21786, 21640, 21505, 21382, 21271, 21171, 21083, 21008, 20945, 20895, 20857, 20831, 20819,
+    20819, 20831, 20857, 20895, 20945, 21008, 21083, 21171, 21271, 21382, 21505, 21640, 21786, 21943, 22111, 22289,
+    22478, 22677, 22886, 23104, 23332, 23568, 23814, 24068, 24330, 24600, 24877, 25162, 25455, 25754, 26060, 26372,
+    26691, 27016, 27346, 27682, 28024, 28370, 28722, 29079, 29440, 29805, 30175, 30550, 30928, 31310, 31696, 32085,
+    32478, 32874, 33273, 33676, 34081, 34490, 34901, 35315, 35731, 36150, 36572, 36996, 37422, 37850, 38280, 38712,
+    39147, 39583, 40021, 40461, 40903, 41346, 41791, 42237, 42685, 43135, 43586, 44038, 44491, 44946, 45403, 45860,
+    46319, 46778, 47239, 47701, 48164, 48628, 49093, 49559, 50026, 50494, 50963, 51432, 51903, 52374, 52846, 53319,
+    53792, 54267, 54742, 55217, 55694, 56171, 56649, 57127, 57606, 58085, 58566, 59046, 59528, 60009, 60492, 60975,
+    61458, 61942, 62426, 62911, 63396, 63882, 64368, 64855, 65342, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65507, 65022, 64536, 64051, 63567, 63083, 62599, 62116, 61634,
+    61152, 60671, 60190, 59709, 59229, 58750, 58272, 57794, 57316, 56839, 56363, 55888, 55413, 54939, 54466, 53993,
+    53521, 53050, 52580, 52111, 51642, 51175, 50708, 50242, 49777, 49313, 48850, 48388, 47928, 47468, 47009, 46552,
+    46096, 45640, 45187, 44734, 44283, 43833, 43385, 42938, 42493, 42049, 41607, 41167, 40728, 40291, 39856, 39422,
+    38991, 38562, 38135, 37710, 37287, 36867, 36449, 36033, 35620, 35210, 34802, 34398, 33996, 33597, 33202, 32810,
+    32421, 32035, 31654, 31276, 30902, 30532, 30167, 29805, 29449, 29097, 28750, 28408, 28071, 27739, 27414, 27094,
+    26780, 26472, 26171, 25877, 25589, 25309, 25036, 24771, 24514, 24264, 24024, 23792, 23568, 23355, 23150, 22955,
+    22770, 22596, 22431, 22278, 22135, 22003, 21883, 21774, 21677, 21591, 21518, 21456, 21407, 21370, 21345, 21333,
+    21333, 21345, 21370, 21407, 21456, 21518, 21591, 21677, 21774, 21883, 22003, 22135, 22278, 22431, 22596, 22770,
+    22955, 23150, 23355, 23568, 23792, 24024, 24264, 24514, 24771, 25036, 25309, 25589, 25877, 26171, 26472, 26780,
+    27094, 27414, 27739, 28071, 28408, 28750, 29097, 29449, 29805, 30167, 30532, 30902, 31276, 31654, 32035, 32421,
+    32810, 33202, 33597, 33996, 34398, 34802, 35210, 35620, 36033, 36449, 36867, 37287, 37710, 38135, 38562, 38991,
+    39422, 39856, 40291, 40728, 41167, 41607, 42049, 42493, 42938, 43385, 43833, 44283, 44734, 45187, 45640, 46096,
+    46552, 47009, 47468, 47928, 48388, 48850, 49313, 49777, 50242, 50708, 51175, 51642, 52111, 52580, 53050, 53521,
+    53993, 54466, 54939, 55413, 55888, 56363, 56839, 57316, 57794, 58272, 58750, 59229, 59709, 60190, 60671, 61152,
+    61634, 62116, 62599, 63083, 63567, 64051, 64536, 65022, 65507, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65192, 64708, 64224, 63741, 63259, 62776, 62295, 61814,
+    61333, 60853, 60374, 59895, 59416, 58939, 58462, 57985, 57509, 57034, 56560, 56086, 55613, 55141, 54669, 54198,
+    53728, 53259, 52791, 52323, 51857, 51391, 50926, 50462, 50000, 49538, 49077, 48617, 48159, 47701, 47245, 46790,
+    46336, 45883, 45432, 44982, 44533, 44086, 43640, 43196, 42753, 42312, 41873, 41435, 40999, 40565, 40133, 39703,
+    39275, 38849, 38425, 38003, 37584, 37167, 36752, 36340, 35930, 35524, 35120, 34719, 34321, 33926, 33534, 33146,
+    32761, 32380, 32002, 31629, 31259, 30893, 30532, 30175, 29823, 29476, 29133, 28795, 28463, 28137, 27815, 27500,
+    27191, 26888, 26592, 26302, 26019, 25744, 25475, 25215, 24962, 24717, 24481, 24254, 24035, 23825, 23624, 23434,
+    23252, 23081, 22921, 22770, 22631, 22502, 22384, 22278, 22183, 22099, 22027, 21967, 21919, 21883, 21859, 21847,
+    21847, 21859, 21883, 21919, 21967, 22027, 22099, 22183, 22278, 22384, 22502, 22631, 22770, 22921, 23081, 23252,
+    23434, 23624, 23825, 24035, 24254, 24481, 24717, 24962, 25215, 25475, 25744, 26019, 26302, 26592, 26888, 27191,
+    27500, 27815, 28137, 28463, 28795, 29133, 29476, 29823, 30175, 30532, 30893, 31259, 31629, 32002, 32380, 32761,
+    33146, 33534, 33926, 34321, 34719, 35120, 35524, 35930, 36340, 36752, 37167, 37584, 38003, 38425, 38849, 39275,
+    39703, 40133, 40565, 40999, 41435, 41873, 42312, 42753, 43196, 43640, 44086, 44533, 44982, 45432, 45883, 46336,
+    46790, 47245, 47701, 48159, 48617, 49077, 49538, 50000, 50462, 50926, 51391, 51857, 52323, 52791, 53259, 53728,
+    54198, 54669, 55141, 55613, 56086, 56560, 57034, 57509, 57985, 58462, 58939, 59416, 59895, 60374, 60853, 61333,
+    61814, 62295, 62776, 63259, 63741, 64224, 64708, 65192, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65366, 64883, 64401, 63919, 63438, 62957, 62477, 61997,
+    61518, 61040, 60562, 60084, 59607, 59131, 58656, 58181, 57707, 57233, 56760, 56288, 55817, 55346, 54877, 54408,
+    53939, 53472, 53006, 52540, 52075, 51612, 51149, 50687, 50226, 49767, 49308, 48850, 48394, 47939, 47485, 47032,
+    46580, 46130, 45681, 45233, 44787, 44343, 43900, 43458, 43018, 42580, 42143, 41708, 41276, 40844, 40415, 39988,
+    39563, 39140, 38719, 38301, 37885, 37471, 37060, 36651, 36245, 35842, 35442, 35044, 34650, 34259, 33871, 33487,
+    33106, 32729, 32355, 31986, 31620, 31259, 30902, 30550, 30202, 29858, 29520, 29187, 28860, 28537, 28221, 27910,
+    27606, 27307, 27016, 26730, 26452, 26181, 25918, 25661, 25413, 25173, 24941, 24717, 24503, 24297, 24101, 23913,
+    23736, 23568, 23411, 23264, 23127, 23001, 22886, 22782, 22689, 22607, 22537, 22478, 22431, 22396, 22372, 22360,
+    22360, 22372, 22396, 22431, 22478, 22537, 22607, 22689, 22782, 22886, 23001, 23127, 23264, 23411, 23568, 23736,
+    23913, 24101, 24297, 24503, 24717, 24941, 25173, 25413, 25661, 25918, 26181, 26452, 26730, 27016, 27307, 27606,
+    27910, 28221, 28537, 28860, 29187, 29520, 29858, 30202, 30550, 30902, 31259, 31620, 31986, 32355, 32729, 33106,
+    33487, 33871, 34259, 34650, 35044, 35442, 35842, 36245, 36651, 37060, 37471, 37885, 38301, 38719, 39140, 39563,
+    39988, 40415, 40844, 41276, 41708, 42143, 42580, 43018, 43458, 43900, 44343, 44787, 45233, 45681, 46130, 46580,
+    47032, 47485, 47939, 48394, 48850, 49308, 49767, 50226, 50687, 51149, 51612, 52075, 52540, 53006, 53472, 53939,
+    54408, 54877, 55346, 55817, 56288, 56760, 57233, 57707, 58181, 58656, 59131, 59607, 60084, 60562, 61040, 61518,
+    61997, 62477, 62957, 63438, 63919, 64401, 64883, 65366, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65062, 64581, 64101, 63621, 63142, 62663, 62184,
+    61707, 61230, 60753, 60277, 59802, 59327, 58854, 58380, 57908, 57436, 56965, 56494, 56025, 55556, 55088, 54621,
+    54154, 53689, 53224, 52761, 52298, 51836, 51376, 50916, 50457, 50000, 49543, 49088, 48633, 48180, 47729, 47278,
+    46829, 46381, 45935, 45490, 45046, 44604, 44164, 43725, 43288, 42852, 42418, 41986, 41556, 41128, 40702, 40278,
+    39856, 39436, 39018, 38603, 38190, 37780, 37372, 36967, 36565, 36165, 35768, 35375, 34984, 34597, 34213, 33832,
+    33455, 33082, 32713, 32347, 31986, 31629, 31276, 30928, 30584, 30245, 29912, 29583, 29260, 28942, 28630, 28324,
+    28024, 27730, 27443, 27162, 26888, 26622, 26362, 26110, 25867, 25631, 25403, 25183, 24973, 24771, 24578, 24395,
+    24221, 24057, 23902, 23758, 23624, 23501, 23388, 23287, 23196, 23116, 23047, 22990, 22944, 22909, 22886, 22874,
+    22874, 22886, 22909, 22944, 22990, 23047, 23116, 23196, 23287, 23388, 23501, 23624, 23758, 23902, 24057, 24221,
+    24395, 24578, 24771, 24973, 25183, 25403, 25631, 25867, 26110, 26362, 26622, 26888, 27162, 27443, 27730, 28024,
+    28324, 28630, 28942, 29260, 29583, 29912, 30245, 30584, 30928, 31276, 31629, 31986, 32347, 32713, 33082, 33455,
+    33832, 34213, 34597, 34984, 35375, 35768, 36165, 36565, 36967, 37372, 37780, 38190, 38603, 39018, 39436, 39856,
+    40278, 40702, 41128, 41556, 41986, 42418, 42852, 43288, 43725, 44164, 44604, 45046, 45490, 45935, 46381, 46829,
+    47278, 47729, 48180, 48633, 49088, 49543, 50000, 50457, 50916, 51376, 51836, 52298, 52761, 53224, 53689, 54154,
+    54621, 55088, 55556, 56025, 56494, 56965, 57436, 57908, 58380, 58854, 59327, 59802, 60277, 60753, 61230, 61707,
+    62184, 62663, 63142, 63621, 64101, 64581, 65062, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65245, 64765, 64286, 63807, 63330, 62852, 62375,
+    61899, 61424, 60949, 60474, 60001, 59528, 59055, 58584, 58113, 57643, 57173, 56704, 56237, 55770, 55303, 54838,
+    54374, 53910, 53447, 52986, 52525, 52065, 51606, 51149, 50692, 50237, 49782, 49329, 48877, 48427, 47977, 47529,
+    47082, 46637, 46193, 45750, 45309, 44870, 44432, 43996, 43561, 43129, 42698, 42268, 41841, 41416, 40993, 40572,
+    40153, 39736, 39322, 38910, 38500, 38093, 37689, 37287, 36888, 36492, 36099, 35709, 35322, 34939, 34559, 34182,
+    33809, 33440, 33074, 32713, 32355, 32002, 31654, 31310, 30970, 30636, 30306, 29982, 29663, 29350, 29042, 28740,
+    28445, 28155, 27872, 27596, 27327, 27064, 26809, 26562, 26322, 26090, 25867, 25651, 25444, 25246, 25057, 24877,
+    24707, 24546, 24395, 24254, 24122, 24002, 23891, 23792, 23703, 23624, 23557, 23501, 23456, 23422, 23400, 23388,
+    23388, 23400, 23422, 23456, 23501, 23557, 23624, 23703, 23792, 23891, 24002, 24122, 24254, 24395, 24546, 24707,
+    24877, 25057, 25246, 25444, 25651, 25867, 26090, 26322, 26562, 26809, 27064, 27327, 27596, 27872, 28155, 28445,
+    28740, 29042, 29350, 29663, 29982, 30306, 30636, 30970, 31310, 31654, 32002, 32355, 32713, 33074, 33440, 33809,
+    34182, 34559, 34939, 35322, 35709, 36099, 36492, 36888, 37287, 37689, 38093, 38500, 38910, 39322, 39736, 40153,
+    40572, 40993, 41416, 41841, 42268, 42698, 43129, 43561, 43996, 44432, 44870, 45309, 45750, 46193, 46637, 47082,
+    47529, 47977, 48427, 48877, 49329, 49782, 50237, 50692, 51149, 51606, 52065, 52525, 52986, 53447, 53910, 54374,
+    54838, 55303, 55770, 56237, 56704, 57173, 57643, 58113, 58584, 59055, 59528, 60001, 60474, 60949, 61424, 61899,
+    62375, 62852, 63330, 63807, 64286, 64765, 65245, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65431, 64952, 64475, 63998, 63521, 63045, 62570,
+    62095, 61621, 61148, 60675, 60203, 59731, 59261, 58791, 58321, 57853, 57385, 56918, 56452, 55987, 55523, 55059,
+    54597, 54135, 53674, 53215, 52756, 52298, 51841, 51386, 50931, 50478, 50026, 49575, 49125, 48677, 48230, 47784,
+    47340, 46897, 46455, 46015, 45577, 45140, 44705, 44271, 43839, 43409, 42981, 42555, 42131, 41708, 41288, 40870,
+    40454, 40041, 39630, 39221, 38815, 38411, 38010, 37612, 37216, 36824, 36434, 36048, 35665, 35285, 34909, 34536,
+    34167, 33801, 33440, 33082, 32729, 32380, 32035, 31696, 31360, 31030, 30705, 30385, 30070, 29761, 29458, 29160,
+    28869, 28584, 28305, 28033, 27768, 27510, 27259, 27016, 26780, 26552, 26332, 26121, 25918, 25723, 25538, 25361,
+    25194, 25036, 24888, 24750, 24621, 24503, 24395, 24297, 24210, 24133, 24068, 24013, 23969, 23936, 23913, 23902,
+    23902, 23913, 23936, 23969, 24013, 24068, 24133, 24210, 24297, 24395, 24503, 24621, 24750, 24888, 25036, 25194,
+    25361, 25538, 25723, 25918, 26121, 26332, 26552, 26780, 27016, 27259, 27510, 27768, 28033, 28305, 28584, 28869,
+    29160, 29458, 29761, 30070, 30385, 30705, 31030, 31360, 31696, 32035, 32380, 32729, 33082, 33440, 33801, 34167,
+    34536, 34909, 35285, 35665, 36048, 36434, 36824, 37216, 37612, 38010, 38411, 38815, 39221, 39630, 40041, 40454,
+    40870, 41288, 41708, 42131, 42555, 42981, 43409, 43839, 44271, 44705, 45140, 45577, 46015, 46455, 46897, 47340,
+    47784, 48230, 48677, 49125, 49575, 50026, 50478, 50931, 51386, 51841, 52298, 52756, 53215, 53674, 54135, 54597,
+    55059, 55523, 55987, 56452, 56918, 57385, 57853, 58321, 58791, 59261, 59731, 60203, 60675, 61148, 61621, 62095,
+    62570, 63045, 63521, 63998, 64475, 64952, 65431, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65143, 64667, 64191, 63716, 63242, 62768,
+    62295, 61822, 61350, 60879, 60409, 59939, 59470, 59002, 58534, 58067, 57601, 57136, 56672, 56208, 55746, 55284,
+    54824, 54364, 53905, 53447, 52991, 52535, 52080, 51627, 51175, 50723, 50274, 49825, 49377, 48931, 48487, 48043,
+    47601, 47161, 46722, 46284, 45848, 45414, 44982, 44551, 44122, 43695, 43269, 42846, 42424, 42005, 41588, 41173,
+    40760, 40350, 39942, 39536, 39133, 38733, 38335, 37940, 37548, 37159, 36773, 36391, 36011, 35635, 35262, 34893,
+    34528, 34167, 33809, 33455, 33106, 32761, 32421, 32085, 31754, 31428, 31107, 30791, 30480, 30175, 29876, 29583,
+    29296, 29015, 28740, 28473, 28212, 27958, 27711, 27471, 27240, 27016, 26800, 26592, 26392, 26201, 26019, 25846,
+    25682, 25527, 25382, 25246, 25120, 25004, 24899, 24803, 24717, 24643, 24578, 24524, 24481, 24449, 24427, 24416,
+    24416, 24427, 24449, 24481, 24524, 24578, 24643, 24717, 24803, 24899, 25004, 25120, 25246, 25382, 25527, 25682,
+    25846, 26019, 26201, 26392, 26592, 26800, 27016, 27240, 27471, 27711, 27958, 28212, 28473, 28740, 29015, 29296,
+    29583, 29876, 30175, 30480, 30791, 31107, 31428, 31754, 32085, 32421, 32761, 33106, 33455, 33809, 34167, 34528,
+    34893, 35262, 35635, 36011, 36391, 36773, 37159, 37548, 37940, 38335, 38733, 39133, 39536, 39942, 40350, 40760,
+    41173, 41588, 42005, 42424, 42846, 43269, 43695, 44122, 44551, 44982, 45414, 45848, 46284, 46722, 47161, 47601,
+    48043, 48487, 48931, 49377, 49825, 50274, 50723, 51175, 51627, 52080, 52535, 52991, 53447, 53905, 54364, 54824,
+    55284, 55746, 56208, 56672, 57136, 57601, 58067, 58534, 59002, 59470, 59939, 60409, 60879, 61350, 61822, 62295,
+    62768, 63242, 63716, 64191, 64667, 65143, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65338, 64863, 64389, 63915, 63442, 62970,
+    62498, 62027, 61557, 61087, 60618, 60150, 59683, 59216, 58750, 58285, 57821, 57358, 56895, 56434, 55973, 55513,
+    55054, 54597, 54140, 53684, 53229, 52776, 52323, 51872, 51422, 50973, 50525, 50079, 49634, 49190, 48747, 48306,
+    47867, 47429, 46992, 46557, 46124, 45693, 45263, 44835, 44408, 43984, 43561, 43141, 42722, 42306, 41892, 41480,
+    41070, 40663, 40258, 39856, 39456, 39059, 38665, 38273, 37885, 37499, 37117, 36738, 36362, 35989, 35620, 35255,
+    34893, 34536, 34182, 33832, 33487, 33146, 32810, 32478, 32151, 31829, 31512, 31200, 30893, 30593, 30298, 30009,
+    29725, 29449, 29178, 28915, 28658, 28408, 28165, 27929, 27701, 27481, 27269, 27064, 26868, 26681, 26502, 26332,
+    26171, 26019, 25877, 25744, 25620, 25507, 25403, 25309, 25225, 25152, 25089, 25036, 24994, 24962, 24941, 24930,
+    24930, 24941, 24962, 24994, 25036, 25089, 25152, 25225, 25309, 25403, 25507, 25620, 25744, 25877, 26019, 26171,
+    26332, 26502, 26681, 26868, 27064, 27269, 27481, 27701, 27929, 28165, 28408, 28658, 28915, 29178, 29449, 29725,
+    30009, 30298, 30593, 30893, 31200, 31512, 31829, 32151, 32478, 32810, 33146, 33487, 33832, 34182, 34536, 34893,
+    35255, 35620, 35989, 36362, 36738, 37117, 37499, 37885, 38273, 38665, 39059, 39456, 39856, 40258, 40663, 41070,
+    41480, 41892, 42306, 42722, 43141, 43561, 43984, 44408, 44835, 45263, 45693, 46124, 46557, 46992, 47429, 47867,
+    48306, 48747, 49190, 49634, 50079, 50525, 50973, 51422, 51872, 52323, 52776, 53229, 53684, 54140, 54597, 55054,
+    55513, 55973, 56434, 56895, 57358, 57821, 58285, 58750, 59216, 59683, 60150, 60618, 61087, 61557, 62027, 62498,
+    62970, 63442, 63915, 64389, 64863, 65338, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65062, 64589, 64117, 63646, 63175,
+    62705, 62235, 61767, 61299, 60831, 60365, 59899, 59434, 58970, 58507, 58044, 57583, 57122, 56663, 56204, 55746,
+    55289, 54833, 54378, 53925, 53472, 53021, 52570, 52121, 51673, 51226, 50781, 50337, 49894, 49452, 49012, 48574,
+    48137, 47701, 47267, 46835, 46404, 45975, 45548, 45122, 44699, 44277, 43857, 43440, 43024, 42611, 42200, 41791,
+    41384, 40980, 40578, 40179, 39783, 39389, 38998, 38610, 38225, 37843, 37464, 37088, 36716, 36347, 35982, 35620,
+    35262, 34909, 34559, 34213, 33871, 33534, 33202, 32874, 32551, 32233, 31920, 31612, 31310, 31013, 30722, 30437,
+    30158, 29885, 29619, 29359, 29106, 28860, 28621, 28389, 28165, 27948, 27739, 27539, 27346, 27162, 26986, 26819,
+    26661, 26512, 26372, 26242, 26121, 26009, 25907, 25815, 25733, 25661, 25600, 25548, 25507, 25475, 25455, 25444,
+    25444, 25455, 25475, 25507, 25548, 25600, 25661, 25733, 25815, 25907, 26009, 26121, 26242, 26372, 26512, 26661,
+    26819, 26986, 27162, 27346, 27539, 27739, 27948, 28165, 28389, 28621, 28860, 29106, 29359, 29619, 29885, 30158,
+    30437, 30722, 31013, 31310, 31612, 31920, 32233, 32551, 32874, 33202, 33534, 33871, 34213, 34559, 34909, 35262,
+    35620, 35982, 36347, 36716, 37088, 37464, 37843, 38225, 38610, 38998, 39389, 39783, 40179, 40578, 40980, 41384,
+    41791, 42200, 42611, 43024, 43440, 43857, 44277, 44699, 45122, 45548, 45975, 46404, 46835, 47267, 47701, 48137,
+    48574, 49012, 49452, 49894, 50337, 50781, 51226, 51673, 52121, 52570, 53021, 53472, 53925, 54378, 54833, 55289,
+    55746, 56204, 56663, 57122, 57583, 58044, 58507, 58970, 59434, 59899, 60365, 60831, 61299, 61767, 62235, 62705,
+    63175, 63646, 64117, 64589, 65062, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65265, 64794, 64323, 63853, 63384,
+    62915, 62447, 61980, 61514, 61048, 60583, 60119, 59656, 59194, 58732, 58272, 57812, 57353, 56895, 56438, 55982,
+    55527, 55074, 54621, 54169, 53719, 53269, 52821, 52374, 51928, 51483, 51040, 50598, 50158, 49719, 49281, 48845,
+    48410, 47977, 47546, 47116, 46688, 46261, 45837, 45414, 44993, 44575, 44158, 43743, 43330, 42920, 42512, 42106,
+    41702, 41301, 40903, 40507, 40113, 39723, 39335, 38951, 38569, 38190, 37815, 37443, 37074, 36709, 36347, 35989,
+    35635, 35285, 34939, 34597, 34259, 33926, 33597, 33273, 32954, 32640, 32331, 32027, 31729, 31436, 31149, 30868,
+    30593, 30324, 30061, 29805, 29556, 29314, 29079, 28850, 28630, 28417, 28212, 28014, 27825, 27644, 27471, 27307,
+    27152, 27006, 26868, 26740, 26622, 26512, 26412, 26322, 26242, 26171, 26110, 26060, 26019, 25989, 25968, 25958,
+    25958, 25968, 25989, 26019, 26060, 26110, 26171, 26242, 26322, 26412, 26512, 26622, 26740, 26868, 27006, 27152,
+    27307, 27471, 27644, 27825, 28014, 28212, 28417, 28630, 28850, 29079, 29314, 29556, 29805, 30061, 30324, 30593,
+    30868, 31149, 31436, 31729, 32027, 32331, 32640, 32954, 33273, 33597, 33926, 34259, 34597, 34939, 35285, 35635,
+    35989, 36347, 36709, 37074, 37443, 37815, 38190, 38569, 38951, 39335, 39723, 40113, 40507, 40903, 41301, 41702,
+    42106, 42512, 42920, 43330, 43743, 44158, 44575, 44993, 45414, 45837, 46261, 46688, 47116, 47546, 47977, 48410,
+    48845, 49281, 49719, 50158, 50598, 51040, 51483, 51928, 52374, 52821, 53269, 53719, 54169, 54621, 55074, 55527,
+    55982, 56438, 56895, 57353, 57812, 58272, 58732, 59194, 59656, 60119, 60583, 61048, 61514, 61980, 62447, 62915,
+    63384, 63853, 64323, 64794, 65265, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65471, 65001, 64532, 64064, 63596,
+    63129, 62663, 62197, 61732, 61269, 60805, 60343, 59882, 59421, 58961, 58502, 58044, 57588, 57132, 56677, 56223,
+    55770, 55318, 54867, 54417, 53969, 53521, 53075, 52630, 52187, 51745, 51304, 50864, 50426, 49989, 49554, 49120,
+    48688, 48257, 47828, 47401, 46975, 46552, 46130, 45710, 45292, 44876, 44462, 44050, 43640, 43233, 42827, 42424,
+    42024, 41626, 41231, 40838, 40448, 40061, 39676, 39295, 38917, 38541, 38169, 37801, 37436, 37074, 36716, 36362,
+    36011, 35665, 35322, 34984, 34650, 34321, 33996, 33676, 33361, 33050, 32745, 32445, 32151, 31862, 31579, 31301,
+    31030, 30765, 30506, 30254, 30009, 29770, 29538, 29314, 29097, 28887, 28685, 28491, 28305, 28127, 27958, 27796,
+    27644, 27500, 27365, 27240, 27123, 27016, 26918, 26829, 26750, 26681, 26622, 26572, 26532, 26502, 26482, 26472,
+    26472, 26482, 26502, 26532, 26572, 26622, 26681, 26750, 26829, 26918, 27016, 27123, 27240, 27365, 27500, 27644,
+    27796, 27958, 28127, 28305, 28491, 28685, 28887, 29097, 29314, 29538, 29770, 30009, 30254, 30506, 30765, 31030,
+    31301, 31579, 31862, 32151, 32445, 32745, 33050, 33361, 33676, 33996, 34321, 34650, 34984, 35322, 35665, 36011,
+    36362, 36716, 37074, 37436, 37801, 38169, 38541, 38917, 39295, 39676, 40061, 40448, 40838, 41231, 41626, 42024,
+    42424, 42827, 43233, 43640, 44050, 44462, 44876, 45292, 45710, 46130, 46552, 46975, 47401, 47828, 48257, 48688,
+    49120, 49554, 49989, 50426, 50864, 51304, 51745, 52187, 52630, 53075, 53521, 53969, 54417, 54867, 55318, 55770,
+    56223, 56677, 57132, 57588, 58044, 58502, 58961, 59421, 59882, 60343, 60805, 61269, 61732, 62197, 62663, 63129,
+    63596, 64064, 64532, 65001, 65471, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65212, 64745, 64278, 63812,
+    63346, 62882, 62418, 61955, 61492, 61031, 60570, 60111, 59652, 59194, 58737, 58281, 57826, 57371, 56918, 56466,
+    56015, 55566, 55117, 54669, 54223, 53778, 53334, 52891, 52449, 52009, 51571, 51133, 50697, 50263, 49830, 49399,
+    48969, 48541, 48115, 47690, 47267, 46846, 46427, 46009, 45594, 45181, 44770, 44361, 43954, 43549, 43147, 42747,
+    42350, 41955, 41563, 41173, 40786, 40402, 40021, 39643, 39268, 38896, 38528, 38163, 37801, 37443, 37088, 36738,
+    36391, 36048, 35709, 35375, 35044, 34719, 34398, 34081, 33770, 33463, 33162, 32866, 32575, 32290, 32011, 31737,
+    31470, 31208, 30953, 30705, 30463, 30228, 30000, 29779, 29565, 29359, 29160, 28969, 28786, 28611, 28445, 28286,
+    28137, 27995, 27863, 27739, 27625, 27519, 27423, 27336, 27259, 27191, 27133, 27084, 27045, 27016, 26996, 26986,
+    26986, 26996, 27016, 27045, 27084, 27133, 27191, 27259, 27336, 27423, 27519, 27625, 27739, 27863, 27995, 28137,
+    28286, 28445, 28611, 28786, 28969, 29160, 29359, 29565, 29779, 30000, 30228, 30463, 30705, 30953, 31208, 31470,
+    31737, 32011, 32290, 32575, 32866, 33162, 33463, 33770, 34081, 34398, 34719, 35044, 35375, 35709, 36048, 36391,
+    36738, 37088, 37443, 37801, 38163, 38528, 38896, 39268, 39643, 40021, 40402, 40786, 41173, 41563, 41955, 42350,
+    42747, 43147, 43549, 43954, 44361, 44770, 45181, 45594, 46009, 46427, 46846, 47267, 47690, 48115, 48541, 48969,
+    49399, 49830, 50263, 50697, 51133, 51571, 52009, 52449, 52891, 53334, 53778, 54223, 54669, 55117, 55566, 56015,
+    56466, 56918, 57371, 57826, 58281, 58737, 59194, 59652, 60111, 60570, 61031, 61492, 61955, 62418, 62882, 63346,
+    63812, 64278, 64745, 65212, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65427, 64961, 64495, 64031,
+    63567, 63104, 62642, 62180, 61720, 61260, 60801, 60343, 59886, 59430, 58975, 58520, 58067, 57615, 57164, 56714,
+    56265, 55817, 55370, 54925, 54480, 54037, 53595, 53155, 52716, 52278, 51841, 51406, 50973, 50541, 50110, 49682,
+    49254, 48829, 48405, 47983, 47562, 47144, 46727, 46313, 45900, 45490, 45081, 44675, 44271, 43870, 43470, 43073,
+    42679, 42287, 41898, 41512, 41128, 40747, 40369, 39995, 39623, 39255, 38889, 38528, 38169, 37815, 37464, 37117,
+    36773, 36434, 36099, 35768, 35442, 35120, 34802, 34490, 34182, 33879, 33582, 33289, 33002, 32721, 32445, 32175,
+    31911, 31654, 31402, 31157, 30919, 30688, 30463, 30245, 30035, 29832, 29636, 29449, 29269, 29097, 28933, 28777,
+    28630, 28491, 28361, 28240, 28127, 28024, 27929, 27844, 27768, 27701, 27644, 27596, 27558, 27529, 27510, 27500,
+    27500, 27510, 27529, 27558, 27596, 27644, 27701, 27768, 27844, 27929, 28024, 28127, 28240, 28361, 28491, 28630,
+    28777, 28933, 29097, 29269, 29449, 29636, 29832, 30035, 30245, 30463, 30688, 30919, 31157, 31402, 31654, 31911,
+    32175, 32445, 32721, 33002, 33289, 33582, 33879, 34182, 34490, 34802, 35120, 35442, 35768, 36099, 36434, 36773,
+    37117, 37464, 37815, 38169, 38528, 38889, 39255, 39623, 39995, 40369, 40747, 41128, 41512, 41898, 42287, 42679,
+    43073, 43470, 43870, 44271, 44675, 45081, 45490, 45900, 46313, 46727, 47144, 47562, 47983, 48405, 48829, 49254,
+    49682, 50110, 50541, 50973, 51406, 51841, 52278, 52716, 53155, 53595, 54037, 54480, 54925, 55370, 55817, 56265,
+    56714, 57164, 57615, 58067, 58520, 58975, 59430, 59886, 60343, 60801, 61260, 61720, 62180, 62642, 63104, 63567,
+    64031, 64495, 64961, 65427, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65180, 64716, 64253,
+    63791, 63330, 62869, 62409, 61950, 61492, 61035, 60579, 60124, 59669, 59216, 58764, 58312, 57862, 57413, 56965,
+    56518, 56072, 55627, 55184, 54742, 54301, 53861, 53423, 52986, 52550, 52116, 51683, 51252, 50822, 50394, 49968,
+    49543, 49120, 48699, 48279, 47861, 47446, 47032, 46620, 46210, 45802, 45397, 44993, 44592, 44194, 43797, 43403,
+    43012, 42623, 42237, 41854, 41473, 41096, 40721, 40350, 39981, 39616, 39255, 38896, 38541, 38190, 37843, 37499,
+    37159, 36824, 36492, 36165, 35842, 35524, 35210, 34901, 34597, 34298, 34004, 33715, 33432, 33154, 32882, 32616,
+    32355, 32101, 31853, 31612, 31377, 31149, 30928, 30713, 30506, 30306, 30114, 29929, 29752, 29583, 29422, 29269,
+    29124, 28988, 28860, 28740, 28630, 28528, 28435, 28352, 28277, 28212, 28155, 28108, 28071, 28042, 28024, 28014,
+    28014, 28024, 28042, 28071, 28108, 28155, 28212, 28277, 28352, 28435, 28528, 28630, 28740, 28860, 28988, 29124,
+    29269, 29422, 29583, 29752, 29929, 30114, 30306, 30506, 30713, 30928, 31149, 31377, 31612, 31853, 32101, 32355,
+    32616, 32882, 33154, 33432, 33715, 34004, 34298, 34597, 34901, 35210, 35524, 35842, 36165, 36492, 36824, 37159,
+    37499, 37843, 38190, 38541, 38896, 39255, 39616, 39981, 40350, 40721, 41096, 41473, 41854, 42237, 42623, 43012,
+    43403, 43797, 44194, 44592, 44993, 45397, 45802, 46210, 46620, 47032, 47446, 47861, 48279, 48699, 49120, 49543,
+    49968, 50394, 50822, 51252, 51683, 52116, 52550, 52986, 53423, 53861, 54301, 54742, 55184, 55627, 56072, 56518,
+    56965, 57413, 57862, 58312, 58764, 59216, 59669, 60124, 60579, 61035, 61492, 61950, 62409, 62869, 63330, 63791,
+    64253, 64716, 65180, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65402, 64940, 64479,
+    64018, 63559, 63100, 62642, 62184, 61728, 61273, 60818, 60365, 59912, 59461, 59010, 58561, 58113, 57665, 57219,
+    56774, 56331, 55888, 55447, 55006, 54568, 54130, 53694, 53259, 52826, 52394, 51964, 51535, 51107, 50682, 50258,
+    49835, 49415, 48996, 48579, 48164, 47751, 47340, 46930, 46523, 46118, 45716, 45315, 44917, 44521, 44128, 43737,
+    43349, 42963, 42580, 42200, 41822, 41448, 41077, 40708, 40343, 39981, 39623, 39268, 38917, 38569, 38225, 37885,
+    37548, 37216, 36888, 36565, 36245, 35930, 35620, 35315, 35014, 34719, 34428, 34143, 33864, 33589, 33321, 33058,
+    32801, 32551, 32306, 32068, 31837, 31612, 31394, 31183, 30979, 30782, 30593, 30411, 30237, 30070, 29912, 29761,
+    29619, 29485, 29359, 29242, 29133, 29033, 28942, 28860, 28786, 28722, 28667, 28621, 28584, 28556, 28537, 28528,
+    28528, 28537, 28556, 28584, 28621, 28667, 28722, 28786, 28860, 28942, 29033, 29133, 29242, 29359, 29485, 29619,
+    29761, 29912, 30070, 30237, 30411, 30593, 30782, 30979, 31183, 31394, 31612, 31837, 32068, 32306, 32551, 32801,
+    33058, 33321, 33589, 33864, 34143, 34428, 34719, 35014, 35315, 35620, 35930, 36245, 36565, 36888, 37216, 37548,
+    37885, 38225, 38569, 38917, 39268, 39623, 39981, 40343, 40708, 41077, 41448, 41822, 42200, 42580, 42963, 43349,
+    43737, 44128, 44521, 44917, 45315, 45716, 46118, 46523, 46930, 47340, 47751, 48164, 48579, 48996, 49415, 49835,
+    50258, 50682, 51107, 51535, 51964, 52394, 52826, 53259, 53694, 54130, 54568, 55006, 55447, 55888, 56331, 56774,
+    57219, 57665, 58113, 58561, 59010, 59461, 59912, 60365, 60818, 61273, 61728, 62184, 62642, 63100, 63559, 64018,
+    64479, 64940, 65402, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65168, 64708,
+    64249, 63791, 63334, 62877, 62422, 61967, 61514, 61061, 60610, 60159, 59709, 59261, 58813, 58367, 57921, 57477,
+    57034, 56593, 56152, 55713, 55275, 54838, 54403, 53969, 53536, 53105, 52676, 52248, 51821, 51396, 50973, 50551,
+    50131, 49713, 49297, 48883, 48470, 48060, 47651, 47245, 46840, 46438, 46038, 45640, 45245, 44852, 44462, 44074,
+    43688, 43306, 42926, 42549, 42175, 41803, 41435, 41070, 40708, 40350, 39995, 39643, 39295, 38951, 38610, 38273,
+    37940, 37612, 37287, 36967, 36651, 36340, 36033, 35731, 35434, 35142, 34855, 34574, 34298, 34027, 33762, 33503,
+    33249, 33002, 32761, 32526, 32298, 32077, 31862, 31654, 31453, 31259, 31073, 30893, 30722, 30558, 30402, 30254,
+    30114, 29982, 29858, 29743, 29636, 29538, 29449, 29368, 29296, 29233, 29178, 29133, 29097, 29069, 29051, 29042,
+    29042, 29051, 29069, 29097, 29133, 29178, 29233, 29296, 29368, 29449, 29538, 29636, 29743, 29858, 29982, 30114,
+    30254, 30402, 30558, 30722, 30893, 31073, 31259, 31453, 31654, 31862, 32077, 32298, 32526, 32761, 33002, 33249,
+    33503, 33762, 34027, 34298, 34574, 34855, 35142, 35434, 35731, 36033, 36340, 36651, 36967, 37287, 37612, 37940,
+    38273, 38610, 38951, 39295, 39643, 39995, 40350, 40708, 41070, 41435, 41803, 42175, 42549, 42926, 43306, 43688,
+    44074, 44462, 44852, 45245, 45640, 46038, 46438, 46840, 47245, 47651, 48060, 48470, 48883, 49297, 49713, 50131,
+    50551, 50973, 51396, 51821, 52248, 52676, 53105, 53536, 53969, 54403, 54838, 55275, 55713, 56152, 56593, 57034,
+    57477, 57921, 58367, 58813, 59261, 59709, 60159, 60610, 61061, 61514, 61967, 62422, 62877, 63334, 63791, 64249,
+    64708, 65168, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65398, 64940,
+    64483, 64027, 63571, 63116, 62663, 62210, 61758, 61307, 60857, 60409, 59961, 59514, 59069, 58624, 58181, 57739,
+    57298, 56858, 56420, 55982, 55546, 55112, 54679, 54247, 53817, 53388, 52961, 52535, 52111, 51688, 51267, 50848,
+    50431, 50015, 49602, 49190, 48780, 48372, 47966, 47562, 47161, 46761, 46364, 45969, 45577, 45187, 44799, 44414,
+    44032, 43652, 43275, 42901, 42530, 42162, 41797, 41435, 41077, 40721, 40369, 40021, 39676, 39335, 38998, 38665,
+    38335, 38010, 37689, 37372, 37060, 36752, 36449, 36150, 35857, 35568, 35285, 35007, 34734, 34467, 34205, 33949,
+    33699, 33455, 33218, 32986, 32761, 32543, 32331, 32126, 31928, 31737, 31553, 31377, 31208, 31047, 30893, 30748,
+    30610, 30480, 30359, 30245, 30140, 30044, 29956, 29876, 29805, 29743, 29690, 29645, 29610, 29583, 29565, 29556,
+    29556, 29565, 29583, 29610, 29645, 29690, 29743, 29805, 29876, 29956, 30044, 30140, 30245, 30359, 30480, 30610,
+    30748, 30893, 31047, 31208, 31377, 31553, 31737, 31928, 32126, 32331, 32543, 32761, 32986, 33218, 33455, 33699,
+    33949, 34205, 34467, 34734, 35007, 35285, 35568, 35857, 36150, 36449, 36752, 37060, 37372, 37689, 38010, 38335,
+    38665, 38998, 39335, 39676, 40021, 40369, 40721, 41077, 41435, 41797, 42162, 42530, 42901, 43275, 43652, 44032,
+    44414, 44799, 45187, 45577, 45969, 46364, 46761, 47161, 47562, 47966, 48372, 48780, 49190, 49602, 50015, 50431,
+    50848, 51267, 51688, 52111, 52535, 52961, 53388, 53817, 54247, 54679, 55112, 55546, 55982, 56420, 56858, 57298,
+    57739, 58181, 58624, 59069, 59514, 59961, 60409, 60857, 61307, 61758, 62210, 62663, 63116, 63571, 64027, 64483,
+    64940, 65398, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65176,
+    64720, 64265, 63812, 63359, 62907, 62456, 62006, 61557, 61109, 60662, 60216, 59771, 59327, 58885, 58444, 58003,
+    57565, 57127, 56690, 56255, 55822, 55389, 54958, 54529, 54101, 53674, 53249, 52826, 52404, 51984, 51566, 51149,
+    50734, 50321, 49910, 49500, 49093, 48688, 48285, 47883, 47485, 47088, 46693, 46301, 45912, 45525, 45140, 44758,
+    44378, 44002, 43628, 43257, 42889, 42524, 42162, 41803, 41448, 41096, 40747, 40402, 40061, 39723, 39389, 39059,
+    38733, 38411, 38093, 37780, 37471, 37167, 36867, 36572, 36282, 35997, 35717, 35442, 35172, 34909, 34650, 34398,
+    34151, 33910, 33676, 33448, 33226, 33010, 32801, 32600, 32404, 32216, 32035, 31862, 31696, 31537, 31386, 31242,
+    31107, 30979, 30859, 30748, 30644, 30550, 30463, 30385, 30315, 30254, 30202, 30158, 30123, 30096, 30079, 30070,
+    30070, 30079, 30096, 30123, 30158, 30202, 30254, 30315, 30385, 30463, 30550, 30644, 30748, 30859, 30979, 31107,
+    31242, 31386, 31537, 31696, 31862, 32035, 32216, 32404, 32600, 32801, 33010, 33226, 33448, 33676, 33910, 34151,
+    34398, 34650, 34909, 35172, 35442, 35717, 35997, 36282, 36572, 36867, 37167, 37471, 37780, 38093, 38411, 38733,
+    39059, 39389, 39723, 40061, 40402, 40747, 41096, 41448, 41803, 42162, 42524, 42889, 43257, 43628, 44002, 44378,
+    44758, 45140, 45525, 45912, 46301, 46693, 47088, 47485, 47883, 48285, 48688, 49093, 49500, 49910, 50321, 50734,
+    51149, 51566, 51984, 52404, 52826, 53249, 53674, 54101, 54529, 54958, 55389, 55822, 56255, 56690, 57127, 57565,
+    58003, 58444, 58885, 59327, 59771, 60216, 60662, 61109, 61557, 62006, 62456, 62907, 63359, 63812, 64265, 64720,
+    65176, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65414,
+    64961, 64508, 64055, 63604, 63154, 62705, 62257, 61809, 61363, 60918, 60474, 60031, 59590, 59149, 58710, 58272,
+    57835, 57399, 56965, 56532, 56100, 55670, 55241, 54814, 54388, 53964, 53541, 53120, 52701, 52283, 51867, 51453,
+    51040, 50630, 50221, 49814, 49410, 49007, 48606, 48208, 47812, 47418, 47026, 46637, 46250, 45866, 45484, 45105,
+    44728, 44355, 43984, 43616, 43251, 42889, 42530, 42175, 41822, 41473, 41128, 40786, 40448, 40113, 39783, 39456,
+    39133, 38815, 38500, 38190, 37885, 37584, 37287, 36996, 36709, 36427, 36150, 35879, 35613, 35352, 35097, 34848,
+    34604, 34367, 34136, 33910, 33692, 33479, 33273, 33074, 32882, 32697, 32518, 32347, 32184, 32027, 31878, 31737,
+    31604, 31478, 31360, 31251, 31149, 31056, 30970, 30893, 30825, 30765, 30713, 30670, 30636, 30610, 30593, 30584,
+    30584, 30593, 30610, 30636, 30670, 30713, 30765, 30825, 30893, 30970, 31056, 31149, 31251, 31360, 31478, 31604,
+    31737, 31878, 32027, 32184, 32347, 32518, 32697, 32882, 33074, 33273, 33479, 33692, 33910, 34136, 34367, 34604,
+    34848, 35097, 35352, 35613, 35879, 36150, 36427, 36709, 36996, 37287, 37584, 37885, 38190, 38500, 38815, 39133,
+    39456, 39783, 40113, 40448, 40786, 41128, 41473, 41822, 42175, 42530, 42889, 43251, 43616, 43984, 44355, 44728,
+    45105, 45484, 45866, 46250, 46637, 47026, 47418, 47812, 48208, 48606, 49007, 49410, 49814, 50221, 50630, 51040,
+    51453, 51867, 52283, 52701, 53120, 53541, 53964, 54388, 54814, 55241, 55670, 56100, 56532, 56965, 57399, 57835,
+    58272, 58710, 59149, 59590, 60031, 60474, 60918, 61363, 61809, 62257, 62705, 63154, 63604, 64055, 64508, 64961,
+    65414, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65204, 64753, 64302, 63853, 63405, 62957, 62511, 62065, 61621, 61178, 60736, 60295, 59855, 59416, 58979, 58543,
+    58108, 57675, 57242, 56812, 56382, 55954, 55527, 55102, 54679, 54257, 53836, 53418, 53001, 52585, 52172, 51760,
+    51350, 50942, 50536, 50131, 49729, 49329, 48931, 48536, 48142, 47751, 47362, 46975, 46591, 46210, 45831, 45455,
+    45081, 44711, 44343, 43978, 43616, 43257, 42901, 42549, 42200, 41854, 41512, 41173, 40838, 40507, 40179, 39856,
+    39536, 39221, 38910, 38603, 38301, 38003, 37710, 37422, 37138, 36860, 36586, 36318, 36055, 35798, 35546, 35300,
+    35060, 34825, 34597, 34375, 34159, 33949, 33746, 33550, 33361, 33178, 33002, 32834, 32672, 32518, 32372, 32233,
+    32101, 31978, 31862, 31754, 31654, 31562, 31478, 31402, 31335, 31276, 31225, 31183, 31149, 31124, 31107, 31098,
+    31098, 31107, 31124, 31149, 31183, 31225, 31276, 31335, 31402, 31478, 31562, 31654, 31754, 31862, 31978, 32101,
+    32233, 32372, 32518, 32672, 32834, 33002, 33178, 33361, 33550, 33746, 33949, 34159, 34375, 34597, 34825, 35060,
+    35300, 35546, 35798, 36055, 36318, 36586, 36860, 37138, 37422, 37710, 38003, 38301, 38603, 38910, 39221, 39536,
+    39856, 40179, 40507, 40838, 41173, 41512, 41854, 42200, 42549, 42901, 43257, 43616, 43978, 44343, 44711, 45081,
+    45455, 45831, 46210, 46591, 46975, 47362, 47751, 48142, 48536, 48931, 49329, 49729, 50131, 50536, 50942, 51350,
+    51760, 52172, 52585, 53001, 53418, 53836, 54257, 54679, 55102, 55527, 55954, 56382, 56812, 57242, 57675, 58108,
+    58543, 58979, 59416, 59855, 60295, 60736, 61178, 61621, 62065, 62511, 62957, 63405, 63853, 64302, 64753, 65204,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65451, 65001, 64553, 64105, 63658, 63213, 62768, 62324, 61882, 61441, 61001, 60562, 60124, 59687, 59252, 58818,
+    58385, 57953, 57523, 57095, 56667, 56241, 55817, 55394, 54973, 54553, 54135, 53719, 53304, 52891, 52480, 52070,
+    51663, 51257, 50854, 50452, 50052, 49655, 49260, 48867, 48476, 48087, 47701, 47317, 46936, 46557, 46181, 45808,
+    45437, 45070, 44705, 44343, 43984, 43628, 43275, 42926, 42580, 42237, 41898, 41563, 41231, 40903, 40578, 40258,
+    39942, 39630, 39322, 39018, 38719, 38425, 38135, 37850, 37569, 37294, 37024, 36759, 36499, 36245, 35997, 35753,
+    35516, 35285, 35060, 34840, 34627, 34421, 34221, 34027, 33840, 33660, 33487, 33321, 33162, 33010, 32866, 32729,
+    32600, 32478, 32364, 32257, 32159, 32068, 31986, 31911, 31845, 31787, 31737, 31696, 31662, 31637, 31620, 31612,
+    31612, 31620, 31637, 31662, 31696, 31737, 31787, 31845, 31911, 31986, 32068, 32159, 32257, 32364, 32478, 32600,
+    32729, 32866, 33010, 33162, 33321, 33487, 33660, 33840, 34027, 34221, 34421, 34627, 34840, 35060, 35285, 35516,
+    35753, 35997, 36245, 36499, 36759, 37024, 37294, 37569, 37850, 38135, 38425, 38719, 39018, 39322, 39630, 39942,
+    40258, 40578, 40903, 41231, 41563, 41898, 42237, 42580, 42926, 43275, 43628, 43984, 44343, 44705, 45070, 45437,
+    45808, 46181, 46557, 46936, 47317, 47701, 48087, 48476, 48867, 49260, 49655, 50052, 50452, 50854, 51257, 51663,
+    52070, 52480, 52891, 53304, 53719, 54135, 54553, 54973, 55394, 55817, 56241, 56667, 57095, 57523, 57953, 58385,
+    58818, 59252, 59687, 60124, 60562, 61001, 61441, 61882, 62324, 62768, 63213, 63658, 64105, 64553, 65001, 65451,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65253, 64806, 64360, 63915, 63471, 63028, 62587, 62146, 61707, 61269, 60831, 60396, 59961, 59528, 59095,
+    58665, 58235, 57807, 57381, 56956, 56532, 56110, 55689, 55270, 54852, 54437, 54023, 53610, 53200, 52791, 52384,
+    51979, 51576, 51175, 50776, 50379, 49984, 49591, 49201, 48812, 48427, 48043, 47662, 47284, 46908, 46535, 46164,
+    45797, 45432, 45070, 44711, 44355, 44002, 43652, 43306, 42963, 42623, 42287, 41955, 41626, 41301, 40980, 40663,
+    40350, 40041, 39736, 39436, 39140, 38849, 38562, 38280, 38003, 37731, 37464, 37202, 36945, 36694, 36449, 36209,
+    35974, 35746, 35524, 35307, 35097, 34893, 34696, 34505, 34321, 34143, 33973, 33809, 33652, 33503, 33361, 33226,
+    33098, 32978, 32866, 32761, 32664, 32575, 32494, 32421, 32355, 32298, 32249, 32208, 32175, 32151, 32134, 32126,
+    32126, 32134, 32151, 32175, 32208, 32249, 32298, 32355, 32421, 32494, 32575, 32664, 32761, 32866, 32978, 33098,
+    33226, 33361, 33503, 33652, 33809, 33973, 34143, 34321, 34505, 34696, 34893, 35097, 35307, 35524, 35746, 35974,
+    36209, 36449, 36694, 36945, 37202, 37464, 37731, 38003, 38280, 38562, 38849, 39140, 39436, 39736, 40041, 40350,
+    40663, 40980, 41301, 41626, 41955, 42287, 42623, 42963, 43306, 43652, 44002, 44355, 44711, 45070, 45432, 45797,
+    46164, 46535, 46908, 47284, 47662, 48043, 48427, 48812, 49201, 49591, 49984, 50379, 50776, 51175, 51576, 51979,
+    52384, 52791, 53200, 53610, 54023, 54437, 54852, 55270, 55689, 56110, 56532, 56956, 57381, 57807, 58235, 58665,
+    59095, 59528, 59961, 60396, 60831, 61269, 61707, 62146, 62587, 63028, 63471, 63915, 64360, 64806, 65253, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65507, 65062, 64618, 64175, 63733, 63292, 62852, 62413, 61976, 61540, 61104, 60671, 60238, 59807, 59376,
+    58948, 58520, 58095, 57670, 57247, 56825, 56406, 55987, 55570, 55155, 54742, 54330, 53920, 53512, 53105, 52701,
+    52298, 51897, 51499, 51102, 50708, 50316, 49926, 49538, 49152, 48769, 48388, 48010, 47635, 47261, 46891, 46523,
+    46159, 45797, 45437, 45081, 44728, 44378, 44032, 43688, 43349, 43012, 42679, 42350, 42024, 41702, 41384, 41070,
+    40760, 40454, 40153, 39856, 39563, 39275, 38991, 38712, 38438, 38169, 37906, 37647, 37393, 37145, 36903, 36666,
+    36434, 36209, 35989, 35776, 35568, 35367, 35172, 34984, 34802, 34627, 34459, 34298, 34143, 33996, 33856, 33723,
+    33597, 33479, 33368, 33265, 33170, 33082, 33002, 32930, 32866, 32810, 32761, 32721, 32689, 32664, 32648, 32640,
+    32640, 32648, 32664, 32689, 32721, 32761, 32810, 32866, 32930, 33002, 33082, 33170, 33265, 33368, 33479, 33597,
+    33723, 33856, 33996, 34143, 34298, 34459, 34627, 34802, 34984, 35172, 35367, 35568, 35776, 35989, 36209, 36434,
+    36666, 36903, 37145, 37393, 37647, 37906, 38169, 38438, 38712, 38991, 39275, 39563, 39856, 40153, 40454, 40760,
+    41070, 41384, 41702, 42024, 42350, 42679, 43012, 43349, 43688, 44032, 44378, 44728, 45081, 45437, 45797, 46159,
+    46523, 46891, 47261, 47635, 48010, 48388, 48769, 49152, 49538, 49926, 50316, 50708, 51102, 51499, 51897, 52298,
+    52701, 53105, 53512, 53920, 54330, 54742, 55155, 55570, 55987, 56406, 56825, 57247, 57670, 58095, 58520, 58948,
+    59376, 59807, 60238, 60671, 61104, 61540, 61976, 62413, 62852, 63292, 63733, 64175, 64618, 65062, 65507, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65321, 64879, 64438, 63998, 63559, 63121, 62684, 62248, 61814, 61381, 60949, 60518, 60089, 59661,
+    59234, 58809, 58385, 57962, 57542, 57122, 56704, 56288, 55874, 55461, 55050, 54640, 54232, 53827, 53423, 53021,
+    52620, 52222, 51826, 51432, 51040, 50651, 50263, 49878, 49495, 49115, 48737, 48361, 47988, 47618, 47250, 46885,
+    46523, 46164, 45808, 45455, 45105, 44758, 44414, 44074, 43737, 43403, 43073, 42747, 42424, 42106, 41791, 41480,
+    41173, 40870, 40572, 40278, 39988, 39703, 39422, 39147, 38876, 38610, 38349, 38093, 37843, 37598, 37358, 37124,
+    36895, 36673, 36456, 36245, 36041, 35842, 35650, 35464, 35285, 35112, 34946, 34787, 34635, 34490, 34352, 34221,
+    34097, 33980, 33871, 33770, 33676, 33589, 33511, 33440, 33376, 33321, 33273, 33234, 33202, 33178, 33162, 33154,
+    33154, 33162, 33178, 33202, 33234, 33273, 33321, 33376, 33440, 33511, 33589, 33676, 33770, 33871, 33980, 34097,
+    34221, 34352, 34490, 34635, 34787, 34946, 35112, 35285, 35464, 35650, 35842, 36041, 36245, 36456, 36673, 36895,
+    37124, 37358, 37598, 37843, 38093, 38349, 38610, 38876, 39147, 39422, 39703, 39988, 40278, 40572, 40870, 41173,
+    41480, 41791, 42106, 42424, 42747, 43073, 43403, 43737, 44074, 44414, 44758, 45105, 45455, 45808, 46164, 46523,
+    46885, 47250, 47618, 47988, 48361, 48737, 49115, 49495, 49878, 50263, 50651, 51040, 51432, 51826, 52222, 52620,
+    53021, 53423, 53827, 54232, 54640, 55050, 55461, 55874, 56288, 56704, 57122, 57542, 57962, 58385, 58809, 59234,
+    59661, 60089, 60518, 60949, 61381, 61814, 62248, 62684, 63121, 63559, 63998, 64438, 64879, 65321, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65143, 64704, 64265, 63828, 63392, 62957, 62523, 62091, 61660, 61230, 60801, 60374, 59948,
+    59523, 59100, 58678, 58258, 57839, 57422, 57007, 56593, 56180, 55770, 55361, 54954, 54548, 54145, 53743, 53343,
+    52946, 52550, 52156, 51765, 51376, 50988, 50604, 50221, 49841, 49463, 49088, 48715, 48345, 47977, 47612, 47250,
+    46891, 46535, 46181, 45831, 45484, 45140, 44799, 44462, 44128, 43797, 43470, 43147, 42827, 42512, 42200, 41892,
+    41588, 41288, 40993, 40702, 40415, 40133, 39856, 39583, 39315, 39052, 38794, 38541, 38294, 38052, 37815, 37584,
+    37358, 37138, 36924, 36716, 36514, 36318, 36128, 35945, 35768, 35598, 35434, 35277, 35127, 34984, 34848, 34719,
+    34597, 34482, 34375, 34275, 34182, 34097, 34019, 33949, 33887, 33832, 33785, 33746, 33715, 33692, 33676, 33668,
+    33668, 33676, 33692, 33715, 33746, 33785, 33832, 33887, 33949, 34019, 34097, 34182, 34275, 34375, 34482, 34597,
+    34719, 34848, 34984, 35127, 35277, 35434, 35598, 35768, 35945, 36128, 36318, 36514, 36716, 36924, 37138, 37358,
+    37584, 37815, 38052, 38294, 38541, 38794, 39052, 39315, 39583, 39856, 40133, 40415, 40702, 40993, 41288, 41588,
+    41892, 42200, 42512, 42827, 43147, 43470, 43797, 44128, 44462, 44799, 45140, 45484, 45831, 46181, 46535, 46891,
+    47250, 47612, 47977, 48345, 48715, 49088, 49463, 49841, 50221, 50604, 50988, 51376, 51765, 52156, 52550, 52946,
+    53343, 53743, 54145, 54548, 54954, 55361, 55770, 56180, 56593, 57007, 57422, 57839, 58258, 58678, 59100, 59523,
+    59948, 60374, 60801, 61230, 61660, 62091, 62523, 62957, 63392, 63828, 64265, 64704, 65143, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65410, 64973, 64536, 64101, 63667, 63233, 62802, 62371, 61942, 61514, 61087, 60662, 60238,
+    59815, 59394, 58975, 58557, 58140, 57725, 57312, 56900, 56490, 56081, 55675, 55270, 54867, 54466, 54067, 53669,
+    53274, 52881, 52490, 52101, 51714, 51329, 50947, 50567, 50189, 49814, 49442, 49072, 48704, 48339, 47977, 47618,
+    47261, 46908, 46557, 46210, 45866, 45525, 45187, 44852, 44521, 44194, 43870, 43549, 43233, 42920, 42611, 42306,
+    42005, 41708, 41416, 41128, 40844, 40565, 40291, 40021, 39756, 39496, 39241, 38991, 38747, 38507, 38273, 38045,
+    37822, 37605, 37393, 37188, 36988, 36795, 36608, 36427, 36252, 36084, 35923, 35768, 35620, 35479, 35345, 35217,
+    35097, 34984, 34878, 34780, 34688, 34604, 34528, 34459, 34398, 34344, 34298, 34259, 34228, 34205, 34190, 34182,
+    34182, 34190, 34205, 34228, 34259, 34298, 34344, 34398, 34459, 34528, 34604, 34688, 34780, 34878, 34984, 35097,
+    35217, 35345, 35479, 35620, 35768, 35923, 36084, 36252, 36427, 36608, 36795, 36988, 37188, 37393, 37605, 37822,
+    38045, 38273, 38507, 38747, 38991, 39241, 39496, 39756, 40021, 40291, 40565, 40844, 41128, 41416, 41708, 42005,
+    42306, 42611, 42920, 43233, 43549, 43870, 44194, 44521, 44852, 45187, 45525, 45866, 46210, 46557, 46908, 47261,
+    47618, 47977, 48339, 48704, 49072, 49442, 49814, 50189, 50567, 50947, 51329, 51714, 52101, 52490, 52881, 53274,
+    53669, 54067, 54466, 54867, 55270, 55675, 56081, 56490, 56900, 57312, 57725, 58140, 58557, 58975, 59394, 59815,
+    60238, 60662, 61087, 61514, 61942, 62371, 62802, 63233, 63667, 64101, 64536, 64973, 65410, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65245, 64810, 64376, 63944, 63513, 63083, 62654, 62227, 61801, 61376, 60953, 60531,
+    60111, 59692, 59274, 58858, 58444, 58031, 57620, 57210, 56802, 56396, 55992, 55589, 55189, 54790, 54393, 53998,
+    53605, 53215, 52826, 52439, 52055, 51673, 51293, 50916, 50541, 50168, 49798, 49431, 49066, 48704, 48345, 47988,
+    47635, 47284, 46936, 46591, 46250, 45912, 45577, 45245, 44917, 44592, 44271, 43954, 43640, 43330, 43024, 42722,
+    42424, 42131, 41841, 41556, 41276, 40999, 40728, 40461, 40199, 39942, 39690, 39443, 39201, 38964, 38733, 38507,
+    38287, 38072, 37864, 37661, 37464, 37273, 37088, 36910, 36738, 36572, 36412, 36260, 36114, 35974, 35842, 35717,
+    35598, 35486, 35382, 35285, 35195, 35112, 35037, 34969, 34909, 34855, 34810, 34772, 34742, 34719, 34704, 34696,
+    34696, 34704, 34719, 34742, 34772, 34810, 34855, 34909, 34969, 35037, 35112, 35195, 35285, 35382, 35486, 35598,
+    35717, 35842, 35974, 36114, 36260, 36412, 36572, 36738, 36910, 37088, 37273, 37464, 37661, 37864, 38072, 38287,
+    38507, 38733, 38964, 39201, 39443, 39690, 39942, 40199, 40461, 40728, 40999, 41276, 41556, 41841, 42131, 42424,
+    42722, 43024, 43330, 43640, 43954, 44271, 44592, 44917, 45245, 45577, 45912, 46250, 46591, 46936, 47284, 47635,
+    47988, 48345, 48704, 49066, 49431, 49798, 50168, 50541, 50916, 51293, 51673, 52055, 52439, 52826, 53215, 53605,
+    53998, 54393, 54790, 55189, 55589, 55992, 56396, 56802, 57210, 57620, 58031, 58444, 58858, 59274, 59692, 60111,
+    60531, 60953, 61376, 61801, 62227, 62654, 63083, 63513, 63944, 64376, 64810, 65245, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65519, 65086, 64655, 64224, 63795, 63367, 62940, 62515, 62091, 61668, 61247, 60827,
+    60409, 59992, 59576, 59163, 58750, 58340, 57931, 57523, 57118, 56714, 56312, 55912, 55513, 55117, 54722, 54330,
+    53939, 53551, 53165, 52781, 52399, 52019, 51642, 51267, 50895, 50525, 50158, 49793, 49431, 49072, 48715, 48361,
+    48010, 47662, 47317, 46975, 46637, 46301, 45969, 45640, 45315, 44993, 44675, 44361, 44050, 43743, 43440, 43141,
+    42846, 42555, 42268, 41986, 41708, 41435, 41167, 40903, 40643, 40389, 40140, 39895, 39656, 39422, 39194, 38971,
+    38753, 38541, 38335, 38135, 37940, 37752, 37569, 37393, 37223, 37060, 36903, 36752, 36608, 36470, 36340, 36216,
+    36099, 35989, 35886, 35790, 35702, 35620, 35546, 35479, 35419, 35367, 35322, 35285, 35255, 35232, 35217, 35210,
+    35210, 35217, 35232, 35255, 35285, 35322, 35367, 35419, 35479, 35546, 35620, 35702, 35790, 35886, 35989, 36099,
+    36216, 36340, 36470, 36608, 36752, 36903, 37060, 37223, 37393, 37569, 37752, 37940, 38135, 38335, 38541, 38753,
+    38971, 39194, 39422, 39656, 39895, 40140, 40389, 40643, 40903, 41167, 41435, 41708, 41986, 42268, 42555, 42846,
+    43141, 43440, 43743, 44050, 44361, 44675, 44993, 45315, 45640, 45969, 46301, 46637, 46975, 47317, 47662, 48010,
+    48361, 48715, 49072, 49431, 49793, 50158, 50525, 50895, 51267, 51642, 52019, 52399, 52781, 53165, 53551, 53939,
+    54330, 54722, 55117, 55513, 55912, 56312, 56714, 57118, 57523, 57931, 58340, 58750, 59163, 59576, 59992, 60409,
+    60827, 61247, 61668, 62091, 62515, 62940, 63367, 63795, 64224, 64655, 65086, 65519, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65366, 64936, 64508, 64080, 63654, 63229, 62806, 62384, 61963, 61544, 61126,
+    60710, 60295, 59882, 59470, 59060, 58651, 58244, 57839, 57436, 57034, 56635, 56237, 55841, 55447, 55054, 54664,
+    54276, 53890, 53507, 53125, 52746, 52369, 51994, 51622, 51252, 50885, 50520, 50158, 49798, 49442, 49088, 48737,
+    48388, 48043, 47701, 47362, 47026, 46693, 46364, 46038, 45716, 45397, 45081, 44770, 44462, 44158, 43857, 43561,
+    43269, 42981, 42698, 42418, 42143, 41873, 41607, 41346, 41089, 40838, 40591, 40350, 40113, 39882, 39656, 39436,
+    39221, 39012, 38808, 38610, 38418, 38232, 38052, 37878, 37710, 37548, 37393, 37245, 37102, 36967, 36838, 36716,
+    36601, 36492, 36391, 36296, 36209, 36128, 36055, 35989, 35930, 35879, 35835, 35798, 35768, 35746, 35731, 35724,
+    35724, 35731, 35746, 35768, 35798, 35835, 35879, 35930, 35989, 36055, 36128, 36209, 36296, 36391, 36492, 36601,
+    36716, 36838, 36967, 37102, 37245, 37393, 37548, 37710, 37878, 38052, 38232, 38418, 38610, 38808, 39012, 39221,
+    39436, 39656, 39882, 40113, 40350, 40591, 40838, 41089, 41346, 41607, 41873, 42143, 42418, 42698, 42981, 43269,
+    43561, 43857, 44158, 44462, 44770, 45081, 45397, 45716, 46038, 46364, 46693, 47026, 47362, 47701, 48043, 48388,
+    48737, 49088, 49442, 49798, 50158, 50520, 50885, 51252, 51622, 51994, 52369, 52746, 53125, 53507, 53890, 54276,
+    54664, 55054, 55447, 55841, 56237, 56635, 57034, 57436, 57839, 58244, 58651, 59060, 59470, 59882, 60295, 60710,
+    61126, 61544, 61963, 62384, 62806, 63229, 63654, 64080, 64508, 64936, 65366, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65220, 64794, 64368, 63944, 63521, 63100, 62680, 62261, 61844, 61428,
+    61014, 60601, 60190, 59780, 59372, 58966, 58561, 58158, 57757, 57358, 56960, 56565, 56171, 55779, 55389, 55002,
+    54616, 54232, 53851, 53472, 53095, 52721, 52349, 51979, 51612, 51247, 50885, 50525, 50168, 49814, 49463, 49115,
+    48769, 48427, 48087, 47751, 47418, 47088, 46761, 46438, 46118, 45802, 45490, 45181, 44876, 44575, 44277, 43984,
+    43695, 43409, 43129, 42852, 42580, 42312, 42049, 41791, 41537, 41288, 41044, 40806, 40572, 40343, 40120, 39902,
+    39690, 39483, 39282, 39086, 38896, 38712, 38535, 38363, 38197, 38038, 37885, 37738, 37598, 37464, 37337, 37216,
+    37102, 36996, 36895, 36802, 36716, 36637, 36565, 36499, 36441, 36391, 36347, 36311, 36282, 36260, 36245, 36238,
+    36238, 36245, 36260, 36282, 36311, 36347, 36391, 36441, 36499, 36565, 36637, 36716, 36802, 36895, 36996, 37102,
+    37216, 37337, 37464, 37598, 37738, 37885, 38038, 38197, 38363, 38535, 38712, 38896, 39086, 39282, 39483, 39690,
+    39902, 40120, 40343, 40572, 40806, 41044, 41288, 41537, 41791, 42049, 42312, 42580, 42852, 43129, 43409, 43695,
+    43984, 44277, 44575, 44876, 45181, 45490, 45802, 46118, 46438, 46761, 47088, 47418, 47751, 48087, 48427, 48769,
+    49115, 49463, 49814, 50168, 50525, 50885, 51247, 51612, 51979, 52349, 52721, 53095, 53472, 53851, 54232, 54616,
+    55002, 55389, 55779, 56171, 56565, 56960, 57358, 57757, 58158, 58561, 58966, 59372, 59780, 60190, 60601, 61014,
+    61428, 61844, 62261, 62680, 63100, 63521, 63944, 64368, 64794, 65220, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65507, 65082, 64659, 64237, 63816, 63396, 62978, 62561, 62146, 61732,
+    61320, 60910, 60500, 60093, 59687, 59283, 58880, 58480, 58081, 57684, 57289, 56895, 56504, 56114, 55727, 55342,
+    54958, 54577, 54198, 53822, 53447, 53075, 52706, 52338, 51974, 51612, 51252, 50895, 50541, 50189, 49841, 49495,
+    49152, 48812, 48476, 48142, 47812, 47485, 47161, 46840, 46523, 46210, 45900, 45594, 45292, 44993, 44699, 44408,
+    44122, 43839, 43561, 43288, 43018, 42753, 42493, 42237, 41986, 41740, 41499, 41263, 41032, 40806, 40585, 40369,
+    40159, 39955, 39756, 39563, 39376, 39194, 39018, 38849, 38685, 38528, 38377, 38232, 38093, 37961, 37836, 37717,
+    37605, 37499, 37400, 37308, 37223, 37145, 37074, 37010, 36953, 36903, 36860, 36824, 36795, 36773, 36759, 36752,
+    36752, 36759, 36773, 36795, 36824, 36860, 36903, 36953, 37010, 37074, 37145, 37223, 37308, 37400, 37499, 37605,
+    37717, 37836, 37961, 38093, 38232, 38377, 38528, 38685, 38849, 39018, 39194, 39376, 39563, 39756, 39955, 40159,
+    40369, 40585, 40806, 41032, 41263, 41499, 41740, 41986, 42237, 42493, 42753, 43018, 43288, 43561, 43839, 44122,
+    44408, 44699, 44993, 45292, 45594, 45900, 46210, 46523, 46840, 47161, 47485, 47812, 48142, 48476, 48812, 49152,
+    49495, 49841, 50189, 50541, 50895, 51252, 51612, 51974, 52338, 52706, 53075, 53447, 53822, 54198, 54577, 54958,
+    55342, 55727, 56114, 56504, 56895, 57289, 57684, 58081, 58480, 58880, 59283, 59687, 60093, 60500, 60910, 61320,
+    61732, 62146, 62561, 62978, 63396, 63816, 64237, 64659, 65082, 65507, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65374, 64952, 64532, 64113, 63696, 63279, 62865, 62452, 62040,
+    61630, 61221, 60814, 60409, 60005, 59603, 59203, 58804, 58407, 58013, 57620, 57229, 56839, 56452, 56067, 55684,
+    55303, 54925, 54548, 54174, 53802, 53433, 53065, 52701, 52338, 51979, 51622, 51267, 50916, 50567, 50221, 49878,
+    49538, 49201, 48867, 48536, 48208, 47883, 47562, 47245, 46930, 46620, 46313, 46009, 45710, 45414, 45122, 44835,
+    44551, 44271, 43996, 43725, 43458, 43196, 42938, 42685, 42437, 42193, 41955, 41721, 41493, 41269, 41051, 40838,
+    40630, 40428, 40232, 40041, 39856, 39676, 39503, 39335, 39174, 39018, 38869, 38726, 38589, 38459, 38335, 38218,
+    38107, 38003, 37906, 37815, 37731, 37654, 37584, 37520, 37464, 37414, 37372, 37337, 37308, 37287, 37273, 37266,
+    37266, 37273, 37287, 37308, 37337, 37372, 37414, 37464, 37520, 37584, 37654, 37731, 37815, 37906, 38003, 38107,
+    38218, 38335, 38459, 38589, 38726, 38869, 39018, 39174, 39335, 39503, 39676, 39856, 40041, 40232, 40428, 40630,
+    40838, 41051, 41269, 41493, 41721, 41955, 42193, 42437, 42685, 42938, 43196, 43458, 43725, 43996, 44271, 44551,
+    44835, 45122, 45414, 45710, 46009, 46313, 46620, 46930, 47245, 47562, 47883, 48208, 48536, 48867, 49201, 49538,
+    49878, 50221, 50567, 50916, 51267, 51622, 51979, 52338, 52701, 53065, 53433, 53802, 54174, 54548, 54925, 55303,
+    55684, 56067, 56452, 56839, 57229, 57620, 58013, 58407, 58804, 59203, 59603, 60005, 60409, 60814, 61221, 61630,
+    62040, 62452, 62865, 63279, 63696, 64113, 64532, 64952, 65374, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65249, 64830, 64413, 63998, 63583, 63171, 62760, 62350,
+    61942, 61535, 61130, 60727, 60326, 59926, 59528, 59131, 58737, 58344, 57953, 57565, 57178, 56793, 56410, 56030,
+    55651, 55275, 54901, 54529, 54159, 53792, 53428, 53065, 52706, 52349, 51994, 51642, 51293, 50947, 50604, 50263,
+    49926, 49591, 49260, 48931, 48606, 48285, 47966, 47651, 47340, 47032, 46727, 46427, 46130, 45837, 45548, 45263,
+    44982, 44705, 44432, 44164, 43900, 43640, 43385, 43135, 42889, 42648, 42412, 42181, 41955, 41734, 41518, 41308,
+    41102, 40903, 40708, 40520, 40337, 40159, 39988, 39823, 39663, 39510, 39362, 39221, 39086, 38957, 38835, 38719,
+    38610, 38507, 38411, 38321, 38239, 38163, 38093, 38031, 37975, 37926, 37885, 37850, 37822, 37801, 37787, 37780,
+    37780, 37787, 37801, 37822, 37850, 37885, 37926, 37975, 38031, 38093, 38163, 38239, 38321, 38411, 38507, 38610,
+    38719, 38835, 38957, 39086, 39221, 39362, 39510, 39663, 39823, 39988, 40159, 40337, 40520, 40708, 40903, 41102,
+    41308, 41518, 41734, 41955, 42181, 42412, 42648, 42889, 43135, 43385, 43640, 43900, 44164, 44432, 44705, 44982,
+    45263, 45548, 45837, 46130, 46427, 46727, 47032, 47340, 47651, 47966, 48285, 48606, 48931, 49260, 49591, 49926,
+    50263, 50604, 50947, 51293, 51642, 51994, 52349, 52706, 53065, 53428, 53792, 54159, 54529, 54901, 55275, 55651,
+    56030, 56410, 56793, 57178, 57565, 57953, 58344, 58737, 59131, 59528, 59926, 60326, 60727, 61130, 61535, 61942,
+    62350, 62760, 63171, 63583, 63998, 64413, 64830, 65249, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65131, 64716, 64302, 63890, 63480, 63070, 62663,
+    62257, 61852, 61449, 61048, 60649, 60251, 59855, 59461, 59069, 58678, 58290, 57903, 57519, 57136, 56756, 56377,
+    56001, 55627, 55256, 54886, 54519, 54154, 53792, 53433, 53075, 52721, 52369, 52019, 51673, 51329, 50988, 50651,
+    50316, 49984, 49655, 49329, 49007, 48688, 48372, 48060, 47751, 47446, 47144, 46846, 46552, 46261, 45975, 45693,
+    45414, 45140, 44870, 44604, 44343, 44086, 43833, 43586, 43342, 43104, 42871, 42642, 42418, 42200, 41986, 41778,
+    41575, 41378, 41186, 40999, 40819, 40643, 40474, 40311, 40153, 40001, 39856, 39716, 39583, 39456, 39335, 39221,
+    39113, 39012, 38917, 38828, 38747, 38671, 38603, 38541, 38487, 38438, 38397, 38363, 38335, 38315, 38301, 38294,
+    38294, 38301, 38315, 38335, 38363, 38397, 38438, 38487, 38541, 38603, 38671, 38747, 38828, 38917, 39012, 39113,
+    39221, 39335, 39456, 39583, 39716, 39856, 40001, 40153, 40311, 40474, 40643, 40819, 40999, 41186, 41378, 41575,
+    41778, 41986, 42200, 42418, 42642, 42871, 43104, 43342, 43586, 43833, 44086, 44343, 44604, 44870, 45140, 45414,
+    45693, 45975, 46261, 46552, 46846, 47144, 47446, 47751, 48060, 48372, 48688, 49007, 49329, 49655, 49984, 50316,
+    50651, 50988, 51329, 51673, 52019, 52369, 52721, 53075, 53433, 53792, 54154, 54519, 54886, 55256, 55627, 56001,
+    56377, 56756, 57136, 57519, 57903, 58290, 58678, 59069, 59461, 59855, 60251, 60649, 61048, 61449, 61852, 62257,
+    62663, 63070, 63480, 63890, 64302, 64716, 65131, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65435, 65022, 64610, 64200, 63791, 63384, 62978,
+    62574, 62172, 61771, 61372, 60975, 60579, 60185, 59793, 59403, 59015, 58629, 58244, 57862, 57482, 57104, 56728,
+    56354, 55982, 55613, 55246, 54881, 54519, 54159, 53802, 53447, 53095, 52746, 52399, 52055, 51714, 51376, 51040,
+    50708, 50379, 50052, 49729, 49410, 49093, 48780, 48470, 48164, 47861, 47562, 47267, 46975, 46688, 46404, 46124,
+    45848, 45577, 45309, 45046, 44787, 44533, 44283, 44038, 43797, 43561, 43330, 43104, 42883, 42667, 42456, 42250,
+    42049, 41854, 41664, 41480, 41301, 41128, 40961, 40799, 40643, 40494, 40350, 40212, 40080, 39955, 39836, 39723,
+    39616, 39516, 39422, 39335, 39255, 39180, 39113, 39052, 38998, 38951, 38910, 38876, 38849, 38828, 38815, 38808,
+    38808, 38815, 38828, 38849, 38876, 38910, 38951, 38998, 39052, 39113, 39180, 39255, 39335, 39422, 39516, 39616,
+    39723, 39836, 39955, 40080, 40212, 40350, 40494, 40643, 40799, 40961, 41128, 41301, 41480, 41664, 41854, 42049,
+    42250, 42456, 42667, 42883, 43104, 43330, 43561, 43797, 44038, 44283, 44533, 44787, 45046, 45309, 45577, 45848,
+    46124, 46404, 46688, 46975, 47267, 47562, 47861, 48164, 48470, 48780, 49093, 49410, 49729, 50052, 50379, 50708,
+    51040, 51376, 51714, 52055, 52399, 52746, 53095, 53447, 53802, 54159, 54519, 54881, 55246, 55613, 55982, 56354,
+    56728, 57104, 57482, 57862, 58244, 58629, 59015, 59403, 59793, 60185, 60579, 60975, 61372, 61771, 62172, 62574,
+    62978, 63384, 63791, 64200, 64610, 65022, 65435, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65330, 64920, 64512, 64105, 63700, 63296,
+    62894, 62494, 62095, 61698, 61303, 60910, 60518, 60128, 59740, 59354, 58970, 58588, 58208, 57830, 57454, 57081,
+    56709, 56340, 55973, 55608, 55246, 54886, 54529, 54174, 53822, 53472, 53125, 52781, 52439, 52101, 51765, 51432,
+    51102, 50776, 50452, 50131, 49814, 49500, 49190, 48883, 48579, 48279, 47983, 47690, 47401, 47116, 46835, 46557,
+    46284, 46015, 45750, 45490, 45233, 44982, 44734, 44491, 44253, 44020, 43791, 43567, 43349, 43135, 42926, 42722,
+    42524, 42331, 42143, 41961, 41784, 41613, 41448, 41288, 41134, 40986, 40844, 40708, 40578, 40454, 40337, 40225,
+    40120, 40021, 39929, 39842, 39763, 39690, 39623, 39563, 39510, 39463, 39422, 39389, 39362, 39342, 39329, 39322,
+    39322, 39329, 39342, 39362, 39389, 39422, 39463, 39510, 39563, 39623, 39690, 39763, 39842, 39929, 40021, 40120,
+    40225, 40337, 40454, 40578, 40708, 40844, 40986, 41134, 41288, 41448, 41613, 41784, 41961, 42143, 42331, 42524,
+    42722, 42926, 43135, 43349, 43567, 43791, 44020, 44253, 44491, 44734, 44982, 45233, 45490, 45750, 46015, 46284,
+    46557, 46835, 47116, 47401, 47690, 47983, 48279, 48579, 48883, 49190, 49500, 49814, 50131, 50452, 50776, 51102,
+    51432, 51765, 52101, 52439, 52781, 53125, 53472, 53822, 54174, 54529, 54886, 55246, 55608, 55973, 56340, 56709,
+    57081, 57454, 57830, 58208, 58588, 58970, 59354, 59740, 60128, 60518, 60910, 61303, 61698, 62095, 62494, 62894,
+    63296, 63700, 64105, 64512, 64920, 65330, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65232, 64826, 64421, 64018, 63617,
+    63217, 62819, 62422, 62027, 61634, 61243, 60853, 60466, 60080, 59696, 59314, 58934, 58557, 58181, 57807, 57436,
+    57067, 56700, 56335, 55973, 55613, 55256, 54901, 54548, 54198, 53851, 53507, 53165, 52826, 52490, 52156, 51826,
+    51499, 51175, 50854, 50536, 50221, 49910, 49602, 49297, 48996, 48699, 48405, 48115, 47828, 47546, 47267, 46992,
+    46722, 46455, 46193, 45935, 45681, 45432, 45187, 44946, 44711, 44480, 44253, 44032, 43815, 43604, 43397, 43196,
+    43000, 42809, 42623, 42443, 42268, 42099, 41936, 41778, 41626, 41480, 41339, 41205, 41077, 40954, 40838, 40728,
+    40624, 40526, 40435, 40350, 40271, 40199, 40133, 40074, 40021, 39975, 39935, 39902, 39876, 39856, 39842, 39836,
+    39836, 39842, 39856, 39876, 39902, 39935, 39975, 40021, 40074, 40133, 40199, 40271, 40350, 40435, 40526, 40624,
+    40728, 40838, 40954, 41077, 41205, 41339, 41480, 41626, 41778, 41936, 42099, 42268, 42443, 42623, 42809, 43000,
+    43196, 43397, 43604, 43815, 44032, 44253, 44480, 44711, 44946, 45187, 45432, 45681, 45935, 46193, 46455, 46722,
+    46992, 47267, 47546, 47828, 48115, 48405, 48699, 48996, 49297, 49602, 49910, 50221, 50536, 50854, 51175, 51499,
+    51826, 52156, 52490, 52826, 53165, 53507, 53851, 54198, 54548, 54901, 55256, 55613, 55973, 56335, 56700, 57067,
+    57436, 57807, 58181, 58557, 58934, 59314, 59696, 60080, 60466, 60853, 61243, 61634, 62027, 62422, 62819, 63217,
+    63617, 64018, 64421, 64826, 65232, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65143, 64741, 64339, 63940,
+    63542, 63146, 62751, 62358, 61967, 61578, 61191, 60805, 60422, 60040, 59661, 59283, 58907, 58534, 58163, 57794,
+    57427, 57062, 56700, 56340, 55982, 55627, 55275, 54925, 54577, 54232, 53890, 53551, 53215, 52881, 52550, 52222,
+    51897, 51576, 51257, 50942, 50630, 50321, 50015, 49713, 49415, 49120, 48829, 48541, 48257, 47977, 47701, 47429,
+    47161, 46897, 46637, 46381, 46130, 45883, 45640, 45403, 45169, 44940, 44717, 44497, 44283, 44074, 43870, 43670,
+    43476, 43288, 43104, 42926, 42753, 42586, 42424, 42268, 42118, 41974, 41835, 41702, 41575, 41454, 41339, 41231,
+    41128, 41032, 40941, 40857, 40780, 40708, 40643, 40585, 40533, 40487, 40448, 40415, 40389, 40369, 40356, 40350,
+    40350, 40356, 40369, 40389, 40415, 40448, 40487, 40533, 40585, 40643, 40708, 40780, 40857, 40941, 41032, 41128,
+    41231, 41339, 41454, 41575, 41702, 41835, 41974, 42118, 42268, 42424, 42586, 42753, 42926, 43104, 43288, 43476,
+    43670, 43870, 44074, 44283, 44497, 44717, 44940, 45169, 45403, 45640, 45883, 46130, 46381, 46637, 46897, 47161,
+    47429, 47701, 47977, 48257, 48541, 48829, 49120, 49415, 49713, 50015, 50321, 50630, 50942, 51257, 51576, 51897,
+    52222, 52550, 52881, 53215, 53551, 53890, 54232, 54577, 54925, 55275, 55627, 55982, 56340, 56700, 57062, 57427,
+    57794, 58163, 58534, 58907, 59283, 59661, 60040, 60422, 60805, 61191, 61578, 61967, 62358, 62751, 63146, 63542,
+    63940, 64339, 64741, 65143, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65463, 65062, 64663, 64265,
+    63870, 63475, 63083, 62692, 62303, 61916, 61531, 61148, 60766, 60387, 60009, 59634, 59261, 58889, 58520, 58154,
+    57789, 57427, 57067, 56709, 56354, 56001, 55651, 55303, 54958, 54616, 54276, 53939, 53605, 53274, 52946, 52620,
+    52298, 51979, 51663, 51350, 51040, 50734, 50431, 50131, 49835, 49543, 49254, 48969, 48688, 48410, 48137, 47867,
+    47601, 47340, 47082, 46829, 46580, 46336, 46096, 45860, 45629, 45403, 45181, 44964, 44752, 44545, 44343, 44146,
+    43954, 43767, 43586, 43409, 43239, 43073, 42914, 42759, 42611, 42468, 42331, 42200, 42074, 41955, 41841, 41734,
+    41632, 41537, 41448, 41365, 41288, 41218, 41154, 41096, 41044, 40999, 40961, 40928, 40903, 40883, 40870, 40864,
+    40864, 40870, 40883, 40903, 40928, 40961, 40999, 41044, 41096, 41154, 41218, 41288, 41365, 41448, 41537, 41632,
+    41734, 41841, 41955, 42074, 42200, 42331, 42468, 42611, 42759, 42914, 43073, 43239, 43409, 43586, 43767, 43954,
+    44146, 44343, 44545, 44752, 44964, 45181, 45403, 45629, 45860, 46096, 46336, 46580, 46829, 47082, 47340, 47601,
+    47867, 48137, 48410, 48688, 48969, 49254, 49543, 49835, 50131, 50431, 50734, 51040, 51350, 51663, 51979, 52298,
+    52620, 52946, 53274, 53605, 53939, 54276, 54616, 54958, 55303, 55651, 56001, 56354, 56709, 57067, 57427, 57789,
+    58154, 58520, 58889, 59261, 59634, 60009, 60387, 60766, 61148, 61531, 61916, 62303, 62692, 63083, 63475, 63870,
+    64265, 64663, 65062, 65463, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65386, 64989, 64593,
+    64200, 63807, 63417, 63028, 62642, 62257, 61874, 61492, 61113, 60736, 60361, 59987, 59616, 59247, 58880, 58516,
+    58154, 57794, 57436, 57081, 56728, 56377, 56030, 55684, 55342, 55002, 54664, 54330, 53998, 53669, 53343, 53021,
+    52701, 52384, 52070, 51760, 51453, 51149, 50848, 50551, 50258, 49968, 49682, 49399, 49120, 48845, 48574, 48306,
+    48043, 47784, 47529, 47278, 47032, 46790, 46552, 46319, 46090, 45866, 45646, 45432, 45222, 45017, 44817, 44622,
+    44432, 44247, 44068, 43894, 43725, 43561, 43403, 43251, 43104, 42963, 42827, 42698, 42574, 42456, 42343, 42237,
+    42137, 42043, 41955, 41873, 41797, 41727, 41664, 41607, 41556, 41512, 41473, 41442, 41416, 41397, 41384, 41378,
+    41378, 41384, 41397, 41416, 41442, 41473, 41512, 41556, 41607, 41664, 41727, 41797, 41873, 41955, 42043, 42137,
+    42237, 42343, 42456, 42574, 42698, 42827, 42963, 43104, 43251, 43403, 43561, 43725, 43894, 44068, 44247, 44432,
+    44622, 44817, 45017, 45222, 45432, 45646, 45866, 46090, 46319, 46552, 46790, 47032, 47278, 47529, 47784, 48043,
+    48306, 48574, 48845, 49120, 49399, 49682, 49968, 50258, 50551, 50848, 51149, 51453, 51760, 52070, 52384, 52701,
+    53021, 53343, 53669, 53998, 54330, 54664, 55002, 55342, 55684, 56030, 56377, 56728, 57081, 57436, 57794, 58154,
+    58516, 58880, 59247, 59616, 59987, 60361, 60736, 61113, 61492, 61874, 62257, 62642, 63028, 63417, 63807, 64200,
+    64593, 64989, 65386, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65317, 64924,
+    64532, 64142, 63754, 63367, 62982, 62599, 62218, 61839, 61462, 61087, 60714, 60343, 59974, 59607, 59243, 58880,
+    58520, 58163, 57807, 57454, 57104, 56756, 56410, 56067, 55727, 55389, 55054, 54722, 54393, 54067, 53743, 53423,
+    53105, 52791, 52480, 52172, 51867, 51566, 51267, 50973, 50682, 50394, 50110, 49830, 49554, 49281, 49012, 48747,
+    48487, 48230, 47977, 47729, 47485, 47245, 47009, 46778, 46552, 46330, 46113, 45900, 45693, 45490, 45292, 45099,
+    44911, 44728, 44551, 44378, 44211, 44050, 43894, 43743, 43598, 43458, 43324, 43196, 43073, 42957, 42846, 42741,
+    42642, 42549, 42462, 42381, 42306, 42237, 42175, 42118, 42068, 42024, 41986, 41955, 41930, 41911, 41898, 41892,
+    41892, 41898, 41911, 41930, 41955, 41986, 42024, 42068, 42118, 42175, 42237, 42306, 42381, 42462, 42549, 42642,
+    42741, 42846, 42957, 43073, 43196, 43324, 43458, 43598, 43743, 43894, 44050, 44211, 44378, 44551, 44728, 44911,
+    45099, 45292, 45490, 45693, 45900, 46113, 46330, 46552, 46778, 47009, 47245, 47485, 47729, 47977, 48230, 48487,
+    48747, 49012, 49281, 49554, 49830, 50110, 50394, 50682, 50973, 51267, 51566, 51867, 52172, 52480, 52791, 53105,
+    53423, 53743, 54067, 54393, 54722, 55054, 55389, 55727, 56067, 56410, 56756, 57104, 57454, 57807, 58163, 58520,
+    58880, 59243, 59607, 59974, 60343, 60714, 61087, 61462, 61839, 62218, 62599, 62982, 63367, 63754, 64142, 64532,
+    64924, 65317, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65257,
+    64867, 64479, 64093, 63708, 63325, 62945, 62566, 62189, 61814, 61441, 61070, 60701, 60334, 59970, 59607, 59247,
+    58889, 58534, 58181, 57830, 57482, 57136, 56793, 56452, 56114, 55779, 55447, 55117, 54790, 54466, 54145, 53827,
+    53512, 53200, 52891, 52585, 52283, 51984, 51688, 51396, 51107, 50822, 50541, 50263, 49989, 49719, 49452, 49190,
+    48931, 48677, 48427, 48180, 47939, 47701, 47468, 47239, 47015, 46795, 46580, 46370, 46164, 45964, 45768, 45577,
+    45391, 45210, 45034, 44864, 44699, 44539, 44384, 44235, 44092, 43954, 43821, 43695, 43573, 43458, 43349, 43245,
+    43147, 43055, 42969, 42889, 42815, 42747, 42685, 42629, 42580, 42536, 42499, 42468, 42443, 42424, 42412, 42406,
+    42406, 42412, 42424, 42443, 42468, 42499, 42536, 42580, 42629, 42685, 42747, 42815, 42889, 42969, 43055, 43147,
+    43245, 43349, 43458, 43573, 43695, 43821, 43954, 44092, 44235, 44384, 44539, 44699, 44864, 45034, 45210, 45391,
+    45577, 45768, 45964, 46164, 46370, 46580, 46795, 47015, 47239, 47468, 47701, 47939, 48180, 48427, 48677, 48931,
+    49190, 49452, 49719, 49989, 50263, 50541, 50822, 51107, 51396, 51688, 51984, 52283, 52585, 52891, 53200, 53512,
+    53827, 54145, 54466, 54790, 55117, 55447, 55779, 56114, 56452, 56793, 57136, 57482, 57830, 58181, 58534, 58889,
+    59247, 59607, 59970, 60334, 60701, 61070, 61441, 61814, 62189, 62566, 62945, 63325, 63708, 64093, 64479, 64867,
+    65257, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65204, 64818, 64434, 64051, 63671, 63292, 62915, 62540, 62167, 61797, 61428, 61061, 60697, 60334, 59974, 59616,
+    59261, 58907, 58557, 58208, 57862, 57519, 57178, 56839, 56504, 56171, 55841, 55513, 55189, 54867, 54548, 54232,
+    53920, 53610, 53304, 53001, 52701, 52404, 52111, 51821, 51535, 51252, 50973, 50697, 50426, 50158, 49894, 49634,
+    49377, 49125, 48877, 48633, 48394, 48159, 47928, 47701, 47479, 47261, 47049, 46840, 46637, 46438, 46244, 46055,
+    45871, 45693, 45519, 45350, 45187, 45029, 44876, 44728, 44586, 44450, 44319, 44194, 44074, 43960, 43851, 43749,
+    43652, 43561, 43476, 43397, 43324, 43257, 43196, 43141, 43092, 43049, 43012, 42981, 42957, 42938, 42926, 42920,
+    42920, 42926, 42938, 42957, 42981, 43012, 43049, 43092, 43141, 43196, 43257, 43324, 43397, 43476, 43561, 43652,
+    43749, 43851, 43960, 44074, 44194, 44319, 44450, 44586, 44728, 44876, 45029, 45187, 45350, 45519, 45693, 45871,
+    46055, 46244, 46438, 46637, 46840, 47049, 47261, 47479, 47701, 47928, 48159, 48394, 48633, 48877, 49125, 49377,
+    49634, 49894, 50158, 50426, 50697, 50973, 51252, 51535, 51821, 52111, 52404, 52701, 53001, 53304, 53610, 53920,
+    54232, 54548, 54867, 55189, 55513, 55841, 56171, 56504, 56839, 57178, 57519, 57862, 58208, 58557, 58907, 59261,
+    59616, 59974, 60334, 60697, 61061, 61428, 61797, 62167, 62540, 62915, 63292, 63671, 64051, 64434, 64818, 65204,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65160, 64777, 64397, 64018, 63642, 63267, 62894, 62523, 62155, 61788, 61424, 61061, 60701, 60343, 59987,
+    59634, 59283, 58934, 58588, 58244, 57903, 57565, 57229, 56895, 56565, 56237, 55912, 55589, 55270, 54954, 54640,
+    54330, 54023, 53719, 53418, 53120, 52826, 52535, 52248, 51964, 51683, 51406, 51133, 50864, 50598, 50337, 50079,
+    49825, 49575, 49329, 49088, 48850, 48617, 48388, 48164, 47944, 47729, 47518, 47312, 47110, 46914, 46722, 46535,
+    46353, 46176, 46004, 45837, 45675, 45519, 45368, 45222, 45081, 44946, 44817, 44693, 44575, 44462, 44355, 44253,
+    44158, 44068, 43984, 43906, 43833, 43767, 43707, 43652, 43604, 43561, 43525, 43495, 43470, 43452, 43440, 43434,
+    43434, 43440, 43452, 43470, 43495, 43525, 43561, 43604, 43652, 43707, 43767, 43833, 43906, 43984, 44068, 44158,
+    44253, 44355, 44462, 44575, 44693, 44817, 44946, 45081, 45222, 45368, 45519, 45675, 45837, 46004, 46176, 46353,
+    46535, 46722, 46914, 47110, 47312, 47518, 47729, 47944, 48164, 48388, 48617, 48850, 49088, 49329, 49575, 49825,
+    50079, 50337, 50598, 50864, 51133, 51406, 51683, 51964, 52248, 52535, 52826, 53120, 53418, 53719, 54023, 54330,
+    54640, 54954, 55270, 55589, 55912, 56237, 56565, 56895, 57229, 57565, 57903, 58244, 58588, 58934, 59283, 59634,
+    59987, 60343, 60701, 61061, 61424, 61788, 62155, 62523, 62894, 63267, 63642, 64018, 64397, 64777, 65160, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65503, 65123, 64745, 64368, 63994, 63621, 63250, 62882, 62515, 62150, 61788, 61428, 61070, 60714, 60361,
+    60009, 59661, 59314, 58970, 58629, 58290, 57953, 57620, 57289, 56960, 56635, 56312, 55992, 55675, 55361, 55050,
+    54742, 54437, 54135, 53836, 53541, 53249, 52961, 52676, 52394, 52116, 51841, 51571, 51304, 51040, 50781, 50525,
+    50274, 50026, 49782, 49543, 49308, 49077, 48850, 48628, 48410, 48197, 47988, 47784, 47585, 47390, 47200, 47015,
+    46835, 46659, 46489, 46324, 46164, 46009, 45860, 45716, 45577, 45443, 45315, 45193, 45075, 44964, 44858, 44758,
+    44663, 44575, 44491, 44414, 44343, 44277, 44217, 44164, 44116, 44074, 44038, 44008, 43984, 43966, 43954, 43948,
+    43948, 43954, 43966, 43984, 44008, 44038, 44074, 44116, 44164, 44217, 44277, 44343, 44414, 44491, 44575, 44663,
+    44758, 44858, 44964, 45075, 45193, 45315, 45443, 45577, 45716, 45860, 46009, 46164, 46324, 46489, 46659, 46835,
+    47015, 47200, 47390, 47585, 47784, 47988, 48197, 48410, 48628, 48850, 49077, 49308, 49543, 49782, 50026, 50274,
+    50525, 50781, 51040, 51304, 51571, 51841, 52116, 52394, 52676, 52961, 53249, 53541, 53836, 54135, 54437, 54742,
+    55050, 55361, 55675, 55992, 56312, 56635, 56960, 57289, 57620, 57953, 58290, 58629, 58970, 59314, 59661, 60009,
+    60361, 60714, 61070, 61428, 61788, 62150, 62515, 62882, 63250, 63621, 63994, 64368, 64745, 65123, 65503, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65471, 65095, 64720, 64348, 63977, 63608, 63242, 62877, 62515, 62155, 61797, 61441, 61087, 60736,
+    60387, 60040, 59696, 59354, 59015, 58678, 58344, 58013, 57684, 57358, 57034, 56714, 56396, 56081, 55770, 55461,
+    55155, 54852, 54553, 54257, 53964, 53674, 53388, 53105, 52826, 52550, 52278, 52009, 51745, 51483, 51226, 50973,
+    50723, 50478, 50237, 50000, 49767, 49538, 49313, 49093, 48877, 48666, 48459, 48257, 48060, 47867, 47679, 47496,
+    47317, 47144, 46975, 46812, 46654, 46501, 46353, 46210, 46073, 45941, 45814, 45693, 45577, 45466, 45362, 45263,
+    45169, 45081, 44999, 44923, 44852, 44787, 44728, 44675, 44628, 44586, 44551, 44521, 44497, 44480, 44468, 44462,
+    44462, 44468, 44480, 44497, 44521, 44551, 44586, 44628, 44675, 44728, 44787, 44852, 44923, 44999, 45081, 45169,
+    45263, 45362, 45466, 45577, 45693, 45814, 45941, 46073, 46210, 46353, 46501, 46654, 46812, 46975, 47144, 47317,
+    47496, 47679, 47867, 48060, 48257, 48459, 48666, 48877, 49093, 49313, 49538, 49767, 50000, 50237, 50478, 50723,
+    50973, 51226, 51483, 51745, 52009, 52278, 52550, 52826, 53105, 53388, 53674, 53964, 54257, 54553, 54852, 55155,
+    55461, 55770, 56081, 56396, 56714, 57034, 57358, 57684, 58013, 58344, 58678, 59015, 59354, 59696, 60040, 60387,
+    60736, 61087, 61441, 61797, 62155, 62515, 62877, 63242, 63608, 63977, 64348, 64720, 65095, 65471, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65447, 65074, 64704, 64335, 63969, 63604, 63242, 62882, 62523, 62167, 61814, 61462, 61113,
+    60766, 60422, 60080, 59740, 59403, 59069, 58737, 58407, 58081, 57757, 57436, 57118, 56802, 56490, 56180, 55874,
+    55570, 55270, 54973, 54679, 54388, 54101, 53817, 53536, 53259, 52986, 52716, 52449, 52187, 51928, 51673, 51422,
+    51175, 50931, 50692, 50457, 50226, 50000, 49777, 49559, 49345, 49136, 48931, 48731, 48536, 48345, 48159, 47977,
+    47801, 47629, 47462, 47301, 47144, 46992, 46846, 46705, 46569, 46438, 46313, 46193, 46078, 45969, 45866, 45768,
+    45675, 45588, 45507, 45432, 45362, 45298, 45239, 45187, 45140, 45099, 45064, 45034, 45011, 44993, 44982, 44976,
+    44976, 44982, 44993, 45011, 45034, 45064, 45099, 45140, 45187, 45239, 45298, 45362, 45432, 45507, 45588, 45675,
+    45768, 45866, 45969, 46078, 46193, 46313, 46438, 46569, 46705, 46846, 46992, 47144, 47301, 47462, 47629, 47801,
+    47977, 48159, 48345, 48536, 48731, 48931, 49136, 49345, 49559, 49777, 50000, 50226, 50457, 50692, 50931, 51175,
+    51422, 51673, 51928, 52187, 52449, 52716, 52986, 53259, 53536, 53817, 54101, 54388, 54679, 54973, 55270, 55570,
+    55874, 56180, 56490, 56802, 57118, 57436, 57757, 58081, 58407, 58737, 59069, 59403, 59740, 60080, 60422, 60766,
+    61113, 61462, 61814, 62167, 62523, 62882, 63242, 63604, 63969, 64335, 64704, 65074, 65447, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65431, 65062, 64696, 64331, 63969, 63608, 63250, 62894, 62540, 62189, 61839, 61492,
+    61148, 60805, 60466, 60128, 59793, 59461, 59131, 58804, 58480, 58158, 57839, 57523, 57210, 56900, 56593, 56288,
+    55987, 55689, 55394, 55102, 54814, 54529, 54247, 53969, 53694, 53423, 53155, 52891, 52630, 52374, 52121, 51872,
+    51627, 51386, 51149, 50916, 50687, 50462, 50242, 50026, 49814, 49607, 49404, 49206, 49012, 48823, 48639, 48459,
+    48285, 48115, 47950, 47790, 47635, 47485, 47340, 47200, 47065, 46936, 46812, 46693, 46580, 46472, 46370, 46273,
+    46181, 46096, 46015, 45941, 45871, 45808, 45750, 45698, 45652, 45612, 45577, 45548, 45525, 45507, 45496, 45490,
+    45490, 45496, 45507, 45525, 45548, 45577, 45612, 45652, 45698, 45750, 45808, 45871, 45941, 46015, 46096, 46181,
+    46273, 46370, 46472, 46580, 46693, 46812, 46936, 47065, 47200, 47340, 47485, 47635, 47790, 47950, 48115, 48285,
+    48459, 48639, 48823, 49012, 49206, 49404, 49607, 49814, 50026, 50242, 50462, 50687, 50916, 51149, 51386, 51627,
+    51872, 52121, 52374, 52630, 52891, 53155, 53423, 53694, 53969, 54247, 54529, 54814, 55102, 55394, 55689, 55987,
+    56288, 56593, 56900, 57210, 57523, 57839, 58158, 58480, 58804, 59131, 59461, 59793, 60128, 60466, 60805, 61148,
+    61492, 61839, 62189, 62540, 62894, 63250, 63608, 63969, 64331, 64696, 65062, 65431, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65423, 65058, 64696, 64335, 63977, 63621, 63267, 62915, 62566, 62218, 61874,
+    61531, 61191, 60853, 60518, 60185, 59855, 59528, 59203, 58880, 58561, 58244, 57931, 57620, 57312, 57007, 56704,
+    56406, 56110, 55817, 55527, 55241, 54958, 54679, 54403, 54130, 53861, 53595, 53334, 53075, 52821, 52570, 52323,
+    52080, 51841, 51606, 51376, 51149, 50926, 50708, 50494, 50284, 50079, 49878, 49682, 49490, 49302, 49120, 48942,
+    48769, 48601, 48438, 48279, 48126, 47977, 47834, 47695, 47562, 47434, 47312, 47194, 47082, 46975, 46874, 46778,
+    46688, 46603, 46523, 46450, 46381, 46319, 46261, 46210, 46164, 46124, 46090, 46061, 46038, 46021, 46009, 46004,
+    46004, 46009, 46021, 46038, 46061, 46090, 46124, 46164, 46210, 46261, 46319, 46381, 46450, 46523, 46603, 46688,
+    46778, 46874, 46975, 47082, 47194, 47312, 47434, 47562, 47695, 47834, 47977, 48126, 48279, 48438, 48601, 48769,
+    48942, 49120, 49302, 49490, 49682, 49878, 50079, 50284, 50494, 50708, 50926, 51149, 51376, 51606, 51841, 52080,
+    52323, 52570, 52821, 53075, 53334, 53595, 53861, 54130, 54403, 54679, 54958, 55241, 55527, 55817, 56110, 56406,
+    56704, 57007, 57312, 57620, 57931, 58244, 58561, 58880, 59203, 59528, 59855, 60185, 60518, 60853, 61191, 61531,
+    61874, 62218, 62566, 62915, 63267, 63621, 63977, 64335, 64696, 65058, 65423, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65423, 65062, 64704, 64348, 63994, 63642, 63292, 62945, 62599, 62257,
+    61916, 61578, 61243, 60910, 60579, 60251, 59926, 59603, 59283, 58966, 58651, 58340, 58031, 57725, 57422, 57122,
+    56825, 56532, 56241, 55954, 55670, 55389, 55112, 54838, 54568, 54301, 54037, 53778, 53521, 53269, 53021, 52776,
+    52535, 52298, 52065, 51836, 51612, 51391, 51175, 50963, 50755, 50551, 50352, 50158, 49968, 49782, 49602, 49426,
+    49254, 49088, 48926, 48769, 48617, 48470, 48328, 48191, 48060, 47933, 47812, 47695, 47585, 47479, 47379, 47284,
+    47194, 47110, 47032, 46959, 46891, 46829, 46773, 46722, 46676, 46637, 46603, 46574, 46552, 46535, 46523, 46518,
+    46518, 46523, 46535, 46552, 46574, 46603, 46637, 46676, 46722, 46773, 46829, 46891, 46959, 47032, 47110, 47194,
+    47284, 47379, 47479, 47585, 47695, 47812, 47933, 48060, 48191, 48328, 48470, 48617, 48769, 48926, 49088, 49254,
+    49426, 49602, 49782, 49968, 50158, 50352, 50551, 50755, 50963, 51175, 51391, 51612, 51836, 52065, 52298, 52535,
+    52776, 53021, 53269, 53521, 53778, 54037, 54301, 54568, 54838, 55112, 55389, 55670, 55954, 56241, 56532, 56825,
+    57122, 57422, 57725, 58031, 58340, 58651, 58966, 59283, 59603, 59926, 60251, 60579, 60910, 61243, 61578, 61916,
+    62257, 62599, 62945, 63292, 63642, 63994, 64348, 64704, 65062, 65423, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65431, 65074, 64720, 64368, 64018, 63671, 63325, 62982, 62642,
+    62303, 61967, 61634, 61303, 60975, 60649, 60326, 60005, 59687, 59372, 59060, 58750, 58444, 58140, 57839, 57542,
+    57247, 56956, 56667, 56382, 56100, 55822, 55546, 55275, 55006, 54742, 54480, 54223, 53969, 53719, 53472, 53229,
+    52991, 52756, 52525, 52298, 52075, 51857, 51642, 51432, 51226, 51025, 50828, 50635, 50447, 50263, 50084, 49910,
+    49740, 49575, 49415, 49260, 49109, 48964, 48823, 48688, 48557, 48432, 48312, 48197, 48087, 47983, 47883, 47790,
+    47701, 47618, 47540, 47468, 47401, 47340, 47284, 47233, 47189, 47150, 47116, 47088, 47065, 47049, 47037, 47032,
+    47032, 47037, 47049, 47065, 47088, 47116, 47150, 47189, 47233, 47284, 47340, 47401, 47468, 47540, 47618, 47701,
+    47790, 47883, 47983, 48087, 48197, 48312, 48432, 48557, 48688, 48823, 48964, 49109, 49260, 49415, 49575, 49740,
+    49910, 50084, 50263, 50447, 50635, 50828, 51025, 51226, 51432, 51642, 51857, 52075, 52298, 52525, 52756, 52991,
+    53229, 53472, 53719, 53969, 54223, 54480, 54742, 55006, 55275, 55546, 55822, 56100, 56382, 56667, 56956, 57247,
+    57542, 57839, 58140, 58444, 58750, 59060, 59372, 59687, 60005, 60326, 60649, 60975, 61303, 61634, 61967, 62303,
+    62642, 62982, 63325, 63671, 64018, 64368, 64720, 65074, 65431, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65447, 65095, 64745, 64397, 64051, 63708, 63367, 63028,
+    62692, 62358, 62027, 61698, 61372, 61048, 60727, 60409, 60093, 59780, 59470, 59163, 58858, 58557, 58258, 57962,
+    57670, 57381, 57095, 56812, 56532, 56255, 55982, 55713, 55447, 55184, 54925, 54669, 54417, 54169, 53925, 53684,
+    53447, 53215, 52986, 52761, 52540, 52323, 52111, 51903, 51699, 51499, 51304, 51113, 50926, 50744, 50567, 50394,
+    50226, 50063, 49904, 49751, 49602, 49458, 49319, 49184, 49055, 48931, 48812, 48699, 48590, 48487, 48388, 48295,
+    48208, 48126, 48049, 47977, 47911, 47850, 47795, 47745, 47701, 47662, 47629, 47601, 47579, 47562, 47551, 47546,
+    47546, 47551, 47562, 47579, 47601, 47629, 47662, 47701, 47745, 47795, 47850, 47911, 47977, 48049, 48126, 48208,
+    48295, 48388, 48487, 48590, 48699, 48812, 48931, 49055, 49184, 49319, 49458, 49602, 49751, 49904, 50063, 50226,
+    50394, 50567, 50744, 50926, 51113, 51304, 51499, 51699, 51903, 52111, 52323, 52540, 52761, 52986, 53215, 53447,
+    53684, 53925, 54169, 54417, 54669, 54925, 55184, 55447, 55713, 55982, 56255, 56532, 56812, 57095, 57381, 57670,
+    57962, 58258, 58557, 58858, 59163, 59470, 59780, 60093, 60409, 60727, 61048, 61372, 61698, 62027, 62358, 62692,
+    63028, 63367, 63708, 64051, 64397, 64745, 65095, 65447, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65471, 65123, 64777, 64434, 64093, 63754, 63417,
+    63083, 62751, 62422, 62095, 61771, 61449, 61130, 60814, 60500, 60190, 59882, 59576, 59274, 58975, 58678, 58385,
+    58095, 57807, 57523, 57242, 56965, 56690, 56420, 56152, 55888, 55627, 55370, 55117, 54867, 54621, 54378, 54140,
+    53905, 53674, 53447, 53224, 53006, 52791, 52580, 52374, 52172, 51974, 51780, 51591, 51406, 51226, 51051, 50880,
+    50713, 50551, 50394, 50242, 50095, 49952, 49814, 49681, 49554, 49431, 49313, 49201, 49093, 48991, 48894, 48802,
+    48715, 48633, 48557, 48487, 48421, 48361, 48306, 48257, 48213, 48175, 48142, 48115, 48093, 48076, 48065, 48060,
+    48060, 48065, 48076, 48093, 48115, 48142, 48175, 48213, 48257, 48306, 48361, 48421, 48487, 48557, 48633, 48715,
+    48802, 48894, 48991, 49093, 49201, 49313, 49431, 49554, 49681, 49814, 49952, 50095, 50242, 50394, 50551, 50713,
+    50880, 51051, 51226, 51406, 51591, 51780, 51974, 52172, 52374, 52580, 52791, 53006, 53224, 53447, 53674, 53905,
+    54140, 54378, 54621, 54867, 55117, 55370, 55627, 55888, 56152, 56420, 56690, 56965, 57242, 57523, 57807, 58095,
+    58385, 58678, 58975, 59274, 59576, 59882, 60190, 60500, 60814, 61130, 61449, 61771, 62095, 62422, 62751, 63083,
+    63417, 63754, 64093, 64434, 64777, 65123, 65471, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65503, 65160, 64818, 64479, 64142, 63807,
+    63475, 63146, 62819, 62494, 62172, 61852, 61535, 61221, 60910, 60601, 60295, 59992, 59692, 59394, 59100, 58809,
+    58520, 58235, 57953, 57675, 57399, 57127, 56858, 56593, 56331, 56072, 55817, 55566, 55318, 55074, 54833, 54597,
+    54364, 54135, 53910, 53689, 53472, 53259, 53050, 52846, 52645, 52449, 52258, 52070, 51887, 51709, 51535, 51365,
+    51200, 51040, 50885, 50734, 50588, 50447, 50310, 50179, 50052, 49931, 49814, 49703, 49596, 49495, 49399, 49308,
+    49222, 49141, 49066, 48996, 48931, 48872, 48818, 48769, 48726, 48688, 48655, 48628, 48606, 48590, 48579, 48574,
+    48574, 48579, 48590, 48606, 48628, 48655, 48688, 48726, 48769, 48818, 48872, 48931, 48996, 49066, 49141, 49222,
+    49308, 49399, 49495, 49596, 49703, 49814, 49931, 50052, 50179, 50310, 50447, 50588, 50734, 50885, 51040, 51200,
+    51365, 51535, 51709, 51887, 52070, 52258, 52449, 52645, 52846, 53050, 53259, 53472, 53689, 53910, 54135, 54364,
+    54597, 54833, 55074, 55318, 55566, 55817, 56072, 56331, 56593, 56858, 57127, 57399, 57675, 57953, 58235, 58520,
+    58809, 59100, 59394, 59692, 59992, 60295, 60601, 60910, 61221, 61535, 61852, 62172, 62494, 62819, 63146, 63475,
+    63807, 64142, 64479, 64818, 65160, 65503, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65204, 64867, 64532, 64200,
+    63870, 63542, 63217, 62894, 62574, 62257, 61942, 61630, 61320, 61014, 60710, 60409, 60111, 59815, 59523, 59234,
+    58948, 58665, 58385, 58108, 57835, 57565, 57298, 57034, 56774, 56518, 56265, 56015, 55770, 55527, 55289, 55054,
+    54824, 54597, 54374, 54154, 53939, 53728, 53521, 53319, 53120, 52926, 52736, 52550, 52369, 52192, 52019, 51852,
+    51688, 51530, 51376, 51226, 51082, 50942, 50807, 50677, 50551, 50431, 50316, 50205, 50100, 50000, 49904, 49814,
+    49729, 49650, 49575, 49506, 49442, 49383, 49329, 49281, 49238, 49201, 49168, 49141, 49120, 49104, 49093, 49088,
+    49088, 49093, 49104, 49120, 49141, 49168, 49201, 49238, 49281, 49329, 49383, 49442, 49506, 49575, 49650, 49729,
+    49814, 49904, 50000, 50100, 50205, 50316, 50431, 50551, 50677, 50807, 50942, 51082, 51226, 51376, 51530, 51688,
+    51852, 52019, 52192, 52369, 52550, 52736, 52926, 53120, 53319, 53521, 53728, 53939, 54154, 54374, 54597, 54824,
+    55054, 55289, 55527, 55770, 56015, 56265, 56518, 56774, 57034, 57298, 57565, 57835, 58108, 58385, 58665, 58948,
+    59234, 59523, 59815, 60111, 60409, 60710, 61014, 61320, 61630, 61942, 62257, 62574, 62894, 63217, 63542, 63870,
+    64200, 64532, 64867, 65204, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65257, 64924, 64593,
+    64265, 63940, 63617, 63296, 62978, 62663, 62350, 62040, 61732, 61428, 61126, 60827, 60531, 60238, 59948, 59661,
+    59376, 59095, 58818, 58543, 58272, 58003, 57739, 57477, 57219, 56965, 56714, 56466, 56223, 55982, 55746, 55513,
+    55284, 55059, 54838, 54621, 54408, 54198, 53993, 53792, 53595, 53403, 53215, 53031, 52851, 52676, 52505, 52338,
+    52177, 52019, 51867, 51719, 51576, 51437, 51304, 51175, 51051, 50931, 50817, 50708, 50604, 50504, 50410, 50321,
+    50237, 50158, 50084, 50015, 49952, 49894, 49841, 49793, 49751, 49713, 49681, 49655, 49634, 49618, 49607, 49602,
+    49602, 49607, 49618, 49634, 49655, 49681, 49713, 49751, 49793, 49841, 49894, 49952, 50015, 50084, 50158, 50237,
+    50321, 50410, 50504, 50604, 50708, 50817, 50931, 51051, 51175, 51304, 51437, 51576, 51719, 51867, 52019, 52177,
+    52338, 52505, 52676, 52851, 53031, 53215, 53403, 53595, 53792, 53993, 54198, 54408, 54621, 54838, 55059, 55284,
+    55513, 55746, 55982, 56223, 56466, 56714, 56965, 57219, 57477, 57739, 58003, 58272, 58543, 58818, 59095, 59376,
+    59661, 59948, 60238, 60531, 60827, 61126, 61428, 61732, 62040, 62350, 62663, 62978, 63296, 63617, 63940, 64265,
+    64593, 64924, 65257, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65317, 64989,
+    64663, 64339, 64018, 63700, 63384, 63070, 62760, 62452, 62146, 61844, 61544, 61247, 60953, 60662, 60374, 60089,
+    59807, 59528, 59252, 58979, 58710, 58444, 58181, 57921, 57665, 57413, 57164, 56918, 56677, 56438, 56204, 55973,
+    55746, 55523, 55303, 55088, 54877, 54669, 54466, 54267, 54071, 53881, 53694, 53512, 53334, 53160, 52991, 52826,
+    52666, 52510, 52359, 52212, 52070, 51933, 51801, 51673, 51550, 51432, 51319, 51211, 51107, 51009, 50916, 50828,
+    50744, 50666, 50593, 50525, 50462, 50405, 50352, 50305, 50263, 50226, 50195, 50168, 50147, 50131, 50121, 50116,
+    50116, 50121, 50131, 50147, 50168, 50195, 50226, 50263, 50305, 50352, 50405, 50462, 50525, 50593, 50666, 50744,
+    50828, 50916, 51009, 51107, 51211, 51319, 51432, 51550, 51673, 51801, 51933, 52070, 52212, 52359, 52510, 52666,
+    52826, 52991, 53160, 53334, 53512, 53694, 53881, 54071, 54267, 54466, 54669, 54877, 55088, 55303, 55523, 55746,
+    55973, 56204, 56438, 56677, 56918, 57164, 57413, 57665, 57921, 58181, 58444, 58710, 58979, 59252, 59528, 59807,
+    60089, 60374, 60662, 60953, 61247, 61544, 61844, 62146, 62452, 62760, 63070, 63384, 63700, 64018, 64339, 64663,
+    64989, 65317, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65386,
+    65062, 64741, 64421, 64105, 63791, 63480, 63171, 62865, 62561, 62261, 61963, 61668, 61376, 61087, 60801, 60518,
+    60238, 59961, 59687, 59416, 59149, 58885, 58624, 58367, 58113, 57862, 57615, 57371, 57132, 56895, 56663, 56434,
+    56208, 55987, 55770, 55556, 55346, 55141, 54939, 54742, 54548, 54359, 54174, 53993, 53817, 53645, 53477, 53314,
+    53155, 53001, 52851, 52706, 52565, 52429, 52298, 52172, 52050, 51933, 51821, 51714, 51612, 51514, 51422, 51334,
+    51252, 51175, 51102, 51035, 50973, 50916, 50864, 50817, 50776, 50739, 50708, 50682, 50661, 50645, 50635, 50630,
+    50630, 50635, 50645, 50661, 50682, 50708, 50739, 50776, 50817, 50864, 50916, 50973, 51035, 51102, 51175, 51252,
+    51334, 51422, 51514, 51612, 51714, 51821, 51933, 52050, 52172, 52298, 52429, 52565, 52706, 52851, 53001, 53155,
+    53314, 53477, 53645, 53817, 53993, 54174, 54359, 54548, 54742, 54939, 55141, 55346, 55556, 55770, 55987, 56208,
+    56434, 56663, 56895, 57132, 57371, 57615, 57862, 58113, 58367, 58624, 58885, 59149, 59416, 59687, 59961, 60238,
+    60518, 60801, 61087, 61376, 61668, 61963, 62261, 62561, 62865, 63171, 63480, 63791, 64105, 64421, 64741, 65062,
+    65386, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65463, 65143, 64826, 64512, 64200, 63890, 63583, 63279, 62978, 62680, 62384, 62091, 61801, 61514, 61230, 60949,
+    60671, 60396, 60124, 59855, 59590, 59327, 59069, 58813, 58561, 58312, 58067, 57826, 57588, 57353, 57122, 56895,
+    56672, 56452, 56237, 56025, 55817, 55613, 55413, 55217, 55026, 54838, 54655, 54476, 54301, 54130, 53964, 53802,
+    53645, 53492, 53343, 53200, 53060, 52926, 52796, 52671, 52550, 52434, 52323, 52217, 52116, 52019, 51928, 51841,
+    51760, 51683, 51612, 51545, 51483, 51427, 51376, 51329, 51288, 51252, 51221, 51195, 51175, 51159, 51149, 51144,
+    51144, 51149, 51159, 51175, 51195, 51221, 51252, 51288, 51329, 51376, 51427, 51483, 51545, 51612, 51683, 51760,
+    51841, 51928, 52019, 52116, 52217, 52323, 52434, 52550, 52671, 52796, 52926, 53060, 53200, 53343, 53492, 53645,
+    53802, 53964, 54130, 54301, 54476, 54655, 54838, 55026, 55217, 55413, 55613, 55817, 56025, 56237, 56452, 56672,
+    56895, 57122, 57353, 57588, 57826, 58067, 58312, 58561, 58813, 59069, 59327, 59590, 59855, 60124, 60396, 60671,
+    60949, 61230, 61514, 61801, 62091, 62384, 62680, 62978, 63279, 63583, 63890, 64200, 64512, 64826, 65143, 65463,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65232, 64920, 64610, 64302, 63998, 63696, 63396, 63100, 62806, 62515, 62227, 61942, 61660, 61381,
+    61104, 60831, 60562, 60295, 60031, 59771, 59514, 59261, 59010, 58764, 58520, 58281, 58044, 57812, 57583, 57358,
+    57136, 56918, 56704, 56494, 56288, 56086, 55888, 55694, 55504, 55318, 55136, 54958, 54785, 54616, 54451, 54291,
+    54135, 53983, 53836, 53694, 53556, 53423, 53294, 53170, 53050, 52936, 52826, 52721, 52620, 52525, 52434, 52349,
+    52268, 52192, 52121, 52055, 51994, 51938, 51887, 51841, 51801, 51765, 51734, 51709, 51688, 51673, 51663, 51658,
+    51658, 51663, 51673, 51688, 51709, 51734, 51765, 51801, 51841, 51887, 51938, 51994, 52055, 52121, 52192, 52268,
+    52349, 52434, 52525, 52620, 52721, 52826, 52936, 53050, 53170, 53294, 53423, 53556, 53694, 53836, 53983, 54135,
+    54291, 54451, 54616, 54785, 54958, 55136, 55318, 55504, 55694, 55888, 56086, 56288, 56494, 56704, 56918, 57136,
+    57358, 57583, 57812, 58044, 58281, 58520, 58764, 59010, 59261, 59514, 59771, 60031, 60295, 60562, 60831, 61104,
+    61381, 61660, 61942, 62227, 62515, 62806, 63100, 63396, 63696, 63998, 64302, 64610, 64920, 65232, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65330, 65022, 64716, 64413, 64113, 63816, 63521, 63229, 62940, 62654, 62371, 62091, 61814,
+    61540, 61269, 61001, 60736, 60474, 60216, 59961, 59709, 59461, 59216, 58975, 58737, 58502, 58272, 58044, 57821,
+    57601, 57385, 57173, 56965, 56760, 56560, 56363, 56171, 55982, 55798, 55618, 55442, 55270, 55102, 54939, 54780,
+    54626, 54476, 54330, 54189, 54052, 53920, 53792, 53669, 53551, 53437, 53329, 53224, 53125, 53031, 52941, 52856,
+    52776, 52701, 52630, 52565, 52505, 52449, 52399, 52354, 52313, 52278, 52248, 52222, 52202, 52187, 52177, 52172,
+    52172, 52177, 52187, 52202, 52222, 52248, 52278, 52313, 52354, 52399, 52449, 52505, 52565, 52630, 52701, 52776,
+    52856, 52941, 53031, 53125, 53224, 53329, 53437, 53551, 53669, 53792, 53920, 54052, 54189, 54330, 54476, 54626,
+    54780, 54939, 55102, 55270, 55442, 55618, 55798, 55982, 56171, 56363, 56560, 56760, 56965, 57173, 57385, 57601,
+    57821, 58044, 58272, 58502, 58737, 58975, 59216, 59461, 59709, 59961, 60216, 60474, 60736, 61001, 61269, 61540,
+    61814, 62091, 62371, 62654, 62940, 63229, 63521, 63816, 64113, 64413, 64716, 65022, 65330, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65435, 65131, 64830, 64532, 64237, 63944, 63654, 63367, 63083, 62802, 62523, 62248,
+    61976, 61707, 61441, 61178, 60918, 60662, 60409, 60159, 59912, 59669, 59430, 59194, 58961, 58732, 58507, 58285,
+    58067, 57853, 57643, 57436, 57233, 57034, 56839, 56649, 56462, 56279, 56100, 55926, 55755, 55589, 55427, 55270,
+    55117, 54968, 54824, 54684, 54548, 54417, 54291, 54169, 54052, 53939, 53832, 53728, 53630, 53536, 53447, 53363,
+    53284, 53210, 53140, 53075, 53016, 52961, 52911, 52866, 52826, 52791, 52761, 52736, 52716, 52701, 52691, 52686,
+    52686, 52691, 52701, 52716, 52736, 52761, 52791, 52826, 52866, 52911, 52961, 53016, 53075, 53140, 53210, 53284,
+    53363, 53447, 53536, 53630, 53728, 53832, 53939, 54052, 54169, 54291, 54417, 54548, 54684, 54824, 54968, 55117,
+    55270, 55427, 55589, 55755, 55926, 56100, 56279, 56462, 56649, 56839, 57034, 57233, 57436, 57643, 57853, 58067,
+    58285, 58507, 58732, 58961, 59194, 59430, 59669, 59912, 60159, 60409, 60662, 60918, 61178, 61441, 61707, 61976,
+    62248, 62523, 62802, 63083, 63367, 63654, 63944, 64237, 64532, 64830, 65131, 65435, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65249, 64952, 64659, 64368, 64080, 63795, 63513, 63233, 62957, 62684,
+    62413, 62146, 61882, 61621, 61363, 61109, 60857, 60610, 60365, 60124, 59886, 59652, 59421, 59194, 58970, 58750,
+    58534, 58321, 58113, 57908, 57707, 57509, 57316, 57127, 56942, 56760, 56583, 56410, 56241, 56077, 55916, 55760,
+    55608, 55461, 55318, 55179, 55045, 54915, 54790, 54669, 54553, 54442, 54335, 54232, 54135, 54042, 53954, 53871,
+    53792, 53719, 53650, 53586, 53526, 53472, 53423, 53378, 53338, 53304, 53274, 53249, 53229, 53215, 53205, 53200,
+    53200, 53205, 53215, 53229, 53249, 53274, 53304, 53338, 53378, 53423, 53472, 53526, 53586, 53650, 53719, 53792,
+    53871, 53954, 54042, 54135, 54232, 54335, 54442, 54553, 54669, 54790, 54915, 55045, 55179, 55318, 55461, 55608,
+    55760, 55916, 56077, 56241, 56410, 56583, 56760, 56942, 57127, 57316, 57509, 57707, 57908, 58113, 58321, 58534,
+    58750, 58970, 59194, 59421, 59652, 59886, 60124, 60365, 60610, 60857, 61109, 61363, 61621, 61882, 62146, 62413,
+    62684, 62957, 63233, 63513, 63795, 64080, 64368, 64659, 64952, 65249, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65374, 65082, 64794, 64508, 64224, 63944, 63667, 63392, 63121,
+    62852, 62587, 62324, 62065, 61809, 61557, 61307, 61061, 60818, 60579, 60343, 60111, 59882, 59656, 59434, 59216,
+    59002, 58791, 58584, 58380, 58181, 57985, 57794, 57606, 57422, 57242, 57067, 56895, 56728, 56565, 56406, 56251,
+    56100, 55954, 55812, 55675, 55542, 55413, 55289, 55169, 55054, 54944, 54838, 54737, 54640, 54548, 54461, 54378,
+    54301, 54228, 54159, 54096, 54037, 53983, 53934, 53890, 53851, 53817, 53787, 53763, 53743, 53728, 53719, 53714,
+    53714, 53719, 53728, 53743, 53763, 53787, 53817, 53851, 53890, 53934, 53983, 54037, 54096, 54159, 54228, 54301,
+    54378, 54461, 54548, 54640, 54737, 54838, 54944, 55054, 55169, 55289, 55413, 55542, 55675, 55812, 55954, 56100,
+    56251, 56406, 56565, 56728, 56895, 57067, 57242, 57422, 57606, 57794, 57985, 58181, 58380, 58584, 58791, 59002,
+    59216, 59434, 59656, 59882, 60111, 60343, 60579, 60818, 61061, 61307, 61557, 61809, 62065, 62324, 62587, 62852,
+    63121, 63392, 63667, 63944, 64224, 64508, 64794, 65082, 65374, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65507, 65220, 64936, 64655, 64376, 64101, 63828, 63559,
+    63292, 63028, 62768, 62511, 62257, 62006, 61758, 61514, 61273, 61035, 60801, 60570, 60343, 60119, 59899, 59683,
+    59470, 59261, 59055, 58854, 58656, 58462, 58272, 58085, 57903, 57725, 57551, 57381, 57215, 57053, 56895, 56742,
+    56593, 56448, 56307, 56171, 56039, 55912, 55789, 55670, 55556, 55447, 55342, 55241, 55146, 55054, 54968, 54886,
+    54809, 54737, 54669, 54606, 54548, 54495, 54446, 54403, 54364, 54330, 54301, 54276, 54257, 54242, 54232, 54228,
+    54228, 54232, 54242, 54257, 54276, 54301, 54330, 54364, 54403, 54446, 54495, 54548, 54606, 54669, 54737, 54809,
+    54886, 54968, 55054, 55146, 55241, 55342, 55447, 55556, 55670, 55789, 55912, 56039, 56171, 56307, 56448, 56593,
+    56742, 56895, 57053, 57215, 57381, 57551, 57725, 57903, 58085, 58272, 58462, 58656, 58854, 59055, 59261, 59470,
+    59683, 59899, 60119, 60343, 60570, 60801, 61035, 61273, 61514, 61758, 62006, 62257, 62511, 62768, 63028, 63292,
+    63559, 63828, 64101, 64376, 64655, 64936, 65220, 65507, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65366, 65086, 64810, 64536, 64265, 63998,
+    63733, 63471, 63213, 62957, 62705, 62456, 62210, 61967, 61728, 61492, 61260, 61031, 60805, 60583, 60365, 60150,
+    59939, 59731, 59528, 59327, 59131, 58939, 58750, 58566, 58385, 58208, 58035, 57867, 57702, 57542, 57385, 57233,
+    57085, 56942, 56802, 56667, 56536, 56410, 56288, 56171, 56058, 55949, 55845, 55746, 55651, 55561, 55475, 55394,
+    55318, 55246, 55179, 55117, 55059, 55006, 54958, 54915, 54877, 54843, 54814, 54790, 54771, 54756, 54746, 54742,
+    54742, 54746, 54756, 54771, 54790, 54814, 54843, 54877, 54915, 54958, 55006, 55059, 55117, 55179, 55246, 55318,
+    55394, 55475, 55561, 55651, 55746, 55845, 55949, 56058, 56171, 56288, 56410, 56536, 56667, 56802, 56942, 57085,
+    57233, 57385, 57542, 57702, 57867, 58035, 58208, 58385, 58566, 58750, 58939, 59131, 59327, 59528, 59731, 59939,
+    60150, 60365, 60583, 60805, 61031, 61260, 61492, 61728, 61967, 62210, 62456, 62705, 62957, 63213, 63471, 63733,
+    63998, 64265, 64536, 64810, 65086, 65366, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65519, 65245, 64973, 64704, 64438,
+    64175, 63915, 63658, 63405, 63154, 62907, 62663, 62422, 62184, 61950, 61720, 61492, 61269, 61048, 60831, 60618,
+    60409, 60203, 60001, 59802, 59607, 59416, 59229, 59046, 58867, 58692, 58520, 58353, 58190, 58031, 57876, 57725,
+    57578, 57436, 57298, 57164, 57034, 56909, 56788, 56672, 56560, 56452, 56349, 56251, 56157, 56067, 55982, 55902,
+    55826, 55755, 55689, 55627, 55570, 55518, 55470, 55427, 55389, 55356, 55327, 55303, 55284, 55270, 55260, 55256,
+    55256, 55260, 55270, 55284, 55303, 55327, 55356, 55389, 55427, 55470, 55518, 55570, 55627, 55689, 55755, 55826,
+    55902, 55982, 56067, 56157, 56251, 56349, 56452, 56560, 56672, 56788, 56909, 57034, 57164, 57298, 57436, 57578,
+    57725, 57876, 58031, 58190, 58353, 58520, 58692, 58867, 59046, 59229, 59416, 59607, 59802, 60001, 60203, 60409,
+    60618, 60831, 61048, 61269, 61492, 61720, 61950, 62184, 62422, 62663, 62907, 63154, 63405, 63658, 63915, 64175,
+    64438, 64704, 64973, 65245, 65519, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65410, 65143, 64879,
+    64618, 64360, 64105, 63853, 63604, 63359, 63116, 62877, 62642, 62409, 62180, 61955, 61732, 61514, 61299, 61087,
+    60879, 60675, 60474, 60277, 60084, 59895, 59709, 59528, 59350, 59176, 59006, 58840, 58678, 58520, 58367, 58217,
+    58072, 57931, 57794, 57661, 57532, 57408, 57289, 57173, 57062, 56956, 56853, 56756, 56663, 56574, 56490, 56410,
+    56335, 56265, 56199, 56138, 56081, 56030, 55982, 55940, 55902, 55869, 55841, 55817, 55798, 55784, 55774, 55770,
+    55770, 55774, 55784, 55798, 55817, 55841, 55869, 55902, 55940, 55982, 56030, 56081, 56138, 56199, 56265, 56335,
+    56410, 56490, 56574, 56663, 56756, 56853, 56956, 57062, 57173, 57289, 57408, 57532, 57661, 57794, 57931, 58072,
+    58217, 58367, 58520, 58678, 58840, 59006, 59176, 59350, 59528, 59709, 59895, 60084, 60277, 60474, 60675, 60879,
+    61087, 61299, 61514, 61732, 61955, 62180, 62409, 62642, 62877, 63116, 63359, 63604, 63853, 64105, 64360, 64618,
+    64879, 65143, 65410, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65321,
+    65062, 64806, 64553, 64302, 64055, 63812, 63571, 63334, 63100, 62869, 62642, 62418, 62197, 61980, 61767, 61557,
+    61350, 61148, 60949, 60753, 60562, 60374, 60190, 60009, 59833, 59661, 59492, 59327, 59167, 59010, 58858, 58710,
+    58566, 58426, 58290, 58158, 58031, 57908, 57789, 57675, 57565, 57459, 57358, 57261, 57168, 57081, 56997, 56918,
+    56844, 56774, 56709, 56649, 56593, 56541, 56494, 56452, 56415, 56382, 56354, 56331, 56312, 56298, 56288, 56284,
+    56284, 56288, 56298, 56312, 56331, 56354, 56382, 56415, 56452, 56494, 56541, 56593, 56649, 56709, 56774, 56844,
+    56918, 56997, 57081, 57168, 57261, 57358, 57459, 57565, 57675, 57789, 57908, 58031, 58158, 58290, 58426, 58566,
+    58710, 58858, 59010, 59167, 59327, 59492, 59661, 59833, 60009, 60190, 60374, 60562, 60753, 60949, 61148, 61350,
+    61557, 61767, 61980, 62197, 62418, 62642, 62869, 63100, 63334, 63571, 63812, 64055, 64302, 64553, 64806, 65062,
+    65321, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65507, 65253, 65001, 64753, 64508, 64265, 64027, 63791, 63559, 63330, 63104, 62882, 62663, 62447, 62235, 62027,
+    61822, 61621, 61424, 61230, 61040, 60853, 60671, 60492, 60317, 60146, 59979, 59815, 59656, 59501, 59350, 59203,
+    59060, 58921, 58786, 58656, 58529, 58407, 58290, 58176, 58067, 57962, 57862, 57766, 57675, 57588, 57505, 57427,
+    57353, 57284, 57219, 57159, 57104, 57053, 57007, 56965, 56928, 56895, 56867, 56844, 56825, 56812, 56802, 56798,
+    56798, 56802, 56812, 56825, 56844, 56867, 56895, 56928, 56965, 57007, 57053, 57104, 57159, 57219, 57284, 57353,
+    57427, 57505, 57588, 57675, 57766, 57862, 57962, 58067, 58176, 58290, 58407, 58529, 58656, 58786, 58921, 59060,
+    59203, 59350, 59501, 59656, 59815, 59979, 60146, 60317, 60492, 60671, 60853, 61040, 61230, 61424, 61621, 61822,
+    62027, 62235, 62447, 62663, 62882, 63104, 63330, 63559, 63791, 64027, 64265, 64508, 64753, 65001, 65253, 65507,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65451, 65204, 64961, 64720, 64483, 64249, 64018, 63791, 63567, 63346, 63129, 62915, 62705, 62498,
+    62295, 62095, 61899, 61707, 61518, 61333, 61152, 60975, 60801, 60631, 60465, 60304, 60146, 59992, 59842, 59696,
+    59554, 59416, 59283, 59154, 59028, 58907, 58791, 58678, 58570, 58466, 58367, 58272, 58181, 58095, 58013, 57935,
+    57862, 57794, 57730, 57670, 57615, 57565, 57519, 57477, 57441, 57408, 57381, 57358, 57339, 57325, 57316, 57312,
+    57312, 57316, 57325, 57339, 57358, 57381, 57408, 57441, 57477, 57519, 57565, 57615, 57670, 57730, 57794, 57862,
+    57935, 58013, 58095, 58181, 58272, 58367, 58466, 58570, 58678, 58791, 58907, 59028, 59154, 59283, 59416, 59554,
+    59696, 59842, 59992, 60146, 60304, 60465, 60631, 60801, 60975, 61152, 61333, 61518, 61707, 61899, 62095, 62295,
+    62498, 62705, 62915, 63129, 63346, 63567, 63791, 64018, 64249, 64483, 64720, 64961, 65204, 65451, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65414, 65176, 64940, 64708, 64479, 64253, 64031, 63812, 63596, 63384, 63175, 62970,
+    62768, 62570, 62375, 62184, 61997, 61814, 61634, 61458, 61286, 61117, 60953, 60792, 60636, 60483, 60334, 60190,
+    60049, 59912, 59780, 59652, 59528, 59408, 59292, 59180, 59073, 58970, 58872, 58777, 58687, 58602, 58520, 58444,
+    58371, 58303, 58240, 58181, 58126, 58076, 58031, 57990, 57953, 57921, 57894, 57871, 57853, 57839, 57830, 57826,
+    57826, 57830, 57839, 57853, 57871, 57894, 57921, 57953, 57990, 58031, 58076, 58126, 58181, 58240, 58303, 58371,
+    58444, 58520, 58602, 58687, 58777, 58872, 58970, 59073, 59180, 59292, 59408, 59528, 59652, 59780, 59912, 60049,
+    60190, 60334, 60483, 60636, 60792, 60953, 61117, 61286, 61458, 61634, 61814, 61997, 62184, 62375, 62570, 62768,
+    62970, 63175, 63384, 63596, 63812, 64031, 64253, 64479, 64708, 64940, 65176, 65414, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65398, 65168, 64940, 64716, 64495, 64278, 64064, 63853, 63646, 63442,
+    63242, 63045, 62852, 62663, 62477, 62295, 62116, 61942, 61771, 61604, 61441, 61281, 61126, 60975, 60827, 60684,
+    60544, 60409, 60277, 60150, 60027, 59908, 59793, 59683, 59576, 59474, 59376, 59283, 59194, 59109, 59028, 58952,
+    58880, 58813, 58750, 58692, 58638, 58588, 58543, 58502, 58466, 58435, 58407, 58385, 58367, 58353, 58344, 58340,
+    58340, 58344, 58353, 58367, 58385, 58407, 58435, 58466, 58502, 58543, 58588, 58638, 58692, 58750, 58813, 58880,
+    58952, 59028, 59109, 59194, 59283, 59376, 59474, 59576, 59683, 59793, 59908, 60027, 60150, 60277, 60409, 60544,
+    60684, 60827, 60975, 61126, 61281, 61441, 61604, 61771, 61942, 62116, 62295, 62477, 62663, 62852, 63045, 63242,
+    63442, 63646, 63853, 64064, 64278, 64495, 64716, 64940, 65168, 65398, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65402, 65180, 64961, 64745, 64532, 64323, 64117, 63915,
+    63716, 63521, 63330, 63142, 62957, 62776, 62599, 62426, 62257, 62091, 61929, 61771, 61617, 61467, 61320, 61178,
+    61040, 60905, 60775, 60649, 60527, 60409, 60295, 60185, 60080, 59979, 59882, 59789, 59700, 59616, 59536, 59461,
+    59390, 59323, 59261, 59203, 59149, 59100, 59055, 59015, 58979, 58948, 58921, 58898, 58880, 58867, 58858, 58854,
+    58854, 58858, 58867, 58880, 58898, 58921, 58948, 58979, 59015, 59055, 59100, 59149, 59203, 59261, 59323, 59390,
+    59461, 59536, 59616, 59700, 59789, 59882, 59979, 60080, 60185, 60295, 60409, 60527, 60649, 60775, 60905, 61040,
+    61178, 61320, 61467, 61617, 61771, 61929, 62091, 62257, 62426, 62599, 62776, 62957, 63142, 63330, 63521, 63716,
+    63915, 64117, 64323, 64532, 64745, 64961, 65180, 65402, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65427, 65212, 65001, 64794, 64589, 64389,
+    64191, 63998, 63807, 63621, 63438, 63259, 63083, 62911, 62743, 62578, 62418, 62261, 62108, 61959, 61814, 61673,
+    61535, 61402, 61273, 61148, 61027, 60910, 60797, 60688, 60583, 60483, 60387, 60295, 60207, 60124, 60045, 59970,
+    59899, 59833, 59771, 59714, 59661, 59612, 59567, 59528, 59492, 59461, 59434, 59412, 59394, 59381, 59372, 59368,
+    59368, 59372, 59381, 59394, 59412, 59434, 59461, 59492, 59528, 59567, 59612, 59661, 59714, 59771, 59833, 59899,
+    59970, 60045, 60124, 60207, 60295, 60387, 60483, 60583, 60688, 60797, 60910, 61027, 61148, 61273, 61402, 61535,
+    61673, 61814, 61959, 62108, 62261, 62418, 62578, 62743, 62911, 63083, 63259, 63438, 63621, 63807, 63998, 64191,
+    64389, 64589, 64794, 65001, 65212, 65427, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65471, 65265, 65062, 64863,
+    64667, 64475, 64286, 64101, 63919, 63741, 63567, 63396, 63229, 63066, 62907, 62751, 62599, 62452, 62308, 62167,
+    62031, 61899, 61771, 61647, 61527, 61411, 61299, 61191, 61087, 60988, 60892, 60801, 60714, 60631, 60553, 60479,
+    60409, 60343, 60282, 60225, 60172, 60124, 60080, 60040, 60005, 59974, 59948, 59926, 59908, 59895, 59886, 59882,
+    59882, 59886, 59895, 59908, 59926, 59948, 59974, 60005, 60040, 60080, 60124, 60172, 60225, 60282, 60343, 60409,
+    60479, 60553, 60631, 60714, 60801, 60892, 60988, 61087, 61191, 61299, 61411, 61527, 61647, 61771, 61899, 62031,
+    62167, 62308, 62452, 62599, 62751, 62907, 63066, 63229, 63396, 63567, 63741, 63919, 64101, 64286, 64475, 64667,
+    64863, 65062, 65265, 65471, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65338,
+    65143, 64952, 64765, 64581, 64401, 64224, 64051, 63882, 63716, 63554, 63396, 63242, 63091, 62945, 62802, 62663,
+    62528, 62397, 62269, 62146, 62027, 61912, 61801, 61694, 61591, 61492, 61398, 61307, 61221, 61139, 61061, 60988,
+    60918, 60853, 60792, 60736, 60684, 60636, 60592, 60553, 60518, 60487, 60461, 60439, 60422, 60409, 60400, 60396,
+    60396, 60400, 60409, 60422, 60439, 60461, 60487, 60518, 60553, 60592, 60636, 60684, 60736, 60792, 60853, 60918,
+    60988, 61061, 61139, 61221, 61307, 61398, 61492, 61591, 61694, 61801, 61912, 62027, 62146, 62269, 62397, 62528,
+    62663, 62802, 62945, 63091, 63242, 63396, 63554, 63716, 63882, 64051, 64224, 64401, 64581, 64765, 64952, 65143,
+    65338, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65431, 65245, 65062, 64883, 64708, 64536, 64368, 64204, 64043, 63886, 63733, 63583, 63438, 63296, 63158,
+    63024, 62894, 62768, 62646, 62528, 62413, 62303, 62197, 62095, 61997, 61903, 61814, 61728, 61647, 61570, 61497,
+    61428, 61363, 61303, 61247, 61195, 61148, 61104, 61065, 61031, 61001, 60975, 60953, 60936, 60923, 60914, 60910,
+    60910, 60914, 60923, 60936, 60953, 60975, 61001, 61031, 61065, 61104, 61148, 61195, 61247, 61303, 61363, 61428,
+    61497, 61570, 61647, 61728, 61814, 61903, 61997, 62095, 62197, 62303, 62413, 62528, 62646, 62768, 62894, 63024,
+    63158, 63296, 63438, 63583, 63733, 63886, 64043, 64204, 64368, 64536, 64708, 64883, 65062, 65245, 65431, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65366, 65192, 65022, 64855, 64692, 64532, 64376, 64224, 64076, 63932, 63791, 63654,
+    63521, 63392, 63267, 63146, 63028, 62915, 62806, 62701, 62599, 62502, 62409, 62320, 62235, 62155, 62078, 62006,
+    61938, 61874, 61814, 61758, 61707, 61660, 61617, 61578, 61544, 61514, 61488, 61467, 61449, 61436, 61428, 61424,
+    61424, 61428, 61436, 61449, 61467, 61488, 61514, 61544, 61578, 61617, 61660, 61707, 61758, 61814, 61874, 61938,
+    62006, 62078, 62155, 62235, 62320, 62409, 62502, 62599, 62701, 62806, 62915, 63028, 63146, 63267, 63392, 63521,
+    63654, 63791, 63932, 64076, 64224, 64376, 64532, 64692, 64855, 65022, 65192, 65366, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65507, 65342, 65180, 65022, 64867, 64716, 64569, 64426, 64286, 64150,
+    64018, 63890, 63766, 63646, 63529, 63417, 63309, 63204, 63104, 63007, 62915, 62827, 62743, 62663, 62587, 62515,
+    62447, 62384, 62324, 62269, 62218, 62172, 62129, 62091, 62057, 62027, 62001, 61980, 61963, 61950, 61942, 61938,
+    61938, 61942, 61950, 61963, 61980, 62001, 62027, 62057, 62091, 62129, 62172, 62218, 62269, 62324, 62384, 62447,
+    62515, 62587, 62663, 62743, 62827, 62915, 63007, 63104, 63204, 63309, 63417, 63529, 63646, 63766, 63890, 64018,
+    64150, 64286, 64426, 64569, 64716, 64867, 65022, 65180, 65342, 65507, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65511, 65358, 65208, 65062, 64920, 64781, 64647,
+    64516, 64389, 64265, 64146, 64031, 63919, 63812, 63708, 63608, 63513, 63421, 63334, 63250, 63171, 63095, 63024,
+    62957, 62894, 62835, 62781, 62730, 62684, 62642, 62604, 62570, 62540, 62515, 62494, 62477, 62464, 62456, 62452,
+    62452, 62456, 62464, 62477, 62494, 62515, 62540, 62570, 62604, 62642, 62684, 62730, 62781, 62835, 62894, 62957,
+    63024, 63095, 63171, 63250, 63334, 63421, 63513, 63608, 63708, 63812, 63919, 64031, 64146, 64265, 64389, 64516,
+    64647, 64781, 64920, 65062, 65208, 65358, 65511, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65414, 65277, 65143,
+    65013, 64887, 64765, 64647, 64532, 64421, 64315, 64212, 64113, 64018, 63927, 63841, 63758, 63679, 63604, 63534,
+    63467, 63405, 63346, 63292, 63242, 63196, 63154, 63116, 63083, 63054, 63028, 63007, 62991, 62978, 62970, 62966,
+    62966, 62970, 62978, 62991, 63007, 63028, 63054, 63083, 63116, 63154, 63196, 63242, 63292, 63346, 63405, 63467,
+    63534, 63604, 63679, 63758, 63841, 63927, 64018, 64113, 64212, 64315, 64421, 64532, 64647, 64765, 64887, 65013,
+    65143, 65277, 65414, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65511, 65386, 65265, 65147, 65034, 64924, 64818, 64716, 64618, 64524, 64434, 64348, 64265, 64187, 64113, 64043,
+    63977, 63915, 63857, 63803, 63754, 63708, 63667, 63629, 63596, 63567, 63542, 63521, 63504, 63492, 63484, 63480,
+    63480, 63484, 63492, 63504, 63521, 63542, 63567, 63596, 63629, 63667, 63708, 63754, 63803, 63857, 63915, 63977,
+    64043, 64113, 64187, 64265, 64348, 64434, 64524, 64618, 64716, 64818, 64924, 65034, 65147, 65265, 65386, 65511,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65427, 65321, 65220, 65123, 65030, 64940, 64855, 64773, 64696, 64622, 64553,
+    64487, 64426, 64368, 64315, 64265, 64220, 64179, 64142, 64109, 64080, 64055, 64035, 64018, 64006, 63998, 63994,
+    63994, 63998, 64006, 64018, 64035, 64055, 64080, 64109, 64142, 64179, 64220, 64265, 64315, 64368, 64426, 64487,
+    64553, 64622, 64696, 64773, 64855, 64940, 65030, 65123, 65220, 65321, 65427, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65447, 65362, 65281, 65204, 65131, 65062,
+    64997, 64936, 64879, 64826, 64777, 64732, 64692, 64655, 64622, 64593, 64569, 64548, 64532, 64520, 64512, 64508,
+    64508, 64512, 64520, 64532, 64548, 64569, 64593, 64622, 64655, 64692, 64732, 64777, 64826, 64879, 64936, 64997,
+    65062, 65131, 65204, 65281, 65362, 65447, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65507, 65447, 65390, 65338, 65289, 65245, 65204, 65168, 65135, 65107, 65082, 65062, 65046, 65034, 65026, 65022,
+    65022, 65026, 65034, 65046, 65062, 65082, 65107, 65135, 65168, 65204, 65245, 65289, 65338, 65390, 65447, 65507,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+};
@@ -0,0 +1,41 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// tables.h: lookup tables generated at build time (see gentables.c)
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_TABLES_H
+#define DUMP1090_TABLES_H
+
+#include <stdint.h>
+
+// Slice-by-N CRC tables: crc_table[k][b] is the CRC of the byte b followed
+// by k zero bytes. crc_table[0] alone gives the classic byte-at-a-time CRC.
+extern const uint32_t crc_table[8][256];
+
+// CRC syndromes of a single-bit error at each bit of a 112-bit message
+extern const uint32_t crc_single_bit_syndrome[112];
+
+// Mode C altitude (in 100s of feet) for each Mode A code, indexed by
+// modeAToIndex(), or INVALID_ALTITUDE
+extern const int modeAToCTable[4096];
+
+// Mode A code for each Mode C altitude + 13, or 0
+extern const unsigned modeCToATable[4096];
+
+// 16-bit magnitude of each UC8 I/Q pair, read as a uint16_t in either byte
+// order (--mag8 rounds these, see MAG16_TO_8)
+extern const uint16_t uc8_lookup[256 * 256];
+
+#endif
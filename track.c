@@ -512,6 +512,14 @@ static void updatePosition(struct aircraft *a, struct modesMessage *mm, uint64_t
 // Receive new messages and update tracked aircraft state
 //
 
+// Does anything look at aircraft state beyond addresses, signal levels and
+// message counts? A pure Beast / raw relay doesn't, and then message bodies
+// needn't be decoded at all.
+static int aircraft_state_wanted(void)
+{
+    return Modes.json_dir || Modes.interactive || !Modes.quiet || Modes.stats || modesNetWantsDecoded();
+}
+
 struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
 {
     struct aircraft *a;
@@ -524,6 +532,9 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
 
     uint64_t now = mstime();
 
+    if (aircraft_state_wanted())
+        decodeModesMessageBody(mm);
+
     // Lookup our aircraft or create a new one
     a = trackFindAircraft(mm->addr);
     if (!a) {                              // If it's a currently unknown aircraft....
@@ -51,6 +51,7 @@
 
 #include <stdlib.h>
 #include <sys/time.h>
+#include <sys/mman.h>
 
 uint64_t mstime(void)
 {
@@ -95,3 +96,113 @@ void end_cpu_timing(const struct timespec *start_time, struct timespec *add_to)
     add_to->tv_nsec += end_time.tv_nsec - start_time->tv_nsec;
     normalize_timespec(add_to);
 }
+
+/* Huge page size, if the system has any huge pages free to allocate, else 0 */
+size_t huge_page_size(void)
+{
+    size_t size = 0;
+    long free_pages = 0;
+#ifdef __linux__
+    FILE *f = fopen("/proc/meminfo", "r");
+    char line[128];
+
+    if (!f)
+        return 0;
+
+    while (fgets(line, sizeof(line), f)) {
+        unsigned long kb;
+        long n;
+
+        if (sscanf(line, "Hugepagesize: %lu kB", &kb) == 1)
+            size = kb * 1024;
+        else if (sscanf(line, "HugePages_Free: %ld", &n) == 1)
+            free_pages = n;
+    }
+
+    fclose(f);
+#endif
+    return (free_pages > 0 ? size : 0);
+}
+
+/* mlock a region if --mlock was given */
+void lock_memory(void *p, size_t size)
+{
+    static int warned = 0;
+
+    if (!Modes.mlock || !p)
+        return;
+
+    if (mlock(p, size) < 0 && !warned) {
+        fprintf(stderr, "Can't lock buffers into memory (%s); check RLIMIT_MEMLOCK\n", strerror(errno));
+        warned = 1;
+    }
+}
+
+/* Allocations made by alloc_big, so that free_big knows their size */
+struct big_alloc {
+    void *p;
+    size_t size;
+    struct big_alloc *next;
+};
+
+static struct big_alloc *big_allocs;
+
+/* Allocate size bytes of zeroed memory for a large table or buffer, from
+ * huge pages where the system has some reserved (otherwise asking for
+ * transparent huge pages), and locked into memory with --mlock. Returns
+ * NULL on failure. Not thread-safe; call it from initialization code.
+ */
+void *alloc_big(size_t size)
+{
+    size_t page = sysconf(_SC_PAGESIZE);
+    size_t huge = huge_page_size();
+    struct big_alloc *a;
+    void *p = MAP_FAILED;
+
+    if (!(a = malloc(sizeof(*a))))
+        return NULL;
+
+#ifdef MAP_HUGETLB
+    if (huge) {
+        a->size = (size + huge - 1) / huge * huge;
+        p = mmap(NULL, a->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#else
+    MODES_NOTUSED(huge);
+#endif
+
+    if (p == MAP_FAILED) {
+        a->size = (size + page - 1) / page * page;
+        p = mmap(NULL, a->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) {
+            free(a);
+            return NULL;
+        }
+#ifdef MADV_HUGEPAGE
+        madvise(p, a->size, MADV_HUGEPAGE);
+#endif
+    }
+
+    lock_memory(p, a->size);
+
+    a->p = p;
+    a->next = big_allocs;
+    big_allocs = a;
+    return p;
+}
+
+/* Free memory from alloc_big; NULL is ignored */
+void free_big(void *p)
+{
+    struct big_alloc **pa;
+
+    for (pa = &big_allocs; *pa; pa = &(*pa)->next) {
+        if ((*pa)->p == p) {
+            struct big_alloc *a = *pa;
+            *pa = a->next;
+            munmap(a->p, a->size);
+            free(a);
+            return;
+        }
+    }
+}
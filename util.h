@@ -21,6 +21,7 @@
 #define DUMP1090_UTIL_H
 
 #include <stdint.h>
+#include <stddef.h>
 
 /* Returns system time in milliseconds */
 uint64_t mstime(void);
@@ -42,4 +43,19 @@ void start_cpu_timing(struct timespec *start_time);
 /* add difference between start_time and the current CPU time to add_to */
 void end_cpu_timing(const struct timespec *start_time, struct timespec *add_to);
 
+/* Huge page size, if the system has any huge pages free to allocate, else 0 */
+size_t huge_page_size(void);
+
+/* mlock a region if --mlock was given */
+void lock_memory(void *p, size_t size);
+
+/* Allocate size bytes of zeroed memory for a large table or buffer, from
+ * huge pages where available, and locked into memory with --mlock. Returns
+ * NULL on failure.
+ */
+void *alloc_big(size_t size);
+
+/* Free memory from alloc_big; NULL is ignored */
+void free_big(void *p);
+
 #endif
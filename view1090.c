@@ -82,9 +82,6 @@ static void view1090InitConfig(void) {
 //
 static void view1090Init(void) {
 
-    pthread_mutex_init(&Modes.data_mutex,NULL);
-    pthread_cond_init(&Modes.data_cond,NULL);
-
 #ifdef _WIN32
     if ( (!Modes.wsaData.wVersion) 
       && (!Modes.wsaData.wHighVersion) ) {
@@ -118,7 +115,6 @@ static void view1090Init(void) {
     // Prepare error correction tables
     modesChecksumInit(Modes.nfix_crc);
     icaoFilterInit();
-    modeACInit();
     interactiveInit();
 }
 
@@ -148,6 +144,9 @@ static error_t parse_opt (int key, char *arg, struct argp_state *state)
         case OptAggressive:
             Modes.nfix_crc = MODES_MAX_BITERRORS;
             break;
+        case OptErrorTableCache:
+            Modes.error_table_cache = strdup(arg);
+            break;
         case OptNoInteractive:
             Modes.interactive = 0;
             break;